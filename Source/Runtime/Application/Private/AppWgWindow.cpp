@@ -20,6 +20,7 @@
 #include "Widgets/WidgetRenderer.h"
 #include "ApplicationSettings.h"
 #include "InputSystem/InputSystem.h"
+#include "Memory/ArenaAllocator.h"
 #include "RenderApi/RenderTaskHelpers.h"
 #include "RenderApi/RenderManager.h"
 #include "IRenderInterfaceModule.h"
@@ -343,6 +344,8 @@ void ApplicationInstance::startNextFrame()
     CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("StartNextFrame"));
 
     frameAllocator.reset();
+    // Scratch arenas of all threads gets reset lazily when each thread accesses its arena next
+    ScratchArena::onFrameBoundary();
 
     /**
      * Flush wait until all previous render commands are finished,
@@ -63,6 +63,11 @@ void ApplicationModule::graphicsInitEvents(ERenderStateEvent renderState)
 constexpr StringLiteralStore<TCHAR("--noRenderThread")> CMDLINE_NORENDERTHREAD;
 REGISTER_CMDARG("Runs the application without special render thread. Useful for debugging!", CMDLINE_NORENDERTHREAD.getChar());
 
+#if PLATFORM_LINUX
+constexpr StringLiteralStore<TCHAR("--noIoThread")> CMDLINE_NOIOTHREAD;
+REGISTER_CMDARG("Runs the application without special IO thread. Async file IO blocks worker threads instead", CMDLINE_NOIOTHREAD.getChar());
+#endif
+
 constexpr StringLiteralStore<TCHAR("--noSpecialThreads")> CMDLINE_NOSPECIALTHREADS;
 REGISTER_CMDARG(
     "Runs the application without any special render threads. Useful for debugging!\n    "
@@ -91,6 +96,12 @@ uint32 ApplicationModule::getThreadingConstraints()
     {
         constraint |= NOSPECIALTHREAD_ENUM_TO_FLAGBIT(RenderThread);
     }
+#if PLATFORM_LINUX
+    if (cmdLines.hasArg(CMDLINE_NOIOTHREAD))
+    {
+        constraint |= NOSPECIALTHREAD_ENUM_TO_FLAGBIT(IOThread);
+    }
+#endif
     return constraint;
 }
 
@@ -148,9 +159,12 @@ void ApplicationModule::startAndRun(ApplicationInstance *appInst, const AppInsta
     {
         WeakModulePtr renderModule = ModuleManager::get()->getOrLoadModule(TCHAR("EngineRenderer"));
         fatalAssertf(!renderModule.expired(), "EngineRenderer not found!");
+        engineRenderer = static_cast<IRenderInterfaceModule *>(renderModule.lock().get());
 
         if (!(appCI.bRenderOffscreen || appCI.bIsComputeOnly))
         {
+            // RHI is selected when loading EngineRenderer, Headless RHI has no surface so there is no need of native windows
+            windowMan.setHeadless(engineRenderer->isHeadlessRHI());
             appInstance->windowManager = &windowMan;
             appInstance->inputSystem = &inputSystem;
         }
@@ -158,7 +172,6 @@ void ApplicationModule::startAndRun(ApplicationInstance *appInst, const AppInsta
         fontManager = FontManager(InitType_DefaultInit);
         appInstance->fontManager = &fontManager;
 
-        engineRenderer = static_cast<IRenderInterfaceModule *>(renderModule.lock().get());
         // Registering before initialization to allow application for handle renderer events
         engineRenderer->registerToStateEvents(
             RenderStateDelegate::SingleCastDelegateType::createObject(appInstance, &ApplicationInstance::onRendererStateEvent)
@@ -217,7 +230,11 @@ ApplicationInstance *ApplicationModule::getApplication() const { return appInsta
 
 void ApplicationModule::windowCreated(GenericAppWindow *createdWindow) const
 {
-    inputSystem.registerWindow(createdWindow);
+    // Headless windows have no native window to receive inputs
+    if (createdWindow->getWindowHandle() != nullptr)
+    {
+        inputSystem.registerWindow(createdWindow);
+    }
     onWindowCreated.invoke(createdWindow);
 }
 
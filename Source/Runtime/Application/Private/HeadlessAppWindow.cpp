@@ -0,0 +1,36 @@
+/*!
+ * \file HeadlessAppWindow.cpp
+ *
+ * \author Jeslas Pravin
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "HeadlessAppWindow.h"
+#include "Logger/Logger.h"
+
+void HeadlessAppWindow::createWindow(const ApplicationInstance * /*appInstance*/)
+{
+    bCreated = true;
+    LOG("HeadlessAppWindow", "Created headless window {} ({}, {})", windowName, windowWidth, windowHeight);
+
+    // There is no OS to activate the window so activate it on first update, Else application will be considered inactive
+    accumulatedEvents[0] = [this]()
+    {
+        if (onWindowActivated.isBound())
+        {
+            onWindowActivated.invoke();
+        }
+    };
+}
+
+void HeadlessAppWindow::destroyWindow()
+{
+    bCreated = false;
+    GenericAppWindow::destroyWindow();
+}
+
+ShortRect HeadlessAppWindow::windowClientRect() const { return ShortRect(Short2(0), Short2(int16(windowWidth), int16(windowHeight))); }
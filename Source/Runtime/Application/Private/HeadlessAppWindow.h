@@ -0,0 +1,32 @@
+/*!
+ * \file HeadlessAppWindow.h
+ *
+ * \author Jeslas Pravin
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "GenericAppWindow.h"
+
+/**
+ * Window that never creates a native window, Used when the selected RHI is headless and has nothing to present.
+ * It only holds the size so the window canvas and the UI can be laid out as if a window existed
+ */
+class HeadlessAppWindow final : public GenericAppWindow
+{
+private:
+    bool bCreated = false;
+
+public:
+    void createWindow(const ApplicationInstance *appInstance) override;
+    void destroyWindow() override;
+    bool isValidWindow() const override { return bCreated; }
+    WindowHandle getWindowHandle() const override { return nullptr; }
+    ShortRect windowClientRect() const override;
+    ShortRect windowRect() const override { return windowClientRect(); }
+};
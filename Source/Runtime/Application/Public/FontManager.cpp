@@ -13,7 +13,7 @@
 #include "Math/Box.h"
 #include "Math/CoreMathTypes.h"
 #include "Math/Math.h"
-#include "Math/MathGeom.h"
+#include "Logger/Logger.h"
 #include "Types/CoreDefines.h"
 #include "Types/Platform/LFS/PlatformLFS.h"
 #include "Types/Platform/LFS/PathFunctions.h"
@@ -23,6 +23,7 @@
 #include "RenderInterface/Rendering/IRenderCommandList.h"
 #include "RenderInterface/Resources/MemoryResources.h"
 
+#include <algorithm>
 #include <array>
 #include <unordered_set>
 
@@ -64,7 +65,12 @@ CONST_EXPR static const uint32 UNICODE_SPACES[] = { SPACE_CHAR, TAB_CHAR, NEWLIN
                                                     0x202F,     0x205F,   0x3000 };
 
 CONST_EXPR static const int32 TAB_SIZE = 4;
+// Each atlas page is a fixed square so that already packed glyph's texture coordinates never change
 CONST_EXPR static const uint16 ATLAS_MAX_SIZE = 2048;
+// Upper bound of atlas memory, Least recently used glyphs are evicted once all pages are full
+CONST_EXPR static const uint8 ATLAS_MAX_PAGES = 2;
+// Shelf heights are rounded up to this step so that glyphs of similar heights shares a shelf
+CONST_EXPR static const uint16 SHELF_HEIGHT_STEP = 4;
 CONST_EXPR static const uint16 BORDER_SIZE = 1;
 
 class FontManagerContext
@@ -98,8 +104,6 @@ public:
     // A Glyph(Character) in a font
     struct FontGlyph
     {
-        // Bitmap data start index in cached bitmap data
-        int64 bitmapDataIdx = -1;
         // Index of a glyph in a font sheet
         int32 glyphIdx = 0;
         // Pixels to add to arrive at next character start for this glyph(Scaled)
@@ -110,32 +114,68 @@ public:
         int32 ascent = 0;
         // Number of pixels below baseline this glyph drops(Scaled)
         int32 descent = 0;
-        // Index to texture atlas
-        int32 texCoordIdx = -1;
+        // Texture coordinate in texture atlas, In texels including border
+        UShortRect texCoords;
+        // Shelf in texture atlas page, -1 if this glyph has no texels in atlas
+        int16 shelfIdx = -1;
         uint8 texAtlasIdx = 0;
+        // True if texels got evicted from atlas or could not be packed, Metrics are still valid
+        bool bEvicted = false;
+        // Atlas generation in which this glyph was last looked up
+        mutable uint32 lastUsedGeneration = 0;
+
+        FORCE_INLINE bool isInAtlas() const { return shelfIdx >= 0; }
     };
-    // This struct is created such that GlyphCoord can be casted from textCoords after packing
-    struct GlyphCoords
+
+    // Free horizontal span in a shelf
+    struct AtlasSpan
     {
-        // Texture coordinate in texture atlas, In texels including border
-        UShortRect texCoords;
-        GlyphIndex contextGlyphIdx;
+        uint16 x;
+        uint16 width;
+    };
+    // Row of glyphs in an atlas page, Glyphs are placed from left to right and freed spans are reused
+    struct AtlasShelf
+    {
+        uint16 y;
+        uint16 height;
+        uint16 cursorX = 0;
+        // Sorted by x
+        std::vector<AtlasSpan> freeSpans;
+    };
+    struct AtlasPage
+    {
+        std::vector<AtlasShelf> shelves;
+        // Y where next shelf starts
+        uint16 shelvesEnd = 0;
+        // CPU copy of the page, Only dirty rectangle is uploaded to GPU
+        std::vector<uint8> texels;
+        UShortRect dirtyRect;
+        bool bDirty = false;
+        // First upload copies whole page, After that GPU copy is preserved and only dirty rectangle is copied into it
+        bool bUploaded = false;
     };
 
     FontIndex defaultFont;
     std::vector<FontInfo> allFonts;
     std::unordered_map<GlyphIndex, FontGlyph> allGlyphs;
-    std::vector<GlyphCoords> allGlyphCoords;
-    // We support maximum 2 atlas, now
-    ImageResourceRef textureAtlases[2];
-    UInt2 atlasSizes[ARRAY_LENGTH(textureAtlases)];
-    std::vector<uint8> bitmapCache;
+    // Accessed only in render thread
+    ImageResourceRef textureAtlases[ATLAS_MAX_PAGES];
+    std::vector<AtlasPage> atlasPages;
+    // Incremented for each update of pending glyphs
+    uint32 atlasGeneration = 0;
+    uint32 evictedGlyphsCount = 0;
 
     std::unordered_set<GlyphIndex> glyphsPending;
 
 private:
     DEBUG_INLINE uint32 findFallbackCodepoint(FontIndex font) noexcept;
 
+    static bool allocateInShelf(AtlasShelf &shelf, uint16 width, uint16 &outX) noexcept;
+    static void freeInShelf(AtlasShelf &shelf, uint16 x, uint16 width) noexcept;
+    // Finds space for glyph of size including border, Fills glyph's atlas placement on success
+    bool allocateAtlasRect(FontGlyph &glyph, const UShort2 &size) noexcept;
+    void evictGlyph(FontGlyph &glyph) noexcept;
+
 public:
     FontManagerContext(const FontManager *inOwner) noexcept
         : owner(inOwner)
@@ -273,7 +313,40 @@ public:
         {
             glyphItr = allGlyphs.find(toGlyphIndex(allFonts[font].fallbackCode, font, height));
         }
-        return ((glyphItr != allGlyphs.cend()) ? &glyphItr->second : nullptr);
+        if (glyphItr != allGlyphs.cend())
+        {
+            glyphItr->second.lastUsedGeneration = atlasGeneration;
+            return &glyphItr->second;
+        }
+        return nullptr;
+    }
+    // True if glyph must be added to pending glyphs
+    FORCE_INLINE bool needsGlyph(GlyphIndex contextGlyphIdx) const noexcept
+    {
+        auto glyphItr = allGlyphs.find(contextGlyphIdx);
+        return glyphItr == allGlyphs.cend() || glyphItr->second.bEvicted;
+    }
+    // Adds back evicted glyphs of this text to pending glyphs
+    FORCE_INLINE void requeueEvictedGlyphs(const String &text, FontIndex font, FontHeight height) noexcept
+    {
+        if (evictedGlyphsCount == 0)
+        {
+            return;
+        }
+        for (uint32 codepoint : StringCodePoints(text))
+        {
+            GlyphIndex contextGlyphIdx = toGlyphIndex(codepoint, font, height);
+            auto glyphItr = allGlyphs.find(contextGlyphIdx);
+            // Same fall back as findGlyph
+            if (glyphItr == allGlyphs.end())
+            {
+                glyphItr = allGlyphs.find(toGlyphIndex(allFonts[font].fallbackCode, font, height));
+            }
+            if (glyphItr != allGlyphs.end() && glyphItr->second.bEvicted)
+            {
+                glyphsPending.insert(glyphItr->first);
+            }
+        }
     }
 
     // Adds some necessary glyphs for this fonts at given height
@@ -283,7 +356,7 @@ public:
         for (uint32 codePt : NECESSARY_CODEPOINTS)
         {
             GlyphIndex contextGlyphIdx = toGlyphIndex(codePt, font, height);
-            if (!allGlyphs.contains(contextGlyphIdx) && codepointToFontGlyphIndex(font, codePt))
+            if (needsGlyph(contextGlyphIdx) && codepointToFontGlyphIndex(font, codePt))
             {
                 glyphsPending.insert(contextGlyphIdx);
             }
@@ -357,6 +430,149 @@ DEBUG_INLINE uint32 FontManagerContext::findFallbackCodepoint(FontIndex font) no
     return UNKNOWN_GLYPH;
 }
 
+bool FontManagerContext::allocateInShelf(AtlasShelf &shelf, uint16 width, uint16 &outX) noexcept
+{
+    for (auto spanItr = shelf.freeSpans.begin(); spanItr != shelf.freeSpans.end(); ++spanItr)
+    {
+        if (spanItr->width < width)
+        {
+            continue;
+        }
+        outX = spanItr->x;
+        if (spanItr->width == width)
+        {
+            shelf.freeSpans.erase(spanItr);
+        }
+        else
+        {
+            spanItr->x += width;
+            spanItr->width -= width;
+        }
+        return true;
+    }
+    if (uint32(shelf.cursorX) + width <= ATLAS_MAX_SIZE)
+    {
+        outX = shelf.cursorX;
+        shelf.cursorX += width;
+        return true;
+    }
+    return false;
+}
+
+void FontManagerContext::freeInShelf(AtlasShelf &shelf, uint16 x, uint16 width) noexcept
+{
+    auto nextItr = std::upper_bound(
+        shelf.freeSpans.begin(), shelf.freeSpans.end(), x, [](uint16 spanX, const AtlasSpan &span) { return spanX < span.x; }
+    );
+    auto spanItr = shelf.freeSpans.insert(nextItr, AtlasSpan{ x, width });
+    // Merge with next span
+    if ((spanItr + 1) != shelf.freeSpans.end() && (spanItr->x + spanItr->width) == (spanItr + 1)->x)
+    {
+        spanItr->width += (spanItr + 1)->width;
+        shelf.freeSpans.erase(spanItr + 1);
+    }
+    // Merge with previous span
+    if (spanItr != shelf.freeSpans.begin() && ((spanItr - 1)->x + (spanItr - 1)->width) == spanItr->x)
+    {
+        (spanItr - 1)->width += spanItr->width;
+        shelf.freeSpans.erase(spanItr);
+    }
+    // Span that ends at cursor can be given back to cursor
+    if (shelf.freeSpans.back().x + shelf.freeSpans.back().width == shelf.cursorX)
+    {
+        shelf.cursorX = shelf.freeSpans.back().x;
+        shelf.freeSpans.pop_back();
+    }
+}
+
+bool FontManagerContext::allocateAtlasRect(FontGlyph &glyph, const UShort2 &size) noexcept
+{
+    if (size.x > ATLAS_MAX_SIZE || size.y > ATLAS_MAX_SIZE)
+    {
+        return false;
+    }
+    const uint16 shelfHeight = uint16(Math::min(Math::alignByUnsafe(uint32(size.y), SHELF_HEIGHT_STEP), uint32(ATLAS_MAX_SIZE)));
+
+    auto placeGlyph = [&glyph, &size](uint8 pageIdx, uint32 shelfIdx, const AtlasShelf &shelf, uint16 x)
+    {
+        glyph.texAtlasIdx = pageIdx;
+        glyph.shelfIdx = int16(shelfIdx);
+        glyph.texCoords = UShortRect{
+            UShort2(x, shelf.y), UShort2(x + size.x, shelf.y + size.y)
+        };
+    };
+    // First try shelves that does not waste more than half of the glyph's height, Then open a new shelf and at last try any shelf that fits
+    for (uint32 pass = 0; pass < 2; ++pass)
+    {
+        const bool bStrict = (pass == 0);
+        for (uint8 pageIdx = 0; pageIdx < atlasPages.size(); ++pageIdx)
+        {
+            AtlasPage &page = atlasPages[pageIdx];
+            for (uint32 shelfIdx = 0; shelfIdx < page.shelves.size(); ++shelfIdx)
+            {
+                AtlasShelf &shelf = page.shelves[shelfIdx];
+                if (shelf.height < size.y || (bStrict && shelf.height > (shelfHeight + shelfHeight / 2)))
+                {
+                    continue;
+                }
+                uint16 x;
+                if (allocateInShelf(shelf, size.x, x))
+                {
+                    placeGlyph(pageIdx, shelfIdx, shelf, x);
+                    return true;
+                }
+            }
+        }
+        if (!bStrict)
+        {
+            break;
+        }
+
+        // New shelf in existing pages or in a new page
+        for (uint8 pageIdx = 0; pageIdx <= atlasPages.size() && pageIdx < ATLAS_MAX_PAGES; ++pageIdx)
+        {
+            if (pageIdx == atlasPages.size())
+            {
+                AtlasPage &newPage = atlasPages.emplace_back();
+                newPage.texels.resize(uint32(ATLAS_MAX_SIZE) * ATLAS_MAX_SIZE, 0);
+            }
+            AtlasPage &page = atlasPages[pageIdx];
+            if (uint32(page.shelvesEnd) + shelfHeight > ATLAS_MAX_SIZE)
+            {
+                continue;
+            }
+            AtlasShelf &shelf = page.shelves.emplace_back();
+            shelf.y = page.shelvesEnd;
+            shelf.height = shelfHeight;
+            page.shelvesEnd += shelfHeight;
+
+            uint16 x;
+            allocateInShelf(shelf, size.x, x);
+            placeGlyph(pageIdx, uint32(page.shelves.size() - 1), shelf, x);
+            return true;
+        }
+    }
+    return false;
+}
+
+void FontManagerContext::evictGlyph(FontGlyph &glyph) noexcept
+{
+    debugAssert(glyph.isInAtlas());
+
+    AtlasPage &page = atlasPages[glyph.texAtlasIdx];
+    freeInShelf(page.shelves[glyph.shelfIdx], glyph.texCoords.minBound.x, glyph.texCoords.size().x);
+    glyph.shelfIdx = -1;
+    glyph.bEvicted = true;
+    evictedGlyphsCount++;
+
+    // Empty shelves at the end of the page can be reused for any height
+    while (!page.shelves.empty() && page.shelves.back().cursorX == 0)
+    {
+        page.shelvesEnd = page.shelves.back().y;
+        page.shelves.pop_back();
+    }
+}
+
 void FontManagerContext::updatePendingGlyphs() noexcept
 {
     if (glyphsPending.empty())
@@ -365,7 +581,17 @@ void FontManagerContext::updatePendingGlyphs() noexcept
     }
     CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("UpdatePendingGlyphs"));
 
-    allGlyphCoords.reserve(allGlyphCoords.size() + glyphsPending.size());
+    // Glyphs that are not looked up since last update can be evicted to make space for new glyphs
+    const uint32 evictBeforeGeneration = atlasGeneration++;
+
+    struct NewGlyph
+    {
+        GlyphIndex contextGlyphIdx;
+        // Size including border
+        UShort2 size;
+    };
+    std::vector<NewGlyph> newGlyphs;
+    newGlyphs.reserve(glyphsPending.size());
     allGlyphs.reserve(allGlyphs.size() + glyphsPending.size());
     for (const GlyphIndex &contextGlyphIdx : glyphsPending)
     {
@@ -385,6 +611,7 @@ void FontManagerContext::updatePendingGlyphs() noexcept
 
         FontGlyph &glyph = allGlyphs[contextGlyphIdx];
         glyph.glyphIdx = glyphIdx;
+        glyph.lastUsedGeneration = atlasGeneration;
         glyphHMetrics(font, glyph, glyph.advance, glyph.lsb);
         glyph.advance = int32(glyph.advance * fontToGlyphScale);
         glyph.lsb = int32(glyph.lsb * fontToGlyphScale);
@@ -401,116 +628,189 @@ void FontManagerContext::updatePendingGlyphs() noexcept
             // Since min value is one ascending from baseline
             glyph.ascent = bitmapBox.minBound.y;
             glyph.descent = bitmapBox.maxBound.y;
-            glyph.bitmapDataIdx = int64(bitmapCache.size());
-            glyph.texCoordIdx = int32(allGlyphCoords.size());
-
-            GlyphCoords &glyphCoords = allGlyphCoords.emplace_back();
-            glyphCoords.contextGlyphIdx = contextGlyphIdx;
             // Add border texels to size
-            glyphCoords.texCoords
-                = UShortRect{ UShort2(0), UShort2(bitmapSize.x, bitmapSize.y) + UShortRect::PointElementType(2 * BORDER_SIZE) };
-
-            bitmapCache.resize(bitmapCache.size() + texelsCount);
-            glyphBitmapSubPixel(
-                font, glyph, fontToGlyphScale, 0, 0, &bitmapCache[glyph.bitmapDataIdx], bitmapSize.x, bitmapSize.y, bitmapSize.x
+            newGlyphs.emplace_back(
+                NewGlyph{ contextGlyphIdx, UShort2(bitmapSize.x, bitmapSize.y) + UShortRect::PointElementType(2 * BORDER_SIZE) }
             );
         }
     }
     glyphsPending.clear();
 
-    std::vector<UShortRect *> packRects;
-    packRects.reserve(allGlyphs.size());
-    // Convert each of rectangles to be placed at origin
-    for (std::pair<const GlyphIndex, FontGlyph> &glyphPair : allGlyphs)
+    // Placing taller glyphs first packs the shelves tighter
+    std::sort(
+        newGlyphs.begin(), newGlyphs.end(),
+        [](const NewGlyph &lhs, const NewGlyph &rhs) { return lhs.size.y == rhs.size.y ? lhs.size.x > rhs.size.x : lhs.size.y > rhs.size.y; }
+    );
+
+    // Least recently used glyphs first, Collected only when atlas is full
+    std::vector<GlyphIndex> evictCandidates;
+    bool bEvictCandidatesCollected = false;
+    uint32 nextEvictCandidate = 0;
+    for (const NewGlyph &newGlyph : newGlyphs)
     {
-        if (glyphPair.second.texCoordIdx == -1)
+        FontGlyph &glyph = allGlyphs[newGlyph.contextGlyphIdx];
+        if (glyph.isInAtlas())
         {
-            continue;
+            evictGlyph(glyph);
         }
-        GlyphCoords &glyphCoords = allGlyphCoords[glyphPair.second.texCoordIdx];
-        UShortRect::PointType rectSize = glyphCoords.texCoords.size();
-        glyphCoords.texCoords.minBound = UShortRect::PointType(0);
-        glyphCoords.texCoords.maxBound = rectSize;
-
-        packRects.emplace_back(&glyphCoords.texCoords);
-    }
-
-    std::vector<PackedRectsBin<UShortRect>> packedBins;
-    std::vector<std::vector<Color>> atlasTexels;
-    if (MathGeom::packRectangles(packedBins, UShortRect::PointType(ATLAS_MAX_SIZE), packRects))
-    {
-        alertAlwaysf(
-            packedBins.size() <= ARRAY_LENGTH(textureAtlases),
-            "Packing fonts in unsuccessful in {} texture atlases extend atlas count if necessary", ARRAY_LENGTH(textureAtlases)
-        );
-        static_assert(
-            ARRAY_LENGTH(textureAtlases) <= std::numeric_limits<decltype(FontGlyph::texAtlasIdx)>::max(),
-            "Texture atlas count is above max index that can be stored at FontGlyph::texAtlasIdx"
-        );
 
-        for (uint8 i = 0; i < ARRAY_LENGTH(textureAtlases) && i < packedBins.size(); ++i)
+        bool bPlaced = allocateAtlasRect(glyph, newGlyph.size);
+        while (!bPlaced)
         {
-            const UShort2 &atlasSize = packedBins[i].binSize;
+            if (!bEvictCandidatesCollected)
+            {
+                bEvictCandidatesCollected = true;
+                for (const std::pair<const GlyphIndex, FontGlyph> &glyphPair : allGlyphs)
+                {
+                    if (glyphPair.second.isInAtlas() && glyphPair.second.lastUsedGeneration < evictBeforeGeneration)
+                    {
+                        evictCandidates.emplace_back(glyphPair.first);
+                    }
+                }
+                std::sort(
+                    evictCandidates.begin(), evictCandidates.end(),
+                    [this](GlyphIndex lhs, GlyphIndex rhs)
+                    { return allGlyphs[lhs].lastUsedGeneration < allGlyphs[rhs].lastUsedGeneration; }
+                );
+            }
+            if (nextEvictCandidate >= evictCandidates.size())
+            {
+                break;
+            }
+            evictGlyph(allGlyphs[evictCandidates[nextEvictCandidate++]]);
+            bPlaced = allocateAtlasRect(glyph, newGlyph.size);
+        }
 
-            atlasSizes[i] = atlasSize;
-            std::vector<Color> &atlasTexs = atlasTexels.emplace_back();
-            atlasTexs.resize(atlasSize.x * atlasSize.y);
-            for (UShortRect *glyphBox : packedBins[i].rects)
+        if (!bPlaced)
+        {
+            LOG_WARN(
+                "FontManager", "Glyph {} cannot be packed into font atlas, All {} pages are in use", newGlyph.contextGlyphIdx,
+                uint32(ATLAS_MAX_PAGES)
+            );
+            if (!glyph.bEvicted)
             {
-                GlyphCoords &glyphCoords = *reinterpret_cast<GlyphCoords *>(glyphBox);
-                FontGlyph &glyph = allGlyphs[glyphCoords.contextGlyphIdx];
-                glyph.texAtlasIdx = i;
+                glyph.bEvicted = true;
+                evictedGlyphsCount++;
+            }
+            continue;
+        }
+        if (glyph.bEvicted)
+        {
+            glyph.bEvicted = false;
+            evictedGlyphsCount--;
+        }
 
-                // Offset border so we copy only to glyph
-                UShortRect bound = clipBorder(glyphCoords.texCoords);
-                UShort2 boundSize = bound.size();
+        uint32 codepoint;
+        FontIndex font;
+        FontHeight height;
+        fromGlyphIndex(codepoint, font, height, newGlyph.contextGlyphIdx);
 
-                // Copy all rows in glyph from bitmap to pixels
-                for (uint32 y = bound.minBound.y; y < bound.maxBound.y; ++y)
-                {
-                    uint32 yOffset = y - bound.minBound.y;
-                    for (uint32 x = bound.minBound.x; x < bound.maxBound.x; ++x)
-                    {
-                        uint32 xOffset = x - bound.minBound.x;
+        AtlasPage &page = atlasPages[glyph.texAtlasIdx];
+        // Clear border texels too as this space might have been used by an evicted glyph
+        for (uint32 y = glyph.texCoords.minBound.y; y < glyph.texCoords.maxBound.y; ++y)
+        {
+            memset(&page.texels[y * ATLAS_MAX_SIZE + glyph.texCoords.minBound.x], 0, newGlyph.size.x);
+        }
+        // Offset border so we rasterize only to glyph, Rows are strided by the page width
+        UShortRect bound = clipBorder(glyph.texCoords);
+        UShort2 boundSize = bound.size();
+        glyphBitmapSubPixel(
+            font, glyph, scaleToPixelHeight(font, heightToPixels(height)), 0, 0,
+            &page.texels[bound.minBound.y * ATLAS_MAX_SIZE + bound.minBound.x], boundSize.x, boundSize.y, ATLAS_MAX_SIZE
+        );
 
-                        // X columns constitutes a Row
-                        uint32 texIdx = y * atlasSize.x + x;
-                        // In Bitmap glyphs are stored as individual continuous
-                        // stream so no need for additional stride
-                        uint32 bitmapIdx = uint32(glyph.bitmapDataIdx + (yOffset * boundSize.x) + xOffset);
+        if (page.bDirty)
+        {
+            page.dirtyRect.grow(glyph.texCoords);
+        }
+        else
+        {
+            page.dirtyRect = glyph.texCoords;
+            page.bDirty = true;
+        }
+    }
 
-                        uint8 bitmap = bitmapCache[bitmapIdx];
-                        atlasTexs[texIdx] = Color(bitmap, bitmap, bitmap, bitmap);
-                    }
-                }
+    struct AtlasUpload
+    {
+        uint8 pageIdx;
+        UShortRect rect;
+        std::vector<Color> texels;
+        bool bPreserveContents;
+    };
+    std::vector<AtlasUpload> atlasUploads;
+    for (uint8 pageIdx = 0; pageIdx < atlasPages.size(); ++pageIdx)
+    {
+        AtlasPage &page = atlasPages[pageIdx];
+        if (!page.bDirty)
+        {
+            continue;
+        }
+        page.bDirty = false;
+        if (!page.bUploaded)
+        {
+            page.dirtyRect = UShortRect(UShort2(0, 0), UShort2(ATLAS_MAX_SIZE, ATLAS_MAX_SIZE));
+        }
+
+        AtlasUpload &upload = atlasUploads.emplace_back();
+        upload.pageIdx = pageIdx;
+        upload.rect = page.dirtyRect;
+        upload.bPreserveContents = page.bUploaded;
+        page.bUploaded = true;
+        UShort2 rectSize = page.dirtyRect.size();
+        upload.texels.resize(uint32(rectSize.x) * rectSize.y);
+        for (uint32 y = 0; y < rectSize.y; ++y)
+        {
+            const uint8 *pageRow = &page.texels[(page.dirtyRect.minBound.y + y) * ATLAS_MAX_SIZE + page.dirtyRect.minBound.x];
+            for (uint32 x = 0; x < rectSize.x; ++x)
+            {
+                uint8 bitmap = pageRow[x];
+                upload.texels[y * rectSize.x + x] = Color(bitmap, bitmap, bitmap, bitmap);
             }
         }
     }
-    else
+    if (atlasUploads.empty())
     {
-        fatalAssertf(false, "Packing fonts failed");
         return;
     }
 
     owner->broadcastPreTextureAtlasUpdate();
     ENQUEUE_RENDER_COMMAND(UpdateFontGlyphs)
     (
-        [this, atlasTexels](class IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance, const GraphicsHelperAPI *graphicsHelper)
+        [this, atlasUploads = std::move(atlasUploads)](
+            class IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance, const GraphicsHelperAPI *graphicsHelper
+        )
         {
             CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("UploadGlyphAtlas"));
 
-            for (int32 i = 0; i < atlasTexels.size(); ++i)
+            for (const AtlasUpload &upload : atlasUploads)
             {
-                ImageResourceCreateInfo ci{
-                    .imageFormat = EPixelDataFormat::R_U8_Norm, .dimensions = {atlasSizes[i].x, atlasSizes[i].y, 1},
-                         .numOfMips = 1
-                };
-                textureAtlases[i] = graphicsHelper->createImage(graphicsInstance, ci);
-                textureAtlases[i]->setShaderUsage(EImageShaderUsage::Sampling);
-                textureAtlases[i]->setResourceName("FontAtlas_" + String::toString(i));
-                textureAtlases[i]->init();
+                ImageResourceRef &textureAtlas = textureAtlases[upload.pageIdx];
+                // Pages are created once and never resized, So only the changed rectangle needs upload after first upload
+                if (!textureAtlas.isValid())
+                {
+                    debugAssert(!upload.bPreserveContents);
+                    ImageResourceCreateInfo ci{
+                        .imageFormat = EPixelDataFormat::R_U8_Norm, .dimensions = {ATLAS_MAX_SIZE, ATLAS_MAX_SIZE, 1},
+                             .numOfMips = 1
+                    };
+                    textureAtlas = graphicsHelper->createImage(graphicsInstance, ci);
+                    textureAtlas->setShaderUsage(EImageShaderUsage::Sampling);
+                    textureAtlas->setResourceName("FontAtlas_" + String::toString(upload.pageIdx));
+                    textureAtlas->init();
+                }
 
-                cmdList->copyToImage(textureAtlases[i], atlasTexels[i]);
+                UShort2 rectSize = upload.rect.size();
+                CopyPixelsToImageInfo copyInfo;
+                copyInfo.dstOffset = { upload.rect.minBound.x, upload.rect.minBound.y, 0 };
+                copyInfo.extent = { rectSize.x, rectSize.y, 1 };
+                copyInfo.subres.baseLayer = 0;
+                copyInfo.subres.layersCount = 1;
+                copyInfo.subres.baseMip = 0;
+                copyInfo.subres.mipCount = 1;
+                copyInfo.bGenerateMips = false;
+                copyInfo.mipFiltering = ESamplerFiltering::Nearest;
+                copyInfo.bPreserveContents = upload.bPreserveContents;
+                cmdList->copyToImage(textureAtlas, upload.texels, copyInfo);
             }
             owner->broadcastTextureAtlasUpdated();
         }
@@ -602,7 +902,7 @@ void FontManager::addGlyphs(FontIndex font, const std::vector<ValueRange<uint32>
             {
                 FontManagerContext::GlyphIndex glyphIdx = FontManagerContext::toGlyphIndex(codePt, font, contextHeight);
                 // If not duplicate and valid glyph
-                if (context->codepointToFontGlyphIndex(font, codePt) && !context->allGlyphs.contains(glyphIdx))
+                if (context->codepointToFontGlyphIndex(font, codePt) && context->needsGlyph(glyphIdx))
                 {
                     context->glyphsPending.insert(glyphIdx);
                 }
@@ -620,7 +920,7 @@ void FontManager::addGlyphs(FontIndex font, const ValueRange<uint32> &glyphCodeR
     {
         FontManagerContext::GlyphIndex glyphIdx = FontManagerContext::toGlyphIndex(codePt, font, contextHeight);
         // If not duplicate and valid glyph
-        if (context->codepointToFontGlyphIndex(font, codePt) && !context->allGlyphs.contains(glyphIdx))
+        if (context->codepointToFontGlyphIndex(font, codePt) && context->needsGlyph(glyphIdx))
         {
             context->glyphsPending.insert(glyphIdx);
         }
@@ -637,7 +937,7 @@ void FontManager::setupTextureAtlas(ShaderParameters *shaderParams, const String
             class IRenderCommandList * /*cmdList*/, IGraphicsInstance * /*graphicsInstance*/, const GraphicsHelperAPI * /*graphicsHelper*/
         )
         {
-            for (int32 i = 0; i < ARRAY_LENGTH(context->textureAtlases); ++i)
+            for (int32 i = 0; i < ATLAS_MAX_PAGES; ++i)
             {
                 shaderParams->setTextureParam(paramName.getChar(), context->textureAtlases[i], i);
                 static ImageViewInfo fontTextureView = {
@@ -790,9 +1090,10 @@ void FontManager::draw(
     {
         return;
     }
-    context->updatePendingGlyphs();
-
     FontManagerContext::FontHeight contextHeight = FontManagerContext::pixelsToHeight(height);
+    // Evicted glyphs must be back in atlas before generating vertices
+    context->requeueEvictedGlyphs(text, font, contextHeight);
+    context->updatePendingGlyphs();
     // For font related unscaled value to height scaled value
     float fontToHeightScale = context->scaleToPixelHeight(font, height);
     // Glyph will be scaled already and below value can be used to scale glyph scaled values to height
@@ -887,8 +1188,6 @@ void FontManager::draw(
         const FontManagerContext::FontGlyph *codeGlyph = context->findGlyph(codepoint, font, contextHeight);
         if (codeGlyph)
         {
-            debugAssert(codeGlyph->texCoordIdx >= 0);
-
             if (lastWordVertex < 0)
             {
                 lastWordVertex = int32(outVertices.size());
@@ -900,37 +1199,41 @@ void FontManager::draw(
             {
                 lastWordWidth += int32(fontToHeightScale * context->glyphKernAdvance(font, *lastGlyph, *codeGlyph));
             }
-            // Add vertices
-            // Glyph related caches
-            UShortRect glyphTexCoordClipped = context->clipBorder(context->allGlyphCoords[codeGlyph->texCoordIdx].texCoords);
-            const auto &texSize = context->atlasSizes[codeGlyph->texAtlasIdx];
-
-            // Width of this glyph's quad for given height scale
-            int32 glyphLeft = cursorPos + lastWordWidth + int32(glyphToHeightScale * codeGlyph->lsb);
-            int32 glyphRight = glyphLeft + int32(glyphTexCoordClipped.size().x * glyphToHeightScale);
-            int32 glyphTop = baseline + int32(glyphToHeightScale * codeGlyph->ascent);
-            int32 glyphBottom = baseline + int32(glyphToHeightScale * codeGlyph->descent);
-            Rect texCoord{
-                {glyphTexCoordClipped.minBound.x / float(texSize.x), glyphTexCoordClipped.minBound.y / float(texSize.y)},
-                {glyphTexCoordClipped.maxBound.x / float(texSize.x), glyphTexCoordClipped.maxBound.y / float(texSize.y)}
-            };
-
-            uint32 glyphVert = uint32(outVertices.size());
-            outVertices.resize(outVertices.size() + 4);
-            // Add left edge 0 to 3
-            outVertices[glyphVert + 0].atlasIdx = codeGlyph->texAtlasIdx;
-            outVertices[glyphVert + 0].pos = { glyphLeft, glyphTop };
-            outVertices[glyphVert + 0].texCoord = texCoord.minBound;
-            outVertices[glyphVert + 3].atlasIdx = codeGlyph->texAtlasIdx;
-            outVertices[glyphVert + 3].pos = { glyphLeft, glyphBottom };
-            outVertices[glyphVert + 3].texCoord = { texCoord.minBound.x(), texCoord.maxBound.y() };
-            // Add right edge 1 to 2
-            outVertices[glyphVert + 1].atlasIdx = codeGlyph->texAtlasIdx;
-            outVertices[glyphVert + 1].pos = { glyphRight, glyphTop };
-            outVertices[glyphVert + 1].texCoord = { texCoord.maxBound.x(), texCoord.minBound.y() };
-            outVertices[glyphVert + 2].atlasIdx = codeGlyph->texAtlasIdx;
-            outVertices[glyphVert + 2].pos = { glyphRight, glyphBottom };
-            outVertices[glyphVert + 2].texCoord = texCoord.maxBound;
+            // Glyphs that could not be packed in atlas only advances the cursor
+            if (codeGlyph->isInAtlas())
+            {
+                // Add vertices
+                // Glyph related caches
+                UShortRect glyphTexCoordClipped = context->clipBorder(codeGlyph->texCoords);
+                const UInt2 texSize{ ATLAS_MAX_SIZE };
+
+                // Width of this glyph's quad for given height scale
+                int32 glyphLeft = cursorPos + lastWordWidth + int32(glyphToHeightScale * codeGlyph->lsb);
+                int32 glyphRight = glyphLeft + int32(glyphTexCoordClipped.size().x * glyphToHeightScale);
+                int32 glyphTop = baseline + int32(glyphToHeightScale * codeGlyph->ascent);
+                int32 glyphBottom = baseline + int32(glyphToHeightScale * codeGlyph->descent);
+                Rect texCoord{
+                    {glyphTexCoordClipped.minBound.x / float(texSize.x), glyphTexCoordClipped.minBound.y / float(texSize.y)},
+                    {glyphTexCoordClipped.maxBound.x / float(texSize.x), glyphTexCoordClipped.maxBound.y / float(texSize.y)}
+                };
+
+                uint32 glyphVert = uint32(outVertices.size());
+                outVertices.resize(outVertices.size() + 4);
+                // Add left edge 0 to 3
+                outVertices[glyphVert + 0].atlasIdx = codeGlyph->texAtlasIdx;
+                outVertices[glyphVert + 0].pos = { glyphLeft, glyphTop };
+                outVertices[glyphVert + 0].texCoord = texCoord.minBound;
+                outVertices[glyphVert + 3].atlasIdx = codeGlyph->texAtlasIdx;
+                outVertices[glyphVert + 3].pos = { glyphLeft, glyphBottom };
+                outVertices[glyphVert + 3].texCoord = { texCoord.minBound.x(), texCoord.maxBound.y() };
+                // Add right edge 1 to 2
+                outVertices[glyphVert + 1].atlasIdx = codeGlyph->texAtlasIdx;
+                outVertices[glyphVert + 1].pos = { glyphRight, glyphTop };
+                outVertices[glyphVert + 1].texCoord = { texCoord.maxBound.x(), texCoord.minBound.y() };
+                outVertices[glyphVert + 2].atlasIdx = codeGlyph->texAtlasIdx;
+                outVertices[glyphVert + 2].pos = { glyphRight, glyphBottom };
+                outVertices[glyphVert + 2].texCoord = texCoord.maxBound;
+            }
 
             // Now advance to next word from horizontal start of this glyph
             lastWordWidth += int32(glyphToHeightScale * codeGlyph->advance);
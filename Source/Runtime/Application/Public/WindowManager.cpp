@@ -13,6 +13,7 @@
 #include "PlatformInstances.h"
 #include "ApplicationInstance.h"
 #include "GenericAppWindow.h"
+#include "HeadlessAppWindow.h"
 #include "Logger/Logger.h"
 #include "RenderApi/GBuffersAndTextures.h"
 #include "RenderApi/RenderManager.h"
@@ -22,10 +23,19 @@
 #include "ApplicationSettings.h"
 #include "IApplicationModule.h"
 
+GenericAppWindow *WindowManager::newAppWindow() const
+{
+    if (bHeadless)
+    {
+        return new HeadlessAppWindow();
+    }
+    return new PlatformAppWindow();
+}
+
 void WindowManager::init()
 {
     const ApplicationInstance *appInstance = IApplicationModule::get()->getApplication();
-    appMainWindow = new PlatformAppWindow();
+    appMainWindow = newAppWindow();
 
     appMainWindow->setWindowSize(ApplicationSettings::screenSize.get().x, ApplicationSettings::screenSize.get().y);
     appMainWindow->setWindowName(appInstance->getAppName().getChar());
@@ -73,7 +83,7 @@ void WindowManager::destroy()
 GenericAppWindow *WindowManager::createWindow(UInt2 size, const TChar *name, GenericAppWindow *parent)
 {
     const ApplicationInstance *appInstance = IApplicationModule::get()->getApplication();
-    GenericAppWindow *appWindow = new PlatformAppWindow();
+    GenericAppWindow *appWindow = newAppWindow();
 
     appWindow->setWindowSize(size.x, size.y);
     appWindow->setWindowName(name);
@@ -133,8 +143,8 @@ std::vector<GenericAppWindow *> WindowManager::getArrangedWindows() const noexce
 
 GenericAppWindow *WindowManager::findWindowUnder(Short2 screenPos) const noexcept
 {
-    // First find using native API
-    WindowHandle wndHnd = PlatformAppWindow::getWindowUnderPoint(screenPos);
+    // First find using native API, Headless windows have no native handles
+    WindowHandle wndHnd = bHeadless ? nullptr : PlatformAppWindow::getWindowUnderPoint(screenPos);
     if (wndHnd != nullptr)
     {
         GenericAppWindow *appWnd = findNativeHandleWindow(wndHnd);
@@ -38,6 +38,8 @@ private:
     std::map<GenericAppWindow *, ManagerData> windowsOpened;
     // For now Will be valid only inside pollWindows
     std::vector<GenericAppWindow *> windowsToDestroy;
+    // Creates windows without any native window when the RHI has nothing to present
+    bool bHeadless = false;
 
 public:
     GenericAppWindow *getMainWindow() const noexcept;
@@ -48,6 +50,10 @@ public:
     GenericAppWindow *findNativeHandleWindow(WindowHandle wndHnd) const noexcept;
     GenericAppWindow *findWindowUnder(Short2 screenPos) const noexcept;
 
+    // Must be set before init
+    FORCE_INLINE void setHeadless(bool bInHeadless) { bHeadless = bInHeadless; }
+    FORCE_INLINE bool isHeadless() const { return bHeadless; }
+
     void init();
     void destroy();
     GenericAppWindow *createWindow(UInt2 size, const TChar *name, GenericAppWindow *parent);
@@ -62,6 +68,7 @@ public:
     void postInitGraphicCore() noexcept;
 
 private:
+    GenericAppWindow *newAppWindow() const;
     void activateWindow(GenericAppWindow *window) noexcept;
     void deactivateWindow(GenericAppWindow *window) noexcept;
     void onWindowResize(uint32 width, uint32 height, GenericAppWindow *window) noexcept;
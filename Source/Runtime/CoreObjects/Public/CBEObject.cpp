@@ -52,6 +52,8 @@ void Object::beginDestroy()
     // Rename it Immediately to allow other objects to replace this object with same name
     INTERNAL_ObjectCoreAccessors::setOuterAndName(this, newObjName, outerObj, getType());
     SET_BITS(INTERNAL_ObjectCoreAccessors::getFlags(this), EObjectFlagBits::ObjFlag_MarkedForDelete);
+    // Weak pointers to this object must fail from now even though it is freed only at next GC
+    getOrCreateObjAllocator(objectDatV.clazz).invalidateHandles(objectDatV.allocIdx);
 }
 
 cbe::ObjectPrivateDataView Object::getObjectData() const { return CoreObjectsModule::objectsDB().getObjectData(getDbIdx()); }
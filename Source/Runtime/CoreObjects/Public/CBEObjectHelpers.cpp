@@ -653,10 +653,10 @@ void replaceObjectReferences(
     }
 
     ReplaceObjRefsVisitableUserData userData{ .replacements = replacements };
-    FieldVisitor::visitFields<ReplaceObjRefsVisitable>(object->getType(), object, &userData);
+    FieldVisitor::visitReferences<ReplaceObjRefsVisitable>(object->getType(), object, &userData);
     for (Object *subObj : subObjects)
     {
-        FieldVisitor::visitFields<ReplaceObjRefsVisitable>(subObj->getType(), subObj, &userData);
+        FieldVisitor::visitReferences<ReplaceObjRefsVisitable>(subObj->getType(), subObj, &userData);
     }
 }
 
@@ -814,15 +814,24 @@ struct FindObjRefsVisitable
     static void visit(const void **ptr, const PropertyInfo &propInfo, void *userData) { visit(const_cast<void **>(ptr), propInfo, userData); }
 };
 
+// Records the top most field before visiting the references in it
 struct StartFindObjRefsVisitable
 {
-    template <typename Type>
-    static void visit(Type *val, const PropertyInfo &propInfo, void *userData)
+    static void visit(void **ptr, const PropertyInfo &propInfo, void *userData)
+    {
+        FindObjRefsVisitableUserData *findRefsUserData = (FindObjRefsVisitableUserData *)(userData);
+        debugAssert(propInfo.fieldProperty);
+        findRefsUserData->fieldProperty = propInfo.fieldProperty;
+        FindObjRefsVisitable::visit(ptr, propInfo, userData);
+    }
+    // It is okay we are not going to do anything that violates constant
+    static void visit(const void **ptr, const PropertyInfo &propInfo, void *userData) { visit(const_cast<void **>(ptr), propInfo, userData); }
+    static void visit(void *val, const PropertyInfo &propInfo, void *userData)
     {
         FindObjRefsVisitableUserData *findRefsUserData = (FindObjRefsVisitableUserData *)(userData);
         debugAssert(propInfo.fieldProperty);
         findRefsUserData->fieldProperty = propInfo.fieldProperty;
-        FindObjRefsVisitable::visit<Type>(val, propInfo, &findRefsUserData);
+        FindObjRefsVisitable::visit(val, propInfo, userData);
     }
 };
 
@@ -851,11 +860,11 @@ COREOBJECTS_EXPORT std::vector<ObjectReferences> findObjectReferences(
 
     std::vector<ObjectReferences> references;
     FindObjRefsVisitableUserData userData{ .objects = objects, .outReferences = references, .searchedIn = object };
-    FieldVisitor::visitFields<StartFindObjRefsVisitable>(object->getType(), object, &userData);
+    FieldVisitor::visitReferences<StartFindObjRefsVisitable>(object->getType(), object, &userData);
     for (Object *subObj : subObjects)
     {
         userData.searchedIn = subObj;
-        FieldVisitor::visitFields<StartFindObjRefsVisitable>(subObj->getType(), subObj, &userData);
+        FieldVisitor::visitReferences<StartFindObjRefsVisitable>(subObj->getType(), subObj, &userData);
     }
     return references;
 }
@@ -17,6 +17,8 @@
 #include "ObjectPathHelpers.h"
 #include "String/NameString.h"
 
+class PackageLoadHandle;
+
 namespace cbe
 {
 
@@ -93,6 +95,31 @@ FORCE_INLINE bool isValidAlloc(const Object *obj)
     return false;
 }
 
+// Returns handle to object's allocation if object is valid, Handle can be validated later without going through objects database
+FORCE_INLINE ObjectAllocHandle getAllocHandle(const Object *obj)
+{
+    if (obj == nullptr)
+    {
+        return {};
+    }
+    CBE_PROFILER_SCOPE("GetObjAllocHandle");
+
+    ObjectDbIdx dbIdx = obj->getDbIdx();
+
+    const CoreObjectsDB &objectsDb = ICoreObjectsModule::objectsDB();
+    ObjectPrivateDataView objectDatV = objectsDb.getObjectData(dbIdx);
+
+    if (objectDatV && NO_BITS_SET(objectDatV.flags, EObjectFlagBits::ObjFlag_MarkedForDelete | EObjectFlagBits::ObjFlag_GCPurge))
+    {
+        ObjectAllocatorBase *objAllocator = getObjAllocator(objectDatV.clazz);
+        if (objAllocator && objAllocator->isValid(objectDatV.allocIdx))
+        {
+            return objAllocator->getAllocHandle(objectDatV.allocIdx);
+        }
+    }
+    return {};
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Object casts
 //////////////////////////////////////////////////////////////////////////
@@ -267,6 +294,11 @@ ClassType *get(StringView objectFullPath)
 
 COREOBJECTS_EXPORT Object *load(StringView objectPath, CBEClass clazz);
 COREOBJECTS_EXPORT Object *getOrLoad(StringView objectPath, CBEClass clazz);
+/**
+ * Starts loading the package at packagePath asynchronously, Objects are streamed in worker threads and finalized in main thread.
+ * Returns invalid handle if package is not found
+ */
+COREOBJECTS_EXPORT PackageLoadHandle loadPackageAsync(StringView packagePath);
 template <typename ClassType>
 ClassType *load(StringView objectPath)
 {
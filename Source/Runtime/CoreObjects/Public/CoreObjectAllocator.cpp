@@ -30,6 +30,33 @@ void initializeObjectAllocators()
     }
 }
 
+ObjectAllocatorBase::~ObjectAllocatorBase()
+{
+    for (std::atomic<uint32> *&generationChunk : generationChunks)
+    {
+        delete[] generationChunk;
+        generationChunk = nullptr;
+    }
+}
+
+void ObjectAllocatorBase::reserveGenerations(AllocIdx slotsCount)
+{
+    if (slotsCount == 0)
+    {
+        return;
+    }
+
+    const uint64 lastChunkedIdx = uint64(slotsCount - 1) + GENERATION_CHUNK_BASE;
+    const uint32 lastChunkIdx = uint32(std::bit_width(lastChunkedIdx) - std::bit_width(GENERATION_CHUNK_BASE));
+    for (uint32 chunkIdx = 0; chunkIdx <= lastChunkIdx; ++chunkIdx)
+    {
+        if (generationChunks[chunkIdx] == nullptr)
+        {
+            generationChunks[chunkIdx] = new std::atomic<uint32>[GENERATION_CHUNK_BASE << chunkIdx]{};
+        }
+    }
+}
+
 ObjectAllocatorBase *getObjAllocator(CBEClass clazz)
 {
     if (!gCBEObjectAllocators)
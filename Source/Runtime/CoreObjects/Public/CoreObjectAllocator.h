@@ -16,32 +16,83 @@
 #include "Memory/SlotAllocator.h"
 #include "Types/Containers/BitArray.h"
 
+#include <atomic>
+#include <bit>
 #include <unordered_map>
 
 namespace cbe
 {
 class ObjectAllocatorBase;
-}
+// Defined in CBEObjectHelpers, Allocators are not thread safe and must be used only from main thread
+COREOBJECTS_EXPORT bool INTERNAL_isInMainThread();
+} // namespace cbe
 
 extern COREOBJECTS_EXPORT std::unordered_map<CBEClass, cbe::ObjectAllocatorBase *> *gCBEObjectAllocators;
 
 namespace cbe
 {
+/**
+ * Handle to an object's allocation slot, Stays valid until the object is marked for delete or freed.
+ * Validating is a single load and compare of the slot's generation, No lock or lookup is involved
+ */
+struct ObjectAllocHandle
+{
+    const std::atomic<uint32> *slotGeneration = nullptr;
+    uint32 generation = 0;
+
+    FORCE_INLINE bool isSet() const { return slotGeneration != nullptr; }
+    FORCE_INLINE bool isValid() const { return slotGeneration && slotGeneration->load(std::memory_order::acquire) == generation; }
+
+    FORCE_INLINE bool operator== (const ObjectAllocHandle &rhs) const
+    {
+        return slotGeneration == rhs.slotGeneration && generation == rhs.generation;
+    }
+    FORCE_INLINE bool operator< (const ObjectAllocHandle &rhs) const
+    {
+        return slotGeneration == rhs.slotGeneration ? generation < rhs.generation : slotGeneration < rhs.slotGeneration;
+    }
+};
+
 class COREOBJECTS_EXPORT ObjectAllocatorBase
 {
+public:
+    using AllocIdx = ObjectAllocIdx;
+
+private:
+    // First chunk holds generations of this many slots and each next chunk holds twice the previous one
+    constexpr static const uint64 GENERATION_CHUNK_BASE = 64;
+    constexpr static const uint32 GENERATION_CHUNKS_COUNT = uint32(sizeof(AllocIdx) * 8 + 2 - std::bit_width(GENERATION_CHUNK_BASE));
+
+    /**
+     * Generation of each allocation slot, Incremented when object in the slot is marked for delete and when the slot is freed.
+     * Chunks are never moved or freed while allocator is alive so handles can point to the generation directly.
+     * Not stored in slot pools as empty pools are freed and a reused slot must not start again from an older generation
+     */
+    std::atomic<uint32> *generationChunks[GENERATION_CHUNKS_COUNT] = {};
+
 protected:
     BitArray<uint64> allocValidity;
 
-public:
-    using AllocIdx = ObjectAllocIdx;
+private:
+    FORCE_INLINE std::atomic<uint32> &generationAt(AllocIdx idx) const
+    {
+        const uint64 chunkedIdx = uint64(idx) + GENERATION_CHUNK_BASE;
+        const uint32 chunkIdx = uint32(std::bit_width(chunkedIdx) - std::bit_width(GENERATION_CHUNK_BASE));
+        debugAssert(generationChunks[chunkIdx]);
+        return generationChunks[chunkIdx][chunkedIdx - (GENERATION_CHUNK_BASE << chunkIdx)];
+    }
 
 protected:
     void constructDefault(void *objPtr, AllocIdx allocIdx, CBEClass clazz) const;
+    // Must be called whenever allocValidity grows, Before any new slot is allocated
+    void reserveGenerations(AllocIdx slotsCount);
 
     virtual void *getAllocAt(AllocIdx idx) const = 0;
 
 public:
-    virtual ~ObjectAllocatorBase() = default;
+    ObjectAllocatorBase() = default;
+    MAKE_TYPE_NONCOPY_NONMOVE(ObjectAllocatorBase)
+    virtual ~ObjectAllocatorBase();
     virtual void *getDefault() const = 0;
     virtual void *allocate(AllocIdx &outAllocIdx) = 0;
     virtual void free(void *ptr, AllocIdx allocIdx) = 0;
@@ -71,6 +122,14 @@ public:
         return retVal;
     }
     FORCE_INLINE bool isValid(AllocIdx idx) const { return allocValidity[idx]; }
+
+    FORCE_INLINE ObjectAllocHandle getAllocHandle(AllocIdx idx) const
+    {
+        const std::atomic<uint32> &slotGeneration = generationAt(idx);
+        return { .slotGeneration = &slotGeneration, .generation = slotGeneration.load(std::memory_order::acquire) };
+    }
+    // All handles obtained for the slot at idx before this call becomes invalid
+    FORCE_INLINE void invalidateHandles(AllocIdx idx) { generationAt(idx).fetch_add(1, std::memory_order::release); }
 };
 
 /**
@@ -196,6 +255,7 @@ public:
     void *getDefault() const override { return getAllocAt(defaultAllocIdx); }
     void *allocate(AllocIdx &outAllocIdx) override
     {
+        fatalAssertf(INTERNAL_isInMainThread(), "Objects must be allocated only from main thread!");
         SizeT allocateFrom = lastAllocatedCacheValid() ? lastAllocPoolCache : findAllocator();
         void *ptr = allocatorPools[allocateFrom]->memAlloc(SlotAllocatorType::SlotSize);
         if (ptr == nullptr)
@@ -213,6 +273,7 @@ public:
     }
     void free(void *ptr, AllocIdx allocIdx) override
     {
+        fatalAssertf(INTERNAL_isInMainThread(), "Objects must be freed only from main thread!");
         // Double freeing?
         debugAssert(isValid(allocIdx));
         if (ptr != getAllocAt(allocIdx))
@@ -224,11 +285,13 @@ public:
         SizeT poolIdx = allocIdxToSlotIdx(slotIdx, allocIdx);
         allocatorPools[poolIdx]->memFree(ptr);
         allocValidity[allocIdx] = false;
+        invalidateHandles(allocIdx);
 
         onFree(poolIdx);
     }
     void free(void *ptr) override
     {
+        fatalAssertf(INTERNAL_isInMainThread(), "Objects must be freed only from main thread!");
         SizeT poolIdx;
         SlotAllocatorType *ptrAllocator = nullptr;
         if (lastAllocatedCacheValid() && allocatorPools[lastAllocPoolCache]->isOwningMemory(ptr))
@@ -258,6 +321,7 @@ public:
 
             ptrAllocator->memFree(ptr);
             allocValidity[allocIdx] = false;
+            invalidateHandles(allocIdx);
             onFree(poolIdx);
         }
     }
@@ -299,6 +363,7 @@ FORCE_INLINE SizeT ObjectAllocator<ClassType>::findAllocator()
     {
         allocatorPools.emplace_back(new SlotAllocatorType());
         allocValidity.add(SlotAllocatorType::Count);
+        reserveGenerations(size());
         return allocatorPools.size() - 1;
     }
 }
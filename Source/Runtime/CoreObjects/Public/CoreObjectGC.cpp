@@ -18,6 +18,10 @@
 #include "PropertyVisitorHelpers.h"
 #include "Property/PropertyHelper.h"
 #include "Visitors/FieldVisitors.h"
+#include "Math/Math.h"
+#include "Types/Platform/Threading/CoPaT/DispatchHelpers.h"
+
+#include <atomic>
 
 namespace cbe
 {
@@ -279,6 +283,7 @@ void CoreObjectGC::unregisterReferenceCollector(IReferenceCollector *collector)
 
 struct GCObjectVisitableUserData
 {
+    // Map itself must not be modified while collecting as multiple workers read it at once
     std::unordered_map<CBEClass, BitArray<uint64>> *objUsedFlags;
     const CoreObjectsDB &objsDb = CoreObjectsModule::objectsDB();
     // Object we are inside, This is to ignore adding reference to itself
@@ -288,6 +293,27 @@ struct GCObjectVisitableUserData
 
 struct GCObjectFieldVisitable
 {
+    // Several workers might be marking objects in same word of the flags so the bits are set using atomic OR
+    static void markObjectUsed(GCObjectVisitableUserData *gcUserData, const cbe::ObjectPrivateDataView &objDatV)
+    {
+        using FlagsArrayType = BitArray<uint64>;
+
+        auto flagsItr = gcUserData->objUsedFlags->find(objDatV.clazz);
+        // Objects created after this GC started are not tracked and will never be cleared in this GC
+        if (flagsItr == gcUserData->objUsedFlags->end() || objDatV.allocIdx >= flagsItr->second.size())
+        {
+            return;
+        }
+        uint64 &flagsWord = flagsItr->second.data()[objDatV.allocIdx >> FlagsArrayType::ARRAY_IDX_SHIFT];
+        const uint64 bitMask = INDEX_TO_FLAG_MASK(uint64(objDatV.allocIdx & FlagsArrayType::BITS_IDX_MASK));
+        std::atomic_ref<uint64> atomicFlagsWord{ flagsWord };
+        // Avoid dirtying the cache line if already marked by some other object
+        if (NO_BITS_SET(atomicFlagsWord.load(std::memory_order::relaxed), bitMask))
+        {
+            atomicFlagsWord.fetch_or(bitMask, std::memory_order::relaxed);
+        }
+    }
+
     // Ignore fundamental and special types, we need none const custom types or pointers
     template <typename Type>
     static void visit(Type *, const PropertyInfo &, void *)
@@ -372,7 +398,7 @@ struct GCObjectFieldVisitable
                 }
                 else
                 {
-                    (*gcUserData->objUsedFlags)[objDatV.clazz][objDatV.allocIdx] = true;
+                    markObjectUsed(gcUserData, objDatV);
                 }
             }
             break;
@@ -392,7 +418,7 @@ struct GCObjectFieldVisitable
     static void visit(const void **ptr, const PropertyInfo &propInfo, void *userData)
     {
         const TypedProperty *prop = PropertyHelper::getUnqualified(propInfo.thisProperty);
-        switch (propInfo.thisProperty->type)
+        switch (prop->type)
         {
         case EPropertyType::ClassType:
         {
@@ -410,7 +436,7 @@ struct GCObjectFieldVisitable
                 }
                 else
                 {
-                    (*gcUserData->objUsedFlags)[objDatV.clazz][objDatV.allocIdx] = true;
+                    markObjectUsed(gcUserData, objDatV);
                 }
             }
             break;
@@ -429,6 +455,43 @@ struct GCObjectFieldVisitable
     }
 };
 
+void CoreObjectGC::collectFromMarkSlices()
+{
+    CBE_PROFILER_SCOPE("GCCollectFromMarkSlices");
+
+    auto markSlice = [this](uint32 sliceIdx)
+    {
+        const MarkSlice &slice = markSlices[sliceIdx];
+        GCObjectVisitableUserData userData{ .objUsedFlags = &objUsedFlags };
+        for (ObjectAllocIdx allocIdx = slice.beginIdx; allocIdx < slice.endIdx; ++allocIdx)
+        {
+            if (!slice.allocator->isValid(allocIdx))
+            {
+                continue;
+            }
+
+            cbe::Object *obj = slice.allocator->getAt<cbe::Object>(allocIdx);
+            if (BIT_NOT_SET(userData.objsDb.getObjectData(obj->getDbIdx()).flags, cbe::EObjectFlagBits::ObjFlag_MarkedForDelete))
+            {
+                userData.thisObj = obj;
+                FieldVisitor::visitReferences<GCObjectFieldVisitable>(slice.clazz, slice.refMap, obj, &userData);
+            }
+        }
+    };
+    if (copat::JobSystem *jobSystem = copat::JobSystem::get())
+    {
+        copat::parallelFor(jobSystem, copat::DispatchFunctionType::createLambda(markSlice), uint32(markSlices.size()));
+    }
+    else
+    {
+        // Runs serially in this thread if there is no job system
+        for (uint32 sliceIdx = 0; sliceIdx != markSlices.size(); ++sliceIdx)
+        {
+            markSlice(sliceIdx);
+        }
+    }
+}
+
 void CoreObjectGC::collectObjects(TickRep &budgetTicks)
 {
     debugAssert(state == EGCState::Collecting);
@@ -440,13 +503,19 @@ void CoreObjectGC::collectObjects(TickRep &budgetTicks)
 
     StopWatch collectionSW;
 
-    GCObjectVisitableUserData userData{ .objUsedFlags = &objUsedFlags };
+    GCObjectVisitableUserData staticsUserData{ .objUsedFlags = &objUsedFlags };
     while (!classesLeft.empty())
     {
-        auto allocatorItr = gCBEObjectAllocators->find(classesLeft.back());
-        debugAssert(allocatorItr != gCBEObjectAllocators->end());
-        // Collect
+        // Gather classes until there is enough slots to keep all workers busy, Budget is checked only after each batch
+        markSlices.clear();
+        ObjectAllocIdx batchSlotsCount = 0;
+        while (!classesLeft.empty() && batchSlotsCount < MARK_BATCH_SLOTS)
         {
+            CBEClass clazz = classesLeft.back();
+            classesLeft.pop_back();
+
+            auto allocatorItr = gCBEObjectAllocators->find(clazz);
+            debugAssert(allocatorItr != gCBEObjectAllocators->end());
             cbe::ObjectAllocatorBase *allocator = allocatorItr->second;
 
             // Right now we are only going through static fields of classes that has object
@@ -454,19 +523,31 @@ void CoreObjectGC::collectObjects(TickRep &budgetTicks)
             // collection pass to collect from static field of all class properties in
             // cbe::Object hierarchy However storing referenced object in statics is not wise so
             // we do only as below or we could never scan any statics?
-            FieldVisitor::visitStaticFields<GCObjectFieldVisitable>(classesLeft.back(), &userData);
+            FieldVisitor::visitStaticFields<GCObjectFieldVisitable>(clazz, &staticsUserData);
 
-            for (cbe::Object *obj : allocator->getAllObjects<cbe::Object>())
+            // Objects of classes without any references cannot mark anything, So they need not be crawled
+            const ClassReferenceMap *refMap = IReflectionRuntimeModule::get()->getReferenceMap(clazz);
+            if (!refMap->hasReferences())
             {
-                if (BIT_NOT_SET(userData.objsDb.getObjectData(obj->getDbIdx()).flags, cbe::EObjectFlagBits::ObjFlag_MarkedForDelete))
-                {
-                    userData.thisObj = obj;
-                    FieldVisitor::visitFields<GCObjectFieldVisitable>(classesLeft.back(), obj, &userData);
-                }
+                continue;
+            }
+
+            const ObjectAllocIdx slotsCount = allocator->size();
+            for (ObjectAllocIdx beginIdx = 0; beginIdx < slotsCount; beginIdx += MARK_SLICE_SLOTS)
+            {
+                markSlices.emplace_back(MarkSlice{ .clazz = clazz,
+                                                   .refMap = refMap,
+                                                   .allocator = allocator,
+                                                   .beginIdx = beginIdx,
+                                                   .endIdx = Math::min(beginIdx + MARK_SLICE_SLOTS, slotsCount) });
             }
-            userData.thisObj = nullptr;
+            batchSlotsCount += slotsCount;
+        }
+        // Collect
+        if (!markSlices.empty())
+        {
+            collectFromMarkSlices();
         }
-        classesLeft.pop_back();
 
         budgetTicks -= collectionSW.thisLapTick();
         collectionSW.lap();
@@ -492,4 +573,4 @@ void CoreObjectGC::collectObjects(TickRep &budgetTicks)
 #if COREOBJCTGC_METRICS
     gcCollectionTicks += collectionSW.durationTick();
 #endif
-}
\ No newline at end of file
+}
@@ -22,15 +22,32 @@
 namespace cbe
 {
 class Object;
+class ObjectAllocatorBase;
 }
 class IReferenceCollector;
+struct ClassReferenceMap;
 
 #define COREOBJCTGC_METRICS DEV_BUILD
 
 // Garbage collection proceeds through the each class's object allocators and collects and clears
+// Collection of references from object fields is split into slices of allocator slots and crawled in parallel by the workers
 class CoreObjectGC
 {
 private:
+    // Range of allocator slots of a class that gets crawled by a single worker at once
+    struct MarkSlice
+    {
+        CBEClass clazz;
+        const ClassReferenceMap *refMap;
+        cbe::ObjectAllocatorBase *allocator;
+        ObjectAllocIdx beginIdx;
+        ObjectAllocIdx endIdx;
+    };
+    // Slots per MarkSlice, Small enough for workers to steal slices of a large class from each other
+    constexpr static const ObjectAllocIdx MARK_SLICE_SLOTS = 256;
+    // Minimum slots that will be crawled in parallel before checking the budget again
+    constexpr static const ObjectAllocIdx MARK_BATCH_SLOTS = 16384;
+
     enum class EGCState
     {
         NewGC,      // Fresh GC all data will be gathered from beginning
@@ -48,6 +65,8 @@ private:
     // are not cleared yet
     std::vector<CBEClass> classesLeft;
     EGCState state = EGCState::NewGC;
+    // Slices of classes being collected in current batch, Kept to reuse the allocation across batches
+    std::vector<MarkSlice> markSlices;
 
     std::vector<IReferenceCollector *> refCollectors;
 
@@ -64,6 +83,7 @@ private:
     void collectFromRefCollectors(TickRep &budgetTicks);
     void markObjectsAsValid(TickRep &budgetTicks);
     void collectObjects(TickRep &budgetTicks);
+    void collectFromMarkSlices();
     void clearUnused(TickRep &budgetTicks);
     void startNewGC(TickRep &budgetTicks);
 
@@ -11,135 +11,283 @@
 
 #include "CoreObjectsDB.h"
 #include "CoreObjectAllocator.h"
+#include "Profiler/ProgramProfiler.hpp"
 #include "Types/Platform/Threading/CoPaT/JobSystem.h"
 
 #include <shared_mutex>
 
+struct alignas(CACHELINE_SIZE) CoreObjectsDB::NameIndexShard
+{
+    mutable SharedLockType lock;
+    ObjectIDToNodeIdx objectIdToNodeIdx;
+};
+
 FORCE_INLINE bool CoreObjectsDB::isMainThread() const { return copat::JobSystem::get()->isInThread(copat::EJobThreadType::MainThread); }
 
-void CoreObjectsDB::SharedLockObjectsDB::lockShared() const { objsDb->dbLock->lock_shared(); }
-void CoreObjectsDB::SharedLockObjectsDB::unlockShared() const { objsDb->dbLock->unlock_shared(); }
+void CoreObjectsDB::SharedLockObjectsDB::lockShared() const { objsDb->treeLock->lock_shared(); }
+void CoreObjectsDB::SharedLockObjectsDB::unlockShared() const { objsDb->treeLock->unlock_shared(); }
 
 CoreObjectsDB::CoreObjectsDB()
 {
-    dbLock = new SharedLockType;
-    // Start with one hundred thousand elements as norm?
-    objectIdToNodeIdx.reserve(100000);
+    treeLock = new SharedLockType;
+    nameShards = new NameIndexShard[NAME_SHARDS_COUNT];
+    for (uint32 shardIdx = 0; shardIdx < NAME_SHARDS_COUNT; ++shardIdx)
+    {
+        // Start with one hundred thousand elements as norm?
+        nameShards[shardIdx].objectIdToNodeIdx.reserve(100000 / NAME_SHARDS_COUNT);
+    }
 }
 
 CoreObjectsDB::~CoreObjectsDB()
 {
-    delete dbLock;
-    dbLock = nullptr;
+    delete treeLock;
+    treeLock = nullptr;
+    delete[] nameShards;
+    nameShards = nullptr;
+    for (std::atomic<ObjectData *> &dataChunk : dataChunks)
+    {
+        delete[] dataChunk.exchange(nullptr, std::memory_order::relaxed);
+    }
 }
 
 void CoreObjectsDB::clear()
 {
-    std::scoped_lock<SharedLockType> scopedLock(*dbLock);
+    std::scoped_lock<SharedLockType> scopedLock(*treeLock);
+    for (NodeIdxType nodeIdx : objectTree.getAll())
+    {
+        objectTree[nodeIdx]->bValid.store(false, std::memory_order::release);
+    }
     objectTree.clear();
-    objectIdToNodeIdx.clear();
+    for (uint32 shardIdx = 0; shardIdx < NAME_SHARDS_COUNT; ++shardIdx)
+    {
+        std::scoped_lock<SharedLockType> shardScopedLock(nameShards[shardIdx].lock);
+        nameShards[shardIdx].objectIdToNodeIdx.clear();
+    }
 }
 
-CoreObjectsDB::NodeIdxType
-CoreObjectsDB::addObject(StringID objectId, StringView fullPath, StringView objName, CBEClass clazz, NodeIdxType parentNodeIdx)
+CoreObjectsDB::ObjectData *CoreObjectsDB::reserveDataAt(NodeIdxType nodeIdx)
 {
-    fatalAssertf(isMainThread(), "Add object {} must be done from main thread!", fullPath);
+    fatalAssertf(nodeIdx < MAX_NODES_COUNT, "Objects count exceeded maximum {}", MAX_NODES_COUNT);
 
-#if DEBUG_VALIDATIONS
-    bool bUniqObject = !hasObject({ .objectPath = fullPath, .objectId = objectId });
-    debugAssert(objectId.isValid() && !fullPath.empty() && bUniqObject);
-#endif
+    const uint64 chunkedIdx = uint64(nodeIdx) + DATA_CHUNK_BASE;
+    const uint32 chunkIdx = uint32(std::bit_width(chunkedIdx) - std::bit_width(DATA_CHUNK_BASE));
+    ObjectData *chunk = dataChunks[chunkIdx].load(std::memory_order::relaxed);
+    if (chunk == nullptr)
+    {
+        chunk = new ObjectData[DATA_CHUNK_BASE << chunkIdx];
+        dataChunks[chunkIdx].store(chunk, std::memory_order::release);
+    }
+    return &chunk[chunkedIdx - (DATA_CHUNK_BASE << chunkIdx)];
+}
 
-    std::scoped_lock<SharedLockType> scopedLock(*dbLock);
+FORCE_INLINE CoreObjectsDB::NameIndexShard &CoreObjectsDB::nameShardOf(StringID objectId) const
+{
+    // Top bits are used as bucket in each shard's map uses the lower bits
+    return nameShards[objectId.getID() >> (sizeof(StringID::IDType) * 8 - NAME_SHARD_BITS)];
+}
 
-    CoreObjectsDB::ObjectData objData{
-        .path = fullPath, .clazz = clazz, .nameOffset = uint32(fullPath.length() - objName.length()), .sid = objectId
-    };
-    NodeIdxType nodeIdx = objectTree.add(objData, parentNodeIdx);
-    objectIdToNodeIdx.emplace(objectId, nodeIdx);
-    return nodeIdx;
+void CoreObjectsDB::removeFromNameIndex(StringID objectId, NodeIdxType nodeIdx)
+{
+    NameIndexShard &shard = nameShardOf(objectId);
+    std::scoped_lock<SharedLockType> scopedLock(shard.lock);
+
+    auto itrPair = shard.objectIdToNodeIdx.equal_range(objectId);
+    for (auto itr = itrPair.first; itr != itrPair.second; ++itr)
+    {
+        if (itr->second == nodeIdx)
+        {
+            shard.objectIdToNodeIdx.erase(itr);
+            return;
+        }
+    }
 }
 
-CoreObjectsDB::NodeIdxType CoreObjectsDB::addRootObject(StringID objectId, StringView fullPath, StringView objName, CBEClass clazz)
+void CoreObjectsDB::addToNameIndex(StringID objectId, NodeIdxType nodeIdx)
 {
-    fatalAssertf(isMainThread(), "Add object {} must be done from main thread!", fullPath);
+    NameIndexShard &shard = nameShardOf(objectId);
+    std::scoped_lock<SharedLockType> scopedLock(shard.lock);
+    shard.objectIdToNodeIdx.emplace(objectId, nodeIdx);
+}
+
+CoreObjectsDB::NodeIdxType CoreObjectsDB::findQueryNodeIdx(const NameIndexShard &shard, const ObjectsDBQuery &query) const
+{
+    ObjectClassMatchFilters::Filter classFilter;
+    switch (query.classMatch)
+    {
+    case EObjectClassMatch::Exact:
+        classFilter = ObjectClassMatchFilters::exact;
+        break;
+    case EObjectClassMatch::DerivedFrom:
+        classFilter = ObjectClassMatchFilters::derived;
+        break;
+    case EObjectClassMatch::Ignore:
+    default:
+        classFilter = ObjectClassMatchFilters::ignore;
+        break;
+    }
 
+    bool bDuplicatePathFound = false;
+    auto itrPair = shard.objectIdToNodeIdx.equal_range(query.objectId);
+    for (auto itr = itrPair.first; itr != itrPair.second; ++itr)
+    {
+        // Path of an object in the shard is only changed after it is removed from the shard
+        const ObjectData *objData = validDataAt(itr->second);
+        if (objData == nullptr)
+        {
+            continue;
+        }
+        if (objData->path.isEqual(query.objectPath))
+        {
+            alertAlwaysf(!bDuplicatePathFound, "Objects with duplicate names found {}", objData->path);
+            bDuplicatePathFound = true;
+            if (classFilter(query, *objData))
+            {
+                return itr->second;
+            }
+        }
+    }
+    return InvalidDbIdx;
+}
+
+CoreObjectsDB::NodeIdxType
+CoreObjectsDB::insertObject(StringID objectId, StringView fullPath, StringView objName, CBEClass clazz, NodeIdxType parentNodeIdx)
+{
 #if DEBUG_VALIDATIONS
     bool bUniqObject = !hasObject({ .objectPath = fullPath, .objectId = objectId });
     debugAssert(objectId.isValid() && !fullPath.empty() && bUniqObject);
 #endif
 
-    std::scoped_lock<SharedLockType> scopedLock(*dbLock);
-
-    CoreObjectsDB::ObjectData objData{
-        .path = fullPath, .clazz = clazz, .nameOffset = uint32(fullPath.length() - objName.length()), .sid = objectId
-    };
-    NodeIdxType nodeIdx = objectTree.add(objData);
-    objectIdToNodeIdx.emplace(objectId, nodeIdx);
+    NodeIdxType nodeIdx;
+    {
+        std::scoped_lock<SharedLockType> scopedLock(*treeLock);
+
+        nodeIdx = objectTree.add(nullptr, parentNodeIdx);
+        ObjectData *objData = reserveDataAt(nodeIdx);
+        objectTree[nodeIdx] = objData;
+
+        objData->path = fullPath;
+        objData->flags = 0;
+        objData->clazz = clazz;
+        objData->allocIdx = 0;
+        objData->nameOffset = uint32(fullPath.length() - objName.length());
+        objData->sid = objectId;
+        objData->outerIdx = parentNodeIdx;
+        objData->bValid.store(true, std::memory_order::release);
+    }
+    addToNameIndex(objectId, nodeIdx);
     return nodeIdx;
 }
 
+CoreObjectsDB::NodeIdxType
+CoreObjectsDB::addObject(StringID objectId, StringView fullPath, StringView objName, CBEClass clazz, NodeIdxType parentNodeIdx)
+{
+    fatalAssertf(isMainThread(), "Add object {} must be done from main thread!", fullPath);
+    return insertObject(objectId, fullPath, objName, clazz, parentNodeIdx);
+}
+
+CoreObjectsDB::NodeIdxType CoreObjectsDB::addRootObject(StringID objectId, StringView fullPath, StringView objName, CBEClass clazz)
+{
+    fatalAssertf(isMainThread(), "Add object {} must be done from main thread!", fullPath);
+    return insertObject(objectId, fullPath, objName, clazz, InvalidDbIdx);
+}
+
 void CoreObjectsDB::removeObject(NodeIdxType nodeIdx)
 {
     fatalAssertf(isMainThread(), "Remove object at node index {} must be done from main thread!", nodeIdx);
+
+    std::scoped_lock<SharedLockType> scopedLock(*treeLock);
     debugAssert(objectTree.isValid(nodeIdx));
 
-    std::scoped_lock<SharedLockType> scopedLock(*dbLock);
+    std::vector<NodeIdxType> removedNodes{ nodeIdx };
+    objectTree.getChildren(removedNodes, nodeIdx, true);
 
-    const ObjectData &objData = objectTree[nodeIdx];
-    objectIdToNodeIdx.erase(findQueryNodeIdx(
-        this, { .objectPath = objData.path.getChar(), .clazz = objData.clazz, .objectId = objData.sid, .classMatch = EObjectClassMatch::Exact }
-    ));
+    for (NodeIdxType removedNodeIdx : removedNodes)
+    {
+        ObjectData *objData = objectTree[removedNodeIdx];
+        objData->bValid.store(false, std::memory_order::release);
+        // Removed before releasing the node index, Otherwise the index might be reused and added to name index again
+        removeFromNameIndex(objData->sid, removedNodeIdx);
+    }
     objectTree.remove(nodeIdx);
 }
 
 void CoreObjectsDB::setObject(NodeIdxType nodeIdx, StringID newId, StringView newFullPath, StringView objName)
 {
     fatalAssertf(isMainThread(), "Set object at node index {} must be done from main thread!", nodeIdx);
-    debugAssert(objectTree.isValid(nodeIdx) && newId.isValid());
-
-    std::scoped_lock<SharedLockType> scopedLock(*dbLock);
-
-    ObjectData &objData = objectTree[nodeIdx];
-    objectIdToNodeIdx.erase(findQueryNodeIdx(
-        this, { .objectPath = objData.path.getChar(), .clazz = objData.clazz, .objectId = objData.sid, .classMatch = EObjectClassMatch::Exact }
-    ));
-    objectIdToNodeIdx.emplace(newId, nodeIdx);
-    objData.sid = newId;
-    objData.path = newFullPath;
-    objData.nameOffset = uint32(newFullPath.length() - objName.length());
+    ObjectData *objData = validDataAt(nodeIdx);
+    debugAssert(objData && newId.isValid());
+
+    // Path must not be changed while it is reachable from name index, Lookups compare it with only shard lock held
+    removeFromNameIndex(objData->sid, nodeIdx);
+    objData->sid = newId;
+    objData->path = newFullPath;
+    objData->nameOffset = uint32(newFullPath.length() - objName.length());
+    addToNameIndex(newId, nodeIdx);
 }
 
 void CoreObjectsDB::setObjectParent(NodeIdxType nodeIdx, NodeIdxType parentNodeIdx)
 {
     fatalAssertf(isMainThread(), "Set parent object for object with node index {} must be done from main thread!", nodeIdx);
-    debugAssert(objectTree.isValid(nodeIdx));
 
-    std::scoped_lock<SharedLockType> scopedLock(*dbLock);
+    std::scoped_lock<SharedLockType> scopedLock(*treeLock);
+    debugAssert(objectTree.isValid(nodeIdx));
 
     objectTree.relinkTo(nodeIdx, parentNodeIdx);
+    objectTree[nodeIdx]->outerIdx = parentNodeIdx;
 }
 
-cbe::Object *CoreObjectsDB::getObject(NodeIdxType nodeIdx) const
+bool CoreObjectsDB::hasObject(ObjectsDBQuery &&query) const
 {
-    SharedLockObjectsDB scopedLock(this);
+    const NameIndexShard &shard = nameShardOf(query.objectId);
+    std::shared_lock<SharedLockType> scopedLock(shard.lock);
+    return findQueryNodeIdx(shard, query) != InvalidDbIdx;
+}
 
-    if (objectTree.isValid(nodeIdx))
+bool CoreObjectsDB::hasObject(NodeIdxType nodeIdx) const
+{
+    const ObjectData *objData = validDataAt(nodeIdx);
+    if (objData == nullptr)
     {
-        const ObjectData &objData = objectTree[nodeIdx];
-        if (ANY_BIT_SET(objData.flags, cbe::EObjectFlagBits::ObjFlag_GCPurge))
+        return false;
+    }
+#if DEV_BUILD
+    ObjectsDBQuery query{ .objectPath = objData->path.getChar(), .clazz = objData->clazz, .objectId = objData->sid };
+    const NameIndexShard &shard = nameShardOf(query.objectId);
+    std::shared_lock<SharedLockType> scopedLock(shard.lock);
+    const bool bInNameIndex = findQueryNodeIdx(shard, query) != InvalidDbIdx;
+    debugAssert(bInNameIndex);
+    return bInNameIndex;
+#else
+    return true;
+#endif
+}
+
+cbe::Object *CoreObjectsDB::getObject(NodeIdxType nodeIdx) const
+{
+    if (const ObjectData *objData = validDataAt(nodeIdx))
+    {
+        if (ANY_BIT_SET(objData->flags, cbe::EObjectFlagBits::ObjFlag_GCPurge))
         {
-            cbe::ObjectAllocatorBase *allocator = cbe::getObjAllocator(objData.clazz);
-            return allocator && allocator->isValid(objData.allocIdx) ? allocator->getAt<cbe::Object>(objData.allocIdx) : nullptr;
+            cbe::ObjectAllocatorBase *allocator = cbe::getObjAllocator(objData->clazz);
+            return allocator && allocator->isValid(objData->allocIdx) ? allocator->getAt<cbe::Object>(objData->allocIdx) : nullptr;
         }
         else
         {
-            return cbe::getObjAllocator(objData.clazz)->getAt<cbe::Object>(objData.allocIdx);
+            return cbe::getObjAllocator(objData->clazz)->getAt<cbe::Object>(objData->allocIdx);
         }
     }
     return nullptr;
 }
 
+cbe::Object *CoreObjectsDB::getObject(ObjectsDBQuery &&query) const { return getObject(getObjectNodeIdx(std::move(query))); }
+
+CoreObjectsDB::NodeIdxType CoreObjectsDB::getObjectNodeIdx(ObjectsDBQuery &&query) const
+{
+    const NameIndexShard &shard = nameShardOf(query.objectId);
+    std::shared_lock<SharedLockType> scopedLock(shard.lock);
+    return findQueryNodeIdx(shard, query);
+}
+
 void CoreObjectsDB::getSubobjects(std::vector<NodeIdxType> &subobjNodeIdxs, NodeIdxType nodeIdx) const
 {
     SharedLockObjectsDB scopedLock(this);
@@ -150,32 +298,13 @@ void CoreObjectsDB::getSubobjects(std::vector<NodeIdxType> &subobjNodeIdxs, Node
 void CoreObjectsDB::getSubobjects(std::vector<cbe::Object *> &subobjs, NodeIdxType nodeIdx) const
 {
     SharedLockObjectsDB scopedLock(this);
-
-    std::vector<NodeIdxType> subobjNodeIdxs;
-    objectTree.getChildren(subobjNodeIdxs, nodeIdx, true);
-    for (NodeIdxType subnodeIdx : subobjNodeIdxs)
-    {
-        if (cbe::Object *obj = getObject(subnodeIdx))
-        {
-            subobjs.emplace_back(obj);
-        }
-    }
+    getAllObjectsUnder(subobjs, nodeIdx, true);
 }
 
 void CoreObjectsDB::getChildren(std::vector<cbe::Object *> &children, NodeIdxType nodeIdx) const
 {
     SharedLockObjectsDB scopedLock(this);
-
-    std::vector<NodeIdxType> childIndices;
-    objectTree.getChildren(childIndices, nodeIdx);
-    children.reserve(children.size() + childIndices.size());
-    for (NodeIdxType subnodeIdx : childIndices)
-    {
-        if (cbe::Object *obj = getObject(subnodeIdx))
-        {
-            children.emplace_back(obj);
-        }
-    }
+    getAllObjectsUnder(children, nodeIdx, false);
 }
 
 void CoreObjectsDB::getAllObjects(std::vector<cbe::Object *> &outObjects) const
@@ -189,6 +318,20 @@ void CoreObjectsDB::getAllObjects(std::vector<cbe::Object *> &outObjects) const
     for (NodeIdxType rootIdx : rootIndices)
     {
         outObjects.emplace_back(getObject(rootIdx));
-        getSubobjects(outObjects, rootIdx);
+        getAllObjectsUnder(outObjects, rootIdx, true);
+    }
+}
+
+void CoreObjectsDB::getAllObjectsUnder(std::vector<cbe::Object *> &outObjects, NodeIdxType nodeIdx, bool bRecurse) const
+{
+    std::vector<NodeIdxType> subobjNodeIdxs;
+    objectTree.getChildren(subobjNodeIdxs, nodeIdx, bRecurse);
+    outObjects.reserve(outObjects.size() + subobjNodeIdxs.size());
+    for (NodeIdxType subnodeIdx : subobjNodeIdxs)
+    {
+        if (cbe::Object *obj = getObject(subnodeIdx))
+        {
+            outObjects.emplace_back(obj);
+        }
     }
 }
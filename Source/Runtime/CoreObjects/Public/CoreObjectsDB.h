@@ -18,6 +18,9 @@
 #include "Types/Containers/FlatTree.h"
 #include "Property/PropertyHelper.h"
 
+#include <atomic>
+#include <bit>
+
 namespace std
 {
 class shared_mutex;
@@ -44,6 +47,10 @@ struct ObjectsDBQuery
  *
  * Contains objects hierarchy data and object SID, Alloc idx in database separate from class for quick
  * access Possible use is for garbage collector in future
+ *
+ * Object data is stored in chunks that never move, So data of a valid node index can be read from any thread without locking.
+ * Name lookups are sharded by StringID with a lock per shard and only the hierarchy tree is guarded by a single lock.
+ * Objects are still added and removed only from main thread as object allocators are not thread safe
  */
 class COREOBJECTS_EXPORT CoreObjectsDB
 {
@@ -55,47 +62,63 @@ public:
     {
     private:
         const CoreObjectsDB *objsDb;
-        bool bIsLocked = false;
 
     public:
         FORCE_INLINE SharedLockObjectsDB(const CoreObjectsDB *inDb);
-        ~SharedLockObjectsDB()
-        {
-            if (bIsLocked)
-            {
-                unlockShared();
-            }
-        }
+        ~SharedLockObjectsDB() { unlockShared(); }
 
     private:
         void lockShared() const;
         void unlockShared() const;
     };
 
+private:
+    struct ObjectData;
+    struct NameIndexShard;
+
+    using SharedLockType = std::shared_mutex;
+    using ObjectIDToNodeIdx = std::unordered_multimap<StringID, NodeIdxType>;
+    // Tree holds only the hierarchy, Each node points to its data in dataChunks
+    using ObjectTreeType = FlatTree<ObjectData *, NodeIdxType>;
+    using ObjectPrivateDataView = cbe::ObjectPrivateDataView;
+
+public:
+    static constexpr const NodeIdxType InvalidDbIdx = ObjectTreeType::InvalidIdx;
+
 private:
     struct ObjectData
     {
         String path;
         EObjectFlags flags = 0;
         // Below 2 can be used to retrieve object from allocator directly
-        CBEClass clazz;
+        CBEClass clazz = nullptr;
         ObjectAllocIdx allocIdx = 0;
         // Offset of name start index in path
         uint32 nameOffset = 0;
         StringID sid;
+        // Same as the parent in objectTree
+        NodeIdxType outerIdx = InvalidDbIdx;
+        // Stored with release once all of above is written, Lock free readers must check this first
+        std::atomic<bool> bValid{ false };
     };
 
-    using SharedLockType = std::shared_mutex;
-    using ObjectIDToNodeIdx = std::unordered_multimap<StringID, NodeIdxType>;
-    using ObjectTreeType = FlatTree<ObjectData, NodeIdxType>;
-    using ObjectPrivateDataView = cbe::ObjectPrivateDataView;
+    // First chunk holds data of this many objects and each next chunk holds twice the previous one
+    constexpr static const uint64 DATA_CHUNK_BASE = 1024;
+    constexpr static const uint32 DATA_CHUNKS_COUNT = uint32(sizeof(uint32) * 8 + 2 - std::bit_width(DATA_CHUNK_BASE));
+    constexpr static const NodeIdxType MAX_NODES_COUNT = NodeIdxType(~uint32(0));
 
-    ObjectIDToNodeIdx objectIdToNodeIdx;
-    ObjectTreeType objectTree;
-    SharedLockType *dbLock;
+    constexpr static const uint32 NAME_SHARD_BITS = 5;
+    constexpr static const uint32 NAME_SHARDS_COUNT = 1 << NAME_SHARD_BITS;
 
-public:
-    static constexpr const NodeIdxType InvalidDbIdx = ObjectTreeType::InvalidIdx;
+    /**
+     * Chunks are allocated when a node index first reaches them and only freed in destructor.
+     * Data of removed objects stays in place until the node index is reused
+     */
+    std::atomic<ObjectData *> dataChunks[DATA_CHUNKS_COUNT] = {};
+    NameIndexShard *nameShards;
+    ObjectTreeType objectTree;
+    // Guards objectTree
+    SharedLockType *treeLock;
 
 public:
     CoreObjectsDB();
@@ -111,105 +134,51 @@ public:
     void setObject(NodeIdxType nodeIdx, StringID newId, StringView newFullPath, StringView objName);
     // Invalid newParent clears current parent
     void setObjectParent(NodeIdxType nodeIdx, NodeIdxType parentNodeIdx);
-    // Assumes that node index is valid
+    // Assumes that node index is valid, Must be set only by the thread that is creating the object
     void setAllocIdx(NodeIdxType nodeIdx, ObjectAllocIdx allocIdx)
     {
-        SharedLockObjectsDB scopedLock(this);
-        fatalAssertf(isMainThread(), "Set allocIdx for object with node index {} must be done from main thread!", nodeIdx);
-        debugAssert(objectTree.isValid(nodeIdx));
+        ObjectData *objData = validDataAt(nodeIdx);
+        debugAssert(objData);
 
-        objectTree[nodeIdx].allocIdx = allocIdx;
+        objData->allocIdx = allocIdx;
     }
     // Assumes that node index is valid
     EObjectFlags &objectFlags(NodeIdxType nodeIdx)
     {
-        SharedLockObjectsDB scopedLock(this);
-        debugAssert(objectTree.isValid(nodeIdx));
-        return objectTree[nodeIdx].flags;
+        ObjectData *objData = validDataAt(nodeIdx);
+        debugAssert(objData);
+        return objData->flags;
     }
 
     // Only determines if the object is present in the database. During GCPurge objects might be here but alloc might not be valid
-    FORCE_INLINE bool hasObject(ObjectsDBQuery &&query) const
-    {
-        SharedLockObjectsDB scopedLock(this);
-
-        auto itr = findQueryNodeIdx(this, query);
-        if (itr != objectIdToNodeIdx.cend())
-        {
-            debugAssert(objectTree.isValid(itr->second));
-            return objectTree.isValid(itr->second);
-        }
-        return false;
-    }
-    FORCE_INLINE bool hasObject(NodeIdxType nodeIdx) const
-    {
-        SharedLockObjectsDB scopedLock(this);
-
-        if (objectTree.isValid(nodeIdx))
-        {
-#if DEV_BUILD
-            const ObjectData &objData = objectTree[nodeIdx];
-            ObjectsDBQuery query{ .objectPath = objData.path.getChar(), .clazz = objData.clazz, .objectId = objData.sid };
-            auto itr = findQueryNodeIdx(this, query);
-            debugAssert(itr != objectIdToNodeIdx.cend());
-            return itr != objectIdToNodeIdx.cend();
-#else
-            return true;
-#endif
-        }
-        return false;
-    }
+    bool hasObject(ObjectsDBQuery &&query) const;
+    bool hasObject(NodeIdxType nodeIdx) const;
 
     cbe::Object *getObject(NodeIdxType nodeIdx) const;
-    cbe::Object *getObject(ObjectsDBQuery &&query) const
-    {
-        SharedLockObjectsDB scopedLock(this);
-
-        auto itr = findQueryNodeIdx(this, query);
-        if (itr != objectIdToNodeIdx.cend())
-        {
-            return getObject(itr->second);
-        }
-        return nullptr;
-    }
-    NodeIdxType getObjectNodeIdx(ObjectsDBQuery &&query) const
-    {
-        SharedLockObjectsDB scopedLock(this);
-
-        auto itr = findQueryNodeIdx(this, query);
-        if (itr != objectIdToNodeIdx.cend())
-        {
-            return itr->second;
-        }
-        return InvalidDbIdx;
-    }
+    cbe::Object *getObject(ObjectsDBQuery &&query) const;
+    NodeIdxType getObjectNodeIdx(ObjectsDBQuery &&query) const;
+    // Lock free, Returned name and path are only valid until the object is renamed or removed
     ObjectPrivateDataView getObjectData(NodeIdxType nodeIdx) const
     {
-        SharedLockObjectsDB scopedLock(this);
-        if (!objectTree.isValid(nodeIdx))
+        const ObjectData *objData = validDataAt(nodeIdx);
+        if (objData == nullptr)
         {
             return ObjectPrivateDataView::getInvalid();
         }
 
-        const ObjectData &objData = objectTree[nodeIdx];
-        const ObjectTreeType::Node &node = objectTree.getNode(nodeIdx);
-        return ObjectPrivateDataView{ .name = objData.path.getChar() + objData.nameOffset,
-                                      .path = objData.path.getChar(),
-                                      .flags = objData.flags,
-                                      .outerIdx = node.parent,
-                                      .sid = objData.sid,
-                                      .allocIdx = objData.allocIdx,
-                                      .clazz = objData.clazz };
+        return ObjectPrivateDataView{ .name = objData->path.getChar() + objData->nameOffset,
+                                      .path = objData->path.getChar(),
+                                      .flags = objData->flags,
+                                      .outerIdx = objData->outerIdx,
+                                      .sid = objData->sid,
+                                      .allocIdx = objData->allocIdx,
+                                      .clazz = objData->clazz };
     }
 
     NodeIdxType getParentIdx(NodeIdxType nodeIdx) const
     {
-        SharedLockObjectsDB scopedLock(this);
-        if (objectTree.isValid(nodeIdx))
-        {
-            return objectTree.getNode(nodeIdx).parent;
-        }
-        return InvalidDbIdx;
+        const ObjectData *objData = validDataAt(nodeIdx);
+        return objData ? objData->outerIdx : InvalidDbIdx;
     }
 
     FORCE_INLINE bool hasChild(NodeIdxType nodeIdx) const
@@ -233,6 +202,33 @@ public:
 private:
     FORCE_INLINE bool isMainThread() const;
 
+    // nullptr if nodeIdx never had any data
+    FORCE_INLINE ObjectData *dataAt(NodeIdxType nodeIdx) const
+    {
+        if (nodeIdx >= MAX_NODES_COUNT)
+        {
+            return nullptr;
+        }
+        const uint64 chunkedIdx = uint64(nodeIdx) + DATA_CHUNK_BASE;
+        const uint32 chunkIdx = uint32(std::bit_width(chunkedIdx) - std::bit_width(DATA_CHUNK_BASE));
+        ObjectData *chunk = dataChunks[chunkIdx].load(std::memory_order::acquire);
+        return chunk ? &chunk[chunkedIdx - (DATA_CHUNK_BASE << chunkIdx)] : nullptr;
+    }
+    FORCE_INLINE ObjectData *validDataAt(NodeIdxType nodeIdx) const
+    {
+        ObjectData *objData = dataAt(nodeIdx);
+        return objData && objData->bValid.load(std::memory_order::acquire) ? objData : nullptr;
+    }
+    // Must be called with treeLock held
+    ObjectData *reserveDataAt(NodeIdxType nodeIdx);
+
+    FORCE_INLINE NameIndexShard &nameShardOf(StringID objectId) const;
+    void removeFromNameIndex(StringID objectId, NodeIdxType nodeIdx);
+    void addToNameIndex(StringID objectId, NodeIdxType nodeIdx);
+
+    NodeIdxType insertObject(StringID objectId, StringView fullPath, StringView objName, CBEClass clazz, NodeIdxType parentNodeIdx);
+    void getAllObjectsUnder(std::vector<cbe::Object *> &outObjects, NodeIdxType nodeIdx, bool bRecurse) const;
+
     struct ObjectClassMatchFilters
     {
         using Filter = Function<bool, const ObjectsDBQuery &, const ObjectData &>;
@@ -245,54 +241,12 @@ private:
         FORCE_INLINE static bool exact(const ObjectsDBQuery &query, const ObjectData &objectData) { return query.clazz == objectData.clazz; }
     };
 
-    template <typename ConstAwareType>
-    static auto findQueryNodeIdx(ConstAwareType *db, const ObjectsDBQuery &query)
-    {
-        ObjectClassMatchFilters::Filter classFilter;
-        switch (query.classMatch)
-        {
-        case EObjectClassMatch::Exact:
-            classFilter = ObjectClassMatchFilters::exact;
-            break;
-        case EObjectClassMatch::DerivedFrom:
-            classFilter = ObjectClassMatchFilters::derived;
-            break;
-        case EObjectClassMatch::Ignore:
-        default:
-            classFilter = ObjectClassMatchFilters::ignore;
-            break;
-        }
-
-        bool bDuplicatePathFound = false;
-        auto itrPair = db->objectIdToNodeIdx.equal_range(query.objectId);
-        for (auto itr = itrPair.first; itr != itrPair.second; ++itr)
-        {
-            if (!db->objectTree.isValid(itr->second))
-            {
-                continue;
-            }
-            const ObjectData &objData = db->objectTree[itr->second];
-            if (objData.path.isEqual(query.objectPath))
-            {
-                alertAlwaysf(!bDuplicatePathFound, "Objects with duplicate names found {}", objData.path);
-                bDuplicatePathFound = true;
-                if (classFilter(query, objData))
-                {
-                    return itr;
-                }
-            }
-        }
-        return db->objectIdToNodeIdx.end();
-    }
+    // Must be called with query's name shard locked
+    NodeIdxType findQueryNodeIdx(const NameIndexShard &shard, const ObjectsDBQuery &query) const;
 };
 
 FORCE_INLINE CoreObjectsDB::SharedLockObjectsDB::SharedLockObjectsDB(const CoreObjectsDB *inDb)
     : objsDb(inDb)
-    , bIsLocked(false)
 {
-    if (!objsDb->isMainThread())
-    {
-        bIsLocked = true;
-        lockShared();
-    }
-}
\ No newline at end of file
+    lockShared();
+}
@@ -28,7 +28,8 @@ public:
     using pointer_type = PointerType;
 
 private:
-    ObjectDbIdx dbIdx = CoreObjectsDB::InvalidDbIdx;
+    // Handle is validated instead of looking up the objects database, Object is never accessed if handle is invalid
+    ObjectAllocHandle allocHandle;
     PointerType objPtr = nullptr;
 
     friend std::hash<WeakObjPtr<PtrType>>;
@@ -37,10 +38,10 @@ public:
     WeakObjPtr() = default;
 
     WeakObjPtr(PointerType ptr) noexcept
+        : allocHandle(cbe::getAllocHandle(ptr))
     {
-        if (cbe::isValid(ptr))
+        if (allocHandle.isSet())
         {
-            dbIdx = ptr->getDbIdx();
             objPtr = ptr;
         }
     }
@@ -48,13 +49,13 @@ public:
     // Explicit copy and move constructor needed as compiler generates them without matching template
     // constructors
     WeakObjPtr(WeakObjPtr &&weakPtr) noexcept
-        : dbIdx(weakPtr.dbIdx)
+        : allocHandle(weakPtr.allocHandle)
         , objPtr(weakPtr.objPtr)
     {
         weakPtr.detachRef();
     }
     WeakObjPtr(const WeakObjPtr &weakPtr) noexcept
-        : dbIdx(weakPtr.dbIdx)
+        : allocHandle(weakPtr.allocHandle)
         , objPtr(weakPtr.objPtr)
     {}
     template <class InPtrType>
@@ -79,15 +80,8 @@ public:
 
     WeakObjPtr &operator= (PointerType ptr) noexcept
     {
-        if (cbe::isValid(ptr))
-        {
-            dbIdx = ptr->getDbIdx();
-            objPtr = ptr;
-        }
-        else
-        {
-            reset();
-        }
+        allocHandle = cbe::getAllocHandle(ptr);
+        objPtr = allocHandle.isSet() ? ptr : nullptr;
         return *this;
     }
 
@@ -97,7 +91,7 @@ public:
     {
         if (this != &weakPtr)
         {
-            dbIdx = weakPtr.dbIdx;
+            allocHandle = weakPtr.allocHandle;
             objPtr = weakPtr.objPtr;
             weakPtr.detachRef();
         }
@@ -105,7 +99,7 @@ public:
     }
     FORCE_INLINE WeakObjPtr &operator= (const WeakObjPtr &weakPtr) noexcept
     {
-        dbIdx = weakPtr.dbIdx;
+        allocHandle = weakPtr.allocHandle;
         objPtr = weakPtr.objPtr;
         return *this;
     }
@@ -140,11 +134,11 @@ public:
     {
         return !(*this == rhs);
     }
-    FORCE_INLINE bool operator== (const WeakObjPtr &rhs) const { return dbIdx == rhs.dbIdx && objPtr == rhs.objPtr; }
+    FORCE_INLINE bool operator== (const WeakObjPtr &rhs) const { return allocHandle == rhs.allocHandle && objPtr == rhs.objPtr; }
     template <typename Type>
     FORCE_INLINE bool operator== (const WeakObjPtr<Type> &rhs) const
     {
-        return dbIdx == rhs.dbIdx && objPtr == rhs.objPtr;
+        return allocHandle == rhs.allocHandle && objPtr == rhs.objPtr;
     }
     template <typename Type>
     FORCE_INLINE bool operator== (Type *rhs) const
@@ -152,11 +146,14 @@ public:
         return get() == rhs;
     }
 
-    FORCE_INLINE bool operator< (const WeakObjPtr &rhs) const { return dbIdx == rhs.dbIdx ? objPtr < rhs.objPtr : dbIdx < rhs.dbIdx; }
+    FORCE_INLINE bool operator< (const WeakObjPtr &rhs) const
+    {
+        return allocHandle == rhs.allocHandle ? objPtr < rhs.objPtr : allocHandle < rhs.allocHandle;
+    }
     template <typename Type>
     FORCE_INLINE bool operator< (const WeakObjPtr<Type> &rhs) const
     {
-        return dbIdx == rhs.dbIdx ? objPtr < rhs.objPtr : dbIdx < rhs.dbIdx;
+        return allocHandle == rhs.allocHandle ? objPtr < rhs.objPtr : allocHandle < rhs.allocHandle;
     }
 
     template <typename AsType>
@@ -174,31 +171,22 @@ public:
         return static_cast<PointerType>(objPtr);
     }
 
-    // Checks if set objectId is valid now
-    FORCE_INLINE bool isValid() const
-    {
-        if (!isSet())
-        {
-            return false;
-        }
-        const CoreObjectsDB &objectsDb = ICoreObjectsModule::objectsDB();
-        Object *obj = objectsDb.getObject(dbIdx);
-        return obj == objPtr && cbe::isValidAlloc(objPtr);
-    }
+    // Checks if set object is valid now, Generation of the slot changes once the object is marked for delete or freed
+    FORCE_INLINE bool isValid() const { return objPtr != nullptr && allocHandle.isValid(); }
     FORCE_INLINE explicit operator bool () const { return isValid(); }
 
     // Check if this WeakPtr is set
-    FORCE_INLINE bool isSet() const { return dbIdx != CoreObjectsDB::InvalidDbIdx && objPtr != nullptr; }
+    FORCE_INLINE bool isSet() const { return allocHandle.isSet() && objPtr != nullptr; }
 
     FORCE_INLINE void swap(WeakObjPtr<ValueType> &weakPtr)
     {
-        std::swap(dbIdx, weakPtr.dbIdx);
+        std::swap(allocHandle, weakPtr.allocHandle);
         std::swap(objPtr, weakPtr.objPtr);
     }
 
     FORCE_INLINE void reset()
     {
-        dbIdx = CoreObjectsDB::InvalidDbIdx;
+        allocHandle = {};
         objPtr = nullptr;
     }
 
@@ -270,7 +258,10 @@ public:
 template <typename Type>
 struct std::hash<cbe::WeakObjPtr<Type>>
 {
-    NODISCARD size_t operator() (const cbe::WeakObjPtr<Type> &ptr) const noexcept { return HashUtility::hashAllReturn(ptr.dbIdx, ptr.objPtr); }
+    NODISCARD size_t operator() (const cbe::WeakObjPtr<Type> &ptr) const noexcept
+    {
+        return HashUtility::hashAllReturn(ptr.allocHandle.slotGeneration, ptr.allocHandle.generation, ptr.objPtr);
+    }
 };
 
 template <>
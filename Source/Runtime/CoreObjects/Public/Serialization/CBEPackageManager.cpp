@@ -19,6 +19,12 @@
 #include "Serialization/PackageSaver.h"
 #include "Types/Platform/LFS/PlatformLFS.h"
 #include "Types/Platform/LFS/PathFunctions.h"
+#include "Types/Platform/LFS/Paths.h"
+#include "Types/Platform/LFS/File/FileHelper.h"
+#include "Serialization/ArrayArchiveStream.h"
+#include "Serialization/BinaryArchive.h"
+#include "Serialization/FileArchiveStream.h"
+#include "Types/Platform/Threading/CoPaT/DispatchHelpers.h"
 
 bool ObjectPathHelper::isValidPackageName(StringView packageName)
 {
@@ -140,6 +146,26 @@ COREOBJECTS_EXPORT Object *load(StringView objectPath, CBEClass clazz)
     return obj;
 }
 
+PackageLoadHandle loadPackageAsync(StringView packagePath)
+{
+    CBE_PROFILER_SCOPE("LoadCbePackageAsync");
+
+    CBEPackageManager &packageManager = CoreObjectsModule::packageManager();
+    StringID packagePathId{ packagePath };
+    PackageLoader *packageLoader = packageManager.getPackageLoader(packagePathId);
+    if (!packageLoader)
+    {
+        packageManager.refreshPackages();
+        packageLoader = packageManager.getPackageLoader(packagePathId);
+        if (!packageLoader)
+        {
+            LOG_ERROR("ObjectHelper", "Package {} is not found!", packagePath);
+            return {};
+        }
+    }
+    return packageLoader->loadAsync();
+}
+
 Object *getOrLoad(StringView objectPath, CBEClass clazz)
 {
     CBE_PROFILER_SCOPE("GetOrLoadCbeObj");
@@ -283,64 +309,244 @@ void CBEPackageManager::onObjectDeleted(cbe::Object *obj)
 
 String CBEPackageManager::findObject(StringView objectPath, CBEClass clazz) const
 {
-    if (clazz == nullptr)
+    auto isMatchingClass = [clazz](const FoundObjectsInfo &foundInfo)
     {
-        auto itr = std::find_if(
-            allFoundObjects.cbegin(), allFoundObjects.cend(),
-            [&objectPath](const FoundObjectsInfo &foundInfo)
-            {
-                return foundInfo.fullPath.find(objectPath) != String::npos;
-            }
-        );
-        return (itr != allFoundObjects.cend()) ? itr->fullPath : TCHAR("");
+        return clazz == nullptr || foundInfo.objClass == clazz || PropertyHelper::isChildOf(foundInfo.objClass, clazz);
+    };
+
+    // Full path
+    if (objectPath.find(ObjectPathHelper::RootObjectSeparator) != StringView::npos)
+    {
+        auto itr = allFoundObjects.find(StringID(objectPath));
+        if (itr != allFoundObjects.cend() && itr->second.fullPath == objectPath && isMatchingClass(itr->second))
+        {
+            return itr->second.fullPath;
+        }
     }
 
-    std::vector<const FoundObjectsInfo *> nameMatchedObjs;
-    // Highly unlikely that 32 objects matches per name
-    nameMatchedObjs.reserve(Math::min(32, allFoundObjects.size()));
-    for (const FoundObjectsInfo &foundInfo : allFoundObjects)
+    // Object name or object path without package, Every suffix match is checked as the first few might not pass the class filter
+    const FoundObjectsInfo *childClassMatch = nullptr;
+    auto suffixRange = objectPathSuffixes.equal_range(StringID(objectPath));
+    for (auto itr = suffixRange.first; itr != suffixRange.second; ++itr)
     {
-        if (foundInfo.fullPath.find(objectPath) != String::npos)
+        auto foundItr = allFoundObjects.find(itr->second);
+        debugAssert(foundItr != allFoundObjects.cend());
+        const FoundObjectsInfo &foundInfo = foundItr->second;
+        if (clazz == nullptr || foundInfo.objClass == clazz)
         {
-            nameMatchedObjs.emplace_back(&foundInfo);
-            if (foundInfo.objClass == clazz)
-            {
-                return foundInfo.fullPath;
-            }
+            return foundInfo.fullPath;
+        }
+        if (!childClassMatch && PropertyHelper::isChildOf(foundInfo.objClass, clazz))
+        {
+            childClassMatch = &foundInfo;
         }
     }
-    for (const FoundObjectsInfo *foundInfo : nameMatchedObjs)
+    if (childClassMatch)
+    {
+        return childClassMatch->fullPath;
+    }
+
+    /**
+     * Package path or a path that starts with package path. Only the paths starting with objectPath are checked from sorted paths.
+     * Arbitrary sub strings of paths are not searched as that needs going through all found objects.
+     */
+    auto itr = std::lower_bound(
+        sortedFoundObjects.cbegin(), sortedFoundObjects.cend(), objectPath,
+        [](const FoundObjectsInfo *foundInfo, StringView prefix)
+        {
+            return StringView(foundInfo->fullPath) < prefix;
+        }
+    );
+    for (; itr != sortedFoundObjects.cend() && (*itr)->fullPath.startsWith(objectPath); ++itr)
     {
-        if (PropertyHelper::isChildOf(foundInfo->objClass, clazz))
+        if (isMatchingClass(**itr))
         {
-            return foundInfo->fullPath;
+            return (*itr)->fullPath;
         }
     }
     return TCHAR("");
 }
 
+std::vector<String> CBEPackageManager::findObjectsUnder(StringView pathPrefix, CBEClass clazz) const
+{
+    std::vector<String> foundPaths;
+    auto itr = std::lower_bound(
+        sortedFoundObjects.cbegin(), sortedFoundObjects.cend(), pathPrefix,
+        [](const FoundObjectsInfo *foundInfo, StringView prefix)
+        {
+            return StringView(foundInfo->fullPath) < prefix;
+        }
+    );
+    for (; itr != sortedFoundObjects.cend() && (*itr)->fullPath.startsWith(pathPrefix); ++itr)
+    {
+        if (clazz == nullptr || PropertyHelper::isChildOf((*itr)->objClass, clazz))
+        {
+            foundPaths.emplace_back((*itr)->fullPath);
+        }
+    }
+    return foundPaths;
+}
+
 void CBEPackageManager::refreshPackages()
 {
+    CBE_PROFILER_SCOPE("RefreshPackages");
+
+    std::vector<String> newPackageFiles;
+    std::vector<StringView> newPackagesContentDir;
     for (const String &contentDir : contentDirs)
     {
-        std::vector<String> packageFiles = FileSystemFunctions::listFiles(contentDir, true, String("*.") + cbe::PACKAGE_EXT);
-        for (const String &packageFilePath : packageFiles)
+        std::vector<String> packageFiles = listPackageFiles(contentDir);
+        for (String &packageFilePath : packageFiles)
         {
             String packagePath = ObjectPathHelper::packagePathFromFilePath(packageFilePath, contentDir);
             if (!packageToLoader.contains(packagePath.getChar()))
             {
-                setupPackage(packageFilePath, contentDir);
+                newPackageFiles.emplace_back(std::move(packageFilePath));
+                newPackagesContentDir.emplace_back(contentDir);
             }
         }
     }
+    setupPackages(newPackageFiles, newPackagesContentDir);
 }
 
 void CBEPackageManager::readPackagesIn(StringView contentDir)
 {
-    std::vector<String> packageFiles = FileSystemFunctions::listFiles(contentDir, true, String("*.") + cbe::PACKAGE_EXT);
-    for (const String &packageFile : packageFiles)
+    CBE_PROFILER_SCOPE("ReadPackagesIn");
+
+    std::vector<String> packageFiles = listPackageFiles(contentDir);
+    std::vector<StringView> packagesContentDir(packageFiles.size(), contentDir);
+    setupPackages(packageFiles, packagesContentDir);
+}
+
+std::vector<String> CBEPackageManager::listPackageFiles(const String &contentDir)
+{
+    const String wildcard = String(TCHAR("*.")) + cbe::PACKAGE_EXT;
+
+    std::vector<String> packageFiles = FileSystemFunctions::listFiles(contentDir, false, wildcard);
+    std::vector<String> subDirs = FileSystemFunctions::listAllDirectories(contentDir, false);
+    if (subDirs.empty())
     {
-        setupPackage(packageFile, contentDir);
+        return packageFiles;
+    }
+
+    std::vector<std::vector<String>> subDirsPackageFiles = copat::parallelForReturn(
+        copat::JobSystem::get(),
+        copat::DispatchFunctionTypeWithRet<std::vector<String>>::createLambda(
+            [&subDirs, &wildcard](uint32 dirIdx)
+            {
+                return FileSystemFunctions::listFiles(subDirs[dirIdx], true, wildcard);
+            }
+        ),
+        uint32(subDirs.size())
+    );
+    for (std::vector<String> &subDirPackageFiles : subDirsPackageFiles)
+    {
+        packageFiles.insert(
+            packageFiles.end(), std::make_move_iterator(subDirPackageFiles.begin()), std::make_move_iterator(subDirPackageFiles.end())
+        );
+    }
+    return packageFiles;
+}
+
+void CBEPackageManager::setupPackages(const std::vector<String> &packageFiles, const std::vector<StringView> &packagesContentDir)
+{
+    debugAssert(packageFiles.size() == packagesContentDir.size());
+    // No early return on empty packageFiles, Stale cache entries must be dropped even if every package got deleted
+    if (!bScanCacheLoaded)
+    {
+        loadScanCache();
+    }
+
+    struct PackageScanResult
+    {
+        uint64 fileSize = 0;
+        TickRep lastWriteTime = 0;
+        PackageHeaderData headerData;
+        // Points into scannedHeadersCache if cache is still valid for this package
+        const PackageHeaderData *cachedHeader = nullptr;
+        bool bScanned = false;
+    };
+    std::vector<PackageScanResult> scanResults(packageFiles.size());
+
+    // Cache is only read inside workers
+    copat::parallelFor(
+        copat::JobSystem::get(),
+        copat::DispatchFunctionType::createLambda(
+            [&packageFiles, &scanResults, this](uint32 fileIdx)
+            {
+                const String &packageFilePath = packageFiles[fileIdx];
+                PackageScanResult &scanResult = scanResults[fileIdx];
+                {
+                    PlatformFile packageFile{ packageFilePath };
+                    scanResult.fileSize = packageFile.fileSize();
+                    scanResult.lastWriteTime = packageFile.lastWriteTimeStamp();
+                }
+
+                auto cacheItr = scannedHeadersCache.find(packageFilePath);
+                if (cacheItr != scannedHeadersCache.cend() && cacheItr->second.fileSize == scanResult.fileSize
+                    && cacheItr->second.lastWriteTime == scanResult.lastWriteTime)
+                {
+                    scanResult.cachedHeader = &cacheItr->second.headerData;
+                    scanResult.bScanned = true;
+                    return;
+                }
+
+                BufferedFileArchiveStream fileStream{ packageFilePath, true };
+                scanResult.bScanned = PackageLoader::readPackageHeader(scanResult.headerData, &fileStream, packageFilePath);
+            }
+        ),
+        uint32(packageFiles.size())
+    );
+
+    // Packages and objects must be created in main thread
+    for (SizeT fileIdx = 0; fileIdx != packageFiles.size(); ++fileIdx)
+    {
+        PackageScanResult &scanResult = scanResults[fileIdx];
+        if (!scanResult.bScanned)
+        {
+            LOG_ERROR("CBEPackageManager", "Failed to scan package {}", packageFiles[fileIdx]);
+            continue;
+        }
+        scannedPackageFiles.insert(packageFiles[fileIdx]);
+
+        if (scanResult.cachedHeader)
+        {
+            setupPackage(packageFiles[fileIdx], packagesContentDir[fileIdx], *scanResult.cachedHeader);
+        }
+        else
+        {
+            setupPackage(packageFiles[fileIdx], packagesContentDir[fileIdx], scanResult.headerData);
+            scannedHeadersCache[packageFiles[fileIdx]] = PackageScanCacheEntry{ .fileSize = scanResult.fileSize,
+                                                                                .lastWriteTime = scanResult.lastWriteTime,
+                                                                                .headerData = std::move(scanResult.headerData) };
+            bScanCacheDirty = true;
+        }
+    }
+
+    // Drop packages that got deleted or moved, Entries outside registered content roots are kept as those roots are not scanned yet
+    for (auto itr = scannedHeadersCache.begin(); itr != scannedHeadersCache.end();)
+    {
+        const bool bInContentRoot = std::any_of(
+            contentDirs.cbegin(), contentDirs.cend(),
+            [&itr](const String &contentDir)
+            {
+                return PathFunctions::isSubdirectory(itr->first, contentDir);
+            }
+        );
+        if (bInContentRoot && !scannedPackageFiles.contains(itr->first))
+        {
+            itr = scannedHeadersCache.erase(itr);
+            bScanCacheDirty = true;
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    if (bScanCacheDirty)
+    {
+        saveScanCache();
     }
 }
 
@@ -361,35 +567,183 @@ void CBEPackageManager::removePackagesFrom(StringView contentDir)
     }
 }
 
-void CBEPackageManager::setupPackage(StringView packageFilePath, StringView contentDir)
+void CBEPackageManager::setupPackage(StringView packageFilePath, StringView contentDir, const PackageHeaderData &headerData)
 {
     String packagePath = ObjectPathHelper::packagePathFromFilePath(packageFilePath, contentDir);
     cbe::Package *package = cbe::Package::createPackage(PathFunctions::toRelativePath(packageFilePath, contentDir), contentDir, true);
 
     PackageLoader *loader = new PackageLoader(package, packageFilePath);
-    loader->prepareLoader();
+    loader->prepareLoader(headerData);
 
     packageToLoader[packagePath.getChar()] = loader;
     allFoundPackages.emplace_back(packagePath);
-    // Add all objects
+    addFoundObjects(packagePath, loader);
+}
+
+void CBEPackageManager::addFoundObjects(const String &packagePath, const PackageLoader *loader)
+{
+    const SizeT sortedCount = sortedFoundObjects.size();
     for (const PackageContainedData &containedData : loader->getContainedObjects())
     {
-        allFoundObjects.emplace_back(
-            packagePath + ObjectPathHelper::RootObjectSeparator + containedData.objectPath, packagePath.getChar(), containedData.clazz
-        );
+        String fullPath = packagePath + ObjectPathHelper::RootObjectSeparator + containedData.objectPath;
+        StringID fullPathId{ fullPath };
+        auto insertResult = allFoundObjects.try_emplace(fullPathId, FoundObjectsInfo{ fullPath, packagePath.getChar(), containedData.clazz });
+        if (!insertResult.second)
+        {
+            alertAlwaysf(
+                insertResult.first->second.fullPath == fullPath, "Object path id collision between {} and {}", insertResult.first->second.fullPath,
+                fullPath
+            );
+            continue;
+        }
+        sortedFoundObjects.emplace_back(&insertResult.first->second);
+
+        // Index the object path and each of its outer stripped suffixes
+        StringView suffix = containedData.objectPath;
+        while (!suffix.empty())
+        {
+            objectPathSuffixes.emplace(StringID(suffix), fullPathId);
+            SizeT separatorAt = suffix.find(ObjectPathHelper::ObjectObjectSeparator);
+            suffix = (separatorAt == StringView::npos) ? StringView() : suffix.substr(separatorAt + 1);
+        }
     }
+
+    // Sort only the newly added paths and merge them
+    auto byFullPath = [](const FoundObjectsInfo *lhs, const FoundObjectsInfo *rhs)
+    {
+        return lhs->fullPath < rhs->fullPath;
+    };
+    std::sort(sortedFoundObjects.begin() + sortedCount, sortedFoundObjects.end(), byFullPath);
+    std::inplace_merge(sortedFoundObjects.begin(), sortedFoundObjects.begin() + sortedCount, sortedFoundObjects.end(), byFullPath);
 }
 
-void CBEPackageManager::clearPackage(PackageLoader *loader)
+void CBEPackageManager::removeFoundObjects(const String &packagePath, const PackageLoader *loader)
 {
-    cbe::ObjectPrivateDataView packageDatV = loader->getPackage()->getObjectData();
-    std::erase(allFoundPackages, packageDatV.name);
+    const StringID packageId{ packagePath };
     std::erase_if(
-        allFoundObjects,
-        [&packageDatV](const FoundObjectsInfo &foundInfo)
+        sortedFoundObjects,
+        [packageId](const FoundObjectsInfo *foundInfo)
         {
-            return foundInfo.packageName == packageDatV.sid;
+            return foundInfo->packageName == packageId;
         }
     );
+
+    for (const PackageContainedData &containedData : loader->getContainedObjects())
+    {
+        String fullPath = packagePath + ObjectPathHelper::RootObjectSeparator + containedData.objectPath;
+        StringID fullPathId{ fullPath };
+        auto foundItr = allFoundObjects.find(fullPathId);
+        if (foundItr == allFoundObjects.end() || foundItr->second.packageName != packageId)
+        {
+            continue;
+        }
+
+        StringView suffix = containedData.objectPath;
+        while (!suffix.empty())
+        {
+            auto suffixRange = objectPathSuffixes.equal_range(StringID(suffix));
+            for (auto itr = suffixRange.first; itr != suffixRange.second; ++itr)
+            {
+                if (itr->second == fullPathId)
+                {
+                    objectPathSuffixes.erase(itr);
+                    break;
+                }
+            }
+            SizeT separatorAt = suffix.find(ObjectPathHelper::ObjectObjectSeparator);
+            suffix = (separatorAt == StringView::npos) ? StringView() : suffix.substr(separatorAt + 1);
+        }
+        allFoundObjects.erase(foundItr);
+    }
+}
+
+void CBEPackageManager::clearPackage(PackageLoader *loader)
+{
+    fatalAssertf(!loader->isAsyncLoading(), "Package loader cannot be cleared while it is loading asynchronously");
+    cbe::ObjectPrivateDataView packageDatV = loader->getPackage()->getObjectData();
+    std::erase(allFoundPackages, packageDatV.name);
+    removeFoundObjects(packageDatV.name, loader);
     delete loader;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Package scan cache
+//////////////////////////////////////////////////////////////////////////
+
+STRINGID_CONSTEXPR static const StringID PACKAGE_SCAN_CACHE_MARKER = STRID("CBEPackageScanCache");
+// Bump this whenever PackageHeaderData layout changes
+constexpr static const uint32 PACKAGE_SCAN_CACHE_VERSION = 0;
+
+static String packageScanCacheFilePath()
+{
+    return PathFunctions::combinePath(Paths::savedDirectory(), TCHAR("Cache"), Paths::applicationName() + String(TCHAR("PackageHeaders.cache")));
+}
+
+void CBEPackageManager::loadScanCache()
+{
+    CBE_PROFILER_SCOPE("LoadPackageScanCache");
+
+    bScanCacheLoaded = true;
+    scannedHeadersCache.clear();
+
+    std::vector<uint8> cacheData;
+    if (!FileHelper::readBytes(cacheData, packageScanCacheFilePath()) || cacheData.empty())
+    {
+        return;
+    }
+
+    ArrayArchiveStream cacheStream;
+    cacheStream.setBuffer(cacheData);
+    BinaryArchive cacheArchive;
+    cacheArchive.setLoading(true);
+    cacheArchive.setStream(&cacheStream);
+
+    StringID cacheMarker;
+    uint32 cacheVersion = ~0u;
+    cacheArchive << cacheMarker << cacheVersion;
+    // Package serializer version changes the header so the cache is invalid as well
+    if (cacheMarker != PACKAGE_SCAN_CACHE_MARKER || cacheVersion != PACKAGE_SCAN_CACHE_VERSION
+        || cacheArchive.getCustomVersion(uint32(PACKAGE_CUSTOM_VERSION_ID)) != PACKAGE_SERIALIZER_VERSION)
+    {
+        LOG("CBEPackageManager", "Package scan cache is outdated, Rescanning all packages");
+        return;
+    }
+
+    SizeT entriesCount = 0;
+    cacheArchive << entriesCount;
+    scannedHeadersCache.reserve(entriesCount);
+    for (SizeT i = 0; i < entriesCount && cacheStream.hasMoreData(1); ++i)
+    {
+        String packageFilePath;
+        PackageScanCacheEntry cacheEntry;
+        cacheArchive << packageFilePath << cacheEntry.fileSize << cacheEntry.lastWriteTime << cacheEntry.headerData;
+        scannedHeadersCache[packageFilePath] = std::move(cacheEntry);
+    }
+}
+
+void CBEPackageManager::saveScanCache()
+{
+    CBE_PROFILER_SCOPE("SavePackageScanCache");
+
+    ArrayArchiveStream cacheStream;
+    BinaryArchive cacheArchive;
+    cacheArchive.setCustomVersion(uint32(PACKAGE_CUSTOM_VERSION_ID), PACKAGE_SERIALIZER_VERSION);
+    cacheArchive.setStream(&cacheStream);
+
+    StringID cacheMarker = PACKAGE_SCAN_CACHE_MARKER;
+    uint32 cacheVersion = PACKAGE_SCAN_CACHE_VERSION;
+    cacheArchive << cacheMarker << cacheVersion;
+
+    SizeT entriesCount = scannedHeadersCache.size();
+    cacheArchive << entriesCount;
+    for (std::pair<const String, PackageScanCacheEntry> &cacheEntry : scannedHeadersCache)
+    {
+        cacheArchive << *const_cast<String *>(&cacheEntry.first) << cacheEntry.second.fileSize << cacheEntry.second.lastWriteTime
+                     << cacheEntry.second.headerData;
+    }
+
+    if (FileHelper::writeBytes(cacheStream.getBuffer(), packageScanCacheFilePath()))
+    {
+        bScanCacheDirty = false;
+    }
 }
\ No newline at end of file
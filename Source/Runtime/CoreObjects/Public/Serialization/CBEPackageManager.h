@@ -12,9 +12,11 @@
 #pragma once
 
 #include "CBEObjectTypes.h"
+#include "Serialization/PackageData.h"
 
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 class PackageLoader;
 
@@ -32,8 +34,28 @@ private:
         StringID packageName;
         CBEClass objClass;
     };
-    // Full path of all found objects
-    std::vector<FoundObjectsInfo> allFoundObjects;
+    // All found objects keyed by full path's id
+    std::unordered_map<StringID, FoundObjectsInfo> allFoundObjects;
+    /**
+     * Each object is indexed with every '/' separated suffix of its object path(Path without package), Including just the object name.
+     * Maps suffix id to the full path id of the object
+     */
+    std::unordered_multimap<StringID, StringID> objectPathSuffixes;
+    // Points into allFoundObjects sorted by full path, Used for prefix and partial path queries
+    std::vector<const FoundObjectsInfo *> sortedFoundObjects;
+
+    struct PackageScanCacheEntry
+    {
+        uint64 fileSize;
+        TickRep lastWriteTime;
+        PackageHeaderData headerData;
+    };
+    // Scanned package headers keyed by package file path, Persisted to disk so unchanged packages are not scanned again on next launch
+    std::unordered_map<String, PackageScanCacheEntry> scannedHeadersCache;
+    // Package files scanned in this session, Cache entries under registered content roots that are not in here are stale
+    std::unordered_set<String> scannedPackageFiles;
+    bool bScanCacheLoaded = false;
+    bool bScanCacheDirty = false;
 
 public:
     CBEPackageManager() = default;
@@ -48,12 +70,23 @@ public:
      *
      * Access: public
      *
-     * @param StringView objectPath - must be either object's path without package or just object name
+     * @param StringView objectPath - must be either full path, object's path without package, just object name or starting of full path
      * @param CBEClass clazz - Class this object must be. if null will ignore class check and returns first found
      *
      * @return String - Object's Full path if found, Else empty
      */
     String findObject(StringView objectPath, CBEClass clazz) const;
+    /**
+     * CBEPackageManager::findObjectsUnder - Finds all objects whose full path starts with pathPrefix
+     *
+     * Access: public
+     *
+     * @param StringView pathPrefix - Package path or a directory of packages or package path with outer object path
+     * @param CBEClass clazz - Class the objects must be child of. if null will ignore class check
+     *
+     * @return std::vector<String> - Full paths of all found objects sorted by path
+     */
+    std::vector<String> findObjectsUnder(StringView pathPrefix, CBEClass clazz) const;
 
     // Scans all content directory and finds new package if present and loads its meta and package tables
     void refreshPackages();
@@ -72,7 +105,20 @@ private:
     void readPackagesIn(StringView contentDir);
     void removePackagesFrom(StringView contentDir);
 
-    void setupPackage(StringView packageFilePath, StringView contentDir);
+    // Lists package files under contentDir, Each sub directory is listed in parallel
+    static std::vector<String> listPackageFiles(const String &contentDir);
+    /**
+     * Scans headers of all the package files in parallel or reuses cached headers if package is not modified,
+     * Then sets up the packages in calling thread. packageFiles and contentDirs must be of same length.
+     */
+    void setupPackages(const std::vector<String> &packageFiles, const std::vector<StringView> &packagesContentDir);
+    void setupPackage(StringView packageFilePath, StringView contentDir, const PackageHeaderData &headerData);
+    // Adds or removes all objects of the package from found objects indices
+    void addFoundObjects(const String &packagePath, const PackageLoader *loader);
+    void removeFoundObjects(const String &packagePath, const PackageLoader *loader);
+
+    void loadScanCache();
+    void saveScanCache();
     // Clears everything related to a package stored in CBEPackageManager and deletes the loader
     void clearPackage(PackageLoader *loader);
 };
\ No newline at end of file
@@ -125,6 +125,10 @@ public:
         innerArchive->serialize(value);
         return *this;
     }
+    bool serializeBlock(void *data, SizeT componentSize, SizeT componentCount) override
+    {
+        return innerArchive->serializeBlock(data, componentSize, componentCount);
+    }
     /* Overrides ends */
 };
 
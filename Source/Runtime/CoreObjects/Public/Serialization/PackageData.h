@@ -12,8 +12,13 @@
 #pragma once
 
 #include "ObjectPtrs.h"
+#include "Serialization/CommonTypesSerialization.h"
 
-constexpr inline const uint32 PACKAGE_SERIALIZER_VERSION = 0;
+#include <map>
+
+// From this version contained object's streamStart is relative to end of package header tables
+constexpr inline const uint32 PACKAGE_VERSION_RELATIVE_STREAM_START = 1;
+constexpr inline const uint32 PACKAGE_SERIALIZER_VERSION = 1;
 constexpr inline const uint32 PACKAGE_SERIALIZER_CUTOFF_VERSION = 0;
 STRINGID_CONSTEXPR inline const StringID PACKAGE_CUSTOM_VERSION_ID = STRID("PackageSerializer");
 STRINGID_CONSTEXPR inline const StringID PACKAGE_ARCHIVE_MARKER = STRID("SerializedCBEPackage");
@@ -49,6 +54,7 @@ struct PackageContainedData
     EObjectFlags objectFlags;
     CBEClass clazz;
 
+    // Always absolute stream position once loaded, Relative to end of header tables when saved
     SizeT streamStart;
     SizeT streamSize;
 
@@ -70,6 +76,70 @@ ArchiveType &operator<< (ArchiveType &archive, PackageContainedData &value)
     return archive;
 }
 
+/**
+ * Package header tables as stored in package file, Classes are kept as names.
+ * Reading this does not touch reflection or objects database so it can be read from any thread and be cached to disk.
+ */
+struct PackageHeaderData
+{
+    struct ContainedEntry
+    {
+        String objectPath;
+        uint32 classVersion;
+        EObjectFlags objectFlags;
+        StringID className;
+
+        // Absolute stream position, Relative stream starts are resolved when reading the header
+        SizeT streamStart;
+        SizeT streamSize;
+    };
+    struct DependencyEntry
+    {
+        String objectFullPath;
+        StringID className;
+    };
+
+    std::map<uint32, uint32> customVersions;
+    std::vector<ContainedEntry> containedObjects;
+    std::vector<DependencyEntry> dependentObjects;
+    // Object data starts after header tables
+    SizeT streamStartAt = 0;
+};
+
+// Must match PackageContainedData serialization
+template <ArchiveTypeName ArchiveType>
+ArchiveType &operator<< (ArchiveType &archive, PackageHeaderData::ContainedEntry &value)
+{
+    archive << value.objectPath;
+    archive << value.classVersion;
+    archive << value.objectFlags;
+    archive << value.className;
+
+    archive << value.streamStart;
+    archive << value.streamSize;
+
+    return archive;
+}
+
+// Must match PackageDependencyData serialization
+template <ArchiveTypeName ArchiveType>
+ArchiveType &operator<< (ArchiveType &archive, PackageHeaderData::DependencyEntry &value)
+{
+    archive << value.objectFullPath;
+    archive << value.className;
+    return archive;
+}
+
+template <ArchiveTypeName ArchiveType>
+ArchiveType &operator<< (ArchiveType &archive, PackageHeaderData &value)
+{
+    archive << value.customVersions;
+    archive << value.containedObjects;
+    archive << value.dependentObjects;
+    archive << value.streamStartAt;
+    return archive;
+}
+
 enum class EPackageLoadSaveResult : uint32
 {
     Failed = 0,
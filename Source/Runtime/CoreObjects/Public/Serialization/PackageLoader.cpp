@@ -12,6 +12,7 @@
 #include "Types/Platform/LFS/File/FileHelper.h"
 #include "Serialization/PackageLoader.h"
 #include "Serialization/ArrayArchiveStream.h"
+#include "Serialization/FileArchiveStream.h"
 #include "Serialization/PackageData.h"
 #include "Visitors/FieldVisitors.h"
 #include "PropertyVisitorHelpers.h"
@@ -19,6 +20,10 @@
 #include "CBEObjectHelpers.h"
 #include "CBEPackage.h"
 #include "CoreObjectDelegates.h"
+#include "Types/Platform/Threading/CoPaT/DispatchHelpers.h"
+#include "Types/Platform/Threading/CoPaT/CoroutineAwaitAll.h"
+#include "Types/Platform/Threading/CoPaT/CoroutineWait.h"
+#include "Types/Platform/Threading/PlatformThreading.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Object Pointers relinking codes
@@ -164,6 +169,65 @@ FORCE_INLINE void PackageLoader::linkContainedObjects() const
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Worker thread object archive
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * Archive used to serialize a contained object from worker threads during async load.
+ * Each object gets its own stream cursor over the package bytes, Object tables are read only shared from the loader
+ */
+class PackageObjectStreamArchive final : public ObjectArchive
+{
+private:
+    PackageLoader *loader;
+    ArrayViewArchiveStream objectStream;
+    BinaryArchive streamArchive;
+
+public:
+    bool bDelayLinkRequired = false;
+
+public:
+    PackageObjectStreamArchive(PackageLoader *inLoader, ArrayView<uint8> packageBytes)
+        : loader(inLoader)
+        , objectStream(packageBytes)
+    {
+        setLoading(true);
+        setSwapBytes(false);
+        streamArchive.setLoading(true);
+        streamArchive.setSwapBytes(false);
+        // Reads archive meta and custom versions from start of package
+        streamArchive.setStream(&objectStream);
+        setInnerArchive(&streamArchive);
+    }
+    MAKE_TYPE_NONCOPY_NONMOVE(PackageObjectStreamArchive)
+
+    void seekTo(SizeT streamPos)
+    {
+        if (objectStream.cursorPos() > streamPos)
+        {
+            objectStream.moveBackward(objectStream.cursorPos() - streamPos);
+        }
+        else
+        {
+            objectStream.moveForward(streamPos - objectStream.cursorPos());
+        }
+    }
+    FORCE_INLINE SizeT cursorPos() const { return objectStream.cursorPos(); }
+
+    /* ObjectArchive overrides */
+    void relinkSerializedPtr(void **objPtrPtr) const final { loader->relinkSerializedPtr(objPtrPtr); }
+    void relinkSerializedPtr(const void **objPtrPtr) const final { loader->relinkSerializedPtr(objPtrPtr); }
+    ObjectArchive &serialize(cbe::Object *&obj) final
+    {
+        SizeT tableIdx;
+        (*static_cast<ObjectArchive *>(this)) << tableIdx;
+        loader->linkSerializedObject(tableIdx, obj, false, bDelayLinkRequired);
+        return *this;
+    }
+    /* Overrides ends */
+};
+
 //////////////////////////////////////////////////////////////////////////
 // PackageLoader specific implementations
 //////////////////////////////////////////////////////////////////////////
@@ -287,20 +351,25 @@ ObjectArchive &PackageLoader::serialize(cbe::Object *&obj)
 {
     SizeT tableIdx;
     (*static_cast<ObjectArchive *>(this)) << tableIdx;
+    linkSerializedObject(tableIdx, obj, true, bDelayLinkRequired);
+    return *this;
+}
 
+void PackageLoader::linkSerializedObject(SizeT tableIdx, cbe::Object *&obj, bool bLoadDependent, bool &bOutDelayLink)
+{
     const bool bIsDependent = BIT_SET(tableIdx, DEPENDENT_OBJECT_FLAG);
     CLEAR_BITS(tableIdx, DEPENDENT_OBJECT_FLAG);
     if (tableIdx == NULL_OBJECT_FLAG || (dependentObjects.size() <= tableIdx && containedObjects.size() <= tableIdx))
     {
         obj = nullptr;
-        return (*this);
+        return;
     }
 
     if (bIsDependent)
     {
         debugAssert(dependentObjects.size() > tableIdx);
 
-        if (!dependentObjects[tableIdx].object.isValid())
+        if (bLoadDependent && !dependentObjects[tableIdx].object.isValid())
         {
             cbe::Object *depObj = cbe::getOrLoad(dependentObjects[tableIdx].objectFullPath, dependentObjects[tableIdx].clazz);
             alertAlwaysf(
@@ -324,30 +393,91 @@ ObjectArchive &PackageLoader::serialize(cbe::Object *&obj)
             // This will be later replaced with actual value at relinkSerializedPtr(ptr)
             UPtrInt *objPtrPtr = reinterpret_cast<UPtrInt *>(&obj);
             *objPtrPtr = delayLinkPtrMask + tableIdx;
-            bDelayLinkRequired = true;
+            bOutDelayLink = true;
         }
     }
-    return *this;
 }
 
-void PackageLoader::prepareLoader()
+bool PackageLoader::readPackageHeader(PackageHeaderData &outHeaderData, ArchiveStream *stream, const String &filePath)
 {
-    cbe::ObjectPrivateDataView packageDatV = package->getObjectData();
+    CBE_PROFILER_SCOPE("ReadPackageHeader");
 
-    ArrayArchiveStream localStream;
-    ArrayArchiveStream *archiveStreamPtr = inStream;
-    if (inStream == nullptr)
+    if (!stream->isAvailable())
     {
-        std::vector<uint8> fileData;
-        bool bRead = FileHelper::readBytes(fileData, packageFilePath);
-        fatalAssertf(bRead, "Package {} at {} cannot be read!", packageDatV.name, packageFilePath);
-        localStream.setBuffer(fileData);
-        archiveStreamPtr = &localStream;
+        LOG_ERROR("PackageLoader", "Package at {} cannot be read!", filePath);
+        return false;
     }
 
-    packageArchive.setStream(&localStream);
+    BinaryArchive headerArchive;
+    headerArchive.setLoading(true);
+    headerArchive.setSwapBytes(false);
+    headerArchive.setStream(stream);
+    outHeaderData.customVersions = headerArchive.getCustomVersions();
+
+    uint32 packageVersion = headerArchive.getCustomVersion(uint32(PACKAGE_CUSTOM_VERSION_ID));
+    if (packageVersion < PACKAGE_SERIALIZER_CUTOFF_VERSION)
+    {
+        LOG_ERROR(
+            "PackageLoader", "Package at {} version {} is not supported. Minimum supported version is {}", filePath, packageVersion,
+            PACKAGE_SERIALIZER_CUTOFF_VERSION
+        );
+        headerArchive.setStream(nullptr);
+        return false;
+    }
+
+    // Try reading the marker
+    {
+        StringID packageMarker;
+        SizeT packageHeaderStart = stream->cursorPos();
+        headerArchive << packageMarker;
+        if (packageMarker != PACKAGE_ARCHIVE_MARKER)
+        {
+            LOG_WARN("PackageLoader", "Package marker not found in {}, Trying to load binary stream as marked package!", filePath);
+            stream->moveBackward(stream->cursorPos() - packageHeaderStart);
+        }
+    }
+    headerArchive << outHeaderData.containedObjects;
+    headerArchive << outHeaderData.dependentObjects;
+    outHeaderData.streamStartAt = stream->cursorPos();
+    // Older packages have absolute stream starts
+    if (packageVersion >= PACKAGE_VERSION_RELATIVE_STREAM_START)
+    {
+        for (PackageHeaderData::ContainedEntry &entry : outHeaderData.containedObjects)
+        {
+            entry.streamStart += outHeaderData.streamStartAt;
+        }
+    }
+
+    headerArchive.setStream(nullptr);
+    return true;
+}
+
+void PackageLoader::prepareLoader()
+{
+    PackageHeaderData headerData;
+    bool bHeaderRead = false;
+    if (inStream)
+    {
+        bHeaderRead = readPackageHeader(headerData, inStream, packageFilePath);
+    }
+    else
+    {
+        // Only the header is read, Rest of the package is read during load
+        BufferedFileArchiveStream fileStream{ packageFilePath, true };
+        bHeaderRead = readPackageHeader(headerData, &fileStream, packageFilePath);
+    }
+    fatalAssertf(bHeaderRead, "Package {} at {} cannot be read!", package->getObjectData().name, packageFilePath);
+
+    prepareLoader(headerData);
+}
+
+void PackageLoader::prepareLoader(const PackageHeaderData &headerData)
+{
+    fatalAssertf(!isAsyncLoading(), "Package {} cannot be prepared while it is being loaded asynchronously", packageFilePath);
+    cbe::ObjectPrivateDataView packageDatV = package->getObjectData();
+
     // Set custom versions to this archive to ensure custom versions are available in ObjectArchive
-    for (const std::pair<const uint32, uint32> &customVersion : packageArchive.getCustomVersions())
+    for (const std::pair<const uint32, uint32> &customVersion : headerData.customVersions)
     {
         setCustomVersion(customVersion.first, customVersion.second);
     }
@@ -358,20 +488,32 @@ void PackageLoader::prepareLoader()
         packageDatV.name, packageVersion, PACKAGE_SERIALIZER_CUTOFF_VERSION
     );
 
-    // Try reading the marker
+    auto findClass = [](StringID className) -> CBEClass
     {
-        StringID packageMarker;
-        SizeT packageHeaderStart = archiveStreamPtr->cursorPos();
-        (*static_cast<ObjectArchive *>(this)) << packageMarker;
-        if (packageMarker != PACKAGE_ARCHIVE_MARKER)
-        {
-            LOG_WARN("PackageLoader", "Package marker not found in {}, Trying to load binary stream as marked package!", packageFilePath);
-            archiveStreamPtr->moveBackward(archiveStreamPtr->cursorPos() - packageHeaderStart);
-        }
+        CBEClass clazz = IReflectionRuntimeModule::get()->getClassType(className);
+        return clazz ? clazz : IReflectionRuntimeModule::get()->getStructType(className);
+    };
+
+    containedObjects.clear();
+    containedObjects.reserve(headerData.containedObjects.size());
+    for (const PackageHeaderData::ContainedEntry &entry : headerData.containedObjects)
+    {
+        PackageContainedData &containedData = containedObjects.emplace_back();
+        containedData.objectPath = entry.objectPath;
+        containedData.classVersion = entry.classVersion;
+        containedData.objectFlags = entry.objectFlags;
+        containedData.clazz = findClass(entry.className);
+        containedData.streamStart = entry.streamStart;
+        containedData.streamSize = entry.streamSize;
+    }
+    dependentObjects.clear();
+    dependentObjects.reserve(headerData.dependentObjects.size());
+    for (const PackageHeaderData::DependencyEntry &entry : headerData.dependentObjects)
+    {
+        PackageDependencyData &dependentData = dependentObjects.emplace_back();
+        dependentData.objectFullPath = entry.objectFullPath;
+        dependentData.clazz = findClass(entry.className);
     }
-    (*static_cast<ObjectArchive *>(this)) << containedObjects;
-    (*static_cast<ObjectArchive *>(this)) << dependentObjects;
-    packageArchive.setStream(nullptr);
 
     // Mask exact bits that are necessary for adding containedObjectIdx
     delayLinkPtrMask = SENTINEL_LINK_PTR;
@@ -379,14 +521,105 @@ void PackageLoader::prepareLoader()
     debugAssert(BIT_SET(clearSentinelBits, containedObjects.size() - 1));
     CLEAR_BITS(delayLinkPtrMask, clearSentinelBits);
 
-    streamStartAt = archiveStreamPtr->cursorPos();
+    streamStartAt = headerData.streamStartAt;
+    objectLoadStates = std::vector<std::atomic<EPackageObjectLoadState>>(containedObjects.size());
 
     alertAlwaysf(!containedObjects.empty(), "Empty package {} at {}", packageDatV.name, packageFilePath);
     CoreObjectDelegates::broadcastPackageScanned(this);
 }
 
+void PackageLoader::createContainedObjects(const String &packageName, EObjectFlags packageFlags)
+{
+    CBE_PROFILER_SCOPE("CreatePackageObjs");
+
+    // Create all object first
+    for (PackageContainedData &containedData : containedObjects)
+    {
+        if (!containedData.object.isValid())
+        {
+            // If this object is transient or in transient hierarchy? Then there is a chance that object will only be created after main
+            // packaged object is serialized
+            EObjectFlags collectedFlags = createContainedObject(containedData, packageName, packageFlags);
+            debugAssert(BIT_SET(collectedFlags, cbe::EObjectFlagBits::ObjFlag_Transient) || containedData.object.isValid());
+        }
+    }
+}
+
+void PackageLoader::finalizeContainedObjects(const String &packageName, EObjectFlags packageFlags)
+{
+    // Try caching the possibly created transient containedObjects again
+    for (PackageContainedData &containedData : containedObjects)
+    {
+        if (!containedData.object.isValid())
+        {
+            createContainedObject(containedData, packageName, packageFlags);
+        }
+    }
+    // Now link the pointers that points to delay created objects
+    linkContainedObjects();
+
+    // Broadcast post serialize event
+    {
+        CBE_PROFILER_SCOPE("PostSerializePackage");
+
+        for (PackageContainedData &containedData : containedObjects)
+        {
+            if (containedData.object.isValid())
+            {
+                containedData.object->postSerialize(*this);
+            }
+        }
+    }
+
+    CLEAR_BITS(cbe::INTERNAL_ObjectCoreAccessors::getFlags(package), cbe::EObjectFlagBits::ObjFlag_PackageLoadPending);
+    SET_BITS(cbe::INTERNAL_ObjectCoreAccessors::getFlags(package), cbe::EObjectFlagBits::ObjFlag_PackageLoaded);
+
+    // Broadcast load events, postLoad() and constructed()
+    {
+        CBE_PROFILER_SCOPE("PostLoadPackage");
+
+        for (PackageContainedData &containedData : containedObjects)
+        {
+            if (containedData.object.isValid())
+            {
+                containedData.object->postLoad();
+            }
+        }
+        CoreObjectDelegates::broadcastPackageLoaded(package);
+    }
+    {
+        CBE_PROFILER_SCOPE("ConstructedPackage");
+
+        for (PackageContainedData &containedData : containedObjects)
+        {
+            if (containedData.object.isValid())
+            {
+                containedData.object->constructed();
+            }
+        }
+        package->constructed();
+    }
+}
+
 EPackageLoadSaveResult PackageLoader::load()
 {
+    if (isAsyncLoading())
+    {
+        // Package will be loaded once in flight async load finishes, Its main thread parts must be run here to avoid dead lock
+        copat::JobSystem *jobSystem = copat::JobSystem::get();
+        if (jobSystem->isInThread(copat::EJobThreadType::MainThread))
+        {
+            while (isAsyncLoading())
+            {
+                if (!jobSystem->tryRunMainJob())
+                {
+                    PlatformThreadingFunctions::sleep(0);
+                }
+            }
+        }
+        return copat::waitOnAwaitable(*asyncLoadTask);
+    }
+
     // Do not use this
     cbe::ObjectPrivateDataView tempPackageDatV = package->getObjectData();
     // This is temporary flag cache to avoid getting package object data for every createContainedObject().
@@ -456,81 +689,184 @@ EPackageLoadSaveResult PackageLoader::load()
         }
     };
 
+    createContainedObjects(packageName, packageFlag);
+
+    // Load each object. Transient objects might not have been linked yet.
+    for (PackageContainedData &containedData : containedObjects)
     {
-        CBE_PROFILER_SCOPE("CreatePackageObjs");
+        containedObjSerializer(containedData);
+    }
+    finalizeContainedObjects(packageName, packageFlag);
 
-        // Create all object first
-        for (PackageContainedData &containedData : containedObjects)
+    return loadResult;
+}
+
+PackageLoadHandle PackageLoader::loadAsync()
+{
+    bool bExpected = false;
+    if (!bAsyncLoading.compare_exchange_strong(bExpected, true, std::memory_order::acq_rel))
+    {
+        return { this };
+    }
+
+    // States are allocated in prepareLoader, Only reset here as handles might be reading them
+    for (std::atomic<EPackageObjectLoadState> &loadState : objectLoadStates)
+    {
+        loadState.store(EPackageObjectLoadState::Pending, std::memory_order::relaxed);
+    }
+    serializedObjectsCount.store(0, std::memory_order::relaxed);
+    if (asyncLoadTask.has_value())
+    {
+        // Previous load's awaiters are resumed in main thread when it finishes, So its task is destroyed only after main thread is done with it
+        copat::fireAndForget(&retireAsyncLoadTask, std::move(*asyncLoadTask));
+        asyncLoadTask.reset();
+    }
+    asyncLoadTask.emplace(loadAsyncImpl());
+    return { this };
+}
+
+copat::JobSystemMainThreadTask PackageLoader::retireAsyncLoadTask(AsyncLoadTask /*finishedTask*/) { co_return; }
+
+PackageLoader::AsyncLoadTask PackageLoader::loadAsyncImpl()
+{
+    // Starts in main thread
+    CBE_PROFILER_SCOPE("LoadPackageAsync");
+
+    cbe::ObjectPrivateDataView tempPackageDatV = package->getObjectData();
+    EObjectFlags packageFlag = tempPackageDatV.flags;
+    String packageName = tempPackageDatV.name;
+    tempPackageDatV = {};
+
+    if (NO_BITS_SET(packageFlag, cbe::EObjectFlagBits::ObjFlag_PackageLoadPending))
+    {
+        for (std::atomic<EPackageObjectLoadState> &loadState : objectLoadStates)
         {
-            if (!containedData.object.isValid())
-            {
-                // If this object is transient or in transient hierarchy? Then there is a chance that object will only be created after main
-                // packaged object is serialized
-                EObjectFlags collectedFlags = createContainedObject(containedData, packageName, packageFlag);
-                debugAssert(BIT_SET(collectedFlags, cbe::EObjectFlagBits::ObjFlag_Transient) || containedData.object.isValid());
-            }
+            loadState.store(EPackageObjectLoadState::Ready, std::memory_order::release);
         }
+        bAsyncLoading.store(false, std::memory_order::release);
+        co_return EPackageLoadSaveResult::Success;
     }
 
-    // Load each object. Transient objects might not have been linked yet.
-    for (PackageContainedData &containedData : containedObjects)
+    /**
+     * Only the object slices are read from the mapped package, Pages are brought in by the OS as workers touch them.
+     * Stream set using setInStreamer is used directly.
+     */
+    std::optional<MappedFileArchiveStream> mappedStream;
+    ArrayView<uint8> packageBytes;
+    if (inStream)
     {
-        containedObjSerializer(containedData);
+        packageBytes = ArrayView<uint8>(inStream->getBuffer());
     }
-    // Try caching the possibly created transient containedObjects again
-    for (PackageContainedData &containedData : containedObjects)
+    else
     {
-        if (!containedData.object.isValid())
+        mappedStream.emplace(packageFilePath);
+        if (!mappedStream->isAvailable())
         {
-            createContainedObject(containedData, packageName, packageFlag);
+            alertAlwaysf(false, "Package {} at {} cannot be read!", packageName, packageFilePath);
+            bAsyncLoading.store(false, std::memory_order::release);
+            co_return EPackageLoadSaveResult::IOError;
         }
+        packageBytes = mappedStream->mappedView();
     }
-    // Now link the pointers that points to delay created objects
-    linkContainedObjects();
 
-    // Broadcast post serialize event
+    // Dependent objects cannot be loaded from workers, So load all of them before streaming
     {
-        CBE_PROFILER_SCOPE("PostSerializePackage");
-
-        for (PackageContainedData &containedData : containedObjects)
+        CBE_PROFILER_SCOPE("LoadPackageDependencies");
+        for (PackageDependencyData &dependentData : dependentObjects)
         {
-            if (containedData.object.isValid())
+            if (!dependentData.object.isValid())
             {
-                containedData.object->postSerialize(*this);
+                cbe::Object *depObj = cbe::getOrLoad(dependentData.objectFullPath, dependentData.clazz);
+                alertAlwaysf(depObj, "Invalid dependent object[{}] in package {}", dependentData.objectFullPath, packageName);
+                dependentData.object = depObj;
             }
         }
     }
 
-    CLEAR_BITS(cbe::INTERNAL_ObjectCoreAccessors::getFlags(package), cbe::EObjectFlagBits::ObjFlag_PackageLoadPending);
-    SET_BITS(cbe::INTERNAL_ObjectCoreAccessors::getFlags(package), cbe::EObjectFlagBits::ObjFlag_PackageLoaded);
+    createContainedObjects(packageName, packageFlag);
 
-    // Broadcast load events, postLoad() and constructed()
+    // Collect objects to stream, Flags are only modified in main thread
+    std::vector<uint32> serializeIdxs;
+    serializeIdxs.reserve(containedObjects.size());
+    for (uint32 containedIdx = 0; containedIdx != containedObjects.size(); ++containedIdx)
     {
-        CBE_PROFILER_SCOPE("PostLoadPackage");
+        PackageContainedData &containedData = containedObjects[containedIdx];
+        if (!containedData.object.isValid()
+            || NO_BITS_SET(containedData.object->getObjectData().flags, cbe::EObjectFlagBits::ObjFlag_PackageLoadPending))
+        {
+            objectLoadStates[containedIdx].store(EPackageObjectLoadState::Serialized, std::memory_order::relaxed);
+            serializedObjectsCount.fetch_add(1, std::memory_order::relaxed);
+            continue;
+        }
 
-        for (PackageContainedData &containedData : containedObjects)
+        if (NO_BITS_SET(containedData.object->collectAllFlags(), cbe::EObjectFlagBits::ObjFlag_Transient))
         {
-            if (containedData.object.isValid())
-            {
-                containedData.object->postLoad();
-            }
+            serializeIdxs.emplace_back(containedIdx);
+        }
+        else
+        {
+            CLEAR_BITS(
+                cbe::INTERNAL_ObjectCoreAccessors::getFlags(containedData.object.get()), cbe::EObjectFlagBits::ObjFlag_PackageLoadPending
+            );
+            objectLoadStates[containedIdx].store(EPackageObjectLoadState::Serialized, std::memory_order::relaxed);
+            serializedObjectsCount.fetch_add(1, std::memory_order::relaxed);
         }
-        CoreObjectDelegates::broadcastPackageLoaded(package);
     }
+
+    std::atomic<bool> bAnySizeMismatch = false;
+    std::atomic<bool> bAnyDelayLink = false;
+    auto serializeContainedObj = [&](uint32 idx)
     {
-        CBE_PROFILER_SCOPE("ConstructedPackage");
+        CBE_PROFILER_SCOPE("SerializeObjAsync");
 
-        for (PackageContainedData &containedData : containedObjects)
+        const uint32 containedIdx = serializeIdxs[idx];
+        PackageContainedData &containedData = containedObjects[containedIdx];
+
+        PackageObjectStreamArchive objectArchive(this, packageBytes);
+        objectArchive.seekTo(containedData.streamStart);
+        containedData.object->serialize(objectArchive);
+
+        SizeT serializedSize = objectArchive.cursorPos() - containedData.streamStart;
+        if (serializedSize != containedData.streamSize)
         {
-            if (containedData.object.isValid())
-            {
-                containedData.object->constructed();
-            }
+            alertAlwaysf(
+                serializedSize == containedData.streamSize,
+                "Corrupted package {} for object {} consider using Custom version and handle versioning! Written out size for object {} is "
+                "not same as read size {}",
+                packageName, containedData.objectPath, containedData.streamSize, serializedSize
+            );
+            bAnySizeMismatch.store(true, std::memory_order::relaxed);
         }
-        package->constructed();
+        if (objectArchive.bDelayLinkRequired)
+        {
+            bAnyDelayLink.store(true, std::memory_order::relaxed);
+        }
+
+        objectLoadStates[containedIdx].store(EPackageObjectLoadState::Serialized, std::memory_order::release);
+        serializedObjectsCount.fetch_add(1, std::memory_order::release);
+    };
+    co_await copat::dispatch(
+        copat::JobSystem::get(), copat::DispatchFunctionType::createLambda(std::move(serializeContainedObj)), uint32(serializeIdxs.size())
+    );
+
+    // Finalize in main thread
+    co_await copat::SwitchJobThreadAwaiter<copat::EJobThreadType::MainThread>{};
+
+    for (uint32 containedIdx : serializeIdxs)
+    {
+        cbe::Object *obj = containedObjects[containedIdx].object.get();
+        SET_BITS(cbe::INTERNAL_ObjectCoreAccessors::getFlags(obj), cbe::EObjectFlagBits::ObjFlag_PackageLoaded);
+        CLEAR_BITS(cbe::INTERNAL_ObjectCoreAccessors::getFlags(obj), cbe::EObjectFlagBits::ObjFlag_PackageLoadPending);
     }
+    bDelayLinkRequired = bDelayLinkRequired || bAnyDelayLink.load(std::memory_order::relaxed);
+    finalizeContainedObjects(packageName, packageFlag);
 
-    return loadResult;
+    for (std::atomic<EPackageObjectLoadState> &loadState : objectLoadStates)
+    {
+        loadState.store(EPackageObjectLoadState::Ready, std::memory_order::release);
+    }
+    bAsyncLoading.store(false, std::memory_order::release);
+    co_return bAnySizeMismatch.load(std::memory_order::relaxed) ? EPackageLoadSaveResult::WithWarnings : EPackageLoadSaveResult::Success;
 }
 
 void PackageLoader::unload()
@@ -550,4 +886,51 @@ void PackageLoader::unload()
         }
     }
     CoreObjectDelegates::broadcastPackageUnloaded(package);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// PackageLoadHandle implementations
+//////////////////////////////////////////////////////////////////////////
+
+bool PackageLoadHandle::isFinished() const { return loader && !loader->isAsyncLoading(); }
+
+float PackageLoadHandle::getProgress() const
+{
+    if (!loader)
+    {
+        return 0.0f;
+    }
+    if (!loader->isAsyncLoading() || loader->containedObjects.empty())
+    {
+        return 1.0f;
+    }
+    return float(loader->serializedObjectsCount.load(std::memory_order::acquire)) / float(loader->containedObjects.size());
+}
+
+EPackageObjectLoadState PackageLoadHandle::getObjectState(SizeT containedIdx) const
+{
+    if (!loader || loader->objectLoadStates.size() <= containedIdx)
+    {
+        return EPackageObjectLoadState::Pending;
+    }
+    return loader->objectLoadStates[containedIdx].load(std::memory_order::acquire);
+}
+
+cbe::Object *PackageLoadHandle::getReadyObject(SizeT containedIdx) const
+{
+    if (getObjectState(containedIdx) != EPackageObjectLoadState::Ready)
+    {
+        return nullptr;
+    }
+    return loader->containedObjects[containedIdx].object.get();
+}
+
+EPackageLoadSaveResult PackageLoadHandle::waitForLoad() const
+{
+    if (!loader || !loader->asyncLoadTask.has_value())
+    {
+        return EPackageLoadSaveResult::Failed;
+    }
+    debugAssertf(!copat::JobSystem::get()->isInThread(copat::EJobThreadType::MainThread), "Waiting for async package load in main thread dead locks");
+    return copat::waitOnAwaitable(*loader->asyncLoadTask);
 }
\ No newline at end of file
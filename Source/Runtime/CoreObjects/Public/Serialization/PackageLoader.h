@@ -14,8 +14,13 @@
 #include "Serialization/PackageData.h"
 #include "Serialization/ObjectArchive.h"
 #include "Serialization/BinaryArchive.h"
+#include "Types/Platform/Threading/CoPaT/JobSystemCoroutine.h"
+
+#include <atomic>
+#include <optional>
 
 class ArrayArchiveStream;
+class PackageLoader;
 
 namespace cbe
 {
@@ -24,8 +29,58 @@ class Object;
 struct ObjectPrivateDataView;
 } // namespace cbe
 
+enum class EPackageObjectLoadState : uint8
+{
+    Pending,
+    // Object data is read from package, Pointers to other contained objects might not be linked yet
+    Serialized,
+    // Object is linked, post serialized, post loaded and constructed
+    Ready
+};
+
+/**
+ * Handle to an asynchronous load of a package started with PackageLoader::loadAsync()
+ * Can be polled for progress and for each contained object's state or co_await on it to get the load result.
+ * Awaiting resumes the awaiting coroutine in main thread as objects are finalized in main thread.
+ */
+class COREOBJECTS_EXPORT PackageLoadHandle
+{
+private:
+    PackageLoader *loader = nullptr;
+
+public:
+    PackageLoadHandle() = default;
+    PackageLoadHandle(PackageLoader *inLoader)
+        : loader(inLoader)
+    {}
+    MAKE_TYPE_DEFAULT_COPY_MOVE(PackageLoadHandle)
+
+    bool isValid() const { return loader != nullptr; }
+    bool isFinished() const;
+    // Fraction of contained objects that are serialized, 1 once load is finished
+    float getProgress() const;
+    EPackageObjectLoadState getObjectState(SizeT containedIdx) const;
+    // Returns contained object only if it is ready to be used
+    cbe::Object *getReadyObject(SizeT containedIdx) const;
+    /**
+     * Blocks until load is finished and returns the load result.
+     * Must not be called from main thread as load needs main thread to finalize objects
+     */
+    EPackageLoadSaveResult waitForLoad() const;
+
+    auto &operator co_await () const;
+};
+
 class PackageLoader final : public ObjectArchive
 {
+public:
+    /**
+     * Starts in main thread, Creating objects and finalizing them must happen in main thread.
+     * Multiple coroutines can await on this
+     */
+    using AsyncLoadTask
+        = copat::JobSystemReturnableTaskMC<EPackageLoadSaveResult, true, copat::EJobThreadType::MainThread, copat::EJobPriority::Priority_Normal>;
+
 private:
     static_assert(sizeof(UPtrInt) == 8, "Change below sentinel value for delay link pointer!");
     constexpr static const UPtrInt SENTINEL_LINK_PTR = 0xCDCDCDCDCDCDCDCD;
@@ -44,6 +99,16 @@ private:
 
     bool bDelayLinkRequired = false;
 
+    /* Async load states */
+    std::optional<AsyncLoadTask> asyncLoadTask;
+    // One per contained object allocated in prepareLoader, Written from workers and read while polling from any thread
+    std::vector<std::atomic<EPackageObjectLoadState>> objectLoadStates;
+    std::atomic<uint32> serializedObjectsCount = 0;
+    std::atomic<bool> bAsyncLoading = false;
+
+    friend class PackageObjectStreamArchive;
+    friend PackageLoadHandle;
+
 private:
     /**
      * Creates or obtains objects contained in this package and sets it in corresponding PackageContainedData
@@ -54,6 +119,22 @@ private:
     template <typename T>
     FORCE_INLINE void relinkLoadedPtr(T **objPtrPtr) const;
     FORCE_INLINE void linkContainedObjects() const;
+    /**
+     * Finds the object at tableIdx in contained or dependent tables. Sets bOutDelayLink if object must be linked later using relinkSerializedPtr
+     * If bLoadDependent is false then dependent objects must already be loaded, This is the case when serializing from worker threads
+     */
+    void linkSerializedObject(SizeT tableIdx, cbe::Object *&obj, bool bLoadDependent, bool &bOutDelayLink);
+    // Creates all contained objects that are not created yet, Must be called in main thread
+    void createContainedObjects(const String &packageName, EObjectFlags packageFlags);
+    /**
+     * Links delay created objects, Calls post serialize, post load and constructed on all objects and marks the package as loaded
+     * Must be called in main thread after all objects are serialized
+     */
+    void finalizeContainedObjects(const String &packageName, EObjectFlags packageFlags);
+
+    AsyncLoadTask loadAsyncImpl();
+    // Just holds the finished task until it runs in main thread
+    static copat::JobSystemMainThreadTask retireAsyncLoadTask(AsyncLoadTask finishedTask);
 
 public:
     PackageLoader(cbe::Package *loadingPackage, const String &filePath);
@@ -70,11 +151,33 @@ public:
      * Loads package header tables
      */
     void prepareLoader();
+    // Prepares loader from already read header, Must be called in main thread as classes are resolved here
+    void prepareLoader(const PackageHeaderData &headerData);
+    // Waits for in flight async load instead of loading again, Main thread jobs are run while waiting if called from main thread
     EPackageLoadSaveResult load();
+    /**
+     * Reads package header and tables first, Creates the objects in main thread and then streams each object's data from package on worker
+     * threads. Objects are finalized back in main thread. Returns handle to already running load if there is one.
+     */
+    PackageLoadHandle loadAsync();
     void unload();
 
+    FORCE_INLINE bool isAsyncLoading() const { return bAsyncLoading.load(std::memory_order::acquire); }
+
     void setInStreamer(ArrayArchiveStream *stream) { inStream = stream; }
 
+    /**
+     * Reads only the header and tables of the package from the stream. Stream must be at the start of package.
+     * Can be called from any thread
+     */
+    static bool readPackageHeader(PackageHeaderData &outHeaderData, ArchiveStream *stream, const String &filePath);
+
     FORCE_INLINE cbe::Package *getPackage() const { return package; }
     FORCE_INLINE const std::vector<PackageContainedData> &getContainedObjects() const { return containedObjects; }
-};
\ No newline at end of file
+};
+
+inline auto &PackageLoadHandle::operator co_await () const
+{
+    debugAssert(loader && loader->asyncLoadTask.has_value());
+    return *loader->asyncLoadTask;
+}
\ No newline at end of file
@@ -18,6 +18,152 @@
 #include "CoreObjectsModule.h"
 #include "CBEPackage.h"
 #include "CoreObjectDelegates.h"
+#include "Types/Platform/Threading/CoPaT/DispatchHelpers.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Per object save archive
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * Archive used to serialize a contained object into its own stream, So that contained objects can be serialized in parallel.
+ * Dependent objects are indexed per object and the indices are patched once package's dependent objects table is built
+ */
+class PackageObjectSaveArchive final : public ObjectArchive
+{
+private:
+    struct DependencyIdxPatch
+    {
+        SizeT streamPos;
+        SizeT localIdx;
+    };
+
+    const PackageSaver *saver = nullptr;
+    ArrayArchiveStream objectStream;
+    BinaryArchive streamArchive;
+    // Archive meta is written at start of stream, Object data starts after that
+    SizeT objectDataStart = 0;
+
+    std::unordered_map<NameString, SizeT> objToLocalDepIdx;
+    std::vector<DependencyIdxPatch> depIdxPatches;
+
+public:
+    // Dependent objects in the order they are first serialized by this object
+    std::vector<std::pair<NameString, cbe::Object *>> dependencies;
+
+public:
+    PackageObjectSaveArchive()
+    {
+        setLoading(false);
+        setSwapBytes(false);
+        streamArchive.setLoading(false);
+        streamArchive.setSwapBytes(false);
+        setInnerArchive(&streamArchive);
+    }
+    MAKE_TYPE_NONCOPY_NONMOVE(PackageObjectSaveArchive)
+
+    void serializeObject(const PackageSaver *inSaver, cbe::Object *obj)
+    {
+        saver = inSaver;
+        streamArchive.setStream(&objectStream);
+        objectDataStart = objectStream.cursorPos();
+
+        /**
+         * If transient we store the object as part of package but never serialize it.
+         * This is to allow us to do pointer fix ups if transient object is available while loading
+         * Collecting all parent object tree so that when loading we do not depend on transient object being available at object creation
+         */
+        if (NO_BITS_SET(obj->collectAllFlags(), cbe::EObjectFlagBits::ObjFlag_Transient))
+        {
+            obj->serialize(*this);
+        }
+    }
+
+    // Overwrites local dependent indices serialized into the stream with package's dependent table indices
+    void patchDependencyIndices(const std::vector<SizeT> &localToPackageIdx)
+    {
+        const SizeT streamEnd = objectStream.cursorPos();
+        for (const DependencyIdxPatch &patch : depIdxPatches)
+        {
+            SizeT depObjIdx = localToPackageIdx[patch.localIdx];
+            if (depObjIdx == patch.localIdx)
+            {
+                continue;
+            }
+
+            seekTo(patch.streamPos);
+            SET_BITS(depObjIdx, DEPENDENT_OBJECT_FLAG);
+            (*static_cast<ObjectArchive *>(this)) << depObjIdx;
+        }
+        seekTo(streamEnd);
+    }
+
+    FORCE_INLINE SizeT objectDataSize() const { return objectStream.cursorPos() - objectDataStart; }
+    FORCE_INLINE const uint8 *objectData() const { return objectStream.getBuffer().data() + objectDataStart; }
+
+    /* ObjectArchive overrides */
+    void relinkSerializedPtr(void **) const final
+    {
+        // Nothing to link
+    }
+    void relinkSerializedPtr(const void **) const final
+    {
+        // Nothing to link
+    }
+    ObjectArchive &serialize(cbe::Object *&obj) final
+    {
+        // Push null object index if object is null
+        if (!obj)
+        {
+            (*static_cast<ObjectArchive *>(this)) << *const_cast<SizeT *>(&NULL_OBJECT_FLAG);
+            return *this;
+        }
+
+        NameString objFullPath = NameString(obj->getObjectData().path);
+        // Contained objects table is only read while objects are being serialized
+        auto containedObjItr = saver->objToContObjsIdx.find(objFullPath);
+        if (containedObjItr != saver->objToContObjsIdx.cend())
+        {
+            SizeT containedObjIdx = containedObjItr->second;
+            (*static_cast<ObjectArchive *>(this)) << containedObjIdx;
+            return *this;
+        }
+
+        auto localDepItr = objToLocalDepIdx.find(objFullPath);
+        SizeT localDepIdx = 0;
+        if (localDepItr == objToLocalDepIdx.end())
+        {
+            localDepIdx = dependencies.size();
+            objToLocalDepIdx[objFullPath] = localDepIdx;
+            dependencies.emplace_back(objFullPath, obj);
+        }
+        else
+        {
+            localDepIdx = localDepItr->second;
+        }
+        depIdxPatches.emplace_back(objectStream.cursorPos(), localDepIdx);
+        SET_BITS(localDepIdx, DEPENDENT_OBJECT_FLAG);
+        (*static_cast<ObjectArchive *>(this)) << localDepIdx;
+        return *this;
+    }
+    /* Overrides ends */
+
+private:
+    void seekTo(SizeT streamPos)
+    {
+        if (objectStream.cursorPos() > streamPos)
+        {
+            objectStream.moveBackward(objectStream.cursorPos() - streamPos);
+        }
+        else
+        {
+            objectStream.moveForward(streamPos - objectStream.cursorPos());
+        }
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+// PackageSaver implementations
+//////////////////////////////////////////////////////////////////////////
 
 void PackageSaver::setupContainedObjs()
 {
@@ -50,19 +196,21 @@ void PackageSaver::setupContainedObjs()
     }
 }
 
-void PackageSaver::serializeObject(cbe::WeakObjPtr<cbe::Object> obj)
+SizeT PackageSaver::findOrAddDependency(cbe::Object *obj, const NameString &objFullPath)
 {
-    debugAssert(obj.isValid());
-
-    /**
-     * If transient we store the object as part of package but never serialize it.
-     * This is to allow us to do pointer fix ups if transient object is available while loading
-     * Collecting all parent object tree so that when loading we do not depend on transient object being available at object creation
-     */
-    if (NO_BITS_SET(obj->collectAllFlags(), cbe::EObjectFlagBits::ObjFlag_Transient))
+    auto depObjItr = objToDepObjsIdx.find(objFullPath);
+    if (depObjItr != objToDepObjsIdx.end())
     {
-        obj->serialize(*this);
+        return depObjItr->second;
     }
+
+    SizeT depObjIdx = dependentObjects.size();
+    objToDepObjsIdx[objFullPath] = depObjIdx;
+    PackageDependencyData &objDepData = dependentObjects.emplace_back();
+    objDepData.object = obj;
+    objDepData.objectFullPath = objFullPath.toString();
+    objDepData.clazz = obj->getType();
+    return depObjIdx;
 }
 
 PackageSaver::PackageSaver(cbe::Package *savingPackage)
@@ -84,81 +232,89 @@ EPackageLoadSaveResult PackageSaver::savePackage()
 {
     CBE_PROFILER_SCOPE("SavePackage");
 
-    ArchiveSizeCounterStream archiveCounter;
-    packageArchive.setStream(&archiveCounter);
     /**
      * STEP 1 :
-     * Dummy archive meta/header size for offsetting original stream start and size later
-     */
-    SizeT dummyHeaderSize = archiveCounter.cursorPos();
-
-    /**
-     * STEP 2 :
-     * Dummy serialize to find stream start and stream size for each object
+     * Serialize each object once into its own stream. Objects do not depend on each other's serialized data so they are serialized in parallel
      */
+    std::vector<PackageObjectSaveArchive> objectArchives(containedObjects.size());
     {
-        CBE_PROFILER_SCOPE("DummySerializePackage");
+        CBE_PROFILER_SCOPE("SerializePackageObjs");
 
-        for (PackageContainedData &containedObjData : containedObjects)
+        auto serializeContainedObj = [this, &objectArchives](uint32 containedIdx)
         {
-            containedObjData.streamStart = archiveCounter.cursorPos();
-            serializeObject(containedObjData.object);
-            containedObjData.streamSize = archiveCounter.cursorPos() - containedObjData.streamStart;
-            // We must have custom version setup if present, Custom version keys must be from class property name
-            containedObjData.classVersion = ArchiveBase::getCustomVersion(uint32(containedObjData.object->getType()->name));
+            CBE_PROFILER_SCOPE("SerializeObj");
+
+            debugAssert(containedObjects[containedIdx].object.isValid());
+            objectArchives[containedIdx].serializeObject(this, containedObjects[containedIdx].object.get());
+        };
+        if (copat::JobSystem *jobSystem = copat::JobSystem::get())
+        {
+            copat::parallelFor(jobSystem, copat::DispatchFunctionType::createLambda(serializeContainedObj), uint32(containedObjects.size()));
+        }
+        else
+        {
+            for (uint32 containedIdx = 0; containedIdx != containedObjects.size(); ++containedIdx)
+            {
+                serializeContainedObj(containedIdx);
+            }
         }
     }
 
     /**
-     * STEP 3 :
-     * Copy custom versions and other archive related property to actual packageArchive
+     * STEP 2 :
+     * Merge dependent objects and custom versions in contained objects order, Package will be same as serializing objects one after another.
+     * Dependent object indices written by each object are patched to index in package's dependent objects table
      */
-    for (const std::pair<const uint32, uint32> &customVersion : ArchiveBase::getCustomVersions())
+    SizeT objectsDataSize = 0;
     {
-        packageArchive.setCustomVersion(customVersion.first, customVersion.second);
-    }
-    packageArchive.setCustomVersion(uint32(PACKAGE_CUSTOM_VERSION_ID), PACKAGE_SERIALIZER_VERSION);
+        CBE_PROFILER_SCOPE("MergePackageObjs");
 
-    /**
-     * STEP 4 :
-     * Now all custom versions and dependent object data are setup we determine new header size
-     * Then set stream the final start and size offsets for serialized objects
-     */
-    packageArchive.setStream(nullptr);
-    archiveCounter.moveBackward(archiveCounter.cursorPos());
-    packageArchive.setStream(&archiveCounter);
-    (*static_cast<ObjectArchive *>(this)) << *const_cast<StringID *>(&PACKAGE_ARCHIVE_MARKER);
-    (*static_cast<ObjectArchive *>(this)) << containedObjects;
-    (*static_cast<ObjectArchive *>(this)) << dependentObjects;
-    SizeT actualHeaderSize = archiveCounter.cursorPos();
-    for (PackageContainedData &containedObjData : containedObjects)
-    {
-        containedObjData.streamStart = (containedObjData.streamStart - dummyHeaderSize) + actualHeaderSize;
+        std::vector<SizeT> localToPackageDepIdx;
+        for (SizeT containedIdx = 0; containedIdx != containedObjects.size(); ++containedIdx)
+        {
+            PackageContainedData &containedObjData = containedObjects[containedIdx];
+            PackageObjectSaveArchive &objectArchive = objectArchives[containedIdx];
+
+            localToPackageDepIdx.clear();
+            for (const std::pair<NameString, cbe::Object *> &dependency : objectArchive.dependencies)
+            {
+                localToPackageDepIdx.emplace_back(findOrAddDependency(dependency.second, dependency.first));
+            }
+            objectArchive.patchDependencyIndices(localToPackageDepIdx);
+
+            for (const std::pair<const uint32, uint32> &customVersion : objectArchive.ArchiveBase::getCustomVersions())
+            {
+                packageArchive.setCustomVersion(customVersion.first, customVersion.second);
+            }
+            // We must have custom version setup if present, Custom version keys must be from class property name
+            containedObjData.classVersion = packageArchive.getCustomVersion(uint32(containedObjData.object->getType()->name));
+
+            // Stream start is relative to end of header tables so that header is written only once
+            containedObjData.streamStart = objectsDataSize;
+            containedObjData.streamSize = objectArchive.objectDataSize();
+            objectsDataSize += containedObjData.streamSize;
+        }
     }
-    SizeT finalPackageSize = containedObjects.back().streamStart + containedObjects.back().streamSize;
+    packageArchive.setCustomVersion(uint32(PACKAGE_CUSTOM_VERSION_ID), PACKAGE_SERIALIZER_VERSION);
 
     /**
-     * STEP 5 :
-     * Setup Array stream to write
+     * STEP 3 :
+     * Write header tables followed by each object's data
      */
     ArrayArchiveStream localStream;
     ArrayArchiveStream *archiveStreamPtr = outStream ? outStream : &localStream;
-    archiveStreamPtr->allocate(finalPackageSize);
-    packageArchive.setStream(archiveStreamPtr);
-
-    /**
-     * STEP 6 :
-     * Write into archive
-     */
     {
-        CBE_PROFILER_SCOPE("SerializePackage");
+        CBE_PROFILER_SCOPE("WritePackage");
 
+        packageArchive.setStream(archiveStreamPtr);
         (*static_cast<ObjectArchive *>(this)) << *const_cast<StringID *>(&PACKAGE_ARCHIVE_MARKER);
         (*static_cast<ObjectArchive *>(this)) << containedObjects;
         (*static_cast<ObjectArchive *>(this)) << dependentObjects;
-        for (PackageContainedData &containedObjData : containedObjects)
+
+        archiveStreamPtr->allocate(objectsDataSize);
+        for (const PackageObjectSaveArchive &objectArchive : objectArchives)
         {
-            serializeObject(containedObjData.object);
+            archiveStreamPtr->write(objectArchive.objectData(), objectArchive.objectDataSize());
         }
         packageArchive.setStream(nullptr);
     }
@@ -196,22 +352,7 @@ ObjectArchive &PackageSaver::serialize(cbe::Object *&obj)
     }
     else
     {
-        auto depObjItr = objToDepObjsIdx.find(objFullPath);
-        SizeT depObjIdx = 0;
-        // If dependent is not there then we must create a new entry and serialize it
-        if (depObjItr == objToDepObjsIdx.end())
-        {
-            depObjIdx = dependentObjects.size();
-            objToDepObjsIdx[objFullPath] = depObjIdx;
-            PackageDependencyData &objDepData = dependentObjects.emplace_back();
-            objDepData.object = obj;
-            objDepData.objectFullPath = objFullPath.toString();
-            objDepData.clazz = obj->getType();
-        }
-        else
-        {
-            depObjIdx = depObjItr->second;
-        }
+        SizeT depObjIdx = findOrAddDependency(obj, objFullPath);
         SET_BITS(depObjIdx, DEPENDENT_OBJECT_FLAG);
         (*static_cast<ObjectArchive *>(this)) << depObjIdx;
     }
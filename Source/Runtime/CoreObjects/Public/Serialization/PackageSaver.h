@@ -16,6 +16,7 @@
 #include "Serialization/BinaryArchive.h"
 
 class ArrayArchiveStream;
+class PackageObjectSaveArchive;
 
 namespace cbe
 {
@@ -37,6 +38,8 @@ private:
     // Only should be set if not going to serialize to file by default
     ArrayArchiveStream *outStream = nullptr;
 
+    friend PackageObjectSaveArchive;
+
 public:
     PackageSaver(cbe::Package *savingPackage);
     EPackageLoadSaveResult savePackage();
@@ -57,6 +60,6 @@ public:
 
 private:
     void setupContainedObjs();
-    // Just helper to bring serializing object bytes to single place
-    void serializeObject(cbe::WeakObjPtr<cbe::Object> obj);
+    // Returns index of obj in dependent objects table, Adds new entry if obj is not found
+    SizeT findOrAddDependency(cbe::Object *obj, const NameString &objFullPath);
 };
@@ -12,6 +12,8 @@
 #include "EngineRenderScene.h"
 #include "Math/Camera.h"
 #include "Math/Plane.h"
+#include "Math/BatchTransform.h"
+#include "Math/MathSIMD.h"
 #include "IApplicationModule.h"
 #include "ApplicationInstance.h"
 #include "Classes/World.h"
@@ -34,6 +36,8 @@
 #include "RenderInterface/Rendering/CommandBuffer.h"
 #include "RenderInterface/ShaderCore/ShaderParameterUtility.h"
 
+#include <bit>
+
 #define DISABLE_PER_FRAME_UPDATE 0
 
 namespace ERendererIntermTexture
@@ -442,6 +446,10 @@ void EngineRenderScene::clearScene()
     frameCount = 0;
     world.reset();
     compsRenderInfo.clear();
+    compsVisibility.clear();
+    compsCulling = {};
+    bCompsDrawableDirty = false;
+    drawPipelineShaders.clear();
     componentToRenderInfo.clear();
     componentUpdates.clear();
 
@@ -544,6 +552,15 @@ FORCE_INLINE void EngineRenderScene::addMeshRef(EVertexType::Type vertType, cbe:
             vertView.vertOffset = vertOffset;
             vertView.vertCount = compRenderInfo.cpuVertBuffer->bufferCount();
             vertView.refs = 1;
+            if (sceneVerts.freeMeshSortIds.empty())
+            {
+                vertView.sortId = sceneVerts.meshSortIdsCount++;
+            }
+            else
+            {
+                vertView.sortId = sceneVerts.freeMeshSortIds.back();
+                sceneVerts.freeMeshSortIds.pop_back();
+            }
 
             uint32 vertStride = compRenderInfo.cpuVertBuffer->bufferStride(), idxStride = compRenderInfo.cpuIdxBuffer->bufferStride();
 
@@ -583,6 +600,7 @@ FORCE_INLINE void EngineRenderScene::removeMeshRef(EVertexType::Type vertType, M
         {
             sceneVerts.vertsAllocTracker.deallocate(meshVertView.vertOffset, meshVertView.vertCount);
             sceneVerts.idxsAllocTracker.deallocate(meshVertView.idxOffset, meshVertView.idxCount);
+            sceneVerts.freeMeshSortIds.emplace_back(meshVertView.sortId);
             sceneVerts.meshes.erase(meshID);
         }
     }
@@ -766,6 +784,7 @@ void EngineRenderScene::addRenderComponents(const std::vector<cbe::RenderableCom
                 debugAssert(compsRenderInfo[idx].cpuVertBuffer.isValid() && compsRenderInfo[idx].cpuIdxBuffer.isValid());
                 addMeshRef(compsRenderInfo[idx].vertexType, compsRenderInfo[idx].meshObjPath, idx);
             }
+            setupCompCulling(idx);
             componentToRenderInfo[compPath] = idx;
         }
     }
@@ -788,6 +807,7 @@ void EngineRenderScene::removeRenderComponents(const std::vector<String> &render
             }
             cbe::RenderableComponent *comp = cbe::cast<cbe::RenderableComponent>(cbe::get(compToRemove.getChar()));
             destroyRenderInfo(comp, idx);
+            clearCompCulling(idx);
             componentToRenderInfo.erase(compToIdxItr);
             compsRenderInfo.reset(idx);
         }
@@ -814,6 +834,7 @@ void EngineRenderScene::recreateRenderComponents(const std::vector<cbe::Renderab
                 debugAssert(compsRenderInfo[idx].cpuVertBuffer.isValid() && compsRenderInfo[idx].cpuIdxBuffer.isValid());
                 addMeshRef(compsRenderInfo[idx].vertexType, compsRenderInfo[idx].meshObjPath, idx);
             }
+            setupCompCulling(idx);
             componentToRenderInfo[compToRecreatePath] = idx;
         }
         else
@@ -838,6 +859,7 @@ void EngineRenderScene::recreateRenderComponents(const std::vector<cbe::Renderab
                     addMeshRef(currVertType, newMesh, idx);
                 }
             }
+            setupCompCulling(idx);
         }
     }
 }
@@ -860,13 +882,8 @@ void EngineRenderScene::updateTfComponents(
             ComponentRenderInfo &compRenderInfo = compsRenderInfo[compRenderIdxItr->second];
             // TODO(Jeslas) : Getting world tf here is safe?
             compRenderInfo.worldTf = renderComp->getWorldTransform();
-            compRenderInfo.worldBound = AABB();
-            Vector3 aabbCorners[8];
-            renderComp->getLocalBound().boundCorners(aabbCorners);
-            for (uint32 i = 0; i != ARRAY_LENGTH(aabbCorners); ++i)
-            {
-                compRenderInfo.worldBound.grow(compRenderInfo.worldTf.transformPoint(aabbCorners[i]));
-            }
+            compRenderInfo.worldBound = BatchTransform::transformAABB(compRenderInfo.worldTf.getTransformMatrix(), renderComp->getLocalBound());
+            updateCompCullingBound(compRenderIdxItr->second);
 
             if (compRenderInfo.tfIndex != 0)
             {
@@ -1029,123 +1046,338 @@ void EngineRenderScene::performTransferCopies(IRenderCommandList *cmdList, IGrap
     cmdList->submitCmd(EQueuePriority::High, submitInfo);
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// Frustum culling
+//////////////////////////////////////////////////////////////////////////
+
+// Number of components visibility in a single word of visibility BitArray
+constexpr static const SizeT VISIBILITY_WORD_BITS = 64;
+// 8 words of visibility bits fill a cache line, So jobs never write to same cache line and each job reads 512 bounds
+constexpr static const SizeT VISIBILITY_WORDS_PER_JOB = 8;
+
+/**
+ * Draw sort key layout from most significant bits, Pipeline is always most significant as each pipeline has its own indirect draw list.
+ * FrontToBack : Pipeline(Shader, Vertex type) | Material | Mesh | Depth
+ * BackToFront : Pipeline(Shader, Vertex type) | Inverted depth | Material | Mesh
+ * Declared here as resolving drawable components checks the pipeline index against it
+ */
+constexpr static const uint32 DRAW_SHADER_BITS = 8;
+constexpr static const uint32 DRAW_VERTEX_TYPE_BITS = 4;
+constexpr static const uint32 DRAW_MATERIAL_BITS = 16;
+constexpr static const uint32 DRAW_MESH_BITS = 16;
+constexpr static const uint32 DRAW_DEPTH_BITS = 20;
+constexpr static const uint32 DRAW_PIPELINE_SHIFT = DRAW_MATERIAL_BITS + DRAW_MESH_BITS + DRAW_DEPTH_BITS;
+constexpr static const uint64 DRAW_MATERIAL_MASK = (1ull << DRAW_MATERIAL_BITS) - 1;
+constexpr static const uint64 DRAW_MESH_MASK = (1ull << DRAW_MESH_BITS) - 1;
+constexpr static const uint64 DRAW_DEPTH_MASK = (1ull << DRAW_DEPTH_BITS) - 1;
+static_assert(DRAW_PIPELINE_SHIFT + DRAW_SHADER_BITS + DRAW_VERTEX_TYPE_BITS == 64, "Draw sort key must use all 64bits");
+static_assert(EVertexType::TypeEnd <= (1u << DRAW_VERTEX_TYPE_BITS), "Vertex types do not fit in draw sort key");
+
+struct FrustumCullingParams
+{
+    constexpr static const uint32 PLANES_COUNT = 6;
+
+    // Frustum plane's normal, Absolute of normal and distance
+    float nX[PLANES_COUNT];
+    float nY[PLANES_COUNT];
+    float nZ[PLANES_COUNT];
+    float absNX[PLANES_COUNT];
+    float absNY[PLANES_COUNT];
+    float absNZ[PLANES_COUNT];
+    float d[PLANES_COUNT];
+
+    // Frustum's AABB center and half extent, Removes the boxes that are not outside any plane but still outside the frustum corners
+    float centerX, centerY, centerZ;
+    float extentX, extentY, extentZ;
+};
+
+/**
+ * Returns the visibility bits of VISIBILITY_WORD_BITS boxes starting at startIdx.
+ * Box with center c and half extent e is outside a plane if its p-vertex is outside, That is (n.c + d + |n|.e) < 0
+ */
+FORCE_INLINE uint64 cullBoundsWord(
+    const float *cX, const float *cY, const float *cZ, const float *eX, const float *eY, const float *eZ, const FrustumCullingParams &frustum
+)
+{
+    uint64 visibleBits = 0;
+#if MATH_SIMD_AVX2
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    for (SizeT i = 0; i != VISIBILITY_WORD_BITS; i += 8)
+    {
+        const __m256 centerX = _mm256_loadu_ps(cX + i), centerY = _mm256_loadu_ps(cY + i), centerZ = _mm256_loadu_ps(cZ + i);
+        const __m256 extentX = _mm256_loadu_ps(eX + i), extentY = _mm256_loadu_ps(eY + i), extentZ = _mm256_loadu_ps(eZ + i);
+
+        // Overlaps frustum AABB in all axes
+        __m256 inside = _mm256_cmp_ps(
+            _mm256_andnot_ps(signMask, _mm256_sub_ps(centerX, _mm256_set1_ps(frustum.centerX))),
+            _mm256_add_ps(extentX, _mm256_set1_ps(frustum.extentX)), _CMP_LE_OQ
+        );
+        inside = _mm256_and_ps(
+            inside, _mm256_cmp_ps(
+                        _mm256_andnot_ps(signMask, _mm256_sub_ps(centerY, _mm256_set1_ps(frustum.centerY))),
+                        _mm256_add_ps(extentY, _mm256_set1_ps(frustum.extentY)), _CMP_LE_OQ
+                    )
+        );
+        inside = _mm256_and_ps(
+            inside, _mm256_cmp_ps(
+                        _mm256_andnot_ps(signMask, _mm256_sub_ps(centerZ, _mm256_set1_ps(frustum.centerZ))),
+                        _mm256_add_ps(extentZ, _mm256_set1_ps(frustum.extentZ)), _CMP_LE_OQ
+                    )
+        );
+
+        for (uint32 p = 0; p != FrustumCullingParams::PLANES_COUNT; ++p)
+        {
+            const __m256 centerDist = _mm256_add_ps(
+                _mm256_add_ps(_mm256_mul_ps(centerX, _mm256_set1_ps(frustum.nX[p])), _mm256_mul_ps(centerY, _mm256_set1_ps(frustum.nY[p]))),
+                _mm256_add_ps(_mm256_mul_ps(centerZ, _mm256_set1_ps(frustum.nZ[p])), _mm256_set1_ps(frustum.d[p]))
+            );
+            const __m256 extentDist = _mm256_add_ps(
+                _mm256_add_ps(
+                    _mm256_mul_ps(extentX, _mm256_set1_ps(frustum.absNX[p])), _mm256_mul_ps(extentY, _mm256_set1_ps(frustum.absNY[p]))
+                ),
+                _mm256_mul_ps(extentZ, _mm256_set1_ps(frustum.absNZ[p]))
+            );
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(centerDist, extentDist), zero, _CMP_GE_OQ));
+        }
+        visibleBits |= uint64(_mm256_movemask_ps(inside)) << i;
+    }
+#elif MATH_SIMD_SSE
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    for (SizeT i = 0; i != VISIBILITY_WORD_BITS; i += 4)
+    {
+        const __m128 centerX = _mm_loadu_ps(cX + i), centerY = _mm_loadu_ps(cY + i), centerZ = _mm_loadu_ps(cZ + i);
+        const __m128 extentX = _mm_loadu_ps(eX + i), extentY = _mm_loadu_ps(eY + i), extentZ = _mm_loadu_ps(eZ + i);
+
+        // Overlaps frustum AABB in all axes
+        __m128 inside = _mm_cmple_ps(
+            _mm_andnot_ps(signMask, _mm_sub_ps(centerX, _mm_set1_ps(frustum.centerX))), _mm_add_ps(extentX, _mm_set1_ps(frustum.extentX))
+        );
+        inside = _mm_and_ps(
+            inside,
+            _mm_cmple_ps(
+                _mm_andnot_ps(signMask, _mm_sub_ps(centerY, _mm_set1_ps(frustum.centerY))), _mm_add_ps(extentY, _mm_set1_ps(frustum.extentY))
+            )
+        );
+        inside = _mm_and_ps(
+            inside,
+            _mm_cmple_ps(
+                _mm_andnot_ps(signMask, _mm_sub_ps(centerZ, _mm_set1_ps(frustum.centerZ))), _mm_add_ps(extentZ, _mm_set1_ps(frustum.extentZ))
+            )
+        );
+
+        for (uint32 p = 0; p != FrustumCullingParams::PLANES_COUNT; ++p)
+        {
+            const __m128 centerDist = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(centerX, _mm_set1_ps(frustum.nX[p])), _mm_mul_ps(centerY, _mm_set1_ps(frustum.nY[p]))),
+                _mm_add_ps(_mm_mul_ps(centerZ, _mm_set1_ps(frustum.nZ[p])), _mm_set1_ps(frustum.d[p]))
+            );
+            const __m128 extentDist = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(extentX, _mm_set1_ps(frustum.absNX[p])), _mm_mul_ps(extentY, _mm_set1_ps(frustum.absNY[p]))),
+                _mm_mul_ps(extentZ, _mm_set1_ps(frustum.absNZ[p]))
+            );
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(centerDist, extentDist), zero));
+        }
+        visibleBits |= uint64(_mm_movemask_ps(inside)) << i;
+    }
+#else
+    for (SizeT i = 0; i != VISIBILITY_WORD_BITS; ++i)
+    {
+        bool bInside = Math::abs(cX[i] - frustum.centerX) <= (eX[i] + frustum.extentX)
+                       && Math::abs(cY[i] - frustum.centerY) <= (eY[i] + frustum.extentY)
+                       && Math::abs(cZ[i] - frustum.centerZ) <= (eZ[i] + frustum.extentZ);
+        for (uint32 p = 0; p != FrustumCullingParams::PLANES_COUNT && bInside; ++p)
+        {
+            const float dist = cX[i] * frustum.nX[p] + cY[i] * frustum.nY[p] + cZ[i] * frustum.nZ[p] + frustum.d[p]
+                               + eX[i] * frustum.absNX[p] + eY[i] * frustum.absNY[p] + eZ[i] * frustum.absNZ[p];
+            bInside = dist >= 0;
+        }
+        visibleBits |= uint64(bInside ? 1 : 0) << i;
+    }
+#endif
+    return visibleBits;
+}
+
+void EngineRenderScene::setupCompCulling(SizeT compRenderInfoIdx)
+{
+    // Always keep culling data in multiples of visibility word so that culling never needs to handle partial words
+    const SizeT requiredSize = Math::alignByUnsafe(compsRenderInfo.totalCount(), VISIBILITY_WORD_BITS);
+    if (compsCulling.size() < requiredSize)
+    {
+        compsCulling.centerX.resize(requiredSize, 0.0f);
+        compsCulling.centerY.resize(requiredSize, 0.0f);
+        compsCulling.centerZ.resize(requiredSize, 0.0f);
+        compsCulling.extentX.resize(requiredSize, -std::numeric_limits<float>::max());
+        compsCulling.extentY.resize(requiredSize, -std::numeric_limits<float>::max());
+        compsCulling.extentZ.resize(requiredSize, -std::numeric_limits<float>::max());
+        compsCulling.drawable.resize(requiredSize);
+    }
+    updateCompCullingBound(compRenderInfoIdx);
+    resolveCompDrawable(compRenderInfoIdx);
+}
+
+void EngineRenderScene::clearCompCulling(SizeT compRenderInfoIdx)
+{
+    debugAssert(compRenderInfoIdx < compsCulling.size());
+    compsCulling.centerX[compRenderInfoIdx] = compsCulling.centerY[compRenderInfoIdx] = compsCulling.centerZ[compRenderInfoIdx] = 0.0f;
+    compsCulling.extentX[compRenderInfoIdx] = compsCulling.extentY[compRenderInfoIdx] = compsCulling.extentZ[compRenderInfoIdx]
+        = -std::numeric_limits<float>::max();
+    compsCulling.drawable[compRenderInfoIdx] = false;
+}
+
+void EngineRenderScene::updateCompCullingBound(SizeT compRenderInfoIdx)
+{
+    debugAssert(compRenderInfoIdx < compsCulling.size());
+    const AABB &worldBound = compsRenderInfo[compRenderInfoIdx].worldBound;
+    if (!worldBound.isValidAABB())
+    {
+        // Negative extent fails every test, -max instead of -infinity to avoid NaN when multiplied by 0
+        compsCulling.extentX[compRenderInfoIdx] = compsCulling.extentY[compRenderInfoIdx] = compsCulling.extentZ[compRenderInfoIdx]
+            = -std::numeric_limits<float>::max();
+        return;
+    }
+
+    const Vector3 center = worldBound.center();
+    const Vector3 extent = worldBound.size() * 0.5f;
+    compsCulling.centerX[compRenderInfoIdx] = center.x();
+    compsCulling.centerY[compRenderInfoIdx] = center.y();
+    compsCulling.centerZ[compRenderInfoIdx] = center.z();
+    compsCulling.extentX[compRenderInfoIdx] = extent.x();
+    compsCulling.extentY[compRenderInfoIdx] = extent.y();
+    compsCulling.extentZ[compRenderInfoIdx] = extent.z();
+}
+
+void EngineRenderScene::resolveCompDrawable(SizeT compRenderInfoIdx)
+{
+    // Indices from pending lists might have been removed already
+    if (!compsRenderInfo.isValid(compRenderInfoIdx) || compRenderInfoIdx >= compsCulling.size())
+    {
+        return;
+    }
+
+    ComponentRenderInfo &compRenderInfo = compsRenderInfo[compRenderInfoIdx];
+    auto meshItr = vertexBuffers[compRenderInfo.vertexType].meshes.find(compRenderInfo.meshObjPath);
+    const bool bDrawable = compRenderInfo.tfIndex != 0 && compRenderInfo.materialIndex != 0
+                           && meshItr != vertexBuffers[compRenderInfo.vertexType].meshes.end();
+    compsCulling.drawable[compRenderInfoIdx] = bDrawable;
+    if (!bDrawable)
+    {
+        return;
+    }
+
+    // Mesh views change only when scene vertices are recreated and that resolves all the components again
+    compRenderInfo.meshSortId = meshItr->second.sortId;
+    compRenderInfo.meshIdxOffset = uint32(meshItr->second.idxOffset);
+    compRenderInfo.meshIdxCount = uint32(meshItr->second.idxCount);
+    compRenderInfo.meshVertOffset = uint32(meshItr->second.vertOffset);
+
+    MaterialShaderParams &shaderMats = shaderToMaterials[compRenderInfo.shaderName];
+    if (shaderMats.drawPipelineIdx == ~0u)
+    {
+        // Draw sort key cannot hold more pipelines, Sorting would mix the draw lists of different shaders
+        fatalAssertf(
+            drawPipelineShaders.size() < (1u << DRAW_SHADER_BITS), "Drawable shaders exceeded {} draw pipelines", (1u << DRAW_SHADER_BITS)
+        );
+        shaderMats.drawPipelineIdx = uint32(drawPipelineShaders.size());
+        drawPipelineShaders.emplace_back(compRenderInfo.shaderName);
+    }
+    compRenderInfo.drawPipelineIdx = shaderMats.drawPipelineIdx;
+}
+
 void EngineRenderScene::updateVisibility(const RenderSceneViewParams &viewParams)
 {
     CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("UpdateVisibility"));
 
-    const uint32 totalCompCapacity = uint32(compsRenderInfo.totalCount());
+    const SizeT totalCompCapacity = compsRenderInfo.totalCount();
     compsVisibility.resize(totalCompCapacity);
 
-    compsVisibility.resetRange(0, totalCompCapacity);
-
-    ApplicationInstance *appInstance = IApplicationModule::get()->getApplication();
+    const SizeT wordsCount = (totalCompCapacity + VISIBILITY_WORD_BITS - 1) / VISIBILITY_WORD_BITS;
+    if (wordsCount == 0)
+    {
+        return;
+    }
+    debugAssert(compsCulling.size() >= wordsCount * VISIBILITY_WORD_BITS);
 
-    // Below ds must be either cache line separated boolean or atomic bool to avoid memory stomping
-    // Will be inside frustum only if every other condition to render a mesh is valid
-    std::vector<std::atomic_flag, CBEStlStackAllocatorExclusive<std::atomic_flag>> compsInsideFrustum(
-        totalCompCapacity, appInstance->getRenderFrameAllocator()
-    );
+    if (bCompsDrawableDirty)
+    {
+        CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("ResolveDrawables"));
+        // Pipeline indices are assigned again so that shaders with no drawable components are pruned
+        drawPipelineShaders.clear();
+        for (std::pair<const String, MaterialShaderParams> &shaderMats : shaderToMaterials)
+        {
+            shaderMats.second.drawPipelineIdx = ~0u;
+        }
+        for (SizeT idx = 0; idx != totalCompCapacity; ++idx)
+        {
+            resolveCompDrawable(idx);
+        }
+        bCompsDrawableDirty = false;
+    }
 
+    uint64 *visibilityWords = compsVisibility.data();
+    const uint64 *drawableWords = compsCulling.drawable.data();
+#if DISABLE_PER_FRAME_UPDATE
+    CBEMemory::memCopy(visibilityWords, drawableWords, wordsCount * sizeof(uint64));
+#else
     Vector3 frustumCorners[8];
-    Plane frustumPlanes[6];
+    Plane frustumPlanes[FrustumCullingParams::PLANES_COUNT];
     viewParams.view.frustumCorners(frustumCorners);
     viewParams.view.frustumPlanes(frustumPlanes);
 
+    FrustumCullingParams frustum;
+    for (uint32 p = 0; p != FrustumCullingParams::PLANES_COUNT; ++p)
+    {
+        frustum.nX[p] = frustumPlanes[p].x();
+        frustum.nY[p] = frustumPlanes[p].y();
+        frustum.nZ[p] = frustumPlanes[p].z();
+        frustum.d[p] = frustumPlanes[p].w();
+        frustum.absNX[p] = Math::abs(frustum.nX[p]);
+        frustum.absNY[p] = Math::abs(frustum.nY[p]);
+        frustum.absNZ[p] = Math::abs(frustum.nZ[p]);
+    }
+    const AABB frustumBound{ ArrayView<Vector3>{ frustumCorners } };
+    const Vector3 frustumCenter = frustumBound.center();
+    const Vector3 frustumExtent = frustumBound.size() * 0.5f;
+    frustum.centerX = frustumCenter.x();
+    frustum.centerY = frustumCenter.y();
+    frustum.centerZ = frustumCenter.z();
+    frustum.extentX = frustumExtent.x();
+    frustum.extentY = frustumExtent.y();
+    frustum.extentZ = frustumExtent.z();
+
+    // Each job writes its own visibility words directly, No other synchronization is necessary
+    ApplicationInstance *appInstance = IApplicationModule::get()->getApplication();
     copat::parallelFor(
         appInstance->jobSystem,
         copat::DispatchFunctionType::createLambda(
-            [this, &compsInsideFrustum, &frustumPlanes, &frustumCorners](uint32 idx)
+            [this, &frustum, visibilityWords, drawableWords, wordsCount](uint32 jobIdx)
             {
-                CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("CompVisibility"));
-                if (!compsRenderInfo.isValid(idx))
-                {
-                    return;
-                }
+                CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("CullVisibilityWords"));
 
-                const ComponentRenderInfo &compRenderInfo = compsRenderInfo[idx];
-                if (vertexBuffers[compRenderInfo.vertexType].meshes.contains(compRenderInfo.meshObjPath) && compRenderInfo.tfIndex != 0
-                    && compRenderInfo.materialIndex != 0)
+                const SizeT startWord = jobIdx * VISIBILITY_WORDS_PER_JOB;
+                const SizeT endWord = Math::min(startWord + VISIBILITY_WORDS_PER_JOB, wordsCount);
+                for (SizeT wordIdx = startWord; wordIdx != endWord; ++wordIdx)
                 {
-#if DISABLE_PER_FRAME_UPDATE
-                    compsInsideFrustum[idx].test_and_set(std::memory_order::relaxed);
-                    return;
-#else
-                    if (!compRenderInfo.worldBound.isValidAABB())
-                    {
-                        return;
-                    }
-
-                    Vector3 aabbCorners[8];
-                    compRenderInfo.worldBound.boundCorners(aabbCorners);
-
-                    // Ensure that box is not completely outside all frustum planes,
-                    // Even if all point is outside 1 plane it will be completely out like AABB
-                    for (const Plane &plane : ArrayView<Plane>{ frustumPlanes })
-                    {
-                        uint32 outsideFrustumCount = 0;
-                        for (const Vector3 &corner : ArrayView<Vector3>{ aabbCorners })
-                        {
-                            outsideFrustumCount += (plane | corner) < 0 ? 1 : 0;
-                        }
-                        if (outsideFrustumCount == 8)
-                        {
-                            return;
-                        }
-                    }
-                    // Now make sure that AABB is not passing through the frustum,
-                    // Pass thru happens when any corner pts axial component is inside it corresponding AABB extremes
-                    uint32 outsideExtremeCount[6] = { 0 };
-                    for (const Vector3 &corner : ArrayView<Vector3>{ frustumCorners })
+                    // No need to cull if nothing in this word can be drawn
+                    if (drawableWords[wordIdx] == 0)
                     {
-                        outsideExtremeCount[0] += corner.x() > compRenderInfo.worldBound.maxBound.x() ? 1 : 0;
-                        outsideExtremeCount[1] += corner.x() < compRenderInfo.worldBound.minBound.x() ? 1 : 0;
-
-                        outsideExtremeCount[2] += corner.y() > compRenderInfo.worldBound.maxBound.y() ? 1 : 0;
-                        outsideExtremeCount[3] += corner.y() < compRenderInfo.worldBound.minBound.y() ? 1 : 0;
-
-                        outsideExtremeCount[4] += corner.z() > compRenderInfo.worldBound.maxBound.z() ? 1 : 0;
-                        outsideExtremeCount[5] += corner.z() < compRenderInfo.worldBound.minBound.z() ? 1 : 0;
+                        visibilityWords[wordIdx] = 0;
+                        continue;
                     }
 
-                    if (outsideExtremeCount[0] != 8 && outsideExtremeCount[1] != 8 && outsideExtremeCount[2] != 8 && outsideExtremeCount[3] != 8
-                        && outsideExtremeCount[4] != 8 && outsideExtremeCount[5] != 8)
-                    {
-                        compsInsideFrustum[idx].test_and_set(std::memory_order_relaxed);
-                    }
-                    else
-                    {
-                        compsInsideFrustum[idx].clear(std::memory_order_relaxed);
-                    }
-#endif
+                    const SizeT idx = wordIdx * VISIBILITY_WORD_BITS;
+                    visibilityWords[wordIdx] = drawableWords[wordIdx]
+                                               & cullBoundsWord(
+                                                   &compsCulling.centerX[idx], &compsCulling.centerY[idx], &compsCulling.centerZ[idx],
+                                                   &compsCulling.extentX[idx], &compsCulling.extentY[idx], &compsCulling.extentZ[idx], frustum
+                                               );
                 }
             }
         ),
-        totalCompCapacity
+        uint32((wordsCount + VISIBILITY_WORDS_PER_JOB - 1) / VISIBILITY_WORDS_PER_JOB)
     );
-
-    CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("WriteVisibilityBits"));
-    for (SizeT i = 0; i != totalCompCapacity;)
-    {
-        bool bIsSet = compsInsideFrustum[i].test(std::memory_order::relaxed);
-        SizeT endIdx = i + 1;
-        for (; endIdx != totalCompCapacity; ++endIdx)
-        {
-            if (bIsSet != compsInsideFrustum[endIdx].test(std::memory_order::relaxed))
-            {
-                break;
-            }
-        }
-        if (bIsSet)
-        {
-            compsVisibility.setRange(i, endIdx - i);
-        }
-        else
-        {
-            compsVisibility.resetRange(i, endIdx - i);
-        }
-
-        i = endIdx;
-    }
+#endif
 }
 
 void EngineRenderScene::syncWorldCompsRenderThread(
@@ -1186,6 +1418,7 @@ void EngineRenderScene::syncWorldCompsRenderThread(
                 for (const std::pair<const cbe::ObjectPath, SizeT> &meshToAdd : meshesToAdd)
                 {
                     addMeshRef(EVertexType::Type(vertType), meshToAdd.first, meshToAdd.second);
+                    resolveCompDrawable(meshToAdd.second);
                 }
 
                 bRecreateSceneVerts = bRecreateSceneVerts || !sceneVerts.meshesToAdd.empty();
@@ -1219,6 +1452,7 @@ void EngineRenderScene::syncWorldCompsRenderThread(
                 for (SizeT compIdxToAdd : compsToAdd)
                 {
                     addCompMaterialData(compIdxToAdd);
+                    resolveCompDrawable(compIdxToAdd);
                 }
 
                 bRecreateMaterials = bRecreateMaterials || !shaderMats.second.compIdxToAdd.empty();
@@ -1253,6 +1487,7 @@ void EngineRenderScene::syncWorldCompsRenderThread(
                 for (SizeT compIdxToAdd : compsToAdd)
                 {
                     addCompInstanceData(compIdxToAdd);
+                    resolveCompDrawable(compIdxToAdd);
                 }
 
                 bRecreateInstanceData = bRecreateInstanceData || !instanceParams.compIdxToAdd.empty();
@@ -1449,8 +1684,17 @@ copat::JobSystemFuncAwaiter EngineRenderScene::recreateSceneVertexBuffers(
             }
         }
         sceneVerts.meshes = std::move(newSceneVerts.meshes);
+
+        // All meshes are new views so sort ids are packed again, Every component is resolved again below
+        sceneVerts.freeMeshSortIds.clear();
+        sceneVerts.meshSortIdsCount = 0;
+        for (std::pair<const cbe::ObjectPath, MeshVertexView> &meshViewPair : sceneVerts.meshes)
+        {
+            meshViewPair.second.sortId = sceneVerts.meshSortIdsCount++;
+        }
     }
 
+    bCompsDrawableDirty = true;
     bVertexUpdating = false;
 }
 
@@ -1602,6 +1846,7 @@ copat::JobSystemFuncAwaiter EngineRenderScene::recreateMaterialBuffers(
         }
     }
 
+    bCompsDrawableDirty = true;
     bMaterialsUpdating = false;
 }
 
@@ -1736,9 +1981,212 @@ copat::JobSystemFuncAwaiter EngineRenderScene::recreateInstanceBuffers(
         }
     }
 
+    bCompsDrawableDirty = true;
     bInstanceParamsUpdating = false;
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// Draw list sorting
+//////////////////////////////////////////////////////////////////////////
+
+// Visibility words whose sort keys are computed by a single job
+constexpr static const SizeT DRAW_KEY_WORDS_PER_JOB = 64;
+
+constexpr static const uint32 RADIX_DIGIT_BITS = 8;
+constexpr static const uint32 RADIX_DIGITS_COUNT = 1u << RADIX_DIGIT_BITS;
+// Keys sorted by a single job in each radix pass, Below this the histogram and scatter jobs cost more than they save
+constexpr static const uint32 RADIX_MIN_KEYS_PER_JOB = 4096;
+
+FORCE_INLINE uint64 drawSortKey(EDrawListOrder::Type order, const ComponentRenderInfo &compRenderInfo, float sqrDistance)
+{
+    // Checked when the pipeline index is assigned
+    debugAssert(compRenderInfo.drawPipelineIdx < (1u << DRAW_SHADER_BITS));
+    const uint64 pipeline = (uint64(compRenderInfo.drawPipelineIdx) << DRAW_VERTEX_TYPE_BITS) | uint64(compRenderInfo.vertexType);
+    const uint64 material = uint64(compRenderInfo.materialIndex) & DRAW_MATERIAL_MASK;
+    // Sort ids are dense so they overflow only if a vertex type has more meshes than mesh bits can hold,
+    // Overflowing meshes share the last id which only loses grouping and not the draws
+    const uint64 mesh = Math::min(uint64(compRenderInfo.meshSortId), DRAW_MESH_MASK);
+    // Bits of a positive float increases with its value, So top bits are a logarithmically quantized depth.
+    // Keeps 8 exponent bits and 12 mantissa bits
+    const uint64 depth = uint64(std::bit_cast<uint32>(sqrDistance) >> (31 - DRAW_DEPTH_BITS));
+
+    if (order == EDrawListOrder::BackToFront)
+    {
+        // Inverted depth sorts farthest first in the same ascending radix sort
+        return (pipeline << DRAW_PIPELINE_SHIFT) | ((DRAW_DEPTH_MASK - depth) << (DRAW_MATERIAL_BITS + DRAW_MESH_BITS))
+               | (material << DRAW_MESH_BITS) | mesh;
+    }
+    return (pipeline << DRAW_PIPELINE_SHIFT) | (material << (DRAW_MESH_BITS + DRAW_DEPTH_BITS)) | (mesh << DRAW_DEPTH_BITS) | depth;
+}
+
+/**
+ * Stable LSD radix sort of keys along with its values, Sorts RADIX_DIGIT_BITS per pass and skips the digits that are same in all keys.
+ * Each pass counts digits per job's range of keys and scatters them to offsets computed from all jobs' counts.
+ * Sorted result will be in keys and values, temp buffers must have count elements.
+ */
+template <typename ValueType>
+void parallelRadixSort(copat::JobSystem *jobSystem, uint64 *keys, ValueType *values, uint64 *tempKeys, ValueType *tempValues, uint32 count)
+{
+    CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("RadixSort"));
+
+    uint64 diffBits = 0;
+    for (uint32 i = 1; i < count; ++i)
+    {
+        diffBits |= keys[i] ^ keys[0];
+    }
+    if (diffBits == 0)
+    {
+        return;
+    }
+
+    const uint32 jobsCount = Math::clamp(count / RADIX_MIN_KEYS_PER_JOB, 1u, jobSystem->getWorkersCount() + 1);
+    const uint32 keysPerJob = (count + jobsCount - 1) / jobsCount;
+    // Digit counts of each job, Turned into the scatter offsets in place
+    std::vector<uint32> jobsDigitOffsets(jobsCount * RADIX_DIGITS_COUNT);
+
+    uint64 *srcKeys = keys, *dstKeys = tempKeys;
+    ValueType *srcValues = values, *dstValues = tempValues;
+    uint32 digitShift = 0;
+    auto countDigits = [&](uint32 jobIdx)
+    {
+        uint32 *digitCounts = &jobsDigitOffsets[jobIdx * RADIX_DIGITS_COUNT];
+        std::fill(digitCounts, digitCounts + RADIX_DIGITS_COUNT, 0);
+
+        const uint32 endIdx = Math::min(jobIdx * keysPerJob + keysPerJob, count);
+        for (uint32 i = jobIdx * keysPerJob; i < endIdx; ++i)
+        {
+            ++digitCounts[(srcKeys[i] >> digitShift) & (RADIX_DIGITS_COUNT - 1)];
+        }
+    };
+    auto scatterDigits = [&](uint32 jobIdx)
+    {
+        uint32 *digitOffsets = &jobsDigitOffsets[jobIdx * RADIX_DIGITS_COUNT];
+
+        const uint32 endIdx = Math::min(jobIdx * keysPerJob + keysPerJob, count);
+        for (uint32 i = jobIdx * keysPerJob; i < endIdx; ++i)
+        {
+            const uint32 dstIdx = digitOffsets[(srcKeys[i] >> digitShift) & (RADIX_DIGITS_COUNT - 1)]++;
+            dstKeys[dstIdx] = srcKeys[i];
+            dstValues[dstIdx] = srcValues[i];
+        }
+    };
+
+    for (; digitShift < 64; digitShift += RADIX_DIGIT_BITS)
+    {
+        if (((diffBits >> digitShift) & (RADIX_DIGITS_COUNT - 1)) == 0)
+        {
+            continue;
+        }
+
+        if (jobsCount == 1)
+        {
+            countDigits(0);
+        }
+        else
+        {
+            copat::parallelFor(jobSystem, copat::DispatchFunctionType::createLambda(countDigits), jobsCount);
+        }
+
+        // Offsets in digit then job order keeps the sort stable
+        uint32 offset = 0;
+        for (uint32 digit = 0; digit != RADIX_DIGITS_COUNT; ++digit)
+        {
+            for (uint32 jobIdx = 0; jobIdx != jobsCount; ++jobIdx)
+            {
+                const uint32 digitCount = jobsDigitOffsets[jobIdx * RADIX_DIGITS_COUNT + digit];
+                jobsDigitOffsets[jobIdx * RADIX_DIGITS_COUNT + digit] = offset;
+                offset += digitCount;
+            }
+        }
+
+        if (jobsCount == 1)
+        {
+            scatterDigits(0);
+        }
+        else
+        {
+            copat::parallelFor(jobSystem, copat::DispatchFunctionType::createLambda(scatterDigits), jobsCount);
+        }
+
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcValues, dstValues);
+    }
+
+    // Odd number of passes leaves the sorted result in temp buffers
+    if (srcKeys != keys)
+    {
+        CBEMemory::memCopy(keys, srcKeys, count * sizeof(uint64));
+        CBEMemory::memCopy(values, srcValues, count * sizeof(ValueType));
+    }
+}
+
+void EngineRenderScene::sortVisibleComponents(
+    const RenderSceneViewParams &viewParams, EDrawListOrder::Type order, std::vector<uint32> &outCompIdxs
+) const
+{
+    CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("SortVisibleComponents"));
+
+    ApplicationInstance *appInstance = IApplicationModule::get()->getApplication();
+    StackAllocator<EThreadSharing::ThreadSharing_Exclusive> &frameAllocator = appInstance->getRenderFrameAllocator();
+
+    const uint64 *visibilityWords = compsVisibility.data();
+    const SizeT wordsCount = (compsVisibility.size() + VISIBILITY_WORD_BITS - 1) / VISIBILITY_WORD_BITS;
+    const uint32 jobsCount = uint32((wordsCount + DRAW_KEY_WORDS_PER_JOB - 1) / DRAW_KEY_WORDS_PER_JOB);
+
+    // Visible components before each job's words, So each job can write its keys without any synchronization
+    std::vector<uint32, CBEStlStackAllocatorExclusive<uint32>> jobsOutOffset(jobsCount, frameAllocator);
+    uint32 visibleCount = 0;
+    for (uint32 jobIdx = 0; jobIdx != jobsCount; ++jobIdx)
+    {
+        jobsOutOffset[jobIdx] = visibleCount;
+        const SizeT endWord = Math::min((jobIdx + 1) * DRAW_KEY_WORDS_PER_JOB, wordsCount);
+        for (SizeT wordIdx = jobIdx * DRAW_KEY_WORDS_PER_JOB; wordIdx != endWord; ++wordIdx)
+        {
+            visibleCount += uint32(std::popcount(visibilityWords[wordIdx]));
+        }
+    }
+
+    outCompIdxs.resize(visibleCount);
+    if (visibleCount == 0)
+    {
+        return;
+    }
+
+    std::vector<uint64, CBEStlStackAllocatorExclusive<uint64>> sortKeys(visibleCount, frameAllocator);
+    uint64 *keys = sortKeys.data();
+    uint32 *compIdxs = outCompIdxs.data();
+    const Vector3 viewLocation = viewParams.view.translation();
+    copat::parallelFor(
+        appInstance->jobSystem,
+        copat::DispatchFunctionType::createLambda(
+            [this, order, &viewLocation, &jobsOutOffset, visibilityWords, wordsCount, keys, compIdxs](uint32 jobIdx)
+            {
+                CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("ComputeDrawSortKeys"));
+
+                uint32 outIdx = jobsOutOffset[jobIdx];
+                const SizeT endWord = Math::min((jobIdx + 1) * DRAW_KEY_WORDS_PER_JOB, wordsCount);
+                for (SizeT wordIdx = jobIdx * DRAW_KEY_WORDS_PER_JOB; wordIdx != endWord; ++wordIdx)
+                {
+                    for (uint64 bits = visibilityWords[wordIdx]; bits != 0; bits &= bits - 1)
+                    {
+                        const SizeT compIdx = wordIdx * VISIBILITY_WORD_BITS + std::countr_zero(bits);
+                        const ComponentRenderInfo &compRenderInfo = compsRenderInfo[compIdx];
+
+                        keys[outIdx] = drawSortKey(order, compRenderInfo, (compRenderInfo.worldTf.getTranslation() - viewLocation).sqrlength());
+                        compIdxs[outIdx] = uint32(compIdx);
+                        ++outIdx;
+                    }
+                }
+            }
+        ),
+        jobsCount
+    );
+
+    std::vector<uint64, CBEStlStackAllocatorExclusive<uint64>> tempKeys(visibleCount, frameAllocator);
+    std::vector<uint32, CBEStlStackAllocatorExclusive<uint32>> tempCompIdxs(visibleCount, frameAllocator);
+    parallelRadixSort(appInstance->jobSystem, keys, compIdxs, tempKeys.data(), tempCompIdxs.data(), visibleCount);
+}
+
 void EngineRenderScene::createNextDrawList(
     const RenderSceneViewParams &viewParams, IRenderCommandList *, IGraphicsInstance *graphicsInstance, const GraphicsHelperAPI *graphicsHelper
 )
@@ -1753,8 +2201,6 @@ void EngineRenderScene::createNextDrawList(
     }
 #endif
 
-    const SizeT totalCompCapacity = compsRenderInfo.totalCount();
-
     for (std::pair<const String, MaterialShaderParams> &shaderMats : shaderToMaterials)
     {
         for (uint32 vertType = EVertexType::TypeStart; vertType != EVertexType::TypeEnd; ++vertType)
@@ -1765,19 +2211,11 @@ void EngineRenderScene::createNextDrawList(
         }
     }
 
-    std::vector<SizeT> compIndices;
+    std::vector<uint32> compIndices;
     {
         CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("SetupVisibleComponents"));
 
-        compIndices.reserve(compsVisibility.countOnes());
-        for (SizeT i = 0; i != totalCompCapacity; ++i)
-        {
-            if (!compsVisibility[i])
-            {
-                continue;
-            }
-            compIndices.emplace_back(i);
-        }
+        sortVisibleComponents(viewParams, GBUFFER_DRAW_ORDER, compIndices);
 
 #if DISABLE_PER_FRAME_UPDATE
         if (bInstanceParamsUpdating || bVertexUpdating)
@@ -1790,36 +2228,45 @@ void EngineRenderScene::createNextDrawList(
             testCounter++;
         }
 #endif
-
-        std::sort(
-            compIndices.begin(), compIndices.end(),
-            [this, &viewParams](SizeT lhs, SizeT rhs)
-            {
-                return (compsRenderInfo[lhs].worldTf.getTranslation() - viewParams.view.translation()).sqrlength()
-                       < (compsRenderInfo[rhs].worldTf.getTranslation() - viewParams.view.translation()).sqrlength();
-            }
-        );
     }
     // Push to cpu draw list buffer
     {
         CBE_PROFILER_SCOPE(CBE_PROFILER_CHAR("WriteDrawListBufferCPU"));
-        for (SizeT compIdx : compIndices)
+
+        std::vector<DrawIndexedIndirectCommand> *cpuDrawList = nullptr;
+        uint32 drawPipelineIdx = ~0u;
+        EVertexType::Type drawVertexType = EVertexType::NoVertex;
+        for (uint32 compIdx : compIndices)
         {
             const ComponentRenderInfo &compRenderInfo = compsRenderInfo[compIdx];
-            debugAssert(
-                compRenderInfo.meshObjPath.isValid() && vertexBuffers[compRenderInfo.vertexType].meshes.contains(compRenderInfo.meshObjPath)
-                && compRenderInfo.materialIndex != 0 && compRenderInfo.tfIndex != 0
-            );
+            debugAssert(compsCulling.drawable[compIdx] && compRenderInfo.materialIndex != 0 && compRenderInfo.tfIndex != 0);
 
-            MaterialShaderParams &shaderMats = shaderToMaterials[compRenderInfo.shaderName];
-            const MeshVertexView &meshView = vertexBuffers[compRenderInfo.vertexType].meshes[compRenderInfo.meshObjPath];
-            DrawIndexedIndirectCommand indexedIndirectDraw{ .indexCount = uint32(meshView.idxCount),
-                                                            .instanceCount = 1,
-                                                            .firstIndex = uint32(meshView.idxOffset),
-                                                            .vertexOffset = int32(meshView.vertOffset),
-                                                            .firstInstance = uint32(instanceIdxToVectorIdx(compRenderInfo.tfIndex)) };
+            // Components of a pipeline are continuous after sorting, So the draw list is found once per pipeline
+            if (drawPipelineIdx != compRenderInfo.drawPipelineIdx || drawVertexType != compRenderInfo.vertexType)
+            {
+                drawPipelineIdx = compRenderInfo.drawPipelineIdx;
+                drawVertexType = compRenderInfo.vertexType;
+                cpuDrawList = &shaderToMaterials[drawPipelineShaders[drawPipelineIdx]].cpuDrawListPerVertType[drawVertexType];
+            }
 
-            shaderMats.cpuDrawListPerVertType[compRenderInfo.vertexType].emplace_back(std::move(indexedIndirectDraw));
+            // Same mesh drawn with continuous instances are merged into single instanced draw
+            const uint32 instanceIdx = uint32(instanceIdxToVectorIdx(compRenderInfo.tfIndex));
+            if (!cpuDrawList->empty())
+            {
+                DrawIndexedIndirectCommand &lastDraw = cpuDrawList->back();
+                if (lastDraw.firstIndex == compRenderInfo.meshIdxOffset && lastDraw.indexCount == compRenderInfo.meshIdxCount
+                    && lastDraw.vertexOffset == int32(compRenderInfo.meshVertOffset)
+                    && lastDraw.firstInstance + lastDraw.instanceCount == instanceIdx)
+                {
+                    lastDraw.instanceCount++;
+                    continue;
+                }
+            }
+            cpuDrawList->emplace_back(DrawIndexedIndirectCommand{ .indexCount = compRenderInfo.meshIdxCount,
+                                                                  .instanceCount = 1,
+                                                                  .firstIndex = compRenderInfo.meshIdxOffset,
+                                                                  .vertexOffset = int32(compRenderInfo.meshVertOffset),
+                                                                  .firstInstance = instanceIdx });
         }
     }
 
@@ -141,8 +141,26 @@ struct ComponentRenderInfo
 
     // Will be same as one mapped in componentToRenderInfo
     cbe::ObjectPath compObjPath;
+
+    // Below are cached when the component becomes drawable so that draw lists need not look up shader and mesh every frame
+    uint32 drawPipelineIdx = 0;
+    uint32 meshSortId = 0;
+    uint32 meshIdxOffset = 0;
+    uint32 meshIdxCount = 0;
+    uint32 meshVertOffset = 0;
 };
 
+namespace EDrawListOrder
+{
+enum Type
+{
+    // Sorted by pipeline, material and mesh then nearest first, For opaque passes where fewer state changes and early depth rejection matters
+    FrontToBack,
+    // Sorted by pipeline then farthest first, For blended passes that needs the draws to be in order
+    BackToFront
+};
+} // namespace EDrawListOrder
+
 struct RenderSceneViewParams
 {
     Camera view;
@@ -157,6 +175,7 @@ class EngineRenderScene
 private:
     constexpr static const uint32 BUFFER_COUNT = 2;
     constexpr static const uint32 VERTEX_TYPE_COUNT = EVertexType::TypeEnd - EVertexType::TypeStart;
+    constexpr static const EDrawListOrder::Type GBUFFER_DRAW_ORDER = EDrawListOrder::FrontToBack;
 
     using RenderInfoVector = SparseVector<ComponentRenderInfo, BitArraySparsityPolicy>;
     static_assert(std::is_same_v<RenderInfoVector::size_type, SizeT>, "Component index type mismatch");
@@ -171,6 +190,8 @@ private:
         SizeT idxCount = 0;
 
         SizeT refs = 0;
+        // Dense id of this mesh among meshes of its vertex type, Draw sort keys stores this instead of the sparse index offset
+        uint32 sortId = 0;
     };
     struct VerticesPerVertType
     {
@@ -180,6 +201,9 @@ private:
         FreeListAllocTracker<1> vertsAllocTracker;
         FreeListAllocTracker<1> idxsAllocTracker;
         std::unordered_map<cbe::ObjectPath, MeshVertexView> meshes;
+        // Sort ids of removed meshes are reused so that ids stay below meshes count
+        std::vector<uint32> freeMeshSortIds;
+        uint32 meshSortIdsCount = 0;
 
         // List of meshes and Component render info index to add for first time
         std::vector<std::pair<cbe::ObjectPath, SizeT>> meshesToAdd;
@@ -227,6 +251,27 @@ private:
         std::vector<BatchCopyBufferInfo> materialCopies;
         std::vector<BatchCopyBufferData> hostToMatCopies;
         bool bMatsCopied = false;
+
+        // Index into drawPipelineShaders, Assigned when first component using this shader becomes drawable
+        uint32 drawPipelineIdx = ~0u;
+    };
+    /**
+     * Frustum culling data in SoA layout indexed by component render info index.
+     * Sized in multiples of visibility word bits so that a whole word of visibility bits can be culled at once.
+     */
+    struct CompsCullingData
+    {
+        // World bound's center and half extent, Empty slots and invalid bounds have negative extent so that they are always culled
+        std::vector<float> centerX;
+        std::vector<float> centerY;
+        std::vector<float> centerZ;
+        std::vector<float> extentX;
+        std::vector<float> extentY;
+        std::vector<float> extentZ;
+        // Component's mesh vertices, instance and material are resolved and it can be drawn when inside frustum
+        BitArray<uint64> drawable;
+
+        SizeT size() const { return centerX.size(); }
     };
 
     uint64 frameCount = 0;
@@ -234,6 +279,9 @@ private:
     cbe::ObjectPath world;
     RenderInfoVector compsRenderInfo;
     BitArray<uint64> compsVisibility;
+    CompsCullingData compsCulling;
+    // Set when async buffer recreation resolved meshes, materials or instances and drawable bits must be resolved again for all components
+    bool bCompsDrawableDirty = false;
     std::unordered_map<cbe::ObjectPath, SizeT> componentToRenderInfo;
     ComponentRenderSyncInfo componentUpdates;
 
@@ -246,6 +294,8 @@ private:
 
     bool bMaterialsUpdating = false;
     std::unordered_map<String, MaterialShaderParams> shaderToMaterials;
+    // Shader names of each draw pipeline index, Draw sort keys stores this index instead of the shader name
+    std::vector<String> drawPipelineShaders;
 
     bool bInstanceParamsUpdating = false;
     InstanceParamsPerVertType instancesData[VERTEX_TYPE_COUNT];
@@ -317,6 +367,13 @@ private:
     void createRenderInfo(cbe::RenderableComponent *comp, SizeT compRenderInfoIdx);
     void destroyRenderInfo(const cbe::RenderableComponent *comp, SizeT compRenderInfoIdx);
 
+    // Updates culling bound and drawable bit of the component, Must be called after component's render info and mesh ref is setup
+    void setupCompCulling(SizeT compRenderInfoIdx);
+    void clearCompCulling(SizeT compRenderInfoIdx);
+    void updateCompCullingBound(SizeT compRenderInfoIdx);
+    // Checks if mesh, instance and material of the component are ready to be drawn. Resolved once when any of those changes
+    void resolveCompDrawable(SizeT compRenderInfoIdx);
+
     void syncWorldCompsRenderThread(
         const ComponentRenderSyncInfo &compsUpdate, IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance,
         const GraphicsHelperAPI *graphicsHelper
@@ -332,6 +389,11 @@ private:
         const RenderSceneViewParams &viewParams, IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance,
         const GraphicsHelperAPI *graphicsHelper
     );
+    /**
+     * Fills outCompIdxs with visible component indices sorted by the draw sort key for the order.
+     * Sort key packs pipeline(shader and vertex type), material, mesh and quantized depth from view and is computed once per component
+     */
+    void sortVisibleComponents(const RenderSceneViewParams &viewParams, EDrawListOrder::Type order, std::vector<uint32> &outCompIdxs) const;
     void performTransferCopies(IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance, const GraphicsHelperAPI *graphicsHelper);
 
     void updateVisibility(const RenderSceneViewParams &viewParams);
@@ -15,6 +15,14 @@
 #include "RenderInterface/GraphicsHelper.h"
 #include "RenderInterface/Rendering/IRenderCommandList.h"
 
+// Vertex arrays are serialized as a single block of floats
+template <>
+struct ArchiveBulkSerializable<StaticMeshVertex> : public std::true_type
+{
+    using ComponentType = float;
+};
+static_assert(sizeof(StaticMeshVertex) == 12 * sizeof(float), "StaticMeshVertex must be packed floats to be serialized as block");
+
 template <ArchiveTypeName ArchiveType>
 ArchiveType &operator<< (ArchiveType &archive, cbe::SMBatchView &value)
 {
@@ -150,18 +158,24 @@ ObjectArchive &StaticMesh::serialize(ObjectArchive &ar)
     {
         fatalAssert(indexCpuView.ptr() != nullptr && vertexCpuView.ptr() != nullptr);
         // Serialize in same way std::vector will be serialized
-        SizeT len = vertexCpuView.size();
-        ar << len;
-        for (StaticMeshVertex &vert : vertexCpuView)
+        SizeT verticesCount = vertexCpuView.size();
+        ar << verticesCount;
+        if (!serializeArchiveBlock(ar, vertexCpuView.data(), verticesCount))
         {
-            ar << vert;
+            for (StaticMeshVertex &vert : vertexCpuView)
+            {
+                ar << vert;
+            }
         }
 
-        SizeT len = indexCpuView.size();
-        ar << len;
-        for (uint32 &idx : indexCpuView)
+        SizeT indicesCount = indexCpuView.size();
+        ar << indicesCount;
+        if (!serializeArchiveBlock(ar, indexCpuView.data(), indicesCount))
         {
-            ar << idx;
+            for (uint32 &idx : indexCpuView)
+            {
+                ar << idx;
+            }
         }
     }
 #endif
@@ -20,6 +20,11 @@
 #include "CBEObjectHelpers.h"
 #include "Components/ComponentBase.h"
 #include "Memory/StackAllocator.h"
+#include "Math/BatchTransform.h"
+#include "Types/Platform/Threading/CoPaT/JobSystem.h"
+#include "Types/Platform/Threading/CoPaT/DispatchHelpers.h"
+
+#include <bit>
 
 namespace cbe
 {
@@ -100,54 +105,12 @@ ObjectArchive &World::serialize(ObjectArchive &ar)
 void World::tfCompTransformed(TransformComponent *tfComponent)
 {
     debugAssert(EWorldState::isPreparedState(getState()));
-    CBE_PROFILER_SCOPE("TfCompTransformed");
-
-    std::vector<TransformComponent *> transformedComps;
-    std::vector<TransformLeafComponent *> transformedLeaves;
 
     auto attachedToItr = compToTf.find(tfComponent);
     if (attachedToItr != compToTf.cend())
     {
-        TFHierarchyIdx attachedToIdx = attachedToItr->second;
-        debugAssert(txHierarchy.isValid(attachedToIdx));
-
-        std::vector<TFHierarchyIdx> idxsToUpdate;
-        idxsToUpdate.emplace_back(attachedToIdx);
-        txHierarchy.getChildren(idxsToUpdate, attachedToIdx, true);
-        updateWorldTf(idxsToUpdate);
-
-        // Add the components to broadcast event
-        transformedComps.reserve(idxsToUpdate.size());
-        for (TFHierarchyIdx tfIdx : idxsToUpdate)
-        {
-            TransformComponent *tfComp = txHierarchy[tfIdx].component;
-            WACHelpers::getComponentLeafs(tfComp, transformedLeaves);
-            transformedComps.emplace_back(tfComp);
-        }
-    }
-
-    // Broadcast events
-    std::erase_if(
-        transformedComps,
-        [this](TransformComponent *comp)
-        {
-            return !dirtyTfComps.insert(comp).second;
-        }
-    );
-    std::erase_if(
-        transformedLeaves,
-        [this](TransformLeafComponent *comp)
-        {
-            return !dirtyLeafComps.insert(comp).second;
-        }
-    );
-    if (!transformedComps.empty())
-    {
-        broadcastTfCompTransformed(transformedComps);
-    }
-    if (!transformedLeaves.empty())
-    {
-        broadcastLeafTransformed(transformedLeaves);
+        debugAssert(txHierarchy.isValid(attachedToItr->second));
+        markTfDirty(attachedToItr->second);
     }
 }
 
@@ -190,14 +153,17 @@ void World::tfComponentAdded(Actor * /*actor*/, TransformComponent *tfComponent)
         auto parentWorldTfItr = compToTf.find(attachedToTf);
         debugAssert(parentWorldTfItr != compToTf.end());
 
-        compToTf[tfComponent] = txHierarchy.add(
-            ComponentWorldTF{ tfComponent, txHierarchy[parentWorldTfItr->second].worldTx.transform(tfComponent->getRelativeTransform()) },
-            parentWorldTfItr->second
+        TFHierarchyIdx compTfIdx = txHierarchy.add(
+            ComponentWorldTF{ tfComponent, getWorldTf(attachedToTf).transform(tfComponent->getRelativeTransform()) }, parentWorldTfItr->second
         );
+        compToTf[tfComponent] = compTfIdx;
+        resetTfDirty(compTfIdx);
     }
     else
     {
-        compToTf[tfComponent] = txHierarchy.add(ComponentWorldTF{ tfComponent, tfComponent->getRelativeTransform() });
+        TFHierarchyIdx compTfIdx = txHierarchy.add(ComponentWorldTF{ tfComponent, tfComponent->getRelativeTransform() });
+        compToTf[tfComponent] = compTfIdx;
+        resetTfDirty(compTfIdx);
     }
     broadcastTfCompAdded(tfComponent);
 }
@@ -464,16 +430,47 @@ bool World::hasWorldTf(const TransformComponent *component) const
     return false;
 }
 
-const Transform3D &World::getWorldTf(const TransformComponent *component) const
+Transform3D World::getWorldTf(const TransformComponent *component) const
 {
     debugAssert(EWorldState::isPreparedState(worldState));
 
     auto compWorldTfItr = compToTf.find(component);
-    if (compWorldTfItr != compToTf.end())
+    if (compWorldTfItr == compToTf.end())
+    {
+        return component->getRelativeTransform();
+    }
+    if (!bHasDirtyTfs)
+    {
+        return txHierarchy[compWorldTfItr->second].worldTx;
+    }
+
+    // Find the highest dirty node in this branch, Everything above it is up to date
+    TFHierarchyIdx dirtyIdx = FlatTree<ComponentWorldTF, TFHierarchyIdx>::InvalidIdx;
+    for (TFHierarchyIdx idx = compWorldTfItr->second; txHierarchy.isValid(idx); idx = txHierarchy.getNode(idx).parent)
+    {
+        if (dirtyTfIdxs[idx])
+        {
+            dirtyIdx = idx;
+        }
+    }
+    if (!txHierarchy.isValid(dirtyIdx))
     {
         return txHierarchy[compWorldTfItr->second].worldTx;
     }
-    return component->getRelativeTransform();
+
+    // Peel the relative transforms from this node up to the dirty node and apply it on top of dirty node's parent
+    Transform3D worldTf = component->getRelativeTransform();
+    for (TFHierarchyIdx idx = compWorldTfItr->second; idx != dirtyIdx;)
+    {
+        idx = txHierarchy.getNode(idx).parent;
+        worldTf = txHierarchy[idx].component->getRelativeTransform().transform(worldTf);
+    }
+    TFHierarchyIdx cleanParentIdx = txHierarchy.getNode(dirtyIdx).parent;
+    if (txHierarchy.isValid(cleanParentIdx))
+    {
+        worldTf = txHierarchy[cleanParentIdx].worldTx.transform(worldTf);
+    }
+    return worldTf;
 }
 
 TransformComponent *World::getComponentAttachedTo(const TransformComponent *component) const
@@ -570,17 +567,41 @@ void World::finishSpawning(Actor *actor)
 
 void World::updateWorldTf(const std::vector<TFHierarchyIdx> &idxsToUpdate)
 {
-    for (TFHierarchyIdx idx : idxsToUpdate)
+    // getChildren() lists siblings together after their parent, So each run of same parent is transformed as one batch
+    std::vector<Transform3D> relativeTfs;
+    std::vector<Transform3D> worldTfs;
+    SizeT runStart = 0;
+    while (runStart < idxsToUpdate.size())
     {
-        TFHierarchyIdx parentIdx = txHierarchy.getNode(idx).parent;
+        const TFHierarchyIdx parentIdx = txHierarchy.getNode(idxsToUpdate[runStart]).parent;
+        SizeT runEnd = runStart + 1;
+        while (runEnd < idxsToUpdate.size() && txHierarchy.getNode(idxsToUpdate[runEnd]).parent == parentIdx)
+        {
+            ++runEnd;
+        }
+
         if (txHierarchy.isValid(parentIdx))
         {
-            txHierarchy[idx].worldTx = txHierarchy[parentIdx].worldTx.transform(txHierarchy[idx].component->getRelativeTransform());
+            relativeTfs.clear();
+            for (SizeT i = runStart; i < runEnd; ++i)
+            {
+                relativeTfs.emplace_back(txHierarchy[idxsToUpdate[i]].component->getRelativeTransform());
+            }
+            worldTfs.resize(relativeTfs.size());
+            BatchTransform::transform(worldTfs, txHierarchy[parentIdx].worldTx, relativeTfs);
+            for (SizeT i = runStart; i < runEnd; ++i)
+            {
+                txHierarchy[idxsToUpdate[i]].worldTx = worldTfs[i - runStart];
+            }
         }
         else
         {
-            txHierarchy[idx].worldTx = txHierarchy[idx].component->getRelativeTransform();
+            for (SizeT i = runStart; i < runEnd; ++i)
+            {
+                txHierarchy[idxsToUpdate[i]].worldTx = txHierarchy[idxsToUpdate[i]].component->getRelativeTransform();
+            }
         }
+        runStart = runEnd;
     }
 }
 
@@ -610,8 +631,105 @@ void World::prepareForPlay()
 
 void World::commitDirtyComponents()
 {
-    dirtyLeafComps.clear();
-    dirtyTfComps.clear();
+    if (!bHasDirtyTfs)
+    {
+        return;
+    }
+    CBE_PROFILER_SCOPE("CommitWorldTransforms");
+
+    // Find the highest dirty node of each dirty branch, Dirty nodes under another dirty node gets updated along with the parent
+    std::vector<TFHierarchyIdx> dirtyBranches;
+    const uint64 *dirtyWords = dirtyTfIdxs.data();
+    const SizeT dirtyWordsCount = (dirtyTfIdxs.size() + 63) / 64;
+    for (SizeT wordIdx = 0; wordIdx < dirtyWordsCount; ++wordIdx)
+    {
+        uint64 dirtyWord = dirtyWords[wordIdx];
+        while (dirtyWord != 0)
+        {
+            const TFHierarchyIdx dirtyIdx = wordIdx * 64 + std::countr_zero(dirtyWord);
+            dirtyWord &= dirtyWord - 1;
+
+            if (!txHierarchy.isValid(dirtyIdx))
+            {
+                continue;
+            }
+            bool bParentDirty = false;
+            for (TFHierarchyIdx parentIdx = txHierarchy.getNode(dirtyIdx).parent; txHierarchy.isValid(parentIdx) && !bParentDirty;
+                 parentIdx = txHierarchy.getNode(parentIdx).parent)
+            {
+                bParentDirty = dirtyTfIdxs[parentIdx];
+            }
+            if (!bParentDirty)
+            {
+                dirtyBranches.emplace_back(dirtyIdx);
+            }
+        }
+    }
+    dirtyTfIdxs.resetRange(0, dirtyTfIdxs.size());
+    bHasDirtyTfs = false;
+
+    // Each branch only writes its own nodes and reads its clean parent so branches can be updated in parallel
+    auto updateBranch = [this, &dirtyBranches](uint32 branchIdx) -> std::vector<TFHierarchyIdx>
+    {
+        std::vector<TFHierarchyIdx> idxsToUpdate;
+        idxsToUpdate.emplace_back(dirtyBranches[branchIdx]);
+        txHierarchy.getChildren(idxsToUpdate, dirtyBranches[branchIdx], true);
+        updateWorldTf(idxsToUpdate);
+        return idxsToUpdate;
+    };
+    std::vector<std::vector<TFHierarchyIdx>> updatedBranches;
+    if (dirtyBranches.size() > 1)
+    {
+        updatedBranches = copat::parallelForReturn(
+            copat::JobSystem::get(), copat::DispatchFunctionTypeWithRet<decltype(updateBranch(0))>::createLambda(std::move(updateBranch)),
+            uint32(dirtyBranches.size())
+        );
+    }
+    else
+    {
+        updatedBranches.emplace_back(updateBranch(0));
+    }
+
+    // Broadcast events, Each node is in only one branch so there is no duplicates
+    std::vector<TransformComponent *> transformedComps;
+    std::vector<TransformLeafComponent *> transformedLeaves;
+    for (const std::vector<TFHierarchyIdx> &branchIdxs : updatedBranches)
+    {
+        transformedComps.reserve(transformedComps.size() + branchIdxs.size());
+        for (TFHierarchyIdx tfIdx : branchIdxs)
+        {
+            TransformComponent *tfComp = txHierarchy[tfIdx].component;
+            WACHelpers::getComponentLeafs(tfComp, transformedLeaves);
+            transformedComps.emplace_back(tfComp);
+        }
+    }
+    if (!transformedComps.empty())
+    {
+        broadcastTfCompTransformed(transformedComps);
+    }
+    if (!transformedLeaves.empty())
+    {
+        broadcastLeafTransformed(transformedLeaves);
+    }
+}
+
+void World::markTfDirty(TFHierarchyIdx idx)
+{
+    if (dirtyTfIdxs.size() <= idx)
+    {
+        dirtyTfIdxs.resize(idx + 1);
+    }
+    dirtyTfIdxs[idx] = true;
+    bHasDirtyTfs = true;
+}
+
+void World::resetTfDirty(TFHierarchyIdx idx)
+{
+    if (dirtyTfIdxs.size() <= idx)
+    {
+        dirtyTfIdxs.resize(idx + 1);
+    }
+    dirtyTfIdxs[idx] = false;
 }
 
 Actor *World::addActor(CBEClass actorClass, StringView actorName, EObjectFlags actorFlags, bool bDelayedInit)
@@ -677,7 +795,9 @@ cbe::Actor *World::setupActorInternal(ActorPrefab *actorPrefab, bool bUpdateTfTr
     // Inserting each TransformComponent into global TF tree
     for (TransformComponent *actorTransformComp : actor->getTransformComponents())
     {
-        compToTf[actorTransformComp] = txHierarchy.add(ComponentWorldTF{ actorTransformComp, actorTransformComp->getRelativeTransform() });
+        TFHierarchyIdx compTfIdx = txHierarchy.add(ComponentWorldTF{ actorTransformComp, actorTransformComp->getRelativeTransform() });
+        compToTf[actorTransformComp] = compTfIdx;
+        resetTfDirty(compTfIdx);
     }
     // Updating its attachments, Reason for separated setup is that transformComps will not be ordered from root to leafs
     for (TransformComponent *actorTransformComp : actor->getTransformComponents())
@@ -692,7 +812,8 @@ cbe::Actor *World::setupActorInternal(ActorPrefab *actorPrefab, bool bUpdateTfTr
             updateTfAttachment(actorTransformComp, actorTransformComp->getAttachedTo(), false);
         }
     }
-    // Now update the world transforms
+    // Update the new actor's world transforms now instead of at commit, Committing would broadcast transformed events for an actor that is
+    // still being setup
     if (bUpdateTfTree)
     {
         CBE_PROFILER_SCOPE("UpdateTfCompTree");
@@ -749,10 +870,7 @@ void World::updateTfAttachment(TransformComponent *attachingComp, TransformCompo
 
     if (bUpdateTfTree)
     {
-        std::vector<TFHierarchyIdx> idxsToUpdate;
-        idxsToUpdate.emplace_back(attachingIdx);
-        txHierarchy.getChildren(idxsToUpdate, attachingIdx, true);
-        updateWorldTf(idxsToUpdate);
+        markTfDirty(attachingIdx);
     }
 }
 
@@ -101,12 +101,12 @@ private:
     META_ANNOTATE(Transient)
     std::set<ActorPrefab *> delayInitPrefabs;
 
-    // TODO(Jeslas) : Clear dirty flags for this components after all system updates, Then remove the Annotation
-    // Components that are either invalidated or transformed
-    META_ANNOTATE(Transient)
-    std::set<TransformComponent *> dirtyTfComps;
-    META_ANNOTATE(Transient)
-    std::set<TransformLeafComponent *> dirtyLeafComps;
+    /**
+     * Nodes in txHierarchy whose world transform and all its children's world transform are outdated, Indexed by TFHierarchyIdx.
+     * World transforms are recomputed once per frame in commitDirtyComponents()
+     */
+    BitArray<uint64> dirtyTfIdxs;
+    bool bHasDirtyTfs = false;
 
     EWorldState::Type worldState;
 
@@ -145,7 +145,8 @@ public:
     bool mergeWorld(World *otherWorld, bool bMoveActors);
 
     bool hasWorldTf(const TransformComponent *component) const;
-    const Transform3D &getWorldTf(const TransformComponent *component) const;
+    // If the world transform is not committed yet, Computes the world transform from the relative transforms of outdated parents
+    Transform3D getWorldTf(const TransformComponent *component) const;
 
     TransformComponent *getComponentAttachedTo(const TransformComponent *component) const;
     void getComponentAttaches(const TransformComponent *component, std::vector<TransformComponent *> &childTfs) const;
@@ -166,7 +167,15 @@ private:
     // Initializes all actor prefab and pushes them to actors list and attaches all linked actors
     void prepareForPlay();
 
+    /**
+     * Recomputes world transforms of all dirty branches in parent before children order, Each branch is computed once and independent
+     * branches are computed in parallel. Broadcasts the transformed components and leaves after that
+     */
     void commitDirtyComponents();
+    // Just marks the node as dirty, World transform gets updated in commitDirtyComponents()
+    void markTfDirty(TFHierarchyIdx idx);
+    // Must be called for every new node in txHierarchy as node indices can be reused
+    void resetTfDirty(TFHierarchyIdx idx);
 
     // bDelayedInit for actor created from class to allow setting up the prefab directly with in the world
     Actor *addActor(CBEClass actorClass, StringView actorName, EObjectFlags actorFlags, bool bDelayedInit);
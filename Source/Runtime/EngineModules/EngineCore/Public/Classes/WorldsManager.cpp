@@ -77,12 +77,23 @@ SharedPtr<EngineRenderScene> WorldsManager::getWorldRenderScene(World *world) co
 void WorldsManager::tickWorlds(float /*deltaTime*/)
 {
     // TODO(Jeslas) : Not sure what to do here yet
-#if EDITOR_BUILD
-    if (renderingWorld && !EWorldState::isPlayState(renderingWorld->getState()))
+
+    // Commit all transforms changed in this frame before rendering the worlds
+    if (renderingWorld && EWorldState::isPreparedState(renderingWorld->getState()))
     {
         renderingWorld->commitDirtyComponents();
     }
-#endif
+    if (playingWorld && playingWorld != renderingWorld && EWorldState::isPreparedState(playingWorld->getState()))
+    {
+        playingWorld->commitDirtyComponents();
+    }
+    for (const std::pair<World *const, WorldInfo> &otherWorld : otherWorlds)
+    {
+        if (EWorldState::isPreparedState(otherWorld.first->getState()))
+        {
+            otherWorld.first->commitDirtyComponents();
+        }
+    }
 }
 
 void WorldsManager::unloadWorld(World *world)
@@ -11,6 +11,7 @@
 
 #include "Components/StaticMeshComponent.h"
 #include "Classes/StaticMesh.h"
+#include "Math/BatchTransform.h"
 #include "EngineRenderScene.h"
 
 namespace cbe
@@ -27,14 +28,7 @@ void StaticMeshComponent::setupRenderInfo(ComponentRenderInfo &compRenderInfo) c
         compRenderInfo.meshObjPath = mesh;
 
         compRenderInfo.worldTf = getWorldTransform();
-        compRenderInfo.worldBound = AABB();
-
-        Vector3 aabbCorners[8];
-        getLocalBound().boundCorners(aabbCorners);
-        for (uint32 i = 0; i != ARRAY_LENGTH(aabbCorners); ++i)
-        {
-            compRenderInfo.worldBound.grow(compRenderInfo.worldTf.transformPoint(aabbCorners[i]));
-        }
+        compRenderInfo.worldBound = BatchTransform::transformAABB(compRenderInfo.worldTf.getTransformMatrix(), getLocalBound());
     }
 }
 
@@ -10,7 +10,9 @@
  */
 
 #include "EngineRendererModule.h"
+#include "CmdLine/CmdLine.h"
 #include "Modules/ModuleManager.h"
+#include "String/StringLiteral.h"
 #include "Types/Platform/PlatformAssertionErrors.h"
 #include "Types/Platform/Threading/CoPaT/JobSystem.h"
 #include "Types/Platform/Threading/CoPaT/CoroutineWait.h"
@@ -21,6 +23,13 @@
 
 DECLARE_MODULE(EngineRenderer, EngineRendererModule)
 
+constexpr StringLiteralStore<TCHAR("--rhi")> CMDLINE_RHI;
+REGISTER_CMDARG(
+    "RHI module to render with, Defaults to VulkanRHI.\n    "
+    "Use NullRHI to run the renderer without a GPU or a window. Example `--rhi NullRHI`",
+    CMDLINE_RHI.getChar()
+);
+
 //////////////////////////////////////////////////////////////////////////
 /// Rendering thread stubs
 //////////////////////////////////////////////////////////////////////////
@@ -53,6 +62,12 @@ RenderManager *EngineRendererModule::getRenderManager() const
     return renderManager;
 }
 
+bool EngineRendererModule::isHeadlessRHI() const
+{
+    debugAssert(!weakRHI.expired());
+    return static_cast<IRHIModule *>(weakRHI.lock().get())->isHeadless();
+}
+
 void EngineRendererModule::initializeGraphics(bool bComputeOnly /*= false*/)
 {
     GlobalRenderVariables::GPU_IS_COMPUTE_ONLY.set(bComputeOnly);
@@ -71,7 +86,11 @@ void EngineRendererModule::unregisterToStateEvents(const DelegateHandle &handle)
 void EngineRendererModule::init()
 {
     renderManager = new RenderManager();
-    weakRHI = ModuleManager::get()->getOrLoadModule(TCHAR("VulkanRHI"));
+
+    rhiModuleName = TCHAR("VulkanRHI");
+    ProgramCmdLine::get().getArg(rhiModuleName, CMDLINE_RHI);
+    weakRHI = ModuleManager::get()->getOrLoadModule(rhiModuleName);
+    fatalAssertf(!weakRHI.expired(), "Failed to load RHI module {}", rhiModuleName.getChar());
     auto rhiModule = weakRHI.lock().get();
 
     graphicsInstanceCache = static_cast<IRHIModule *>(rhiModule)->createGraphicsInstance();
@@ -97,7 +116,7 @@ void EngineRendererModule::release()
 
     graphicsInstanceCache = nullptr;
     graphicsHelperCache = nullptr;
-    ModuleManager::get()->unloadModule(TCHAR("VulkanRHI"));
+    ModuleManager::get()->unloadModule(rhiModuleName);
 }
 
 // IRenderInterfaceModule Impl
@@ -20,6 +20,8 @@ private:
     IGraphicsInstance *graphicsInstanceCache;
     const GraphicsHelperAPI *graphicsHelperCache;
     WeakModulePtr weakRHI;
+    // Name of the RHI module selected using --rhi command line
+    String rhiModuleName;
 
     RenderManager *renderManager;
 
@@ -34,6 +36,7 @@ public:
     void initializeGraphics(bool bComputeOnly = false);
     void finalizeGraphicsInitialization() final;
     RenderManager *getRenderManager() const final;
+    bool isHeadlessRHI() const final;
     DelegateHandle registerToStateEvents(RenderStateDelegate::SingleCastDelegateType &&callback) final;
     void unregisterToStateEvents(const DelegateHandle &handle) final;
     /* IModuleBase finals */
@@ -59,6 +59,8 @@ public:
     virtual IGraphicsInstance *currentGraphicsInstance() const = 0;
     virtual const GraphicsHelperAPI *currentGraphicsHelper() const = 0;
     virtual RenderManager *getRenderManager() const = 0;
+    // Can be used from any thread as RHI is selected when loading this module
+    virtual bool isHeadlessRHI() const = 0;
 
     virtual void initializeGraphics(bool bComputeOnly = false) = 0;
     virtual void finalizeGraphicsInitialization() = 0;
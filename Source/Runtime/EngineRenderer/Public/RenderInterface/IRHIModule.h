@@ -22,4 +22,6 @@ public:
     virtual IGraphicsInstance *createGraphicsInstance() = 0;
     virtual void destroyGraphicsInstance() = 0;
     virtual const GraphicsHelperAPI *getGraphicsHelper() const = 0;
+    // Headless RHI has no surface to present to, Application will not create any native window for it
+    virtual bool isHeadless() const = 0;
 };
\ No newline at end of file
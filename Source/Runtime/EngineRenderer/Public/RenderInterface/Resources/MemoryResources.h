@@ -283,6 +283,11 @@ struct CopyPixelsToImageInfo
     bool bGenerateMips = false;
     // Filtering to be used to generate MIPs
     ESamplerFiltering::Type mipFiltering;
+    /**
+     * Image is already copied to before and is in its shader read layout. Texels outside the copied region are kept intact,
+     * Otherwise image's old contents might be discarded by the copy
+     */
+    bool bPreserveContents = false;
 };
 
 struct CopyImageInfo
@@ -9,12 +9,14 @@
  *  License can be read in LICENSE file at this repository's root
  */
 
+#include <bit>
 #include <unordered_set>
 
 #include "Math/Matrix4.h"
 #include "Math/Vector2.h"
 #include "Math/Vector4.h"
 #include "Types/Platform/PlatformAssertionErrors.h"
+#include "Memory/Memory.h"
 #include "RenderApi/RenderTaskHelpers.h"
 #include "IRenderInterfaceModule.h"
 #include "RenderInterface/GraphicsHelper.h"
@@ -323,12 +325,11 @@ uint32 ShaderParametersLayout::getSetID(StringID paramName) const
 
 DEFINE_GRAPHICS_RESOURCE(ShaderParameters)
 
-size_t ShaderParameters::BufferParameterUpdate::Hasher::operator() (const BufferParameterUpdate &keyVal) const noexcept
+// GPU stride of each element of an index accessible field
+// NOTE : If this stride logic changes here. Change it in resizeRuntimeBuffer() and setBufferResource()
+FORCE_INLINE uint32 gpuElementStride(const ShaderBufferField *field)
 {
-    size_t seed = HashUtility::hash(keyVal.bufferName);
-    HashUtility::hashCombine(seed, keyVal.paramName);
-    HashUtility::hashCombine(seed, keyVal.index);
-    return seed;
+    return BIT_SET(field->fieldDecorations, ShaderBufferField::IsStruct) ? field->paramInfo->paramStride() : field->stride;
 }
 
 ShaderParameters::ShaderParameters(const GraphicsResource *shaderParamLayout, const std::set<uint32> &ignoredSetIds /* = {}*/)
@@ -474,6 +475,8 @@ void ShaderParameters::initParamsMaps(
                     }
                 }
 
+                resizeGpuLayoutData(paramData);
+
                 if (bufferInitStride > 0)
                 {
                     const GraphicsHelperAPI *graphicsHelper = IRenderInterfaceModule::get()->currentGraphicsHelper();
@@ -562,7 +565,9 @@ void ShaderParameters::release()
     {
         delete[] bufferParam.second.cpuBuffer;
     }
+    dirtyBuffers.clear();
     shaderBuffers.clear();
+    paramsGeneration++;
     shaderTexels.clear();
     shaderTextures.clear();
     shaderSamplers.clear();
@@ -726,44 +731,50 @@ void ShaderParameters::pullBufferParamUpdates(
     std::vector<BatchCopyBufferData> &copies, IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance
 )
 {
-    std::unordered_set<BufferParameterUpdate, BufferParameterUpdate::Hasher> uniqueBufferUpdates(bufferUpdates.cbegin(), bufferUpdates.cend());
-
-    for (const BufferParameterUpdate &bufferUpdate : uniqueBufferUpdates)
+    for (BufferParametersData *bufferData : dirtyBuffers)
     {
-        const BufferParametersData &bufferParamData = shaderBuffers.at(bufferUpdate.bufferName);
-        const BufferParametersData::BufferParameter &bufferParamField = bufferParamData.bufferParams.at(bufferUpdate.paramName);
-
-        // Offset of struct when updating field is inside inner struct,
-        // In which case field offset will always be from its outer struct and we have to add this
-        // offset to that for obtaining proper offset
-        uint32 outerOffset = 0;
+        const uint32 gpuDataSize = uint32(bufferData->gpuLayoutData.size());
+        auto emitCopy = [&copies, bufferData, gpuDataSize](SizeT startGranule, SizeT endGranule)
+        {
+            BatchCopyBufferData copyData;
+            copyData.dst = bufferData->gpuBuffer;
+            copyData.dstOffset = uint32(startGranule * GPU_DIRTY_GRANULE);
+            copyData.dataToCopy = bufferData->gpuLayoutData.data() + copyData.dstOffset;
+            copyData.size = Math::min(uint32(endGranule * GPU_DIRTY_GRANULE), gpuDataSize) - copyData.dstOffset;
+            copies.emplace_back(copyData);
+        };
+
+        // Merge contiguous dirty granules into single copy, A run can continue across the words
+        SizeT runStart = 0;
+        SizeT runEnd = 0;
+        uint64 *dirtyWords = bufferData->dirtyGranules.data();
+        const SizeT wordsCount = (bufferData->dirtyGranules.size() + 63) / 64;
+        for (SizeT wordIdx = 0; wordIdx != wordsCount; ++wordIdx)
         {
-            const BufferParametersData::BufferParameter *outerBufferParamField
-                = bufferParamField.outerName.isValid() ? &bufferParamData.bufferParams.at(bufferParamField.outerName) : nullptr;
-            while (outerBufferParamField)
+            uint64 dirtyWord = dirtyWords[wordIdx];
+            dirtyWords[wordIdx] = 0;
+            while (dirtyWord != 0)
             {
-                if (outerBufferParamField->bufferField->isIndexAccessible())
+                const uint32 setStart = uint32(std::countr_zero(dirtyWord));
+                const uint32 setEnd = setStart + uint32(std::countr_one(dirtyWord >> setStart));
+                const SizeT granuleStart = wordIdx * 64 + setStart;
+                if (runEnd != granuleStart)
                 {
-                    LOG_WARN(
-                        "ShaderParameters",
-                        "Setting value of parameter[{}] inside a struct[{}] in AoS[{}] will always set param value at struct index 0",
-                        bufferUpdate.paramName, bufferUpdate.bufferName, outerBufferParamField->bufferField->paramName
-                    );
+                    if (runEnd != runStart)
+                    {
+                        emitCopy(runStart, runEnd);
+                    }
+                    runStart = granuleStart;
                 }
-
-                outerOffset += outerBufferParamField->bufferField->offset;
-                outerBufferParamField
-                    = outerBufferParamField->outerName.isValid() ? &bufferParamData.bufferParams.at(outerBufferParamField->outerName) : nullptr;
+                runEnd = wordIdx * 64 + setEnd;
+                dirtyWord = (setEnd >= 64) ? 0 : (dirtyWord & (~uint64(0) << setEnd));
             }
         }
-
-        BatchCopyBufferData copyData;
-        copyData.dst = bufferParamData.gpuBuffer;
-        copyData.dstOffset = outerOffset + bufferParamField.bufferField->offset + (bufferUpdate.index * bufferParamField.bufferField->stride);
-        copyData.dataToCopy = bufferParamField.bufferField->fieldData(bufferParamField.outerPtr, nullptr, &copyData.size);
-        copyData.dataToCopy = reinterpret_cast<const uint8 *>(copyData.dataToCopy) + (bufferUpdate.index * copyData.size);
-
-        copies.emplace_back(copyData);
+        if (runEnd != runStart)
+        {
+            emitCopy(runStart, runEnd);
+        }
+        bufferData->bHasDirtyGranules = false;
     }
 
     ParamUpdateLambdaOut genericUpdateOut{ &copies };
@@ -771,7 +782,7 @@ void ShaderParameters::pullBufferParamUpdates(
     {
         lambda(genericUpdateOut, cmdList, graphicsInstance);
     }
-    bufferUpdates.clear();
+    dirtyBuffers.clear();
     genericUpdates.clear();
 }
 
@@ -877,136 +888,210 @@ void *ShaderParameters::getOuterPtrForPath(
     return (void *)(paramOuterPtr);
 }
 
-template <typename FieldType>
-bool ShaderParameters::setFieldParam(StringID paramName, const FieldType &value, uint32 index)
+ShaderParameters::FieldHandle ShaderParameters::resolveFieldHandle(
+    BufferParametersData &bufferData, const BufferParametersData::BufferParameter &bufferParam, uint32 index
+)
 {
-    bool bValueSet = false;
-    StringID bufferName;
-    std::pair<const BufferParametersData *, const BufferParametersData::BufferParameter *> foundInfo = findBufferParam(bufferName, paramName);
-
-    BufferParameterUpdate updateVal{ bufferName, paramName, 0 };
-
-    if (foundInfo.first && foundInfo.second && BIT_NOT_SET(foundInfo.second->bufferField->fieldDecorations, ShaderBufferField::IsStruct))
+    const ShaderBufferField *bufferField = bufferParam.bufferField;
+    if (BIT_SET(bufferField->fieldDecorations, ShaderBufferField::IsStruct))
     {
-        if (foundInfo.second->bufferField->isIndexAccessible())
-        {
-            if (!foundInfo.second->bufferField->isPointer() || (foundInfo.first->runtimeArray->currentCount > index))
-            {
-                bValueSet = foundInfo.second->bufferField->setFieldDataArray(foundInfo.second->outerPtr, value, index);
-                updateVal.index = index;
-            }
-        }
-        else
+        return {};
+    }
+    if (bufferField->isIndexAccessible())
+    {
+        const uint32 maxCount = bufferField->isPointer() ? bufferData.runtimeArray->currentCount : (bufferField->size / bufferField->stride);
+        if (index >= maxCount)
         {
-            bValueSet = foundInfo.second->bufferField->setFieldData(foundInfo.second->outerPtr, value);
+            return {};
         }
     }
-    if (bValueSet)
+    else
     {
-        bufferUpdates.emplace_back(updateVal);
+        index = 0;
     }
-    else
+
+    // Offset of struct when field is inside inner struct,
+    // In which case field offset will always be from its outer struct and we have to add this
+    // offset to that for obtaining proper offset
+    uint32 outerOffset = 0;
     {
-        LOG_ERROR(
-            "ShaderParameters", "Cannot set {}[{}] of {}", paramName, index,
-            bufferName.isValid() ? bufferName.toString()
-                                 : TCHAR("Buffer not found")
-            );
+        const BufferParametersData::BufferParameter *outerBufferParamField
+            = bufferParam.outerName.isValid() ? &bufferData.bufferParams.at(bufferParam.outerName) : nullptr;
+        while (outerBufferParamField)
+        {
+            if (outerBufferParamField->bufferField->isIndexAccessible())
+            {
+                LOG_WARN(
+                    "ShaderParameters",
+                    "Setting value of parameter[{}] inside a struct in AoS[{}] will always set param value at struct index 0",
+                    bufferField->paramName, outerBufferParamField->bufferField->paramName
+                );
+            }
+
+            outerOffset += outerBufferParamField->bufferField->offset;
+            outerBufferParamField
+                = outerBufferParamField->outerName.isValid() ? &bufferData.bufferParams.at(outerBufferParamField->outerName) : nullptr;
+        }
     }
-    return bValueSet;
+
+    FieldHandle handle;
+    handle.bufferData = &bufferData;
+    handle.bufferField = bufferField;
+    handle.outerPtr = bufferParam.outerPtr;
+    handle.index = index;
+    handle.gpuOffset = outerOffset + bufferField->offset + index * bufferField->stride;
+    handle.layoutVersion = bufferData.layoutVersion;
+    handle.paramsGeneration = paramsGeneration;
+    return handle;
 }
 
-template <typename FieldType>
-bool ShaderParameters::setFieldParam(StringID paramName, StringID bufferName, const FieldType &value, uint32 index)
+ShaderParameters::FieldHandle ShaderParameters::getFieldHandle(StringID paramName, uint32 index /* = 0 */)
 {
-    bool bValueSet = false;
-    BufferParameterUpdate updateVal{ bufferName, paramName, 0 };
+    StringID bufferName;
+    std::pair<const BufferParametersData *, const BufferParametersData::BufferParameter *> foundInfo = findBufferParam(bufferName, paramName);
+    if (foundInfo.first && foundInfo.second)
+    {
+        // findBufferParam is const so the found buffer data is const, This is non const ShaderParameters so it is fine
+        FieldHandle handle = resolveFieldHandle(const_cast<BufferParametersData &>(*foundInfo.first), *foundInfo.second, index);
+        if (handle.isResolved())
+        {
+            return handle;
+        }
+    }
+    LOG_ERROR(
+        "ShaderParameters", "Cannot resolve {}[{}] of {}", paramName, index,
+        bufferName.isValid() ? bufferName.toString()
+                             : TCHAR("Buffer not found")
+        );
+    return {};
+}
 
+ShaderParameters::FieldHandle ShaderParameters::getFieldHandle(StringID paramName, StringID bufferName, uint32 index /* = 0 */)
+{
     auto bufferParamsItr = shaderBuffers.find(bufferName);
     if (bufferParamsItr != shaderBuffers.end())
     {
         auto bufferParamItr = bufferParamsItr->second.bufferParams.find(paramName);
-        if (bufferParamItr != bufferParamsItr->second.bufferParams.end()
-            && BIT_NOT_SET(bufferParamItr->second.bufferField->fieldDecorations, ShaderBufferField::IsStruct))
+        if (bufferParamItr != bufferParamsItr->second.bufferParams.end())
         {
-            if (bufferParamItr->second.bufferField->isIndexAccessible())
+            FieldHandle handle = resolveFieldHandle(bufferParamsItr->second, bufferParamItr->second, index);
+            if (handle.isResolved())
             {
-                if (!bufferParamItr->second.bufferField->isPointer() || (bufferParamsItr->second.runtimeArray->currentCount > index))
-                {
-                    bValueSet = bufferParamItr->second.bufferField->setFieldDataArray(bufferParamItr->second.outerPtr, value, index);
-                    updateVal.index = index;
-                }
-            }
-            else
-            {
-                bValueSet = bufferParamItr->second.bufferField->setFieldData(bufferParamItr->second.outerPtr, value);
+                return handle;
             }
         }
     }
-    if (bValueSet)
-    {
-        bufferUpdates.emplace_back(updateVal);
-    }
-    else
-    {
-        LOG_ERROR("ShaderParameters", "Cannot set {}[{}] of {}", paramName, index, bufferName);
-    }
-    return bValueSet;
+    LOG_ERROR("ShaderParameters", "Cannot resolve {}[{}] of {}", paramName, index, bufferName);
+    return {};
 }
 
-template <typename FieldType>
-bool ShaderParameters::setFieldAtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const FieldType &value)
+ShaderParameters::FieldHandle ShaderParameters::getFieldHandle(ArrayView<StringID> pathNames, ArrayView<uint32> indices)
 {
-    // 1 or 2 can be set using setFieldParam
+    // 1 or 2 can be resolved directly
     if (pathNames.size() == 1)
     {
-        return setFieldParam(pathNames[0], value, indices[0]);
+        return getFieldHandle(pathNames[0], indices[0]);
     }
     else if (pathNames.size() == 2)
     {
-        return setFieldParam(pathNames[1], pathNames[0], value, indices[1]);
+        return getFieldHandle(pathNames[1], pathNames[0], indices[1]);
     }
     else if (pathNames.size() == 0) [[unlikely]]
     {
-        LOG_ERROR("ShaderParameters", "Setting field at path without valid parameters!");
-        return false;
+        LOG_ERROR("ShaderParameters", "Resolving field at path without valid parameters!");
+        return {};
     }
 
     std::vector<const BufferParametersData::BufferParameter *> innerBufferParams;
     void *paramOuterPtr = getOuterPtrForPath(innerBufferParams, pathNames, indices);
-    if (paramOuterPtr)
+    if (paramOuterPtr == nullptr)
     {
-        bool bValueSet = false;
-        uint32 updatedIdx = 0;
-        if (innerBufferParams.back()->bufferField->isIndexAccessible()) [[likely]]
-        {
-            updatedIdx = indices.back();
-            bValueSet = innerBufferParams.back()->bufferField->setFieldDataArray(paramOuterPtr, value, updatedIdx);
-        }
-        else
+        LOG_ERROR("ShaderParameters", "Failed to resolve {} parameter", pathNames.back());
+        return {};
+    }
+
+    BufferParametersData &bufferData = shaderBuffers.find(pathNames[0])->second;
+    const ShaderBufferField *bufferField = innerBufferParams.back()->bufferField;
+
+    FieldHandle handle;
+    handle.bufferData = &bufferData;
+    handle.bufferField = bufferField;
+    handle.outerPtr = paramOuterPtr;
+    handle.index = bufferField->isIndexAccessible() ? indices.back() : 0;
+    handle.layoutVersion = bufferData.layoutVersion;
+    handle.paramsGeneration = paramsGeneration;
+    // Each struct in the path offsets the field by its offset and by indexed element's stride
+    for (SizeT i = 0; i != innerBufferParams.size(); ++i)
+    {
+        const ShaderBufferField *pathField = innerBufferParams[i]->bufferField;
+        handle.gpuOffset += pathField->offset;
+        if (pathField->isIndexAccessible())
         {
-            bValueSet = innerBufferParams.back()->bufferField->setFieldData(paramOuterPtr, value);
+            handle.gpuOffset += indices[i + 1] * gpuElementStride(pathField);
         }
+    }
+    return handle;
+}
+
+void ShaderParameters::resizeGpuLayoutData(BufferParametersData &bufferData) const
+{
+    uint32 gpuDataSize = bufferData.descriptorInfo->bufferParamInfo->paramStride();
+    if (bufferData.runtimeArray.has_value())
+    {
+        const ShaderBufferField *runtimeField = bufferData.bufferParams.find(bufferData.runtimeArray->paramName)->second.bufferField;
+        gpuDataSize = bufferData.runtimeArray->offset + bufferData.runtimeArray->currentCount * gpuElementStride(runtimeField);
+    }
+    bufferData.gpuLayoutData.resize(gpuDataSize, 0);
+    bufferData.dirtyGranules.resize((gpuDataSize + GPU_DIRTY_GRANULE - 1) / GPU_DIRTY_GRANULE);
+}
+
+void ShaderParameters::markGpuDataDirty(BufferParametersData &bufferData, uint32 gpuOffset, const void *data, uint32 size)
+{
+    if (gpuOffset + size > bufferData.gpuLayoutData.size()) [[unlikely]]
+    {
+        LOG_ERROR(
+            "ShaderParameters", "Cannot copy {} bytes at offset {}, Buffer size is {}", size, gpuOffset, bufferData.gpuLayoutData.size()
+        );
+        return;
+    }
+    CBEMemory::memCopy(bufferData.gpuLayoutData.data() + gpuOffset, data, size);
+
+    const uint32 startGranule = gpuOffset / GPU_DIRTY_GRANULE;
+    const uint32 endGranule = (gpuOffset + size + GPU_DIRTY_GRANULE - 1) / GPU_DIRTY_GRANULE;
+    bufferData.dirtyGranules.setRange(startGranule, endGranule - startGranule);
+    if (!bufferData.bHasDirtyGranules)
+    {
+        bufferData.bHasDirtyGranules = true;
+        dirtyBuffers.emplace_back(&bufferData);
+    }
+}
 
-        if (bValueSet)
+template <typename FieldType>
+bool ShaderParameters::setFieldByHandle(const FieldHandle &handle, const FieldType &value)
+{
+    if (!isValidHandle(handle))
+    {
+        // Unresolved handle would have been logged when resolving
+        if (handle.isResolved())
         {
-            BufferParameterUpdate bufferUpdate = { pathNames[0], pathNames.back(), updatedIdx };
-            // Mark the first non zero indexed parameter field/buffer for update, This is because only one index value can be updated
-            // BufferParameterUpdate::index has to cover the entire struct that contains the edited field
-            for (uint32 i = 0; i != innerBufferParams.size(); ++i)
-            {
-                if (indices[i + 1] != 0 && innerBufferParams[i]->bufferField->isIndexAccessible())
-                {
-                    bufferUpdate = { pathNames[0], pathNames[i + 1], indices[i + 1] };
-                    break;
-                }
-            }
-            bufferUpdates.emplace_back(std::move(bufferUpdate));
-            return true;
+            LOG_ERROR("ShaderParameters", "Cannot set {} using stale field handle", handle.bufferField->paramName);
         }
+        return false;
     }
-    LOG_ERROR("ShaderParameters", "Failed to set {} parameter", pathNames.back());
-    return false;
+
+    const bool bValueSet = handle.bufferField->isIndexAccessible()
+                               ? handle.bufferField->setFieldDataArray(handle.outerPtr, value, handle.index)
+                               : handle.bufferField->setFieldData(handle.outerPtr, value);
+    if (!bValueSet)
+    {
+        LOG_ERROR("ShaderParameters", "Cannot set {}[{}], Value type does not match", handle.bufferField->paramName, handle.index);
+        return false;
+    }
+
+    uint32 elementSize = 0;
+    const uint8 *elementData = reinterpret_cast<const uint8 *>(handle.bufferField->fieldData(handle.outerPtr, nullptr, &elementSize));
+    markGpuDataDirty(*handle.bufferData, handle.gpuOffset, elementData + handle.index * elementSize, elementSize);
+    return true;
 }
 
 template <typename FieldType>
@@ -1099,85 +1184,106 @@ FieldType ShaderParameters::getFieldAtPath(ArrayView<StringID> pathNames, ArrayV
 
 bool ShaderParameters::setIntParam(StringID paramName, StringID bufferName, int32 value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, bufferName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, bufferName, index), value);
 }
 
 bool ShaderParameters::setIntParam(StringID paramName, StringID bufferName, uint32 value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, bufferName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, bufferName, index), value);
 }
 
-bool ShaderParameters::setIntParam(StringID paramName, int32 value, uint32 index /* = 0 */) { return setFieldParam(paramName, value, index); }
+bool ShaderParameters::setIntParam(StringID paramName, int32 value, uint32 index /* = 0 */)
+{
+    return setFieldByHandle(getFieldHandle(paramName, index), value);
+}
 
-bool ShaderParameters::setIntParam(StringID paramName, uint32 value, uint32 index /* = 0 */) { return setFieldParam(paramName, value, index); }
+bool ShaderParameters::setIntParam(StringID paramName, uint32 value, uint32 index /* = 0 */)
+{
+    return setFieldByHandle(getFieldHandle(paramName, index), value);
+}
 
 bool ShaderParameters::setFloatParam(StringID paramName, StringID bufferName, float value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, bufferName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, bufferName, index), value);
 }
 
-bool ShaderParameters::setFloatParam(StringID paramName, float value, uint32 index /* = 0 */) { return setFieldParam(paramName, value, index); }
+bool ShaderParameters::setFloatParam(StringID paramName, float value, uint32 index /* = 0 */)
+{
+    return setFieldByHandle(getFieldHandle(paramName, index), value);
+}
 
 bool ShaderParameters::setVector2Param(StringID paramName, StringID bufferName, const Vector2 &value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, bufferName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, bufferName, index), value);
 }
 
 bool ShaderParameters::setVector2Param(StringID paramName, const Vector2 &value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, index), value);
 }
 
 bool ShaderParameters::setVector4Param(StringID paramName, StringID bufferName, const Vector4 &value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, bufferName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, bufferName, index), value);
 }
 
 bool ShaderParameters::setVector4Param(StringID paramName, const Vector4 &value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, index), value);
 }
 
 bool ShaderParameters::setMatrixParam(StringID paramName, StringID bufferName, const Matrix4 &value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, bufferName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, bufferName, index), value);
 }
 
 bool ShaderParameters::setMatrixParam(StringID paramName, const Matrix4 &value, uint32 index /* = 0 */)
 {
-    return setFieldParam(paramName, value, index);
+    return setFieldByHandle(getFieldHandle(paramName, index), value);
 }
 
 bool ShaderParameters::setIntAtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, int32 value)
 {
-    return setFieldAtPath(pathNames, indices, value);
+    return setFieldByHandle(getFieldHandle(pathNames, indices), value);
 }
 
 bool ShaderParameters::setIntAtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, uint32 value)
 {
-    return setFieldAtPath(pathNames, indices, value);
+    return setFieldByHandle(getFieldHandle(pathNames, indices), value);
 }
 
 bool ShaderParameters::setFloatAtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, float value)
 {
-    return setFieldAtPath(pathNames, indices, value);
+    return setFieldByHandle(getFieldHandle(pathNames, indices), value);
 }
 
 bool ShaderParameters::setVector2AtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const Vector2 &value)
 {
-    return setFieldAtPath(pathNames, indices, value);
+    return setFieldByHandle(getFieldHandle(pathNames, indices), value);
 }
 
 bool ShaderParameters::setVector4AtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const Vector4 &value)
 {
-    return setFieldAtPath(pathNames, indices, value);
+    return setFieldByHandle(getFieldHandle(pathNames, indices), value);
 }
 
 bool ShaderParameters::setMatrixAtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const Matrix4 &value)
 {
-    return setFieldAtPath(pathNames, indices, value);
+    return setFieldByHandle(getFieldHandle(pathNames, indices), value);
 }
 
+bool ShaderParameters::setIntParam(const FieldHandle &handle, int32 value) { return setFieldByHandle(handle, value); }
+
+bool ShaderParameters::setIntParam(const FieldHandle &handle, uint32 value) { return setFieldByHandle(handle, value); }
+
+bool ShaderParameters::setFloatParam(const FieldHandle &handle, float value) { return setFieldByHandle(handle, value); }
+
+bool ShaderParameters::setVector2Param(const FieldHandle &handle, const Vector2 &value) { return setFieldByHandle(handle, value); }
+
+bool ShaderParameters::setVector4Param(const FieldHandle &handle, const Vector4 &value) { return setFieldByHandle(handle, value); }
+
+bool ShaderParameters::setMatrixParam(const FieldHandle &handle, const Matrix4 &value) { return setFieldByHandle(handle, value); }
+
 bool ShaderParameters::setTexelParam(StringID paramName, BufferResourceRef texelBuffer, uint32 index /*= 0*/)
 {
     auto texelParamItr = shaderTexels.find(paramName);
@@ -1388,6 +1494,8 @@ bool ShaderParameters::setBufferResource(StringID bufferName, BufferResourceRef
             initBufferParams(
                 bufferData, bufferData.descriptorInfo->bufferParamInfo, bufferData.cpuBuffer, StringID(EInitType::InitType_NoInit)
             );
+            bufferData.layoutVersion++;
+            resizeGpuLayoutData(bufferData);
         }
         bufferResourceUpdates.insert(bufferName);
     }
@@ -1519,6 +1627,8 @@ void ShaderParameters::resizeRuntimeBuffer(StringID bufferName, uint32 minCount)
             initBufferParams(
                 bufferData, bufferData.descriptorInfo->bufferParamInfo, bufferData.cpuBuffer, StringID(EInitType::InitType_NoInit)
             );
+            bufferData.layoutVersion++;
+            resizeGpuLayoutData(bufferData);
 
             ENQUEUE_RENDER_COMMAND(ResizeRuntimeBuffer)
             (
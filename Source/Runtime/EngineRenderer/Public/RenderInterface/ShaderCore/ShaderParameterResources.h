@@ -19,6 +19,7 @@
 #include "Reflections/Functions.h"
 #include "Types/Containers/ReferenceCountPtr.h"
 #include "Types/Containers/ArrayView.h"
+#include "Types/Containers/BitArray.h"
 #include "RenderInterface/Resources/GraphicsResources.h"
 #include "RenderInterface/Resources/MemoryResources.h"
 #include "RenderInterface/Resources/Samplers/SamplerInterface.h"
@@ -194,21 +195,6 @@ protected:
     };
 
     using ParamUpdateLambda = LambdaFunction<void, ParamUpdateLambdaOut &, IRenderCommandList *, IGraphicsInstance *>;
-    struct BufferParameterUpdate
-    {
-        StringID bufferName;
-        StringID paramName;
-        uint32 index = 0;
-
-        bool operator== (const BufferParameterUpdate &other) const
-        {
-            return bufferName == other.bufferName && paramName == other.paramName && index == other.index;
-        }
-        struct Hasher
-        {
-            _NODISCARD size_t operator() (const BufferParameterUpdate &keyVal) const noexcept;
-        };
-    };
 
     struct BufferParametersData
     {
@@ -236,6 +222,14 @@ protected:
         // Linear list of all level parameters inside this buffer
         std::map<StringID, BufferParameter> bufferParams;
         std::optional<RuntimeArrayParameter> runtimeArray;
+
+        // Mirror of the buffer in GPU layout, Field setters write here along with cpuBuffer and copies to gpuBuffer are sourced from here
+        std::vector<uint8> gpuLayoutData;
+        // Each bit marks a GPU_DIRTY_GRANULE bytes of gpuLayoutData that must be copied to gpuBuffer
+        BitArray<uint64> dirtyGranules;
+        // Incremented whenever bufferParams are regenerated, FieldHandle resolved at older version are stale
+        uint32 layoutVersion = 0;
+        bool bHasDirtyGranules = false;
     };
 
     struct TexelParameterData
@@ -272,7 +266,8 @@ protected:
     // will be used only in terms of ShaderParametersLayout
     std::set<uint32> ignoredSets;
 
-    std::vector<BufferParameterUpdate> bufferUpdates;
+    // Buffers that have dirty granules to be copied in next pullBufferParamUpdates
+    std::vector<BufferParametersData *> dirtyBuffers;
     std::set<StringID> bufferResourceUpdates;
     std::set<std::pair<StringID, uint32>> texelUpdates;
     std::set<std::pair<StringID, uint32>> textureUpdates;
@@ -281,6 +276,33 @@ protected:
 
     const GraphicsResource *paramLayout = nullptr;
     String descriptorSetName;
+    // Incremented on every release, All BufferParametersData are freed then so FieldHandle resolved before are stale
+    uint32 paramsGeneration = 0;
+
+public:
+    // Dirty tracking granularity in bytes, All GPU scalar fields are 4 bytes aligned
+    constexpr static const uint32 GPU_DIRTY_GRANULE = 4;
+
+    /**
+     * Resolved location of a non struct field element inside a buffer. Setting through the handle skips the buffer and parameter lookups that
+     * set*Param and set*AtPath does every call.
+     * Handle becomes stale once the buffer's runtime array is resized, its buffer resource is set or parameters are released,
+     * Resolve it again after that. Use isValidHandle to check, The handle alone cannot tell if its buffer data is still alive.
+     */
+    struct FieldHandle
+    {
+        BufferParametersData *bufferData = nullptr;
+        const ShaderBufferField *bufferField = nullptr;
+        // Native struct that contains this field, Already offset to the indexed struct elements in the path
+        void *outerPtr = nullptr;
+        uint32 index = 0;
+        // Offset of the field element from start of GPU buffer
+        uint32 gpuOffset = 0;
+        uint32 layoutVersion = 0;
+        uint32 paramsGeneration = 0;
+
+        FORCE_INLINE bool isResolved() const { return bufferData != nullptr; }
+    };
 
 public:
     /* ReferenceCountPtr implementation */
@@ -332,6 +354,21 @@ public:
     bool setVector2AtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const Vector2 &value);
     bool setVector4AtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const Vector4 &value);
     bool setMatrixAtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const Matrix4 &value);
+    // Below get*Handle resolves the field once, Same restrictions as the set*Param and set*AtPath. Returns invalid handle on failure
+    FieldHandle getFieldHandle(StringID paramName, uint32 index = 0);
+    FieldHandle getFieldHandle(StringID paramName, StringID bufferName, uint32 index = 0);
+    FieldHandle getFieldHandle(ArrayView<StringID> pathNames, ArrayView<uint32> indices);
+    // bufferData is dereferenced only after the generation matches, So handles that outlived a release are never dereferenced
+    FORCE_INLINE bool isValidHandle(const FieldHandle &handle) const
+    {
+        return handle.isResolved() && handle.paramsGeneration == paramsGeneration && handle.bufferData->layoutVersion == handle.layoutVersion;
+    }
+    bool setIntParam(const FieldHandle &handle, int32 value);
+    bool setIntParam(const FieldHandle &handle, uint32 value);
+    bool setFloatParam(const FieldHandle &handle, float value);
+    bool setVector2Param(const FieldHandle &handle, const Vector2 &value);
+    bool setVector4Param(const FieldHandle &handle, const Vector4 &value);
+    bool setMatrixParam(const FieldHandle &handle, const Matrix4 &value);
 
     bool setTexelParam(StringID paramName, BufferResourceRef texelBuffer, uint32 index = 0);
     bool setTextureParam(StringID paramName, ImageResourceRef texture, uint32 index = 0);
@@ -393,12 +430,13 @@ private:
         std::vector<const BufferParametersData::BufferParameter *> &outInnerBufferParams, ArrayView<StringID> pathNames,
         ArrayView<uint32> indices
     ) const;
+    FieldHandle resolveFieldHandle(BufferParametersData &bufferData, const BufferParametersData::BufferParameter &bufferParam, uint32 index);
+    // Resizes gpuLayoutData and dirtyGranules to current GPU size of the buffer
+    void resizeGpuLayoutData(BufferParametersData &bufferData) const;
+    // Copies the data to gpuLayoutData at gpuOffset and marks the granules overlapping it for copying
+    void markGpuDataDirty(BufferParametersData &bufferData, uint32 gpuOffset, const void *data, uint32 size);
     template <typename FieldType>
-    bool setFieldParam(StringID paramName, const FieldType &value, uint32 index);
-    template <typename FieldType>
-    bool setFieldParam(StringID paramName, StringID bufferName, const FieldType &value, uint32 index);
-    template <typename FieldType>
-    bool setFieldAtPath(ArrayView<StringID> pathNames, ArrayView<uint32> indices, const FieldType &value);
+    bool setFieldByHandle(const FieldHandle &handle, const FieldType &value);
     template <typename FieldType>
     FieldType getFieldParam(StringID paramName, uint32 index) const;
     template <typename FieldType>
@@ -10,9 +10,11 @@
  */
 
 #include "CmdLine/CmdLine.h"
+#include "CoreObjectsDB.h"
 #include "Logger/Logger.h"
 #include "Memory/Memory.h"
 #include "Modules/ModuleManager.h"
+#include "String/StringLiteral.h"
 #include "Types/CoreTypes.h"
 #include "Types/Platform/Threading/CoPaT/JobSystem.h"
 #include "Types/Platform/Threading/CoPaT/JobSystemCoroutine.h"
@@ -24,12 +26,92 @@
 #include "Types/Time.h"
 
 #include <iostream>
+#include <shared_mutex>
 
 // Override new and delete
 CBE_GLOBAL_NEWDELETE_OVERRIDES
 
 bool bQuit = false;
 
+constexpr StringLiteralStore<TCHAR("--benchObjectsDb")> CMDLINE_BENCH_OBJECTSDB;
+REGISTER_CMDARG(
+    "Measures CoreObjectsDB lookups from all worker threads with sharded locks against a single lock guarding every lookup.",
+    CMDLINE_BENCH_OBJECTSDB.getChar()
+);
+
+/**
+ * Single lock run takes one shared_mutex for every lookup like CoreObjectsDB did before its name index was sharded,
+ * So both runs differ only in how many lock words the readers contend on
+ */
+void benchmarkObjectsDb()
+{
+    constexpr static const uint32 OBJECTS_COUNT = 1u << 16;
+    constexpr static const uint32 LOOKUPS_PER_JOB = 1u << 18;
+
+    copat::JobSystem *jobSystem = copat::JobSystem::get();
+    const uint32 jobsCount = jobSystem->getWorkersCount() + 1;
+
+    CoreObjectsDB objectsDb;
+    std::vector<String> objectPaths;
+    std::vector<StringID> objectIds;
+    objectPaths.reserve(OBJECTS_COUNT);
+    objectIds.reserve(OBJECTS_COUNT);
+    for (uint32 i = 0; i != OBJECTS_COUNT; ++i)
+    {
+        objectPaths.emplace_back(String(TCHAR("BenchObject_")) + String::toString(i));
+        objectIds.emplace_back(StringID(objectPaths.back()));
+        objectsDb.addRootObject(objectIds.back(), objectPaths.back(), objectPaths.back(), nullptr);
+    }
+
+    std::shared_mutex singleLock;
+    std::atomic<uint32> foundCount{ 0 };
+    auto runLookups = [&](bool bSingleLock)
+    {
+        foundCount.store(0, std::memory_order::relaxed);
+        const TickRep startTick = Time::timeNow();
+        copat::parallelFor(
+            jobSystem,
+            copat::DispatchFunctionType::createLambda(
+                [&](uint32 jobIdx)
+                {
+                    uint32 found = 0;
+                    // Each job walks the objects with a different stride so that jobs do not read same object in lock step
+                    uint32 objIdx = jobIdx;
+                    const uint32 stride = 2 * jobIdx + 1;
+                    for (uint32 i = 0; i != LOOKUPS_PER_JOB; ++i)
+                    {
+                        objIdx = (objIdx + stride) % OBJECTS_COUNT;
+                        CoreObjectsDB::NodeIdxType nodeIdx;
+                        if (bSingleLock)
+                        {
+                            std::shared_lock<std::shared_mutex> scopedLock(singleLock);
+                            nodeIdx = objectsDb.getObjectNodeIdx({ .objectPath = objectPaths[objIdx], .objectId = objectIds[objIdx] });
+                            found += objectsDb.getObjectData(nodeIdx).sid == objectIds[objIdx];
+                        }
+                        else
+                        {
+                            nodeIdx = objectsDb.getObjectNodeIdx({ .objectPath = objectPaths[objIdx], .objectId = objectIds[objIdx] });
+                            found += objectsDb.getObjectData(nodeIdx).sid == objectIds[objIdx];
+                        }
+                    }
+                    foundCount.fetch_add(found, std::memory_order::relaxed);
+                }
+            ),
+            jobsCount
+        );
+        const TickRep endTick = Time::timeNow();
+
+        LOG("TestConsole", "{} : {} lookups in {} jobs took {}ms, Found {}", (bSingleLock ? TCHAR("Single lock") : TCHAR("Sharded")),
+            jobsCount * LOOKUPS_PER_JOB, jobsCount, Time::asMilliSeconds(endTick - startTick), foundCount.load(std::memory_order::relaxed));
+    };
+    // First run warms up the caches for both
+    runLookups(false);
+    runLookups(true);
+    runLookups(false);
+
+    objectsDb.clear();
+}
+
 copat::JobSystemWorkerThreadTask enqForevStub(copat::EJobPriority jobPriority, uint32 idx)
 {
     char priorityC[] = { 'L', 'N', 'C' };
@@ -94,6 +176,14 @@ copat::NormalFuncAwaiter enqueueForever(uint32 count)
 
 void doMain(void *)
 {
+    if (ProgramCmdLine::get().hasArg(CMDLINE_BENCH_OBJECTSDB.getChar()))
+    {
+        benchmarkObjectsDb();
+        Logger::flushStream();
+        copat::JobSystem::get()->exitMain();
+        return;
+    }
+
     enqueueForever(2048);
 
     char c;
@@ -265,7 +265,8 @@ class ExperimentalEnginePBR
     void sortSpotFromView(std::vector<uint32> &indices);
     void sortPointsFromView(std::vector<uint32> &indices);
 
-    BoundingVolume<GridEntity> sceneVolume;
+    DynamicAABBTree<GridEntity> sceneVolume;
+    std::unordered_map<GridEntity, DynamicAABBTree<GridEntity>::ProxyIdx> sceneVolumeProxies;
     GridEntity selection;
 
     // Now we support only 8 shadowed lights per type
@@ -810,7 +811,14 @@ void ExperimentalEnginePBR::setupLightSceneDrawCmdsBuffer(class IRenderCommandLi
         }
 
         LightObjectCulling &lightCulling = lightCullings[lightCullingOffset + idx];
-        sceneVolume.findIntersection(lightCulling.setIntersections, lightRegion, true);
+        sceneVolume.query(
+            lightRegion,
+            [&lightCulling](DynamicAABBTree<GridEntity>::ProxyIdx, const GridEntity &gridEntity)
+            {
+                lightCulling.setIntersections.emplace_back(gridEntity);
+                return true;
+            }
+        );
         for (const GridEntity &gridEntity : lightCulling.setIntersections)
         {
             if (gridEntity.type == GridEntity::Entity)
@@ -1434,7 +1442,18 @@ void ExperimentalEnginePBR::createScene()
         // pushSpt(heroLight);
     }
 
-    sceneVolume.reinitialize(entities, Vector3(50, 50, 50));
+    std::vector<AABB> entityBounds;
+    entityBounds.reserve(entities.size());
+    for (const GridEntity &entity : entities)
+    {
+        entityBounds.emplace_back(entity.getBounds());
+    }
+    std::vector<DynamicAABBTree<GridEntity>::ProxyIdx> entityProxies;
+    sceneVolume.build(entities, entityBounds, entityProxies);
+    for (SizeT i = 0; i < entities.size(); ++i)
+    {
+        sceneVolumeProxies[entities[i]] = entityProxies[i];
+    }
 }
 
 void ExperimentalEnginePBR::createSceneRenderData(
@@ -3031,10 +3050,10 @@ void ExperimentalEnginePBR::tickEngine()
         if (mouseCoord.x() >= 0 && mouseCoord.x() <= 1.0f && mouseCoord.y() >= 0 && mouseCoord.y() <= 1.0f)
         {
             Vector3 worldFwd = camera.screenToWorldFwd(mouseCoord);
-            std::vector<GridEntity> entities;
-            if (sceneVolume.raycast(entities, camera.translation(), worldFwd, 2000))
+            GridEntity hitEntity;
+            if (sceneVolume.raycast(ArrayRange<GridEntity>(&hitEntity, 1), camera.translation(), worldFwd, 2000, true) > 0)
             {
-                selection = entities.front();
+                selection = hitEntity;
             }
             else
             {
@@ -3530,11 +3549,7 @@ void ExperimentalEnginePBR::drawSelectionWidget(class ImGuiDrawInterface * /*dra
                     entity.updateInstanceParams(instanceParameters);
 
                     AABB newBound = getBounds(selection);
-                    sceneVolume.updateBounds(selection, currentBound, newBound);
-                    if (sceneVolume.findIntersection(newBound, true).empty())
-                    {
-                        sceneVolume.addedNewObject(selection);
-                    }
+                    sceneVolume.move(sceneVolumeProxies[selection], newBound, newBound.center() - currentBound.center());
                 }
             }
 
@@ -3582,11 +3597,7 @@ void ExperimentalEnginePBR::drawSelectionWidget(class ImGuiDrawInterface * /*dra
                 if (bTransformChanged)
                 {
                     AABB newBound = getBounds(selection);
-                    sceneVolume.updateBounds(selection, currentBound, newBound);
-                    if (sceneVolume.findIntersection(newBound, true).empty())
-                    {
-                        sceneVolume.addedNewObject(selection);
-                    }
+                    sceneVolume.move(sceneVolumeProxies[selection], newBound, newBound.center() - currentBound.center());
                 }
                 bNeedsUpdate = bTransformChanged;
             }
@@ -3630,11 +3641,7 @@ void ExperimentalEnginePBR::drawSelectionWidget(class ImGuiDrawInterface * /*dra
             if (ImGui::DragFloat3("Translation", reinterpret_cast<float *>(&entity.lightPos), 1.0f))
             {
                 AABB newBound = getBounds(selection);
-                sceneVolume.updateBounds(selection, currentBound, newBound);
-                if (sceneVolume.findIntersection(newBound, true).empty())
-                {
-                    sceneVolume.addedNewObject(selection);
-                }
+                sceneVolume.move(sceneVolumeProxies[selection], newBound, newBound.center() - currentBound.center());
                 bNeedsUpdate = true;
             }
 
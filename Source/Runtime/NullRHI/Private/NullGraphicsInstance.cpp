@@ -0,0 +1,58 @@
+/*!
+ * \file NullGraphicsInstance.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullGraphicsInstance.h"
+#include "Logger/Logger.h"
+#include "NullRHIModule.h"
+#include "RenderInterface/GlobalRenderVariables.h"
+
+void NullGraphicsInstance::load()
+{
+    LOG_DEBUG("NullRHI", "Loading null graphics instance");
+
+    // Null device supports everything that renderer might query, Nothing is executed in GPU anyway
+    GlobalRenderVariables::ENABLE_ANISOTROPY.set(true);
+    GlobalRenderVariables::MAX_ANISOTROPY.set(16.0f);
+    GlobalRenderVariables::ENABLE_NON_FILL_DRAWS.set(true);
+    GlobalRenderVariables::ENABLE_WIDE_LINES.set(true);
+
+    GlobalRenderVariables::ENABLED_RESOURCE_RUNTIME_ARRAY.set(true);
+    GlobalRenderVariables::ENABLED_RESOURCE_UPDATE_AFTER_BIND.set(true);
+    GlobalRenderVariables::ENABLED_RESOURCE_UPDATE_UNUSED.set(true);
+    GlobalRenderVariables::MAX_UPDATE_AFTER_BIND_DESCRIPTORS.set(~0u);
+
+    GlobalRenderVariables::MAX_INDIRECT_DRAW_COUNT.set(~0u);
+
+    GlobalRenderVariables::MAX_TIMELINE_OFFSET.set(~0ull);
+    GlobalRenderVariables::ENABLED_TIMELINE_SEMAPHORE.set(true);
+
+    GlobalRenderVariables::ENABLE_EXTENDED_STORAGES.set(true);
+    GlobalRenderVariables::ENABLE_GEOMETRY_SHADERS.set(true);
+}
+
+void NullGraphicsInstance::unload()
+{
+    nullCmdList.reset();
+
+    LOG_DEBUG("NullRHI", "Unloading null graphics instance");
+}
+
+void NullGraphicsInstance::updateSurfaceDependents()
+{
+    // There is no surface to depend on, Only the device dependent objects are created here
+    if (!nullCmdList)
+    {
+        nullCmdList = SharedPtr<NullRenderCmdList>(new NullRenderCmdList(this, INullRHIModule::get()->getGraphicsHelper(), &cmdRecorder));
+    }
+    GlobalRenderVariables::GPU_DEVICE_INITIALIZED.set(true);
+}
+
+void NullGraphicsInstance::initializeCmds(class IRenderCommandList *commandList) { commandList->setup(nullCmdList.get()); }
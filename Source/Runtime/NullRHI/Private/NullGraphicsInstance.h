@@ -0,0 +1,35 @@
+/*!
+ * \file NullGraphicsInstance.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+#include "Memory/SmartPointers.h"
+#include "NullInternals/Commands/NullRenderCmdList.h"
+#include "RenderInterface/GraphicsIntance.h"
+
+class NullGraphicsInstance final : public IGraphicsInstance
+{
+private:
+    SharedPtr<class IRenderCommandList> nullCmdList;
+
+public:
+    // Outlives the command list so stats can be queried even after graphics is unloaded
+    NullCmdRecorder cmdRecorder;
+
+public:
+    /* IGraphicsInstance override */
+
+    void load() override;
+    void unload() override;
+    void updateSurfaceDependents() override;
+    void initializeCmds(class IRenderCommandList *commandList) override;
+
+    /* Override ends */
+};
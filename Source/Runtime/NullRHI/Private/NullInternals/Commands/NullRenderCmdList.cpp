@@ -0,0 +1,985 @@
+/*!
+ * \file NullRenderCmdList.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Commands/NullRenderCmdList.h"
+#include "Logger/Logger.h"
+#include "Math/Math.h"
+#include "NullGraphicsHelper.h"
+#include "NullInternals/Resources/NullMemoryResources.h"
+#include "NullInternals/Resources/NullSyncResource.h"
+#include "RenderInterface/GraphicsHelper.h"
+#include "Types/Colors.h"
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+//////////////////////////////////////////////////////////////////////////
+//// NullCmdRecorder
+//////////////////////////////////////////////////////////////////////////
+
+void NullCmdRecorder::record(
+    ENullCmdType::Type cmdType, const GraphicsResource *cmdBuffer, uint32 arg0 /*= 0*/, uint32 arg1 /*= 0*/, uint32 arg2 /*= 0*/,
+    uint32 arg3 /*= 0*/
+)
+{
+    currentStats.cmdCounts[cmdType]++;
+    if (bRecordCmds)
+    {
+        currentCmds.emplace_back(NullRecordedCmd{
+            .cmdType = cmdType, .cmdBuffer = cmdBuffer, .args = { arg0, arg1, arg2, arg3 }
+        });
+    }
+}
+
+void NullCmdRecorder::swapFrame()
+{
+    const uint64 nextFrameIdx = currentStats.frameIdx + 1;
+
+    lastStats = currentStats;
+    lastCmds = std::move(currentCmds);
+
+    currentStats = {};
+    currentStats.frameIdx = nextFrameIdx;
+    currentCmds.clear();
+    // Most frames record similar amount of commands
+    currentCmds.reserve(lastCmds.size());
+}
+
+// Adds time spent in scope to frame's record time
+struct ScopedRecordTime
+{
+    NullRHIFrameStats &stats;
+    TickRep startTime;
+
+    ScopedRecordTime(NullRHIFrameStats &inStats)
+        : stats(inStats)
+        , startTime(HighResolutionTime::timeNow())
+    {}
+    ~ScopedRecordTime() { stats.recordTime += HighResolutionTime::asNanoSeconds(HighResolutionTime::timeNow() - startTime); }
+};
+
+//////////////////////////////////////////////////////////////////////////
+//// NullCommandBuffer
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullCommandBuffer)
+
+NullCommandBuffer::NullCommandBuffer(const String &name, EQueueFunction queue, bool bIsReusable)
+    : BaseType()
+    , cmdName(name)
+    , usage(queue)
+    , bIsResetable(bIsReusable)
+{}
+
+//////////////////////////////////////////////////////////////////////////
+//// NullRenderCmdList
+//////////////////////////////////////////////////////////////////////////
+
+NullRenderCmdList::NullRenderCmdList(IGraphicsInstance *graphicsInstance, const GraphicsHelperAPI *graphicsHelper, NullCmdRecorder *cmdRecorder)
+    : graphicsInstanceCache(graphicsInstance)
+    , graphicsHelperCache(graphicsHelper)
+    , recorder(cmdRecorder)
+{}
+
+NullRenderCmdList::~NullRenderCmdList()
+{
+    for (const std::pair<const String, NullCommandBuffer *> &cmdBufferPair : commandBuffers)
+    {
+        cmdBufferPair.second->signalingSemaphore.reset();
+        cmdBufferPair.second->release();
+        delete cmdBufferPair.second;
+    }
+    commandBuffers.clear();
+}
+
+void NullRenderCmdList::newFrame(float timeDelta) { recorder->swapFrame(); }
+
+NullCommandBuffer *NullRenderCmdList::getNullCmdBuffer(const GraphicsResource *cmdBuffer) const
+{
+    debugAssert(cmdBuffer && cmdBuffer->getType()->isChildOf(NullCommandBuffer::staticType()));
+    return const_cast<NullCommandBuffer *>(static_cast<const NullCommandBuffer *>(cmdBuffer));
+}
+
+uint64 NullRenderCmdList::execCopyToBuffer(const BatchCopyBufferData &copyData) const
+{
+    uint8 *dstMemory = NullGraphicsHelper::getHostMemory(copyData.dst.get());
+    if (dstMemory == nullptr || copyData.dataToCopy == nullptr)
+    {
+        LOG_ERROR("NullRenderCmdList", "Invalid buffer or data to copy");
+        return 0;
+    }
+    if (uint64(copyData.dstOffset) + copyData.size > copyData.dst->getResourceSize())
+    {
+        LOG_ERROR(
+            "NullRenderCmdList", "Copy size {} at offset {} overflows buffer {} of size {}", copyData.size, copyData.dstOffset,
+            copyData.dst->getResourceName().getChar(), copyData.dst->getResourceSize()
+        );
+        return 0;
+    }
+    memcpy(dstMemory + copyData.dstOffset, copyData.dataToCopy, copyData.size);
+    return copyData.size;
+}
+
+uint64 NullRenderCmdList::execCopyBuffer(const BufferResourceRef &src, const BufferResourceRef &dst, const CopyBufferInfo &copyInfo) const
+{
+    const uint8 *srcMemory = NullGraphicsHelper::getHostMemory(src.get());
+    uint8 *dstMemory = NullGraphicsHelper::getHostMemory(dst.get());
+    if (srcMemory == nullptr || dstMemory == nullptr)
+    {
+        LOG_ERROR("NullRenderCmdList", "Invalid source or destination buffer to copy");
+        return 0;
+    }
+    if (copyInfo.srcOffset + copyInfo.copySize > src->getResourceSize() || copyInfo.dstOffset + copyInfo.copySize > dst->getResourceSize())
+    {
+        LOG_ERROR(
+            "NullRenderCmdList", "Copy size {} overflows buffers {}(Offset {}) or {}(Offset {})", copyInfo.copySize,
+            src->getResourceName().getChar(), copyInfo.srcOffset, dst->getResourceName().getChar(), copyInfo.dstOffset
+        );
+        return 0;
+    }
+    // Source and destination can be same buffer
+    memmove(dstMemory + copyInfo.dstOffset, srcMemory + copyInfo.srcOffset, copyInfo.copySize);
+    return copyInfo.copySize;
+}
+
+uint64 NullRenderCmdList::execCopyToImage(const ImageResourceRef &dst, const BufferResourceRef &pixelData, CopyPixelsToImageInfo copyInfo) const
+{
+    // Only base MIP is backed by memory
+    if (copyInfo.subres.baseMip != 0)
+    {
+        return 0;
+    }
+    NullImageResource *nullImage = dst.reference<NullImageResource>();
+    const uint8 *srcMemory = NullGraphicsHelper::getHostMemory(pixelData.get());
+    if (srcMemory == nullptr || !nullImage->isValid())
+    {
+        return 0;
+    }
+
+    const UInt3 &imageSize = dst->getImageSize();
+    const uint32 pixelDataSize = EPixelDataFormat::getFormatInfo(dst->imageFormat())->pixelDataSize;
+    copyInfo.subres.baseLayer = Math::min(copyInfo.subres.baseLayer, dst->getLayerCount());
+    copyInfo.subres.layersCount = Math::min(copyInfo.subres.layersCount, dst->getLayerCount() - copyInfo.subres.baseLayer);
+    // Pixels are tightly packed in source as extent sized layers
+    const uint64 srcRowSize = uint64(copyInfo.extent.x) * pixelDataSize;
+    const uint64 srcLayerSize = srcRowSize * copyInfo.extent.y * copyInfo.extent.z;
+    const UInt3 copyExtent = Math::min(copyInfo.extent, imageSize - Math::min(copyInfo.dstOffset, imageSize));
+    const uint64 copyRowSize = uint64(copyExtent.x) * pixelDataSize;
+
+    uint64 bytesCopied = 0;
+    for (uint32 layerIdx = 0; layerIdx < copyInfo.subres.layersCount; ++layerIdx)
+    {
+        uint8 *dstLayer = nullImage->memory() + (copyInfo.subres.baseLayer + layerIdx) * nullImage->layerSize();
+        const uint8 *srcLayer = srcMemory + layerIdx * srcLayerSize;
+        if ((layerIdx + 1) * srcLayerSize > pixelData->getResourceSize())
+        {
+            break;
+        }
+        for (uint32 z = 0; z < copyExtent.z; ++z)
+        {
+            for (uint32 y = 0; y < copyExtent.y; ++y)
+            {
+                const uint64 dstPixelIdx = (uint64(copyInfo.dstOffset.z + z) * imageSize.y + copyInfo.dstOffset.y + y) * imageSize.x
+                                           + copyInfo.dstOffset.x;
+                memcpy(dstLayer + dstPixelIdx * pixelDataSize, srcLayer + (uint64(z) * copyInfo.extent.y + y) * srcRowSize, copyRowSize);
+                bytesCopied += copyRowSize;
+            }
+        }
+    }
+    return bytesCopied;
+}
+
+uint64 NullRenderCmdList::execCopyImage(
+    const ImageResourceRef &src, const ImageResourceRef &dst, const CopyImageInfo &srcInfo, const CopyImageInfo &dstInfo
+) const
+{
+    if (srcInfo.subres.baseMip != 0 || dstInfo.subres.baseMip != 0)
+    {
+        return 0;
+    }
+    const NullImageResource *srcImage = src.reference<NullImageResource>();
+    NullImageResource *dstImage = dst.reference<NullImageResource>();
+    const uint32 pixelDataSize = EPixelDataFormat::getFormatInfo(src->imageFormat())->pixelDataSize;
+    if (!srcImage->isValid() || !dstImage->isValid() || pixelDataSize != EPixelDataFormat::getFormatInfo(dst->imageFormat())->pixelDataSize)
+    {
+        LOG_ERROR(
+            "NullRenderCmdList", "Cannot copy image {} to {}, Invalid images or incompatible formats", src->getResourceName().getChar(),
+            dst->getResourceName().getChar()
+        );
+        return 0;
+    }
+
+    const UInt3 &srcSize = src->getImageSize();
+    const UInt3 &dstSize = dst->getImageSize();
+    const uint32 srcLayers
+        = Math::min(srcInfo.subres.layersCount, src->getLayerCount() - Math::min(srcInfo.subres.baseLayer, src->getLayerCount()));
+    const uint32 dstLayers
+        = Math::min(dstInfo.subres.layersCount, dst->getLayerCount() - Math::min(dstInfo.subres.baseLayer, dst->getLayerCount()));
+    const UInt3 copyExtent = Math::min(
+        Math::min(srcInfo.extent, dstInfo.extent),
+        Math::min(srcSize - Math::min(srcInfo.offset, srcSize), dstSize - Math::min(dstInfo.offset, dstSize))
+    );
+    const uint64 copyRowSize = uint64(copyExtent.x) * pixelDataSize;
+
+    uint64 bytesCopied = 0;
+    for (uint32 layerIdx = 0; layerIdx < Math::min(srcLayers, dstLayers); ++layerIdx)
+    {
+        const uint8 *srcLayer = srcImage->memory() + (srcInfo.subres.baseLayer + layerIdx) * srcImage->layerSize();
+        uint8 *dstLayer = dstImage->memory() + (dstInfo.subres.baseLayer + layerIdx) * dstImage->layerSize();
+        for (uint32 z = 0; z < copyExtent.z; ++z)
+        {
+            for (uint32 y = 0; y < copyExtent.y; ++y)
+            {
+                const uint64 srcPixelIdx = (uint64(srcInfo.offset.z + z) * srcSize.y + srcInfo.offset.y + y) * srcSize.x + srcInfo.offset.x;
+                const uint64 dstPixelIdx = (uint64(dstInfo.offset.z + z) * dstSize.y + dstInfo.offset.y + y) * dstSize.x + dstInfo.offset.x;
+                memmove(dstLayer + dstPixelIdx * pixelDataSize, srcLayer + srcPixelIdx * pixelDataSize, copyRowSize);
+                bytesCopied += copyRowSize;
+            }
+        }
+    }
+    return bytesCopied;
+}
+
+uint64 NullRenderCmdList::execFillImage(const ImageResourceRef &image, const uint8 *pixel, ArrayView<ImageSubresource> subresources) const
+{
+    NullImageResource *nullImage = image.reference<NullImageResource>();
+    if (!nullImage->isValid())
+    {
+        return 0;
+    }
+    const uint32 pixelDataSize = EPixelDataFormat::getFormatInfo(image->imageFormat())->pixelDataSize;
+    const uint64 pixelsPerLayer = nullImage->layerSize() / pixelDataSize;
+
+    uint64 bytesFilled = 0;
+    for (const ImageSubresource &subres : subresources)
+    {
+        if (subres.baseMip != 0)
+        {
+            continue;
+        }
+        const uint32 layersCount
+            = Math::min(subres.layersCount, image->getLayerCount() - Math::min(subres.baseLayer, image->getLayerCount()));
+        for (uint32 layerIdx = 0; layerIdx < layersCount; ++layerIdx)
+        {
+            uint8 *dstLayer = nullImage->memory() + (subres.baseLayer + layerIdx) * nullImage->layerSize();
+            for (uint64 pixelIdx = 0; pixelIdx < pixelsPerLayer; ++pixelIdx)
+            {
+                memcpy(dstLayer + pixelIdx * pixelDataSize, pixel, pixelDataSize);
+            }
+            bytesFilled += nullImage->layerSize();
+        }
+    }
+    return bytesFilled;
+}
+
+bool NullRenderCmdList::clearColorToPixel(
+    std::vector<uint8> &outPixel, const ImageResourceRef &image, const LinearColor &clearColor, bool bIsFloat
+) const
+{
+    const EPixelDataFormat::PixelFormatInfo *formatInfo = EPixelDataFormat::getFormatInfo(image->imageFormat());
+    if (formatInfo == nullptr || formatInfo->pixelDataSize == 0)
+    {
+        return false;
+    }
+
+    // Add 32 bit extra space to staging to compensate 32 mask out of range when copying data
+    const uint32 dataMargin = uint32(Math::ceil(float(sizeof(uint32)) / formatInfo->pixelDataSize));
+    BufferResourceRef stagingBuffer
+        = graphicsHelperCache->createReadOnlyBuffer(graphicsInstanceCache, formatInfo->pixelDataSize, 1 + dataMargin);
+    stagingBuffer->setAsStagingResource(true);
+    stagingBuffer->setDeferredDelete(false);
+    stagingBuffer->setResourceName(image->getResourceName() + TCHAR("_ClearStaging"));
+    stagingBuffer->init();
+
+    uint8 *stagingPtr = reinterpret_cast<uint8 *>(graphicsHelperCache->borrowMappedPtr(graphicsInstanceCache, stagingBuffer));
+    LinearColor pixels[] = { clearColor };
+    copyPixelsTo(stagingBuffer, stagingPtr, pixels, formatInfo, bIsFloat);
+    outPixel.assign(stagingPtr, stagingPtr + formatInfo->pixelDataSize);
+    graphicsHelperCache->returnMappedPtr(graphicsInstanceCache, stagingBuffer);
+
+    stagingBuffer->release();
+    stagingBuffer.reset();
+    return true;
+}
+
+void NullRenderCmdList::recordDraw(
+    ENullCmdType::Type cmdType, const GraphicsResource *cmdBuffer, uint32 first, uint32 count, uint32 firstInstance, uint32 instanceCount
+) const
+{
+    recorder->currentStats.drawCalls++;
+    recorder->currentStats.verticesDrawn += uint64(count) * instanceCount;
+    recorder->currentStats.instancesDrawn += instanceCount;
+    recorder->record(cmdType, cmdBuffer, first, count, firstInstance, instanceCount);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//// Immediate commands
+//////////////////////////////////////////////////////////////////////////
+
+void NullRenderCmdList::copyToBuffer(BufferResourceRef dst, uint32 dstOffset, const void *dataToCopy, uint32 size)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    const uint64 bytesCopied = execCopyToBuffer(BatchCopyBufferData{ dst, dstOffset, dataToCopy, size });
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyBuffer, nullptr, uint32(bytesCopied), 1);
+}
+
+void NullRenderCmdList::copyBuffer(BufferResourceRef src, BufferResourceRef dst, ArrayView<CopyBufferInfo> copies)
+{
+    cmdCopyBuffer(nullptr, src, dst, copies);
+}
+
+void NullRenderCmdList::copyToBuffer(ArrayView<BatchCopyBufferData> batchCopies) { cmdCopyToBuffer(nullptr, batchCopies); }
+
+void NullRenderCmdList::copyBuffer(ArrayView<BatchCopyBufferInfo> batchCopies) { cmdCopyBuffer(nullptr, batchCopies); }
+
+void NullRenderCmdList::copyToImage(ImageResourceRef dst, ArrayView<class Color> pixelData, const CopyPixelsToImageInfo &copyInfo)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    fatalAssertf(dst->isValid(), "Invalid image resource {}", dst->getResourceName().getChar());
+    if (EPixelDataFormat::isDepthFormat(dst->imageFormat()) || EPixelDataFormat::isFloatingFormat(dst->imageFormat()))
+    {
+        LOG_ERROR("NullRenderCmdList", "Depth/Float format is not supported for copying from Color data");
+        return;
+    }
+    const EPixelDataFormat::PixelFormatInfo *formatInfo = EPixelDataFormat::getFormatInfo(dst->imageFormat());
+
+    // Add 32 bit extra space to staging to compensate 32 mask out of range when copying data
+    uint32 dataMargin = uint32(Math::ceil(float(sizeof(uint32)) / formatInfo->pixelDataSize));
+    BufferResourceRef stagingBuffer
+        = graphicsHelperCache->createReadOnlyBuffer(graphicsInstanceCache, formatInfo->pixelDataSize, uint32(pixelData.size()) + dataMargin);
+    stagingBuffer->setAsStagingResource(true);
+    stagingBuffer->setDeferredDelete(false);
+    stagingBuffer->setResourceName(dst->getResourceName() + TCHAR("_Staging"));
+    stagingBuffer->init();
+
+    uint8 *stagingPtr = reinterpret_cast<uint8 *>(graphicsHelperCache->borrowMappedPtr(graphicsInstanceCache, stagingBuffer));
+    if (!simpleCopyPixelsTo(stagingBuffer, stagingPtr, pixelData, dst->imageFormat(), formatInfo))
+    {
+        copyPixelsTo(stagingBuffer, stagingPtr, pixelData, formatInfo);
+    }
+    graphicsHelperCache->returnMappedPtr(graphicsInstanceCache, stagingBuffer);
+
+    const uint64 bytesCopied = execCopyToImage(dst, stagingBuffer, copyInfo);
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyToImage, nullptr, uint32(bytesCopied), 1);
+
+    stagingBuffer->release();
+    stagingBuffer.reset();
+}
+
+void NullRenderCmdList::copyToImage(ImageResourceRef dst, ArrayView<class LinearColor> pixelData, const CopyPixelsToImageInfo &copyInfo)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    fatalAssertf(dst->isValid(), "Invalid image resource {}", dst->getResourceName().getChar());
+    const EPixelDataFormat::PixelFormatInfo *formatInfo = EPixelDataFormat::getFormatInfo(dst->imageFormat());
+    if (EPixelDataFormat::isDepthFormat(dst->imageFormat())
+        && (formatInfo->componentSize[0] != 32 || EPixelDataFormat::isStencilFormat(dst->imageFormat())))
+    {
+        LOG_ERROR("NullRenderCmdList", "Depth/Float format with size other than 32bit is not supported for copying from Color data");
+        return;
+    }
+
+    // Add 32 bit extra space to staging to compensate 32 mask out of range when copying data
+    uint32 dataMargin = uint32(Math::ceil(float(sizeof(uint32)) / formatInfo->pixelDataSize));
+    BufferResourceRef stagingBuffer
+        = graphicsHelperCache->createReadOnlyBuffer(graphicsInstanceCache, formatInfo->pixelDataSize, uint32(pixelData.size()) + dataMargin);
+    stagingBuffer->setAsStagingResource(true);
+    stagingBuffer->setDeferredDelete(false);
+    stagingBuffer->setResourceName(dst->getResourceName() + TCHAR("_Staging"));
+    stagingBuffer->init();
+
+    uint8 *stagingPtr = reinterpret_cast<uint8 *>(graphicsHelperCache->borrowMappedPtr(graphicsInstanceCache, stagingBuffer));
+    copyPixelsTo(
+        stagingBuffer, stagingPtr, pixelData, formatInfo,
+        EPixelDataFormat::isDepthFormat(dst->imageFormat()) || EPixelDataFormat::isFloatingFormat(dst->imageFormat())
+    );
+    graphicsHelperCache->returnMappedPtr(graphicsInstanceCache, stagingBuffer);
+
+    const uint64 bytesCopied = execCopyToImage(dst, stagingBuffer, copyInfo);
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyToImage, nullptr, uint32(bytesCopied), 1);
+
+    stagingBuffer->release();
+    stagingBuffer.reset();
+}
+
+void NullRenderCmdList::copyToImageLinearMapped(ImageResourceRef dst, ArrayView<class Color> pixelData, const CopyPixelsToImageInfo &copyInfo)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    fatalAssertf(dst->isValid(), "Invalid image resource {}", dst->getResourceName().getChar());
+    if (EPixelDataFormat::isDepthFormat(dst->imageFormat()) || EPixelDataFormat::isFloatingFormat(dst->imageFormat()))
+    {
+        LOG_ERROR("NullRenderCmdList", "Depth/Float format is not supported for copying from Color data");
+        return;
+    }
+    const EPixelDataFormat::PixelFormatInfo *formatInfo = EPixelDataFormat::getFormatInfo(dst->imageFormat());
+
+    // Add 32 bit extra space to staging to compensate 32 mask out of range when copying data
+    uint32 dataMargin = uint32(Math::ceil(float(sizeof(uint32)) / formatInfo->pixelDataSize));
+    BufferResourceRef stagingBuffer
+        = graphicsHelperCache->createReadOnlyBuffer(graphicsInstanceCache, formatInfo->pixelDataSize, uint32(pixelData.size()) + dataMargin);
+    stagingBuffer->setAsStagingResource(true);
+    stagingBuffer->setDeferredDelete(false);
+    stagingBuffer->setResourceName(dst->getResourceName() + TCHAR("_Staging"));
+    stagingBuffer->init();
+
+    uint8 *stagingPtr = reinterpret_cast<uint8 *>(graphicsHelperCache->borrowMappedPtr(graphicsInstanceCache, stagingBuffer));
+    copyPixelsLinearMappedTo(stagingBuffer, stagingPtr, pixelData, formatInfo);
+    graphicsHelperCache->returnMappedPtr(graphicsInstanceCache, stagingBuffer);
+
+    const uint64 bytesCopied = execCopyToImage(dst, stagingBuffer, copyInfo);
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyToImage, nullptr, uint32(bytesCopied), 1);
+
+    stagingBuffer->release();
+    stagingBuffer.reset();
+}
+
+void NullRenderCmdList::copyOrResolveImage(
+    ImageResourceRef src, ImageResourceRef dst, const CopyImageInfo &srcInfo, const CopyImageInfo &dstInfo
+)
+{
+    cmdCopyOrResolveImage(nullptr, src, dst, srcInfo, dstInfo);
+}
+
+void NullRenderCmdList::clearImage(ImageResourceRef image, const LinearColor &clearColor, ArrayView<ImageSubresource> subresources)
+{
+    cmdClearImage(nullptr, image, clearColor, subresources);
+}
+
+void NullRenderCmdList::clearDepth(ImageResourceRef image, float depth, uint32 stencil, ArrayView<ImageSubresource> subresources)
+{
+    cmdClearDepth(nullptr, image, depth, stencil, subresources);
+}
+
+void NullRenderCmdList::setupInitialLayout(ImageResourceRef image) { recorder->record(ENullCmdType::TransitionLayout, nullptr, 1); }
+
+void NullRenderCmdList::presentImage(
+    ArrayView<WindowCanvasRef> canvases, ArrayView<uint32> imageIndices, ArrayView<SemaphoreRef> waitOnSemaphores
+)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+    for (uint32 i = 0; i < canvases.size(); ++i)
+    {
+        recorder->record(ENullCmdType::Present, nullptr, imageIndices[i]);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//// Command buffer commands
+//////////////////////////////////////////////////////////////////////////
+
+void NullRenderCmdList::cmdCopyBuffer(
+    const GraphicsResource *cmdBuffer, BufferResourceRef src, BufferResourceRef dst, ArrayView<CopyBufferInfo> copies
+)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    uint64 bytesCopied = 0;
+    for (const CopyBufferInfo &copyInfo : copies)
+    {
+        bytesCopied += execCopyBuffer(src, dst, copyInfo);
+    }
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyBuffer, cmdBuffer, uint32(bytesCopied), uint32(copies.size()));
+}
+
+void NullRenderCmdList::cmdCopyBuffer(const GraphicsResource *cmdBuffer, ArrayView<BatchCopyBufferInfo> copies)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    uint64 bytesCopied = 0;
+    for (const BatchCopyBufferInfo &copyInfo : copies)
+    {
+        bytesCopied += execCopyBuffer(copyInfo.src, copyInfo.dst, copyInfo.copyInfo);
+    }
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyBuffer, cmdBuffer, uint32(bytesCopied), uint32(copies.size()));
+}
+
+void NullRenderCmdList::cmdCopyToBuffer(const GraphicsResource *cmdBuffer, ArrayView<BatchCopyBufferData> batchCopies)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    uint64 bytesCopied = 0;
+    for (const BatchCopyBufferData &copyData : batchCopies)
+    {
+        bytesCopied += execCopyToBuffer(copyData);
+    }
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyBuffer, cmdBuffer, uint32(bytesCopied), uint32(batchCopies.size()));
+}
+
+void NullRenderCmdList::cmdCopyOrResolveImage(
+    const GraphicsResource *cmdBuffer, ImageResourceRef src, ImageResourceRef dst, const CopyImageInfo &srcInfo, const CopyImageInfo &dstInfo
+)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    // Resolving is same as copying as there is no multi sampled memory
+    const uint64 bytesCopied = execCopyImage(src, dst, srcInfo, dstInfo);
+    recorder->currentStats.bytesCopied += bytesCopied;
+    recorder->record(ENullCmdType::CopyImage, cmdBuffer, uint32(bytesCopied), 1);
+}
+
+void NullRenderCmdList::cmdTransitionLayouts(const GraphicsResource *cmdBuffer, ArrayView<ImageResourceRef> images)
+{
+    recorder->record(ENullCmdType::TransitionLayout, cmdBuffer, uint32(images.size()));
+}
+
+void NullRenderCmdList::cmdClearImage(
+    const GraphicsResource *cmdBuffer, ImageResourceRef image, const LinearColor &clearColor, ArrayView<ImageSubresource> subresources
+)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    uint64 bytesCleared = 0;
+    std::vector<uint8> pixel;
+    if (EPixelDataFormat::isDepthFormat(image->imageFormat()))
+    {
+        LOG_ERROR("NullRenderCmdList", "Depth image {} must be cleared using clearDepth", image->getResourceName().getChar());
+    }
+    else if (clearColorToPixel(pixel, image, clearColor, EPixelDataFormat::isFloatingFormat(image->imageFormat())))
+    {
+        bytesCleared = execFillImage(image, pixel.data(), subresources);
+    }
+    recorder->currentStats.bytesCopied += bytesCleared;
+    recorder->record(ENullCmdType::ClearImage, cmdBuffer, uint32(bytesCleared), uint32(subresources.size()));
+}
+
+void NullRenderCmdList::cmdClearDepth(
+    const GraphicsResource *cmdBuffer, ImageResourceRef image, float depth, uint32 stencil, ArrayView<ImageSubresource> subresources
+)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    uint64 bytesCleared = 0;
+    const EPixelDataFormat::PixelFormatInfo *formatInfo = EPixelDataFormat::getFormatInfo(image->imageFormat());
+    // Only 32bit float depth has a known host layout, Other depth formats are just recorded
+    if (EPixelDataFormat::isDepthFormat(image->imageFormat()) && !EPixelDataFormat::isStencilFormat(image->imageFormat())
+        && formatInfo->componentSize[0] == 32)
+    {
+        bytesCleared = execFillImage(image, reinterpret_cast<const uint8 *>(&depth), subresources);
+    }
+    recorder->currentStats.bytesCopied += bytesCleared;
+    recorder->record(ENullCmdType::ClearImage, cmdBuffer, uint32(bytesCleared), uint32(subresources.size()));
+}
+
+void NullRenderCmdList::cmdBarrierResources(const GraphicsResource *cmdBuffer, ArrayView<ShaderParametersRef> descriptorsSets)
+{
+    recorder->record(ENullCmdType::Barrier, cmdBuffer, uint32(descriptorsSets.size()));
+}
+
+void NullRenderCmdList::cmdBarrierVertices(const GraphicsResource *cmdBuffer, ArrayView<BufferResourceRef> vertexBuffers)
+{
+    recorder->record(ENullCmdType::Barrier, cmdBuffer, uint32(vertexBuffers.size()));
+}
+
+void NullRenderCmdList::cmdBarrierIndices(const GraphicsResource *cmdBuffer, ArrayView<BufferResourceRef> indexBuffers)
+{
+    recorder->record(ENullCmdType::Barrier, cmdBuffer, uint32(indexBuffers.size()));
+}
+
+void NullRenderCmdList::cmdBarrierIndirectDraws(const GraphicsResource *cmdBuffer, ArrayView<BufferResourceRef> indirectDrawBuffers)
+{
+    recorder->record(ENullCmdType::Barrier, cmdBuffer, uint32(indirectDrawBuffers.size()));
+}
+
+void NullRenderCmdList::cmdReleaseQueueResources(const GraphicsResource *cmdBuffer, EQueueFunction releaseToQueue)
+{
+    recorder->record(ENullCmdType::ReleaseQueue, cmdBuffer, uint32(releaseToQueue));
+}
+
+void NullRenderCmdList::cmdReleaseQueueResources(
+    const GraphicsResource *cmdBuffer, EQueueFunction releaseToQueue,
+    const std::unordered_map<MemoryResourceRef, EQueueFunction> &perResourceRelease
+)
+{
+    recorder->record(ENullCmdType::ReleaseQueue, cmdBuffer, uint32(releaseToQueue), uint32(perResourceRelease.size()));
+}
+
+void NullRenderCmdList::cmdBeginRenderPass(
+    const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline, const IRect &renderArea,
+    const RenderPassAdditionalProps &renderpassAdditionalProps, const RenderPassClearValue &clearColor
+)
+{
+    getNullCmdBuffer(cmdBuffer)->cmdState = ECmdState::RenderPass;
+    recorder->record(
+        ENullCmdType::BeginRenderPass, cmdBuffer, uint32(renderArea.minBound.x), uint32(renderArea.minBound.y), uint32(renderArea.maxBound.x),
+        uint32(renderArea.maxBound.y)
+    );
+}
+
+void NullRenderCmdList::cmdEndRenderPass(const GraphicsResource *cmdBuffer)
+{
+    getNullCmdBuffer(cmdBuffer)->cmdState = ECmdState::Recording;
+    recorder->record(ENullCmdType::EndRenderPass, cmdBuffer);
+}
+
+void NullRenderCmdList::cmdBindGraphicsPipeline(
+    const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline, const GraphicsPipelineState &state
+) const
+{
+    recorder->record(ENullCmdType::BindPipeline, cmdBuffer);
+}
+
+void NullRenderCmdList::cmdBindComputePipeline(const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline) const
+{
+    recorder->record(ENullCmdType::BindPipeline, cmdBuffer);
+}
+
+void NullRenderCmdList::cmdPushConstants(
+    const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline, uint32 stagesUsed, const uint8 *data,
+    ArrayView<CopyBufferInfo> pushConsts
+) const
+{
+    recorder->record(ENullCmdType::PushConstants, cmdBuffer, stagesUsed, uint32(pushConsts.size()));
+}
+
+void NullRenderCmdList::cmdBindDescriptorsSetInternal(
+    const GraphicsResource *cmdBuffer, const PipelineBase *contextPipeline, const std::map<uint32, ShaderParametersRef> &descriptorsSets
+) const
+{
+    recorder->record(ENullCmdType::BindDescriptors, cmdBuffer, uint32(descriptorsSets.size()));
+}
+
+void NullRenderCmdList::cmdBindDescriptorsSetsInternal(
+    const GraphicsResource *cmdBuffer, const PipelineBase *contextPipeline, ArrayView<ShaderParametersRef> descriptorsSets
+) const
+{
+    recorder->record(ENullCmdType::BindDescriptors, cmdBuffer, uint32(descriptorsSets.size()));
+}
+
+void NullRenderCmdList::cmdBindVertexBuffer(
+    const GraphicsResource *cmdBuffer, uint32 firstBinding, BufferResourceRef vertexBuffer, uint64 offset
+)
+{
+    recorder->record(ENullCmdType::BindVertexBuffer, cmdBuffer, firstBinding, 1);
+}
+
+void NullRenderCmdList::cmdBindVertexBuffers(
+    const GraphicsResource *cmdBuffer, uint32 firstBinding, ArrayView<BufferResourceRef> vertexBuffers, ArrayView<uint64> offsets
+)
+{
+    recorder->record(ENullCmdType::BindVertexBuffer, cmdBuffer, firstBinding, uint32(vertexBuffers.size()));
+}
+
+void NullRenderCmdList::cmdBindIndexBuffer(const GraphicsResource *cmdBuffer, const BufferResourceRef &indexBuffer, uint64 offset /*= 0*/)
+{
+    recorder->record(ENullCmdType::BindIndexBuffer, cmdBuffer, indexBuffer->bufferStride());
+}
+
+void NullRenderCmdList::cmdDispatch(const GraphicsResource *cmdBuffer, uint32 groupSizeX, uint32 groupSizeY, uint32 groupSizeZ /*= 1*/) const
+{
+    recorder->currentStats.dispatches++;
+    recorder->record(ENullCmdType::Dispatch, cmdBuffer, groupSizeX, groupSizeY, groupSizeZ);
+}
+
+void NullRenderCmdList::cmdDrawIndexed(
+    const GraphicsResource *cmdBuffer, uint32 firstIndex, uint32 indexCount, uint32 firstInstance /*= 0*/, uint32 instanceCount /*= 1*/,
+    int32 vertexOffset /*= 0*/
+) const
+{
+    recordDraw(ENullCmdType::DrawIndexed, cmdBuffer, firstIndex, indexCount, firstInstance, instanceCount);
+}
+
+void NullRenderCmdList::cmdDrawVertices(
+    const GraphicsResource *cmdBuffer, uint32 firstVertex, uint32 vertexCount, uint32 firstInstance /*= 0*/, uint32 instanceCount /*= 1*/
+) const
+{
+    recordDraw(ENullCmdType::DrawVertices, cmdBuffer, firstVertex, vertexCount, firstInstance, instanceCount);
+}
+
+void NullRenderCmdList::cmdDrawIndexedIndirect(
+    const GraphicsResource *cmdBuffer, const BufferResourceRef &drawCmdsBuffer, uint32 bufferOffset, uint32 drawCount, uint32 stride
+)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    const uint8 *drawCmds = NullGraphicsHelper::getHostMemory(drawCmdsBuffer.get());
+    if (drawCmds == nullptr)
+    {
+        return;
+    }
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        const uint64 drawCmdOffset = bufferOffset + uint64(i) * stride;
+        if (drawCmdOffset + sizeof(DrawIndexedIndirectCommand) > drawCmdsBuffer->getResourceSize())
+        {
+            LOG_ERROR("NullRenderCmdList", "Indirect draw {} is out of buffer {}", i, drawCmdsBuffer->getResourceName().getChar());
+            break;
+        }
+        DrawIndexedIndirectCommand drawCmd;
+        memcpy(&drawCmd, drawCmds + drawCmdOffset, sizeof(DrawIndexedIndirectCommand));
+        recordDraw(
+            ENullCmdType::DrawIndexedIndirect, cmdBuffer, drawCmd.firstIndex, drawCmd.indexCount, drawCmd.firstInstance, drawCmd.instanceCount
+        );
+    }
+}
+
+void NullRenderCmdList::cmdDrawIndirect(
+    const GraphicsResource *cmdBuffer, const BufferResourceRef &drawCmdsBuffer, uint32 bufferOffset, uint32 drawCount, uint32 stride
+)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    const uint8 *drawCmds = NullGraphicsHelper::getHostMemory(drawCmdsBuffer.get());
+    if (drawCmds == nullptr)
+    {
+        return;
+    }
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        const uint64 drawCmdOffset = bufferOffset + uint64(i) * stride;
+        if (drawCmdOffset + sizeof(DrawIndirectCommand) > drawCmdsBuffer->getResourceSize())
+        {
+            LOG_ERROR("NullRenderCmdList", "Indirect draw {} is out of buffer {}", i, drawCmdsBuffer->getResourceName().getChar());
+            break;
+        }
+        DrawIndirectCommand drawCmd;
+        memcpy(&drawCmd, drawCmds + drawCmdOffset, sizeof(DrawIndirectCommand));
+        recordDraw(
+            ENullCmdType::DrawIndirect, cmdBuffer, drawCmd.firstVertex, drawCmd.vertexCount, drawCmd.firstInstance, drawCmd.instanceCount
+        );
+    }
+}
+
+void NullRenderCmdList::cmdSetViewportAndScissors(
+    const GraphicsResource *cmdBuffer, ArrayView<std::pair<IRect, IRect>> viewportAndScissors, uint32 firstViewport /*= 0*/
+) const
+{
+    recorder->record(ENullCmdType::DynamicState, cmdBuffer, firstViewport, uint32(viewportAndScissors.size()));
+}
+
+void NullRenderCmdList::cmdSetViewportAndScissor(
+    const GraphicsResource *cmdBuffer, const IRect &viewport, const IRect &scissor, uint32 atViewport /*= 0*/
+) const
+{
+    recorder->record(ENullCmdType::DynamicState, cmdBuffer, atViewport, 1);
+}
+
+void NullRenderCmdList::cmdSetScissor(const GraphicsResource *cmdBuffer, const IRect &scissor, uint32 atViewport /*= 0*/) const
+{
+    recorder->record(ENullCmdType::DynamicState, cmdBuffer, atViewport, 1);
+}
+
+void NullRenderCmdList::cmdSetLineWidth(const GraphicsResource *cmdBuffer, float lineWidth) const
+{
+    recorder->record(ENullCmdType::DynamicState, cmdBuffer);
+}
+
+void NullRenderCmdList::cmdSetDepthBias(const GraphicsResource *cmdBuffer, float constantBias, float slopeFactor, float clampValue) const
+{
+    recorder->record(ENullCmdType::DynamicState, cmdBuffer);
+}
+
+void NullRenderCmdList::cmdBeginBufferMarker(
+    const GraphicsResource *commandBuffer, const String &name, const LinearColor &color /*= LinearColorConst::WHITE*/
+) const
+{
+    recorder->record(ENullCmdType::Marker, commandBuffer, 1);
+}
+
+void NullRenderCmdList::cmdInsertBufferMarker(
+    const GraphicsResource *commandBuffer, const String &name, const LinearColor &color /*= LinearColorConst::WHITE*/
+) const
+{
+    recorder->record(ENullCmdType::Marker, commandBuffer, 0);
+}
+
+void NullRenderCmdList::cmdEndBufferMarker(const GraphicsResource *commandBuffer) const
+{
+    recorder->record(ENullCmdType::Marker, commandBuffer, 2);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//// Command buffer management
+//////////////////////////////////////////////////////////////////////////
+
+const GraphicsResource *NullRenderCmdList::startCmd(const String &uniqueName, EQueueFunction queue, bool bIsReusable)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    NullCommandBuffer *cmdBuffer = nullptr;
+    auto cmdBufferItr = commandBuffers.find(uniqueName);
+    if (cmdBufferItr == commandBuffers.end())
+    {
+        cmdBuffer = new NullCommandBuffer(uniqueName, queue, bIsReusable);
+        cmdBuffer->init();
+        commandBuffers[uniqueName] = cmdBuffer;
+    }
+    else
+    {
+        cmdBuffer = cmdBufferItr->second;
+        switch (cmdBuffer->cmdState)
+        {
+        case ECmdState::Recording:
+        case ECmdState::RenderPass:
+            LOG_WARN("NullRenderCmdList", "Command buffer {} is already being recorded", uniqueName.getChar());
+            return cmdBuffer;
+        case ECmdState::Submitted:
+            LOG_ERROR("NullRenderCmdList", "Command buffer {} is submitted and not finished before recording again", uniqueName.getChar());
+            fatalAssertf(false, "Submitted command buffer {} cannot be recorded", uniqueName.getChar());
+            return cmdBuffer;
+        case ECmdState::Recorded:
+            fatalAssertf(cmdBuffer->bIsResetable, "Record once command buffer {} cannot be recorded again", uniqueName.getChar());
+            break;
+        case ECmdState::Idle:
+        default:
+            break;
+        }
+    }
+
+    cmdBuffer->cmdState = ECmdState::Recording;
+    recorder->currentStats.cmdBuffersRecorded++;
+    recorder->record(ENullCmdType::StartCmd, cmdBuffer, uint32(queue), bIsReusable ? 1 : 0);
+    return cmdBuffer;
+}
+
+void NullRenderCmdList::endCmd(const GraphicsResource *cmdBuffer)
+{
+    NullCommandBuffer *nullCmdBuffer = getNullCmdBuffer(cmdBuffer);
+    debugAssert(nullCmdBuffer->cmdState == ECmdState::Recording);
+    nullCmdBuffer->cmdState = ECmdState::Recorded;
+    recorder->record(ENullCmdType::EndCmd, cmdBuffer);
+}
+
+void NullRenderCmdList::freeCmd(const GraphicsResource *cmdBuffer)
+{
+    NullCommandBuffer *nullCmdBuffer = getNullCmdBuffer(cmdBuffer);
+    commandBuffers.erase(nullCmdBuffer->getResourceName());
+    nullCmdBuffer->signalingSemaphore.reset();
+    nullCmdBuffer->release();
+    delete nullCmdBuffer;
+}
+
+void NullRenderCmdList::submitCmdBuffers(const std::vector<const GraphicsResource *> &cmdBuffers, FenceRef fence)
+{
+    for (const GraphicsResource *cmdBuffer : cmdBuffers)
+    {
+        NullCommandBuffer *nullCmdBuffer = getNullCmdBuffer(cmdBuffer);
+        if (nullCmdBuffer->cmdState != ECmdState::Recorded)
+        {
+            LOG_ERROR("NullRenderCmdList", "Command buffer {} is not recorded before submit", nullCmdBuffer->getResourceName().getChar());
+            continue;
+        }
+        nullCmdBuffer->cmdState = ECmdState::Submitted;
+        // Nothing to execute so the semaphore is signaled right away
+        nullCmdBuffer->signalingSemaphore = graphicsHelperCache->createTimelineSemaphore(
+            graphicsInstanceCache, (nullCmdBuffer->getResourceName() + TCHAR("_Semaphore")).getChar()
+        );
+        nullCmdBuffer->signalingSemaphore->init();
+        nullCmdBuffer->signalingSemaphore->resetSignal(1);
+    }
+    if (fence.isValid())
+    {
+        fence.reference<NullFence>()->signal();
+    }
+    recorder->currentStats.submits++;
+    recorder->record(ENullCmdType::Submit, nullptr, uint32(cmdBuffers.size()));
+}
+
+void NullRenderCmdList::submitCmd(EQueuePriority::Enum priority, const CommandSubmitInfo &submitInfo, FenceRef fence)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+
+    submitCmdBuffers(submitInfo.cmdBuffers, fence);
+    for (const TimelineSemaphoreSubmitInfo &signalTimeline : submitInfo.signalTimelines)
+    {
+        signalTimeline.semaphore->resetSignal(signalTimeline.value);
+    }
+}
+
+void NullRenderCmdList::submitCmds(EQueuePriority::Enum priority, ArrayView<CommandSubmitInfo> submitInfos, FenceRef fence)
+{
+    for (const CommandSubmitInfo &submitInfo : submitInfos)
+    {
+        submitCmd(priority, submitInfo, fence);
+    }
+}
+
+void NullRenderCmdList::submitWaitCmd(EQueuePriority::Enum priority, const CommandSubmitInfo2 &submitInfo)
+{
+    submitCmd(priority, submitInfo);
+    for (const GraphicsResource *cmdBuffer : submitInfo.cmdBuffers)
+    {
+        finishCmd(cmdBuffer);
+    }
+}
+
+void NullRenderCmdList::submitCmds(EQueuePriority::Enum priority, ArrayView<CommandSubmitInfo2> submitInfos)
+{
+    for (const CommandSubmitInfo2 &submitInfo : submitInfos)
+    {
+        submitCmd(priority, submitInfo);
+    }
+}
+
+void NullRenderCmdList::submitCmd(EQueuePriority::Enum priority, const CommandSubmitInfo2 &command)
+{
+    ScopedRecordTime recordTime(recorder->currentStats);
+    // Commands waited on are already complete as nothing is executed
+    submitCmdBuffers(command.cmdBuffers, nullptr);
+}
+
+void NullRenderCmdList::finishCmd(const GraphicsResource *cmdBuffer)
+{
+    NullCommandBuffer *nullCmdBuffer = getNullCmdBuffer(cmdBuffer);
+    if (nullCmdBuffer->cmdState == ECmdState::Submitted)
+    {
+        nullCmdBuffer->cmdState = ECmdState::Recorded;
+        nullCmdBuffer->signalingSemaphore.reset();
+    }
+}
+
+void NullRenderCmdList::finishCmd(const String &uniqueName)
+{
+    auto cmdBufferItr = commandBuffers.find(uniqueName);
+    if (cmdBufferItr != commandBuffers.end())
+    {
+        finishCmd(cmdBufferItr->second);
+    }
+}
+
+const GraphicsResource *NullRenderCmdList::getCmdBuffer(const String &uniqueName) const
+{
+    auto cmdBufferItr = commandBuffers.find(uniqueName);
+    return cmdBufferItr != commandBuffers.cend() ? cmdBufferItr->second : nullptr;
+}
+
+TimelineSemaphoreRef NullRenderCmdList::getCmdSignalSemaphore(const String &uniqueName) const
+{
+    const GraphicsResource *cmdBuffer = getCmdBuffer(uniqueName);
+    return cmdBuffer ? getCmdSignalSemaphore(cmdBuffer) : TimelineSemaphoreRef();
+}
+
+TimelineSemaphoreRef NullRenderCmdList::getCmdSignalSemaphore(const GraphicsResource *cmdBuffer) const
+{
+    const NullCommandBuffer *nullCmdBuffer = getNullCmdBuffer(cmdBuffer);
+    return nullCmdBuffer->cmdState == ECmdState::Submitted ? nullCmdBuffer->signalingSemaphore : TimelineSemaphoreRef();
+}
+
+void NullRenderCmdList::waitIdle() { flushAllcommands(); }
+
+void NullRenderCmdList::waitOnResDepCmds(const MemoryResourceRef &resource) {}
+
+void NullRenderCmdList::flushAllcommands()
+{
+    for (const std::pair<const String, NullCommandBuffer *> &cmdBufferPair : commandBuffers)
+    {
+        finishCmd(cmdBufferPair.second);
+    }
+}
+
+bool NullRenderCmdList::hasCmdsUsingResource(const MemoryResourceRef &resource, bool bFinishCmds) { return false; }
@@ -0,0 +1,222 @@
+/*!
+ * \file NullRenderCmdList.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+#include "NullRHIModule.h"
+#include "RenderInterface/Rendering/CommandBuffer.h"
+#include "RenderInterface/Rendering/IRenderCommandList.h"
+
+#include <map>
+
+class IGraphicsInstance;
+class GraphicsHelperAPI;
+
+// Collects the commands and stats of null command list per frame
+struct NullCmdRecorder
+{
+    bool bRecordCmds = true;
+
+    NullRHIFrameStats currentStats;
+    NullRHIFrameStats lastStats;
+    std::vector<NullRecordedCmd> currentCmds;
+    std::vector<NullRecordedCmd> lastCmds;
+
+    void record(
+        ENullCmdType::Type cmdType, const GraphicsResource *cmdBuffer, uint32 arg0 = 0, uint32 arg1 = 0, uint32 arg2 = 0, uint32 arg3 = 0
+    );
+    // Moves current frame into last frame and starts a new frame
+    void swapFrame();
+};
+
+class NullCommandBuffer final : public GraphicsResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullCommandBuffer, , GraphicsResource, )
+private:
+    String cmdName;
+
+    NullCommandBuffer() = default;
+
+public:
+    EQueueFunction usage = EQueueFunction::Generic;
+    bool bIsResetable = false;
+    ECmdState cmdState = ECmdState::Idle;
+    // Valid only after submit until the command is finished
+    TimelineSemaphoreRef signalingSemaphore;
+
+    NullCommandBuffer(const String &name, EQueueFunction queue, bool bIsReusable);
+
+    /* GraphicsResource overrides */
+    String getResourceName() const override { return cmdName; }
+    void setResourceName(const String &name) override { cmdName = name; }
+    /* Override ends */
+};
+
+/**
+ * Every command is executed immediately when recorded, Copies and clears are done on resource's host memory. Everything else is only recorded
+ * into the NullCmdRecorder. Submitted commands are complete as soon as they are submitted.
+ */
+class NullRenderCmdList final : public IRenderCommandList
+{
+private:
+    IGraphicsInstance *graphicsInstanceCache;
+    const GraphicsHelperAPI *graphicsHelperCache;
+    // Recorder is owned by graphics instance so it can be used inside const commands
+    NullCmdRecorder *recorder;
+
+    std::map<String, NullCommandBuffer *> commandBuffers;
+
+private:
+    NullCommandBuffer *getNullCmdBuffer(const GraphicsResource *cmdBuffer) const;
+
+    // Each returns the bytes actually written to host memory
+    uint64 execCopyToBuffer(const BatchCopyBufferData &copyData) const;
+    uint64 execCopyBuffer(const BufferResourceRef &src, const BufferResourceRef &dst, const CopyBufferInfo &copyInfo) const;
+    uint64 execCopyToImage(const ImageResourceRef &dst, const BufferResourceRef &pixelData, CopyPixelsToImageInfo copyInfo) const;
+    uint64 execCopyImage(const ImageResourceRef &src, const ImageResourceRef &dst, const CopyImageInfo &srcInfo, const CopyImageInfo &dstInfo)
+        const;
+    // Fills all base MIP layers in subresources with a single pixel's data
+    uint64 execFillImage(const ImageResourceRef &image, const uint8 *pixel, ArrayView<ImageSubresource> subresources) const;
+    // Converts clear color to image format's pixel, Returns false if format is not supported
+    bool clearColorToPixel(std::vector<uint8> &outPixel, const ImageResourceRef &image, const LinearColor &clearColor, bool bIsFloat) const;
+
+    void recordDraw(
+        ENullCmdType::Type cmdType, const GraphicsResource *cmdBuffer, uint32 first, uint32 count, uint32 firstInstance, uint32 instanceCount
+    ) const;
+
+    // Marks all cmds in submit as submitted and completed
+    void submitCmdBuffers(const std::vector<const GraphicsResource *> &cmdBuffers, FenceRef fence);
+
+public:
+    NullRenderCmdList(IGraphicsInstance *graphicsInstance, const GraphicsHelperAPI *graphicsHelper, NullCmdRecorder *cmdRecorder);
+    ~NullRenderCmdList();
+
+    void newFrame(float timeDelta) final;
+
+    void copyToBuffer(BufferResourceRef dst, uint32 dstOffset, const void *dataToCopy, uint32 size) final;
+    void copyBuffer(BufferResourceRef src, BufferResourceRef dst, ArrayView<CopyBufferInfo> copies) final;
+    void copyToBuffer(ArrayView<BatchCopyBufferData> batchCopies) final;
+    void copyBuffer(ArrayView<BatchCopyBufferInfo> batchCopies) final;
+
+    void copyToImage(ImageResourceRef dst, ArrayView<class Color> pixelData, const CopyPixelsToImageInfo &copyInfo) final;
+    void copyToImage(ImageResourceRef dst, ArrayView<class LinearColor> pixelData, const CopyPixelsToImageInfo &copyInfo) final;
+    void copyToImageLinearMapped(ImageResourceRef dst, ArrayView<class Color> pixelData, const CopyPixelsToImageInfo &copyInfo) final;
+    void copyOrResolveImage(ImageResourceRef src, ImageResourceRef dst, const CopyImageInfo &srcInfo, const CopyImageInfo &dstInfo) final;
+
+    void clearImage(ImageResourceRef image, const LinearColor &clearColor, ArrayView<ImageSubresource> subresources) final;
+    void clearDepth(ImageResourceRef image, float depth, uint32 stencil, ArrayView<ImageSubresource> subresources) final;
+
+    void setupInitialLayout(ImageResourceRef image) final;
+
+    void presentImage(ArrayView<WindowCanvasRef> canvases, ArrayView<uint32> imageIndices, ArrayView<SemaphoreRef> waitOnSemaphores) final;
+
+    void cmdCopyBuffer(const GraphicsResource *cmdBuffer, BufferResourceRef src, BufferResourceRef dst, ArrayView<CopyBufferInfo> copies) final;
+    void cmdCopyBuffer(const GraphicsResource *cmdBuffer, ArrayView<BatchCopyBufferInfo> copies) final;
+    void cmdCopyToBuffer(const GraphicsResource *cmdBuffer, ArrayView<BatchCopyBufferData> batchCopies) final;
+    void cmdCopyOrResolveImage(
+        const GraphicsResource *cmdBuffer, ImageResourceRef src, ImageResourceRef dst, const CopyImageInfo &srcInfo,
+        const CopyImageInfo &dstInfo
+    ) final;
+    void cmdTransitionLayouts(const GraphicsResource *cmdBuffer, ArrayView<ImageResourceRef> images) final;
+    void cmdClearImage(
+        const GraphicsResource *cmdBuffer, ImageResourceRef image, const LinearColor &clearColor, ArrayView<ImageSubresource> subresources
+    ) final;
+    void cmdClearDepth(
+        const GraphicsResource *cmdBuffer, ImageResourceRef image, float depth, uint32 stencil, ArrayView<ImageSubresource> subresources
+    ) final;
+
+    void cmdBarrierResources(const GraphicsResource *cmdBuffer, ArrayView<ShaderParametersRef> descriptorsSets) final;
+    void cmdBarrierVertices(const GraphicsResource *cmdBuffer, ArrayView<BufferResourceRef> vertexBuffers) final;
+    void cmdBarrierIndices(const GraphicsResource *cmdBuffer, ArrayView<BufferResourceRef> indexBuffers) final;
+    void cmdBarrierIndirectDraws(const GraphicsResource *cmdBuffer, ArrayView<BufferResourceRef> indirectDrawBuffers) final;
+    void cmdReleaseQueueResources(const GraphicsResource *cmdBuffer, EQueueFunction releaseToQueue) final;
+    void cmdReleaseQueueResources(
+        const GraphicsResource *cmdBuffer, EQueueFunction releaseToQueue,
+        const std::unordered_map<MemoryResourceRef, EQueueFunction> &perResourceRelease
+    ) final;
+
+    void cmdBeginRenderPass(
+        const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline, const IRect &renderArea,
+        const RenderPassAdditionalProps &renderpassAdditionalProps, const RenderPassClearValue &clearColor
+    ) final;
+    void cmdEndRenderPass(const GraphicsResource *cmdBuffer) final;
+
+    void cmdBindGraphicsPipeline(
+        const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline, const GraphicsPipelineState &state
+    ) const final;
+    void cmdBindComputePipeline(const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline) const final;
+
+    void cmdPushConstants(
+        const GraphicsResource *cmdBuffer, const LocalPipelineContext &contextPipeline, uint32 stagesUsed, const uint8 *data,
+        ArrayView<CopyBufferInfo> pushConsts
+    ) const final;
+    void cmdBindDescriptorsSetInternal(
+        const GraphicsResource *cmdBuffer, const PipelineBase *contextPipeline, const std::map<uint32, ShaderParametersRef> &descriptorsSets
+    ) const final;
+    void cmdBindDescriptorsSetsInternal(
+        const GraphicsResource *cmdBuffer, const PipelineBase *contextPipeline, ArrayView<ShaderParametersRef> descriptorsSets
+    ) const final;
+
+    void cmdBindVertexBuffer(const GraphicsResource *cmdBuffer, uint32 firstBinding, BufferResourceRef vertexBuffer, uint64 offset) final;
+    void cmdBindVertexBuffers(
+        const GraphicsResource *cmdBuffer, uint32 firstBinding, ArrayView<BufferResourceRef> vertexBuffers, ArrayView<uint64> offsets
+    ) final;
+    void cmdBindIndexBuffer(const GraphicsResource *cmdBuffer, const BufferResourceRef &indexBuffer, uint64 offset = 0) final;
+
+    void cmdDispatch(const GraphicsResource *cmdBuffer, uint32 groupSizeX, uint32 groupSizeY, uint32 groupSizeZ = 1) const final;
+    void cmdDrawIndexed(
+        const GraphicsResource *cmdBuffer, uint32 firstIndex, uint32 indexCount, uint32 firstInstance = 0, uint32 instanceCount = 1,
+        int32 vertexOffset = 0
+    ) const final;
+    void cmdDrawVertices(
+        const GraphicsResource *cmdBuffer, uint32 firstVertex, uint32 vertexCount, uint32 firstInstance = 0, uint32 instanceCount = 1
+    ) const final;
+    void cmdDrawIndexedIndirect(
+        const GraphicsResource *cmdBuffer, const BufferResourceRef &drawCmdsBuffer, uint32 bufferOffset, uint32 drawCount, uint32 stride
+    ) final;
+    void cmdDrawIndirect(
+        const GraphicsResource *cmdBuffer, const BufferResourceRef &drawCmdsBuffer, uint32 bufferOffset, uint32 drawCount, uint32 stride
+    ) final;
+
+    void cmdSetViewportAndScissors(
+        const GraphicsResource *cmdBuffer, ArrayView<std::pair<IRect, IRect>> viewportAndScissors, uint32 firstViewport = 0
+    ) const final;
+    void cmdSetViewportAndScissor(const GraphicsResource *cmdBuffer, const IRect &viewport, const IRect &scissor, uint32 atViewport = 0)
+        const final;
+    void cmdSetScissor(const GraphicsResource *cmdBuffer, const IRect &scissor, uint32 atViewport = 0) const final;
+    void cmdSetLineWidth(const GraphicsResource *cmdBuffer, float lineWidth) const final;
+    void cmdSetDepthBias(const GraphicsResource *cmdBuffer, float constantBias, float slopeFactor, float clampValue) const final;
+
+    void cmdBeginBufferMarker(const GraphicsResource *commandBuffer, const String &name, const LinearColor &color = LinearColorConst::WHITE)
+        const final;
+    void cmdInsertBufferMarker(const GraphicsResource *commandBuffer, const String &name, const LinearColor &color = LinearColorConst::WHITE)
+        const final;
+    void cmdEndBufferMarker(const GraphicsResource *commandBuffer) const final;
+
+    const GraphicsResource *startCmd(const String &uniqueName, EQueueFunction queue, bool bIsReusable) final;
+    void endCmd(const GraphicsResource *cmdBuffer) final;
+    void freeCmd(const GraphicsResource *cmdBuffer) final;
+    void submitCmd(EQueuePriority::Enum priority, const CommandSubmitInfo &submitInfo, FenceRef fence) final;
+    void submitCmds(EQueuePriority::Enum priority, ArrayView<CommandSubmitInfo> submitInfos, FenceRef fence) final;
+    void submitWaitCmd(EQueuePriority::Enum priority, const CommandSubmitInfo2 &submitInfo) final;
+    void submitCmds(EQueuePriority::Enum priority, ArrayView<CommandSubmitInfo2> submitInfos) final;
+    void submitCmd(EQueuePriority::Enum priority, const CommandSubmitInfo2 &command) final;
+
+    void finishCmd(const GraphicsResource *cmdBuffer) final;
+    void finishCmd(const String &uniqueName) final;
+    const GraphicsResource *getCmdBuffer(const String &uniqueName) const final;
+    TimelineSemaphoreRef getCmdSignalSemaphore(const String &uniqueName) const final;
+    TimelineSemaphoreRef getCmdSignalSemaphore(const GraphicsResource *cmdBuffer) const final;
+
+    void waitIdle() final;
+    void waitOnResDepCmds(const MemoryResourceRef &resource) final;
+    void flushAllcommands() final;
+    bool hasCmdsUsingResource(const MemoryResourceRef &resource, bool bFinishCmds) final;
+};
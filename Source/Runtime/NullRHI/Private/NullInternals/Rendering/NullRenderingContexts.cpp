@@ -0,0 +1,110 @@
+/*!
+ * \file NullRenderingContexts.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Rendering/NullRenderingContexts.h"
+#include "Logger/Logger.h"
+#include "NullInternals/ShaderCore/NullShaderParamResourcesFactory.h"
+#include "RenderApi/GBuffersAndTextures.h"
+#include "RenderApi/Rendering/PipelineRegistration.h"
+#include "RenderApi/Rendering/ShaderObject.h"
+#include "RenderApi/Rendering/ShaderObjectFactory.h"
+#include "RenderApi/Shaders/Base/DrawMeshShader.h"
+#include "RenderApi/Shaders/Base/UtilityShaders.h"
+#include "RenderInterface/GlobalRenderVariables.h"
+#include "RenderInterface/Resources/ShaderResources.h"
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+void NullGlobalRenderingContext::initApiInstances()
+{
+    shaderParamLayoutsFactory = new NullShaderParametersLayoutFactory();
+    pipelineFactory = new PipelineFactory();
+    shaderObjectFactory = new ShaderObjectFactory();
+
+    // Nothing gets compiled so there is nothing to cache
+    pipelinesCache = nullptr;
+}
+
+void NullGlobalRenderingContext::initializeApiContext()
+{
+    auto defaultShaderCollectionItr = rawShaderObjects.find(DEFAULT_SHADER_NAME);
+    if (defaultShaderCollectionItr != rawShaderObjects.end())
+    {
+        debugAssert(!GlobalRenderVariables::GPU_IS_COMPUTE_ONLY.get());
+        ShaderDataCollection &defaultShaderCollection = defaultShaderCollectionItr->second;
+
+        const DrawMeshShaderObject::ShaderResourceList &defaultShaders
+            = static_cast<DrawMeshShaderObject *>(defaultShaderCollection.shaderObject)->getAllShaders();
+        for (const DrawMeshShaderObject::ShaderResourceInfo &defaultShader : defaultShaders)
+        {
+            // Since default alone will be used as parent
+            defaultShader.pipeline->setCanBeParent(true);
+            defaultShader.pipeline->init();
+        }
+    }
+
+    for (std::pair<const StringID, ShaderDataCollection> &shaderCollection : rawShaderObjects)
+    {
+        if (shaderCollection.first == StringID(DEFAULT_SHADER_NAME))
+        {
+            continue;
+        }
+
+        if (shaderCollection.second.shaderObject->baseShaderType() == DrawMeshShaderConfig::staticType())
+        {
+            debugAssert(!GlobalRenderVariables::GPU_IS_COMPUTE_ONLY.get());
+
+            const DrawMeshShaderObject::ShaderResourceList &allShaders
+                = static_cast<DrawMeshShaderObject *>(shaderCollection.second.shaderObject)->getAllShaders();
+
+            for (const DrawMeshShaderObject::ShaderResourceInfo &shaderPair : allShaders)
+            {
+                ERenderPassFormat::Type renderPassUsage
+                    = static_cast<const DrawMeshShaderConfig *>(shaderPair.shader->getShaderConfig())->renderpassUsage();
+                EVertexType::Type vertUsage = static_cast<const DrawMeshShaderConfig *>(shaderPair.shader->getShaderConfig())->vertexUsage();
+
+                FramebufferFormat fbFormat(renderPassUsage);
+                GraphicsPipelineBase *defaultGraphicsPipeline;
+                const ShaderResource *defaultShader = static_cast<DrawMeshShaderObject *>(defaultShaderCollectionItr->second.shaderObject)
+                                                          ->getShader(vertUsage, fbFormat, &defaultGraphicsPipeline);
+
+                if (defaultShader == nullptr)
+                {
+                    LOG_ERROR(
+                        "NullGlobalRenderingContext",
+                        "Default shader must contain all the permutations, Missing "
+                        "for [{} {}]",
+                        EVertexType::toString(vertUsage).getChar(), ERenderPassFormat::toString(renderPassUsage).getChar()
+                    );
+                    fatalAssertf(defaultShader, "Default shader missing!");
+                }
+
+                shaderPair.pipeline->setParentPipeline(defaultGraphicsPipeline);
+                shaderPair.pipeline->init();
+            }
+        }
+        else if (shaderCollection.second.shaderObject->baseShaderType() == UniqueUtilityShaderConfig::staticType())
+        {
+            debugAssert(!GlobalRenderVariables::GPU_IS_COMPUTE_ONLY.get());
+
+            UniqueUtilityShaderObject *shaderObject = static_cast<UniqueUtilityShaderObject *>(shaderCollection.second.shaderObject);
+            initializeGenericGraphicsPipeline(shaderObject->getDefaultPipeline());
+        }
+        else if (shaderCollection.second.shaderObject->baseShaderType() == ComputeShaderConfig::staticType())
+        {
+            ComputeShaderObject *shaderObject = static_cast<ComputeShaderObject *>(shaderCollection.second.shaderObject);
+            shaderObject->getPipeline()->init();
+        }
+    }
+}
+
+void NullGlobalRenderingContext::clearApiContext() {}
+
+void NullGlobalRenderingContext::initializeGenericGraphicsPipeline(PipelineBase *pipeline) { pipeline->init(); }
@@ -0,0 +1,26 @@
+/*!
+ * \file NullRenderingContexts.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+#include "RenderApi/Rendering/RenderingContexts.h"
+
+// There are no render passes or pipeline layouts in null RHI, So this only initializes pipelines in the order a real RHI would
+class NullGlobalRenderingContext final : public GlobalRenderingContextBase
+{
+protected:
+    /* GlobalRenderingContextBase overrides */
+    void initApiInstances() final;
+    void initializeApiContext() final;
+    void clearApiContext() final;
+    void initializeGenericGraphicsPipeline(PipelineBase *pipeline) final;
+
+    /* Override ends */
+};
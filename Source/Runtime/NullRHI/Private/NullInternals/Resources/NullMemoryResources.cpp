@@ -0,0 +1,271 @@
+/*!
+ * \file NullMemoryResources.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Resources/NullMemoryResources.h"
+#include "Logger/Logger.h"
+
+//////////////////////////////////////////////////////////////////////////
+//// Buffer resource
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullBufferResource)
+
+NullBufferResource::NullBufferResource(uint32 bufferStride, uint32 bufferCount)
+    : BaseType()
+    , count(bufferCount)
+    , stride(bufferStride)
+{}
+
+NullBufferResource::NullBufferResource(EPixelDataFormat::Type texelFormat, uint32 texelCount)
+    : BaseType()
+    , count(texelCount)
+    , stride(0)
+{
+    dataFormat = texelFormat;
+}
+
+void NullBufferResource::init()
+{
+    BaseType::init();
+    reinitResources();
+}
+
+void NullBufferResource::reinitResources()
+{
+    release();
+    BaseType::reinitResources();
+    if (getResourceSize() == 0)
+    {
+        LOG_ERROR("NullBufferResource", "Invalid resource {}", getResourceName().getChar());
+        return;
+    }
+    hostMemory.resize(getResourceSize());
+}
+
+void NullBufferResource::release()
+{
+    hostMemory.clear();
+    hostMemory.shrink_to_fit();
+    BaseType::release();
+}
+
+uint64 NullBufferResource::getResourceSize() const { return uint64(count) * bufferStride(); }
+
+bool NullBufferResource::isValid() { return !hostMemory.empty(); }
+
+void NullBufferResource::setTexelFormat(EPixelDataFormat::Type format) { dataFormat = format; }
+
+uint32 NullBufferResource::bufferStride() const
+{
+    if (dataFormat != EPixelDataFormat::Undefined)
+    {
+        const EPixelDataFormat::PixelFormatInfo *formatInfo = EPixelDataFormat::getFormatInfo(dataFormat);
+        return formatInfo ? formatInfo->pixelDataSize : 0;
+    }
+    return stride;
+}
+
+void NullBufferResource::setBufferStride(uint32 newStride) { stride = newStride; }
+
+uint32 NullBufferResource::bufferCount() const { return count; }
+
+void NullBufferResource::setBufferCount(uint32 newCount) { count = newCount; }
+
+//////////////////////////////////////////////////////////////////////////
+//// Buffer types
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullRBuffer)
+
+NullRBuffer::NullRBuffer(uint32 bufferStride, uint32 bufferCount /*= 1*/)
+    : BaseType(bufferStride, bufferCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullWBuffer)
+
+NullWBuffer::NullWBuffer(uint32 bufferStride, uint32 bufferCount /*= 1*/)
+    : BaseType(bufferStride, bufferCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullRWBuffer)
+
+NullRWBuffer::NullRWBuffer(uint32 bufferStride, uint32 bufferCount /*= 1*/)
+    : BaseType(bufferStride, bufferCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullRTexelBuffer)
+
+NullRTexelBuffer::NullRTexelBuffer(EPixelDataFormat::Type texelFormat, uint32 texelCount /*= 1*/)
+    : BaseType(texelFormat, texelCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullWTexelBuffer)
+
+NullWTexelBuffer::NullWTexelBuffer(EPixelDataFormat::Type texelFormat, uint32 texelCount /*= 1*/)
+    : BaseType(texelFormat, texelCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullRWTexelBuffer)
+
+NullRWTexelBuffer::NullRWTexelBuffer(EPixelDataFormat::Type texelFormat, uint32 texelCount /*= 1*/)
+    : BaseType(texelFormat, texelCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullVertexBuffer)
+
+NullVertexBuffer::NullVertexBuffer(uint32 bufferStride, uint32 bufferCount /*= 1*/)
+    : BaseType(bufferStride, bufferCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullIndexBuffer)
+
+NullIndexBuffer::NullIndexBuffer(uint32 bufferStride, uint32 bufferCount /*= 1*/)
+    : BaseType(bufferStride, bufferCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullRIndirectBuffer)
+
+NullRIndirectBuffer::NullRIndirectBuffer(uint32 bufferStride, uint32 bufferCount /*= 1*/)
+    : BaseType(bufferStride, bufferCount)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullWIndirectBuffer)
+
+NullWIndirectBuffer::NullWIndirectBuffer(uint32 bufferStride, uint32 bufferCount /*= 1*/)
+    : BaseType(bufferStride, bufferCount)
+{}
+
+//////////////////////////////////////////////////////////////////////////
+//// Image resource
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullImageResource)
+
+NullImageResource::NullImageResource(ImageResourceCreateInfo createInfo, bool bIsStaging /*= false*/)
+    : BaseType(createInfo)
+{
+    bIsStagingResource = bIsStaging;
+}
+
+void NullImageResource::init()
+{
+    BaseType::init();
+    reinitResources();
+}
+
+void NullImageResource::reinitResources()
+{
+    release();
+    BaseType::reinitResources();
+
+    if (bIsCube && (layerCount % 6) != 0)
+    {
+        LOG_WARN(
+            "NullImageResource", "Cube map image {} should have 6 multiple layers, current layer count {}", getResourceName().getChar(),
+            layerCount
+        );
+        layerCount = ((layerCount / 6) + 1) * 6;
+    }
+    if (isRenderTarget)
+    {
+        // In render targets only one mip map is allowed
+        numOfMips = 1;
+    }
+    else if (dimensions.z > 1)
+    {
+        numOfMips = 1;
+        sampleCounts = EPixelSampleCount::SampleCount1;
+    }
+    else if (numOfMips == 0)
+    {
+        numOfMips = mipCountFromDim();
+    }
+
+    if (getResourceSize() == 0)
+    {
+        LOG_ERROR("NullImageResource", "Invalid image {} or not supported image format", getResourceName().getChar());
+        return;
+    }
+    hostMemory.resize(getResourceSize());
+}
+
+void NullImageResource::release()
+{
+    hostMemory.clear();
+    hostMemory.shrink_to_fit();
+    BaseType::release();
+}
+
+uint64 NullImageResource::getResourceSize() const { return layerSize() * layerCount; }
+
+bool NullImageResource::isValid() { return !hostMemory.empty(); }
+
+uint64 NullImageResource::layerSize() const
+{
+    const EPixelDataFormat::PixelFormatInfo *formatInfo = EPixelDataFormat::getFormatInfo(dataFormat);
+    return formatInfo ? uint64(dimensions.x) * dimensions.y * dimensions.z * formatInfo->pixelDataSize : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//// Image types
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullRenderTargetResource)
+
+NullRenderTargetResource::NullRenderTargetResource()
+    : BaseType()
+{
+    isRenderTarget = true;
+    shaderUsage = 0;
+}
+
+NullRenderTargetResource::NullRenderTargetResource(ImageResourceCreateInfo createInfo)
+    : BaseType(createInfo, false)
+{
+    isRenderTarget = true;
+    shaderUsage = 0;
+}
+
+DEFINE_GRAPHICS_RESOURCE(NullCubeImageResource)
+
+NullCubeImageResource::NullCubeImageResource()
+    : BaseType()
+{
+    bIsCube = true;
+    layerCount = 6;
+}
+
+NullCubeImageResource::NullCubeImageResource(ImageResourceCreateInfo createInfo, bool bIsStaging /*= false*/)
+    : BaseType(createInfo, bIsStaging)
+{
+    bIsCube = true;
+    layerCount = 6;
+}
+
+DEFINE_GRAPHICS_RESOURCE(NullCubeRTImageResource)
+
+NullCubeRTImageResource::NullCubeRTImageResource()
+    : BaseType()
+{
+    bIsCube = true;
+    layerCount = 6;
+    isRenderTarget = true;
+    shaderUsage = 0;
+}
+
+NullCubeRTImageResource::NullCubeRTImageResource(ImageResourceCreateInfo createInfo)
+    : BaseType(createInfo, false)
+{
+    bIsCube = true;
+    layerCount = 6;
+    isRenderTarget = true;
+    shaderUsage = 0;
+}
@@ -0,0 +1,227 @@
+/*!
+ * \file NullMemoryResources.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "RenderInterface/Resources/MemoryResources.h"
+
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+//// Buffers
+//////////////////////////////////////////////////////////////////////////
+
+// All null buffers are host memory of bufferCount * bufferStride bytes, Derived types only exists to keep the resource type graph same as
+// other RHIs
+class NullBufferResource : public BufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullBufferResource, , BufferResource, )
+
+private:
+    std::vector<uint8> hostMemory;
+    uint32 count = 1;
+    uint32 stride = 0;
+
+protected:
+    NullBufferResource() = default;
+    NullBufferResource(uint32 bufferStride, uint32 bufferCount);
+    NullBufferResource(EPixelDataFormat::Type texelFormat, uint32 texelCount);
+
+public:
+    /* GraphicsResource overrides */
+    void init() override;
+    void reinitResources() override;
+    void release() override;
+
+    /* MemoryResource overrides */
+    uint64 getResourceSize() const override;
+    bool isValid() override;
+
+    /* BufferResource overrides */
+    void setTexelFormat(EPixelDataFormat::Type format) override;
+    uint32 bufferStride() const override;
+    void setBufferStride(uint32 newStride) override;
+    uint32 bufferCount() const override;
+    void setBufferCount(uint32 newCount) override;
+    /* End overrides */
+
+    FORCE_INLINE uint8 *memory() { return hostMemory.data(); }
+    FORCE_INLINE const uint8 *memory() const { return hostMemory.data(); }
+};
+
+class NullRBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullRBuffer, , NullBufferResource, )
+private:
+    NullRBuffer() = default;
+
+public:
+    NullRBuffer(uint32 bufferStride, uint32 bufferCount = 1);
+};
+
+class NullWBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullWBuffer, , NullBufferResource, )
+private:
+    NullWBuffer() = default;
+
+public:
+    NullWBuffer(uint32 bufferStride, uint32 bufferCount = 1);
+};
+
+class NullRWBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullRWBuffer, , NullBufferResource, )
+private:
+    NullRWBuffer() = default;
+
+public:
+    NullRWBuffer(uint32 bufferStride, uint32 bufferCount = 1);
+};
+
+class NullRTexelBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullRTexelBuffer, , NullBufferResource, )
+private:
+    NullRTexelBuffer() = default;
+
+public:
+    NullRTexelBuffer(EPixelDataFormat::Type texelFormat, uint32 texelCount = 1);
+};
+
+class NullWTexelBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullWTexelBuffer, , NullBufferResource, )
+private:
+    NullWTexelBuffer() = default;
+
+public:
+    NullWTexelBuffer(EPixelDataFormat::Type texelFormat, uint32 texelCount = 1);
+};
+
+class NullRWTexelBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullRWTexelBuffer, , NullBufferResource, )
+private:
+    NullRWTexelBuffer() = default;
+
+public:
+    NullRWTexelBuffer(EPixelDataFormat::Type texelFormat, uint32 texelCount = 1);
+};
+
+class NullVertexBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullVertexBuffer, , NullBufferResource, )
+private:
+    NullVertexBuffer() = default;
+
+public:
+    NullVertexBuffer(uint32 bufferStride, uint32 bufferCount = 1);
+};
+
+class NullIndexBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullIndexBuffer, , NullBufferResource, )
+private:
+    NullIndexBuffer() = default;
+
+public:
+    NullIndexBuffer(uint32 bufferStride, uint32 bufferCount = 1);
+};
+
+class NullRIndirectBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullRIndirectBuffer, , NullBufferResource, )
+private:
+    NullRIndirectBuffer() = default;
+
+public:
+    NullRIndirectBuffer(uint32 bufferStride, uint32 bufferCount = 1);
+};
+
+class NullWIndirectBuffer final : public NullBufferResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullWIndirectBuffer, , NullBufferResource, )
+private:
+    NullWIndirectBuffer() = default;
+
+public:
+    NullWIndirectBuffer(uint32 bufferStride, uint32 bufferCount = 1);
+};
+
+//////////////////////////////////////////////////////////////////////////
+//// Images
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * Only the base MIP of each layer is backed by host memory, Layers are laid out one after another with tightly packed rows.
+ * Other MIPs are never read by anything in CPU so copies to them are only recorded.
+ */
+class NullImageResource : public ImageResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullImageResource, , ImageResource, )
+
+private:
+    std::vector<uint8> hostMemory;
+
+protected:
+    bool bIsCube = false;
+
+    NullImageResource() = default;
+
+public:
+    NullImageResource(ImageResourceCreateInfo createInfo, bool bIsStaging = false);
+
+    /* GraphicsResource overrides */
+    void init() override;
+    void reinitResources() override;
+    void release() override;
+
+    /* MemoryResource overrides */
+    uint64 getResourceSize() const override;
+    bool isValid() override;
+    /* End overrides */
+
+    FORCE_INLINE uint8 *memory() { return hostMemory.data(); }
+    FORCE_INLINE const uint8 *memory() const { return hostMemory.data(); }
+    // Bytes in a layer of base MIP
+    uint64 layerSize() const;
+};
+
+class NullRenderTargetResource final : public NullImageResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullRenderTargetResource, , NullImageResource, )
+private:
+    NullRenderTargetResource();
+
+public:
+    NullRenderTargetResource(ImageResourceCreateInfo createInfo);
+};
+
+class NullCubeImageResource final : public NullImageResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullCubeImageResource, , NullImageResource, )
+private:
+    NullCubeImageResource();
+
+public:
+    NullCubeImageResource(ImageResourceCreateInfo createInfo, bool bIsStaging = false);
+};
+
+class NullCubeRTImageResource final : public NullImageResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullCubeRTImageResource, , NullImageResource, )
+private:
+    NullCubeRTImageResource();
+
+public:
+    NullCubeRTImageResource(ImageResourceCreateInfo createInfo);
+};
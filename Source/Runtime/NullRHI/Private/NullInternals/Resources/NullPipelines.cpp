@@ -0,0 +1,24 @@
+/*!
+ * \file NullPipelines.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Resources/NullPipelines.h"
+
+DEFINE_GRAPHICS_RESOURCE(NullGraphicsPipeline)
+
+NullGraphicsPipeline::NullGraphicsPipeline(const GraphicsPipelineBase *parent)
+    : BaseType(parent)
+{}
+
+DEFINE_GRAPHICS_RESOURCE(NullComputePipeline)
+
+NullComputePipeline::NullComputePipeline(const ComputePipelineBase *parent)
+    : BaseType(parent)
+{}
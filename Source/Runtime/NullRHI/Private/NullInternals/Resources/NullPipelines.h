@@ -0,0 +1,34 @@
+/*!
+ * \file NullPipelines.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "RenderInterface/Resources/Pipelines.h"
+
+// Pipelines only holds the config and the layouts, Permutations are never compiled
+
+class NullGraphicsPipeline final : public GraphicsPipelineBase
+{
+    DECLARE_GRAPHICS_RESOURCE(NullGraphicsPipeline, , GraphicsPipelineBase, )
+
+public:
+    NullGraphicsPipeline() = default;
+    NullGraphicsPipeline(const GraphicsPipelineBase *parent);
+};
+
+class NullComputePipeline final : public ComputePipelineBase
+{
+    DECLARE_GRAPHICS_RESOURCE(NullComputePipeline, , ComputePipelineBase, )
+
+public:
+    NullComputePipeline() = default;
+    NullComputePipeline(const ComputePipelineBase *parent);
+};
@@ -0,0 +1,18 @@
+/*!
+ * \file NullSampler.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Resources/NullSampler.h"
+
+DEFINE_GRAPHICS_RESOURCE(NullSampler)
+
+NullSampler::NullSampler(SamplerCreateInfo samplerCI)
+    : BaseType(samplerCI)
+{}
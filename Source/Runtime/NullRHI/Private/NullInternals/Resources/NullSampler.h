@@ -0,0 +1,26 @@
+/*!
+ * \file NullSampler.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "RenderInterface/Resources/Samplers/SamplerInterface.h"
+
+// Sampler config is all there is to a sampler in null RHI
+class NullSampler final : public SamplerInterface
+{
+    DECLARE_GRAPHICS_RESOURCE(NullSampler, , SamplerInterface, )
+
+private:
+    NullSampler() = default;
+
+public:
+    NullSampler(SamplerCreateInfo samplerCI);
+};
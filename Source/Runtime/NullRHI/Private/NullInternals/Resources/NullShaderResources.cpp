@@ -0,0 +1,71 @@
+/*!
+ * \file NullShaderResources.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Resources/NullShaderResources.h"
+#include "Logger/Logger.h"
+#include "ShaderArchive.h"
+#include "Types/Platform/LFS/PathFunctions.h"
+#include "Types/Platform/LFS/Paths.h"
+#include "Types/Platform/LFS/PlatformLFS.h"
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+DEFINE_GRAPHICS_RESOURCE(NullShaderCodeResource)
+
+NullShaderCodeResource::NullShaderCodeResource(const String &shaderName, const ShaderStageDescription *desc)
+    : BaseType(shaderName, desc->entryPoint, nullptr)
+    , stageDescription(desc)
+{}
+
+String NullShaderCodeResource::getResourceName() const
+{
+    return BaseType::getResourceName() + EShaderStage::getShaderStageInfo(shaderStage())->shortName;
+}
+
+EShaderStage::Type NullShaderCodeResource::shaderStage() const { return EShaderStage::Type(stageDescription->stage); }
+
+DEFINE_GRAPHICS_RESOURCE(NullShaderResource)
+
+NullShaderResource::NullShaderResource(const ShaderConfigCollector *inConfig)
+    : BaseType(inConfig)
+{}
+
+void NullShaderResource::init()
+{
+    String reflectionsFilePath = PathFunctions::combinePath(Paths::applicationDirectory(), TCHAR("Shaders"), shaderConfig->getShaderFileName())
+                                 + TCHAR(".") + REFLECTION_EXTENSION;
+    PlatformFile reflectionFile(reflectionsFilePath);
+    reflectionFile.setFileFlags(EFileFlags::Read | EFileFlags::OpenExisting);
+    reflectionFile.addSharingFlags(EFileSharing::NoSharing);
+    reflectionFile.addAttributes(EFileAdditionalFlags::ReadOnly);
+
+    fatalAssertf(
+        reflectionFile.exists(), "Reflection file is mandatory in shader {}[Reflection file {}]", getResourceName().getChar(),
+        reflectionFile.getFileName().getChar()
+    );
+    reflectionFile.openFile();
+    LOG_DEBUG("NullShaderResource", "Loading reflection file {}", reflectionFile.getFileName().getChar());
+
+    std::vector<uint8> reflectionData;
+    reflectionFile.read(reflectionData);
+    reflectionFile.closeFile();
+
+    ShaderArchive archive(reflectionData);
+    archive << reflectedData;
+
+    for (ShaderStageDescription &stageDesc : reflectedData.stages)
+    {
+        shaders[EShaderStage::Type(stageDesc.stage)] = SharedPtr<ShaderCodeResource>(new NullShaderCodeResource(getResourceName(), &stageDesc));
+    }
+
+    BaseType::init();
+}
+
+const ShaderReflected *NullShaderResource::getReflection() const { return &reflectedData; }
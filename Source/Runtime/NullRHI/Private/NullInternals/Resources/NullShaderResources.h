@@ -0,0 +1,51 @@
+/*!
+ * \file NullShaderResources.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "RenderInterface/Resources/ShaderResources.h"
+#include "ShaderReflected.h"
+
+// No shader module to create, Only the stage reflection is kept so that stage queries works
+class NullShaderCodeResource final : public ShaderCodeResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullShaderCodeResource, , ShaderCodeResource, )
+private:
+    const ShaderStageDescription *stageDescription = nullptr;
+
+    NullShaderCodeResource() = default;
+
+public:
+    NullShaderCodeResource(const String &shaderName, const ShaderStageDescription *desc);
+
+    /* ShaderCodeResource overrides */
+    String getResourceName() const override;
+    EShaderStage::Type shaderStage() const override;
+    /* End overrides */
+};
+
+// Loads only the reflection of the shader, SPIR-V code is never needed as nothing gets executed
+class NullShaderResource final : public ShaderResource
+{
+    DECLARE_GRAPHICS_RESOURCE(NullShaderResource, , ShaderResource, )
+private:
+    ShaderReflected reflectedData;
+
+    NullShaderResource() = default;
+
+public:
+    NullShaderResource(const ShaderConfigCollector *inConfig);
+
+    /* ShaderResource overrides */
+    void init() override;
+    const ShaderReflected *getReflection() const override;
+    /* End overrides */
+};
@@ -0,0 +1,86 @@
+/*!
+ * \file NullSyncResource.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Resources/NullSyncResource.h"
+#include "Logger/Logger.h"
+
+DEFINE_GRAPHICS_RESOURCE(NullSemaphore)
+
+//////////////////////////////////////////////////////////////////////////
+//// NullTimelineSemaphore
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullTimelineSemaphore)
+
+void NullTimelineSemaphore::init()
+{
+    BaseType::init();
+    reinitResources();
+}
+
+void NullTimelineSemaphore::reinitResources()
+{
+    BaseType::reinitResources();
+    value.store(0, std::memory_order::relaxed);
+}
+
+void NullTimelineSemaphore::waitForSignal(uint64 waitValue) const
+{
+    // Nothing will ever signal this from another thread, Waiting on non signaled value is a dead lock in real device
+    if (!isSignaled(waitValue))
+    {
+        LOG_WARN(
+            "NullTimelineSemaphore", "Waiting on timeline semaphore {} for value {} that will never be signaled(Current value {})",
+            resourceName.getChar(), waitValue, currentValue()
+        );
+    }
+}
+
+bool NullTimelineSemaphore::isSignaled(uint64 checkValue) const { return currentValue() >= checkValue; }
+
+void NullTimelineSemaphore::resetSignal(uint64 resetValue) { value.store(resetValue, std::memory_order::release); }
+
+uint64 NullTimelineSemaphore::currentValue() const { return value.load(std::memory_order::acquire); }
+
+//////////////////////////////////////////////////////////////////////////
+//// NullFence
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullFence)
+
+NullFence::NullFence(bool bIsSignaled)
+    : BaseType()
+    , bCreateSignaled(bIsSignaled)
+{}
+
+void NullFence::init()
+{
+    BaseType::init();
+    reinitResources();
+}
+
+void NullFence::reinitResources()
+{
+    BaseType::reinitResources();
+    bSignaled.store(bCreateSignaled, std::memory_order::relaxed);
+}
+
+void NullFence::waitForSignal() const
+{
+    if (!isSignaled())
+    {
+        LOG_WARN("NullFence", "Waiting on fence {} that is not submitted to be signaled", resourceName.getChar());
+    }
+}
+
+bool NullFence::isSignaled() const { return bSignaled.load(std::memory_order::acquire); }
+
+void NullFence::resetSignal() { bSignaled.store(false, std::memory_order::release); }
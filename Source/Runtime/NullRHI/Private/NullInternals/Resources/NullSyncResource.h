@@ -0,0 +1,72 @@
+/*!
+ * \file NullSyncResource.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "RenderInterface/Resources/GraphicsSyncResource.h"
+
+#include <atomic>
+
+// Binary semaphores only synchronizes GPU to GPU, There is nothing to track in null RHI
+class NullSemaphore final : public GraphicsSemaphore
+{
+    DECLARE_GRAPHICS_RESOURCE(NullSemaphore, , GraphicsSemaphore, )
+
+public:
+    NullSemaphore() = default;
+};
+
+class NullTimelineSemaphore final : public GraphicsTimelineSemaphore
+{
+    DECLARE_GRAPHICS_RESOURCE(NullTimelineSemaphore, , GraphicsTimelineSemaphore, )
+
+private:
+    std::atomic<uint64> value{ 0 };
+
+public:
+    NullTimelineSemaphore() = default;
+
+    /* GraphicsResource overrides */
+    void init() override;
+    void reinitResources() override;
+    /* GraphicsTimelineSemaphore overrides */
+    void waitForSignal(uint64 waitValue) const override;
+    bool isSignaled(uint64 checkValue) const override;
+    void resetSignal(uint64 resetValue) override;
+    uint64 currentValue() const override;
+    /* End overrides */
+};
+
+// Fences gets signaled as soon as the commands waiting on it are submitted
+class NullFence final : public GraphicsFence
+{
+    DECLARE_GRAPHICS_RESOURCE(NullFence, , GraphicsFence, )
+
+private:
+    std::atomic<bool> bSignaled{ false };
+    bool bCreateSignaled = false;
+
+    NullFence() = default;
+
+public:
+    NullFence(bool bIsSignaled);
+
+    /* GraphicsResource overrides */
+    void init() override;
+    void reinitResources() override;
+    /* GraphicsSyncResource overrides */
+    void waitForSignal() const override;
+    bool isSignaled() const override;
+    void resetSignal() override;
+    /* End overrides */
+
+    void signal() { bSignaled.store(true, std::memory_order::release); }
+};
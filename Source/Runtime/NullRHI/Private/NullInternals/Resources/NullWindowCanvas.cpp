@@ -0,0 +1,87 @@
+/*!
+ * \file NullWindowCanvas.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/Resources/NullWindowCanvas.h"
+#include "GenericAppWindow.h"
+#include "ApplicationSettings.h"
+#include "Logger/Logger.h"
+#include "NullInternals/Resources/NullSyncResource.h"
+
+DEFINE_GRAPHICS_RESOURCE(NullWindowCanvas)
+
+void NullWindowCanvas::init()
+{
+    BaseType::init();
+
+    // Null window is allowed as there is no surface to create, Only a window that failed to create is an error
+    if (ownerWindow && !ownerWindow->isValidWindow())
+    {
+        LOG_ERROR("NullWindowCanvas", "Cannot initialize canvas for window {} that is not created", ownerWindow->getWindowName());
+        return;
+    }
+
+    const String canvasName = ownerWindow ? ownerWindow->getWindowName() : String(TCHAR("NullWindowCanvas"));
+    semaphores.resize(SWAPCHAIN_IMAGES);
+    fences.resize(SWAPCHAIN_IMAGES);
+    for (uint32 i = 0; i < SWAPCHAIN_IMAGES; ++i)
+    {
+        semaphores[i] = SemaphoreRef(new NullSemaphore());
+        semaphores[i]->setResourceName(canvasName + TCHAR("_Semaphore_") + String::toString(i));
+        semaphores[i]->init();
+
+        fences[i] = FenceRef(new NullFence(false));
+        fences[i]->setResourceName(canvasName + TCHAR("_Fence_") + String::toString(i));
+        fences[i]->init();
+    }
+    reinitResources();
+}
+
+void NullWindowCanvas::reinitResources()
+{
+    BaseType::reinitResources();
+    if (ownerWindow)
+    {
+        ownerWindow->windowSize(currentImageSize.x, currentImageSize.y);
+    }
+    else
+    {
+        currentImageSize = ApplicationSettings::screenSize.get();
+    }
+    currentSwapchainIdx = 0;
+}
+
+void NullWindowCanvas::release()
+{
+    semaphores.clear();
+    fences.clear();
+    BaseType::release();
+}
+
+uint32 NullWindowCanvas::requestNextImage(SemaphoreRef *waitOnSemaphore, FenceRef *waitOnFence /*= nullptr*/)
+{
+    currentSwapchainIdx = (currentSwapchainIdx + 1) % SWAPCHAIN_IMAGES;
+
+    // Image is available right away so acquire fence is always signaled
+    fences[currentSwapchainIdx].reference<NullFence>()->signal();
+    if (waitOnSemaphore)
+    {
+        *waitOnSemaphore = semaphores[currentSwapchainIdx];
+    }
+    if (waitOnFence)
+    {
+        *waitOnFence = fences[currentSwapchainIdx];
+    }
+    return currentSwapchainIdx;
+}
+
+EPixelDataFormat::Type NullWindowCanvas::windowCanvasFormat() const { return EPixelDataFormat::BGRA_U8_Norm; }
+
+int32 NullWindowCanvas::imagesCount() const { return int32(SWAPCHAIN_IMAGES); }
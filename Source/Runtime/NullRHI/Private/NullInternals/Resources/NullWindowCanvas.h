@@ -0,0 +1,48 @@
+/*!
+ * \file NullWindowCanvas.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "RenderInterface/Resources/GenericWindowCanvas.h"
+#include "RenderInterface/Resources/GraphicsSyncResource.h"
+
+#include <vector>
+
+/**
+ * Window canvas without any surface, Swapchain images are just cycled in order and the acquire sync resources are signaled right away.
+ * Owner window can be null in which case the canvas is sized using ApplicationSettings::screenSize
+ */
+class NullWindowCanvas final : public GenericWindowCanvas
+{
+    DECLARE_GRAPHICS_RESOURCE(NullWindowCanvas, , GenericWindowCanvas, )
+private:
+    constexpr static const uint32 SWAPCHAIN_IMAGES = 3;
+
+    std::vector<SemaphoreRef> semaphores;
+    std::vector<FenceRef> fences;
+
+    NullWindowCanvas() = default;
+
+public:
+    NullWindowCanvas(GenericAppWindow *window)
+        : BaseType(window)
+    {}
+
+    /* GraphicsResource overrides */
+    void init() override;
+    void reinitResources() override;
+    void release() override;
+    /* GenericWindowCanvas overrides */
+    uint32 requestNextImage(SemaphoreRef *waitOnSemaphore, FenceRef *waitOnFence = nullptr) override;
+    EPixelDataFormat::Type windowCanvasFormat() const override;
+    int32 imagesCount() const override;
+    /* End overrides */
+};
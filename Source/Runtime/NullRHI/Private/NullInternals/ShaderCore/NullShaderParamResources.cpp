@@ -0,0 +1,160 @@
+/*!
+ * \file NullShaderParamResources.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/ShaderCore/NullShaderParamResources.h"
+#include "RenderApi/Material/MaterialCommonUniforms.h"
+#include "RenderApi/Scene/RenderScene.h"
+#include "RenderApi/Shaders/Base/DrawMeshShader.h"
+#include "RenderInterface/Resources/ShaderResources.h"
+#include "RenderInterface/ShaderCore/ShaderParameterUtility.h"
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+//////////////////////////////////////////////////////////////////////////
+// NullShaderUniqDescLayout
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullShaderUniqDescLayout)
+
+NullShaderUniqDescLayout::NullShaderUniqDescLayout(const ShaderResource *shaderResource, uint32 descSetIdx)
+    : BaseType(shaderResource, descSetIdx)
+{}
+
+String NullShaderUniqDescLayout::getResourceName() const
+{
+    return respectiveShaderRes->getResourceName() + TCHAR("_DescriptorsSetLayout") + String::toString(getSetID());
+}
+
+void NullShaderUniqDescLayout::bindBufferParamInfo(std::map<StringID, struct ShaderBufferDescriptorType *> &bindingBuffers) const
+{
+    respectiveShaderRes->bindBufferParamInfo(bindingBuffers);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NullVertexUniqDescLayout
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullVertexUniqDescLayout)
+
+NullVertexUniqDescLayout::NullVertexUniqDescLayout(const ShaderResource *shaderResource)
+    : BaseType(shaderResource, ShaderParameterUtility::INSTANCE_UNIQ_SET)
+{}
+
+String NullVertexUniqDescLayout::getResourceName() const
+{
+    return respectiveShaderRes->getResourceName()
+           + TCHAR("_DescriptorsSetLayout") + String::toString(ShaderParameterUtility::INSTANCE_UNIQ_SET);
+}
+
+void NullVertexUniqDescLayout::bindBufferParamInfo(std::map<StringID, struct ShaderBufferDescriptorType *> &bindingBuffers) const
+{
+    const std::map<StringID, ShaderBufferParamInfo *> &vertexSpecificBufferInfo = MaterialVertexUniforms::bufferParamInfo(
+        static_cast<const DrawMeshShaderConfig *>(respectiveShaderRes->getShaderConfig())->vertexUsage()
+    );
+
+    for (const std::pair<const StringID, ShaderBufferParamInfo *> &bufferInfo : vertexSpecificBufferInfo)
+    {
+        auto foundDescBinding = bindingBuffers.find(bufferInfo.first);
+
+        debugAssert(foundDescBinding != bindingBuffers.end());
+
+        foundDescBinding->second->bufferParamInfo = bufferInfo.second;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NullViewUniqDescLayout
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullViewUniqDescLayout)
+
+NullViewUniqDescLayout::NullViewUniqDescLayout(const ShaderResource *shaderResource)
+    : BaseType(shaderResource, ShaderParameterUtility::VIEW_UNIQ_SET)
+{}
+
+String NullViewUniqDescLayout::getResourceName() const
+{
+    return respectiveShaderRes->getResourceName() + TCHAR("_DescriptorsSetLayout") + String::toString(ShaderParameterUtility::VIEW_UNIQ_SET);
+}
+
+void NullViewUniqDescLayout::bindBufferParamInfo(std::map<StringID, struct ShaderBufferDescriptorType *> &bindingBuffers) const
+{
+    const std::map<StringID, ShaderBufferParamInfo *> &viewSpecificBufferInfo = RenderSceneBase::sceneViewParamInfo();
+
+    for (const std::pair<const StringID, ShaderBufferParamInfo *> &bufferInfo : viewSpecificBufferInfo)
+    {
+        auto foundDescBinding = bindingBuffers.find(bufferInfo.first);
+
+        debugAssert(foundDescBinding != bindingBuffers.end());
+
+        foundDescBinding->second->bufferParamInfo = bufferInfo.second;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NullBindlessDescLayout
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullBindlessDescLayout)
+
+NullBindlessDescLayout::NullBindlessDescLayout(const ShaderResource *shaderResource)
+    : BaseType(shaderResource, ShaderParameterUtility::BINDLESS_SET)
+{}
+
+String NullBindlessDescLayout::getResourceName() const
+{
+    return respectiveShaderRes->getResourceName()
+           + TCHAR("_BindlessDescriptorsSetLayout") + String::toString(ShaderParameterUtility::BINDLESS_SET);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NullShaderParametersLayout
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullShaderParametersLayout)
+
+NullShaderParametersLayout::NullShaderParametersLayout(const ShaderResource *shaderResource)
+    : BaseType(shaderResource)
+{}
+
+String NullShaderParametersLayout::getResourceName() const { return respectiveShaderRes->getResourceName() + TCHAR("_DescSetLayout"); }
+
+//////////////////////////////////////////////////////////////////////////
+// NullShaderSetParameters
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullShaderSetParameters)
+
+void NullShaderSetParameters::updateParams(IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance)
+{
+    // Only the buffer copies are real, There is no descriptor to write for resource updates
+    BaseType::updateParams(cmdList, graphicsInstance);
+
+    bufferResourceUpdates.clear();
+    texelUpdates.clear();
+    textureUpdates.clear();
+    samplerUpdates.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NullShaderParameters
+//////////////////////////////////////////////////////////////////////////
+
+DEFINE_GRAPHICS_RESOURCE(NullShaderParameters)
+
+void NullShaderParameters::updateParams(IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance)
+{
+    BaseType::updateParams(cmdList, graphicsInstance);
+
+    bufferResourceUpdates.clear();
+    texelUpdates.clear();
+    textureUpdates.clear();
+    samplerUpdates.clear();
+}
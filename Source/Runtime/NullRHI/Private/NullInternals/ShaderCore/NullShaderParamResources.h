@@ -0,0 +1,140 @@
+/*!
+ * \file NullShaderParamResources.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "RenderInterface/ShaderCore/ShaderParameterResources.h"
+
+/**
+ * Parameters layouts in null RHI only binds buffer param info so that the CPU side buffer layouts are same as real RHI.
+ * There is no descriptors set layout to create.
+ */
+
+// descriptor set layout and its info unique to each shader
+class NullShaderUniqDescLayout final : public ShaderSetParametersLayout
+{
+    DECLARE_GRAPHICS_RESOURCE(NullShaderUniqDescLayout, , ShaderSetParametersLayout, )
+private:
+    NullShaderUniqDescLayout() = default;
+
+public:
+    NullShaderUniqDescLayout(const ShaderResource *shaderResource, uint32 descSetIdx);
+
+    /* GraphicsResource overrides */
+    String getResourceName() const final;
+
+    /* ShaderSetParametersLayout overrides */
+protected:
+    void bindBufferParamInfo(std::map<StringID, struct ShaderBufferDescriptorType *> &bindingBuffers) const final;
+    /* Override ends */
+};
+
+// This will be unique for each vertex type instance
+class NullVertexUniqDescLayout final : public ShaderSetParametersLayout
+{
+    DECLARE_GRAPHICS_RESOURCE(NullVertexUniqDescLayout, , ShaderSetParametersLayout, )
+private:
+    NullVertexUniqDescLayout() = default;
+
+public:
+    NullVertexUniqDescLayout(const ShaderResource *shaderResource);
+
+    /* GraphicsResource overrides */
+    String getResourceName() const final;
+
+    /* ShaderSetParametersLayout overrides */
+protected:
+    void bindBufferParamInfo(std::map<StringID, struct ShaderBufferDescriptorType *> &bindingBuffers) const final;
+    /* Override ends */
+};
+
+// This will be unique for view scene
+class NullViewUniqDescLayout final : public ShaderSetParametersLayout
+{
+    DECLARE_GRAPHICS_RESOURCE(NullViewUniqDescLayout, , ShaderSetParametersLayout, )
+private:
+    NullViewUniqDescLayout() = default;
+
+public:
+    NullViewUniqDescLayout(const ShaderResource *shaderResource);
+
+    /* GraphicsResource overrides */
+    String getResourceName() const final;
+
+    /* ShaderSetParametersLayout overrides */
+protected:
+    void bindBufferParamInfo(std::map<StringID, struct ShaderBufferDescriptorType *> &bindingBuffers) const final;
+    /* Override ends */
+};
+
+// Bindless global descriptor set, Does not have any buffers to bind
+class NullBindlessDescLayout final : public ShaderSetParametersLayout
+{
+    DECLARE_GRAPHICS_RESOURCE(NullBindlessDescLayout, , ShaderSetParametersLayout, )
+private:
+    NullBindlessDescLayout() = default;
+
+public:
+    NullBindlessDescLayout(const ShaderResource *shaderResource);
+
+    /* GraphicsResource overrides */
+    String getResourceName() const final;
+    /* Override ends */
+};
+
+// For shaders other than DrawMeshShader
+class NullShaderParametersLayout final : public ShaderParametersLayout
+{
+    DECLARE_GRAPHICS_RESOURCE(NullShaderParametersLayout, , ShaderParametersLayout, )
+private:
+    NullShaderParametersLayout() = default;
+
+public:
+    NullShaderParametersLayout(const ShaderResource *shaderResource);
+
+    /* GraphicsResource overrides */
+    String getResourceName() const final;
+    /* Override ends */
+};
+
+// For shaders and layouts of DrawMeshShaders
+class NullShaderSetParameters final : public ShaderParameters
+{
+    DECLARE_GRAPHICS_RESOURCE(NullShaderSetParameters, , ShaderParameters, )
+private:
+    NullShaderSetParameters() = default;
+
+public:
+    NullShaderSetParameters(const GraphicsResource *shaderParamLayout)
+        : BaseType(shaderParamLayout)
+    {}
+
+    /* ShaderParameters overrides */
+    void updateParams(IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance) final;
+    /* Override ends */
+};
+
+// For shaders and layouts not corresponding to DrawMeshShaders
+class NullShaderParameters final : public ShaderParameters
+{
+    DECLARE_GRAPHICS_RESOURCE(NullShaderParameters, , ShaderParameters, )
+private:
+    NullShaderParameters() = default;
+
+public:
+    NullShaderParameters(const GraphicsResource *shaderParamLayout, const std::set<uint32> &ignoredSetIds)
+        : BaseType(shaderParamLayout, ignoredSetIds)
+    {}
+
+    /* ShaderParameters overrides */
+    void updateParams(IRenderCommandList *cmdList, IGraphicsInstance *graphicsInstance) final;
+    /* Override ends */
+};
@@ -0,0 +1,45 @@
+/*!
+ * \file NullShaderParamResourcesFactory.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullInternals/ShaderCore/NullShaderParamResourcesFactory.h"
+#include "Logger/Logger.h"
+#include "NullInternals/ShaderCore/NullShaderParamResources.h"
+#include "RenderApi/Shaders/Base/DrawMeshShader.h"
+#include "RenderInterface/ShaderCore/ShaderParameterUtility.h"
+
+GraphicsResource *NullShaderParametersLayoutFactory::create(const ShaderResource *forShader, uint32 descriptorsSetIdx) const
+{
+    if (forShader->getShaderConfig()->getType()->isChildOf(DrawMeshShaderConfig::staticType()))
+    {
+        switch (descriptorsSetIdx)
+        {
+        case ShaderParameterUtility::INSTANCE_UNIQ_SET:
+            return new NullVertexUniqDescLayout(forShader);
+        case ShaderParameterUtility::VIEW_UNIQ_SET:
+            return new NullViewUniqDescLayout(forShader);
+        case ShaderParameterUtility::BINDLESS_SET:
+            return new NullBindlessDescLayout(forShader);
+        case ShaderParameterUtility::SHADER_UNIQ_SET:
+        case ShaderParameterUtility::SHADER_VARIANT_UNIQ_SET:
+            return new NullShaderUniqDescLayout(forShader, descriptorsSetIdx);
+        default:
+            LOG_ERROR(
+                "NullShaderParametersLayoutFactory", "Not support descriptor index {} for shader {}", descriptorsSetIdx,
+                forShader->getResourceName().getChar()
+            );
+            return nullptr;
+        }
+    }
+    else
+    {
+        return new NullShaderParametersLayout(forShader);
+    }
+}
@@ -0,0 +1,24 @@
+/*!
+ * \file NullShaderParamResourcesFactory.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+#include "Types/CoreTypes.h"
+#include "Types/Patterns/FactoriesBase.h"
+
+class ShaderResource;
+class GraphicsResource;
+
+class NullShaderParametersLayoutFactory final : public FactoriesBase<GraphicsResource *, const ShaderResource *, uint32>
+{
+
+public:
+    GraphicsResource *create(const ShaderResource *forShader, uint32 descriptorsSetIdx) const final;
+};
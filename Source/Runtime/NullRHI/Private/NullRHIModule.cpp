@@ -0,0 +1,162 @@
+/*!
+ * \file NullRHIModule.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullRHIModule.h"
+#include "Modules/ModuleManager.h"
+#include "NullGraphicsHelper.h"
+#include "NullGraphicsInstance.h"
+
+class NullRHIModule final : public INullRHIModule
+{
+private:
+    IGraphicsInstance *graphicsInstance = nullptr;
+    // Returned when there is no graphics instance to query from
+    NullCmdRecorder emptyRecorder;
+
+public:
+    /* IRHIModule overrides */
+    IGraphicsInstance *createGraphicsInstance() final;
+    const GraphicsHelperAPI *getGraphicsHelper() const final;
+    bool isHeadless() const final { return true; }
+
+    /* IModuleBase overrides */
+    void init() final;
+    void release() final;
+    void destroyGraphicsInstance() final;
+    /* INullRHIModule overrides */
+    IGraphicsInstance *getGraphicsInstance() const final;
+    const NullRHIFrameStats &lastFrameStats() const final;
+    const std::vector<NullRecordedCmd> &lastFrameCmds() const final;
+    const NullRHIFrameStats &currentFrameStats() const final;
+    const std::vector<NullRecordedCmd> &currentFrameCmds() const final;
+    void setRecordCmds(bool bRecord) final;
+    /* End overrides */
+
+private:
+    FORCE_INLINE const NullCmdRecorder &getRecorder() const
+    {
+        return graphicsInstance ? static_cast<const NullGraphicsInstance *>(graphicsInstance)->cmdRecorder : emptyRecorder;
+    }
+};
+
+DECLARE_MODULE(NullRHI, NullRHIModule)
+
+IGraphicsInstance *NullRHIModule::createGraphicsInstance()
+{
+    if (graphicsInstance == nullptr)
+    {
+        graphicsInstance = new NullGraphicsInstance();
+    }
+    return graphicsInstance;
+}
+
+void NullRHIModule::destroyGraphicsInstance()
+{
+    if (graphicsInstance != nullptr)
+    {
+        delete static_cast<NullGraphicsInstance *>(graphicsInstance);
+        graphicsInstance = nullptr;
+    }
+}
+
+const GraphicsHelperAPI *NullRHIModule::getGraphicsHelper() const
+{
+    static NullGraphicsHelper graphicsHelper;
+    return &graphicsHelper;
+}
+
+void NullRHIModule::init() {}
+
+void NullRHIModule::release() { destroyGraphicsInstance(); }
+
+IGraphicsInstance *NullRHIModule::getGraphicsInstance() const { return graphicsInstance; }
+
+const NullRHIFrameStats &NullRHIModule::lastFrameStats() const { return getRecorder().lastStats; }
+
+const std::vector<NullRecordedCmd> &NullRHIModule::lastFrameCmds() const { return getRecorder().lastCmds; }
+
+const NullRHIFrameStats &NullRHIModule::currentFrameStats() const { return getRecorder().currentStats; }
+
+const std::vector<NullRecordedCmd> &NullRHIModule::currentFrameCmds() const { return getRecorder().currentCmds; }
+
+void NullRHIModule::setRecordCmds(bool bRecord)
+{
+    if (graphicsInstance)
+    {
+        static_cast<NullGraphicsInstance *>(graphicsInstance)->cmdRecorder.bRecordCmds = bRecord;
+    }
+}
+
+INullRHIModule *INullRHIModule::get()
+{
+    static WeakModulePtr weakRiModule = (ModuleManager::get()->getOrLoadModule(TCHAR("NullRHI")));
+    return weakRiModule.expired() ? nullptr : static_cast<INullRHIModule *>(weakRiModule.lock().get());
+}
+
+const TChar *ENullCmdType::toString(Type cmdType)
+{
+    switch (cmdType)
+    {
+    case ENullCmdType::CopyBuffer:
+        return TCHAR("CopyBuffer");
+    case ENullCmdType::CopyToImage:
+        return TCHAR("CopyToImage");
+    case ENullCmdType::CopyImage:
+        return TCHAR("CopyImage");
+    case ENullCmdType::ClearImage:
+        return TCHAR("ClearImage");
+    case ENullCmdType::TransitionLayout:
+        return TCHAR("TransitionLayout");
+    case ENullCmdType::Barrier:
+        return TCHAR("Barrier");
+    case ENullCmdType::ReleaseQueue:
+        return TCHAR("ReleaseQueue");
+    case ENullCmdType::BeginRenderPass:
+        return TCHAR("BeginRenderPass");
+    case ENullCmdType::EndRenderPass:
+        return TCHAR("EndRenderPass");
+    case ENullCmdType::BindPipeline:
+        return TCHAR("BindPipeline");
+    case ENullCmdType::PushConstants:
+        return TCHAR("PushConstants");
+    case ENullCmdType::BindDescriptors:
+        return TCHAR("BindDescriptors");
+    case ENullCmdType::BindVertexBuffer:
+        return TCHAR("BindVertexBuffer");
+    case ENullCmdType::BindIndexBuffer:
+        return TCHAR("BindIndexBuffer");
+    case ENullCmdType::Dispatch:
+        return TCHAR("Dispatch");
+    case ENullCmdType::DrawIndexed:
+        return TCHAR("DrawIndexed");
+    case ENullCmdType::DrawVertices:
+        return TCHAR("DrawVertices");
+    case ENullCmdType::DrawIndexedIndirect:
+        return TCHAR("DrawIndexedIndirect");
+    case ENullCmdType::DrawIndirect:
+        return TCHAR("DrawIndirect");
+    case ENullCmdType::DynamicState:
+        return TCHAR("DynamicState");
+    case ENullCmdType::Marker:
+        return TCHAR("Marker");
+    case ENullCmdType::StartCmd:
+        return TCHAR("StartCmd");
+    case ENullCmdType::EndCmd:
+        return TCHAR("EndCmd");
+    case ENullCmdType::Submit:
+        return TCHAR("Submit");
+    case ENullCmdType::Present:
+        return TCHAR("Present");
+    default:
+        break;
+    }
+    return TCHAR("");
+}
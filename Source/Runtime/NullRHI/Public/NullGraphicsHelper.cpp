@@ -0,0 +1,319 @@
+/*!
+ * \file NullGraphicsHelper.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "NullGraphicsHelper.h"
+#include "NullInternals/Rendering/NullRenderingContexts.h"
+#include "NullInternals/Resources/NullMemoryResources.h"
+#include "NullInternals/Resources/NullPipelines.h"
+#include "NullInternals/Resources/NullSampler.h"
+#include "NullInternals/Resources/NullShaderResources.h"
+#include "NullInternals/Resources/NullSyncResource.h"
+#include "NullInternals/Resources/NullWindowCanvas.h"
+#include "NullInternals/ShaderCore/NullShaderParamResources.h"
+#include "RenderInterface/GlobalRenderVariables.h"
+#include "RenderInterface/Rendering/FramebufferTypes.h"
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+struct NullFrameBuffer final : public Framebuffer
+{};
+
+SemaphoreRef NullGraphicsHelper::createSemaphore(IGraphicsInstance *, const TChar *semaphoreName) const
+{
+    auto *semaphore = new NullSemaphore();
+    semaphore->setResourceName(semaphoreName);
+    return SemaphoreRef(semaphore);
+}
+
+TimelineSemaphoreRef NullGraphicsHelper::createTimelineSemaphore(IGraphicsInstance *, const TChar *semaphoreName) const
+{
+    auto *tSemaphore = new NullTimelineSemaphore();
+    tSemaphore->setResourceName(semaphoreName);
+    return TimelineSemaphoreRef(tSemaphore);
+}
+
+void NullGraphicsHelper::waitTimelineSemaphores(
+    IGraphicsInstance *, std::vector<TimelineSemaphoreRef> *semaphores, std::vector<uint64> *waitForValues
+) const
+{
+    fatalAssertf(
+        semaphores->size() <= waitForValues->size(), "Cannot wait on semaphores if the wait for values is less than waiting semaphors count"
+    );
+    for (uint32 i = 0; i < semaphores->size(); ++i)
+    {
+        (*semaphores)[i]->waitForSignal((*waitForValues)[i]);
+    }
+}
+
+FenceRef NullGraphicsHelper::createFence(IGraphicsInstance *, const TChar *fenceName, bool bIsSignaled /*= false*/) const
+{
+    NullFence *fence = new NullFence(bIsSignaled);
+    fence->setResourceName(fenceName);
+    return FenceRef(fence);
+}
+
+void NullGraphicsHelper::waitFences(IGraphicsInstance *, std::vector<FenceRef> *fences, bool /*waitAll*/) const
+{
+    for (const FenceRef &fence : *fences)
+    {
+        fence->waitForSignal();
+    }
+}
+
+SamplerRef NullGraphicsHelper::createSampler(IGraphicsInstance *, SamplerCreateInfo createInfo) const
+{
+    return SamplerRef(new NullSampler(createInfo));
+}
+
+ESamplerFiltering::Type
+NullGraphicsHelper::clampFiltering(IGraphicsInstance *, ESamplerFiltering::Type sampleFiltering, EPixelDataFormat::Type imageFormat) const
+{
+    return sampleFiltering;
+}
+
+WindowCanvasRef NullGraphicsHelper::createWindowCanvas(IGraphicsInstance *, GenericAppWindow *fromWindow) const
+{
+    return WindowCanvasRef(new NullWindowCanvas(fromWindow));
+}
+
+void NullGraphicsHelper::cacheSurfaceProperties(IGraphicsInstance *, const WindowCanvasRef &windowCanvas) const
+{
+    // Presenting is just recorded so any surface can be presented to
+    GlobalRenderVariables::PRESENTING_ENABLED.set(true);
+}
+
+BufferResourceRef NullGraphicsHelper::createReadOnlyBuffer(IGraphicsInstance *, uint32 bufferStride, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullRBuffer(bufferStride, bufferCount));
+}
+
+BufferResourceRef NullGraphicsHelper::createWriteOnlyBuffer(IGraphicsInstance *, uint32 bufferStride, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullWBuffer(bufferStride, bufferCount));
+}
+
+BufferResourceRef NullGraphicsHelper::createReadWriteBuffer(IGraphicsInstance *, uint32 bufferStride, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullRWBuffer(bufferStride, bufferCount));
+}
+
+BufferResourceRef
+NullGraphicsHelper::createReadOnlyTexels(IGraphicsInstance *, EPixelDataFormat::Type texelFormat, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullRTexelBuffer(texelFormat, bufferCount));
+}
+
+BufferResourceRef
+NullGraphicsHelper::createWriteOnlyTexels(IGraphicsInstance *, EPixelDataFormat::Type texelFormat, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullWTexelBuffer(texelFormat, bufferCount));
+}
+
+BufferResourceRef
+NullGraphicsHelper::createReadWriteTexels(IGraphicsInstance *, EPixelDataFormat::Type texelFormat, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullRWTexelBuffer(texelFormat, bufferCount));
+}
+
+BufferResourceRef NullGraphicsHelper::createReadOnlyIndexBuffer(IGraphicsInstance *, uint32 bufferStride, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullIndexBuffer(bufferStride, bufferCount));
+}
+
+BufferResourceRef NullGraphicsHelper::createReadOnlyVertexBuffer(IGraphicsInstance *, uint32 bufferStride, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullVertexBuffer(bufferStride, bufferCount));
+}
+
+BufferResourceRef NullGraphicsHelper::createReadOnlyIndirectBuffer(IGraphicsInstance *, uint32 bufferStride, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullRIndirectBuffer(bufferStride, bufferCount));
+}
+
+BufferResourceRef NullGraphicsHelper::createWriteOnlyIndirectBuffer(IGraphicsInstance *, uint32 bufferStride, uint32 bufferCount /*= 1*/) const
+{
+    return BufferResourceRef(new NullWIndirectBuffer(bufferStride, bufferCount));
+}
+
+ImageResourceRef NullGraphicsHelper::createImage(IGraphicsInstance *, ImageResourceCreateInfo createInfo, bool bIsStaging /*= false*/) const
+{
+    return ImageResourceRef(new NullImageResource(createInfo, bIsStaging));
+}
+
+ImageResourceRef NullGraphicsHelper::createCubeImage(IGraphicsInstance *, ImageResourceCreateInfo createInfo, bool bIsStaging /*= false*/) const
+{
+    return ImageResourceRef(new NullCubeImageResource(createInfo, bIsStaging));
+}
+
+ImageResourceRef NullGraphicsHelper::createRTImage(
+    IGraphicsInstance *, ImageResourceCreateInfo createInfo, EPixelSampleCount::Type sampleCount /*= EPixelSampleCount::SampleCount1*/
+) const
+{
+    auto rtImage = new NullRenderTargetResource(createInfo);
+    rtImage->setSampleCounts(sampleCount);
+    return ImageResourceRef(rtImage);
+}
+
+ImageResourceRef NullGraphicsHelper::createCubeRTImage(
+    IGraphicsInstance *, ImageResourceCreateInfo createInfo, EPixelSampleCount::Type sampleCount /*= EPixelSampleCount::SampleCount1*/
+) const
+{
+    auto rtImage = new NullCubeRTImageResource(createInfo);
+    rtImage->setSampleCounts(sampleCount);
+    return ImageResourceRef(rtImage);
+}
+
+// Host memory is always mapped
+void NullGraphicsHelper::mapResource(IGraphicsInstance *, BufferResourceRef &buffer) const {}
+
+void NullGraphicsHelper::unmapResource(IGraphicsInstance *, BufferResourceRef &buffer) const {}
+
+void NullGraphicsHelper::mapResource(IGraphicsInstance *, ImageResourceRef &image) const {}
+
+void NullGraphicsHelper::unmapResource(IGraphicsInstance *, ImageResourceRef &image) const {}
+
+void *NullGraphicsHelper::borrowMappedPtr(IGraphicsInstance *, ImageResourceRef &resource) const
+{
+    return getHostMemory(resource.reference());
+}
+
+void NullGraphicsHelper::returnMappedPtr(IGraphicsInstance *, ImageResourceRef &resource) const {}
+
+void NullGraphicsHelper::flushMappedPtr(IGraphicsInstance *, const std::vector<ImageResourceRef> &resources) const {}
+
+void *NullGraphicsHelper::borrowMappedPtr(IGraphicsInstance *, BufferResourceRef &resource) const
+{
+    return getHostMemory(resource.reference());
+}
+
+void NullGraphicsHelper::returnMappedPtr(IGraphicsInstance *, BufferResourceRef &resource) const {}
+
+void NullGraphicsHelper::flushMappedPtr(IGraphicsInstance *, const std::vector<BufferResourceRef> &resources) const {}
+
+void NullGraphicsHelper::markForDeletion(
+    IGraphicsInstance *, GraphicsResource *resource, EDeferredDelStrategy deleteStrategy, TickRep duration /*= 1*/
+) const
+{
+    if (resource == nullptr)
+    {
+        return;
+    }
+    resource->release();
+    delete resource;
+}
+
+void NullGraphicsHelper::markForDeletion(
+    IGraphicsInstance *, SimpleSingleCastDelegate deleter, EDeferredDelStrategy deleteStrategy, TickRep duration /*= 1*/
+) const
+{
+    if (deleter.isBound())
+    {
+        deleter.invoke();
+    }
+}
+
+PipelineBase *NullGraphicsHelper::createGraphicsPipeline(IGraphicsInstance *, const PipelineBase *parent) const
+{
+    return new NullGraphicsPipeline(static_cast<const GraphicsPipelineBase *>(parent));
+}
+
+PipelineBase *NullGraphicsHelper::createGraphicsPipeline(IGraphicsInstance *, const GraphicsPipelineConfig &config) const
+{
+    auto *graphicsPipeline = new NullGraphicsPipeline();
+    graphicsPipeline->setPipelineConfig(config);
+    return graphicsPipeline;
+}
+
+PipelineBase *NullGraphicsHelper::createComputePipeline(IGraphicsInstance *, const PipelineBase *parent) const
+{
+    return new NullComputePipeline(static_cast<const ComputePipelineBase *>(parent));
+}
+
+PipelineBase *NullGraphicsHelper::createComputePipeline(IGraphicsInstance *) const { return new NullComputePipeline(); }
+
+GlobalRenderingContextBase *NullGraphicsHelper::createGlobalRenderingContext() const { return new NullGlobalRenderingContext(); }
+
+ShaderResource *NullGraphicsHelper::createShaderResource(const ShaderConfigCollector *inConfig) const
+{
+    return new NullShaderResource(inConfig);
+}
+
+ShaderParametersRef NullGraphicsHelper::createShaderParameters(
+    IGraphicsInstance *, const GraphicsResource *paramLayout, const std::set<uint32> &ignoredSetIds /*= {}*/
+) const
+{
+    ShaderParametersRef shaderParameter;
+    if (paramLayout->getType()->isChildOf<ShaderSetParametersLayout>())
+    {
+        shaderParameter = new NullShaderSetParameters(paramLayout);
+    }
+    else if (paramLayout->getType()->isChildOf<ShaderParametersLayout>())
+    {
+        shaderParameter = new NullShaderParameters(paramLayout, ignoredSetIds);
+    }
+    return shaderParameter;
+}
+
+Framebuffer *NullGraphicsHelper::createFbInstance() const { return new NullFrameBuffer(); }
+
+void NullGraphicsHelper::initializeFb(IGraphicsInstance *, Framebuffer *fb, const UInt2 &frameSize) const {}
+
+void NullGraphicsHelper::initializeSwapchainFb(IGraphicsInstance *, Framebuffer *fb, WindowCanvasRef canvas, uint32 swapchainIdx) const
+{
+    ImageResourceRef dummyImageResource(new ImageResource(ImageResourceCreateInfo{ canvas->windowCanvasFormat() }));
+    dummyImageResource->setResourceName(TCHAR("FB_DummyTexture_NoInit"));
+    fb->textures.push_back(dummyImageResource);
+}
+
+const GraphicsResourceType *NullGraphicsHelper::readOnlyBufferType() const { return NullRBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::writeOnlyBufferType() const { return NullWBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::readWriteBufferType() const { return NullRWBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::readOnlyTexelsType() const { return NullRTexelBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::writeOnlyTexelsType() const { return NullWTexelBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::readWriteTexelsType() const { return NullRWTexelBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::readOnlyIndexBufferType() const { return NullIndexBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::readOnlyVertexBufferType() const { return NullVertexBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::readOnlyIndirectBufferType() const { return NullRIndirectBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::writeOnlyIndirectBufferType() const { return NullWIndirectBuffer::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::imageType() const { return NullImageResource::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::cubeImageType() const { return NullCubeImageResource::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::rtImageType() const { return NullRenderTargetResource::staticType(); }
+
+const GraphicsResourceType *NullGraphicsHelper::cubeRTImageType() const { return NullCubeRTImageResource::staticType(); }
+
+uint8 *NullGraphicsHelper::getHostMemory(const MemoryResource *resource)
+{
+    if (resource == nullptr)
+    {
+        return nullptr;
+    }
+    // Host memory is mutable even through const resources just like GPU memory
+    if (resource->getType()->isChildOf(NullBufferResource::staticType()))
+    {
+        return const_cast<NullBufferResource *>(static_cast<const NullBufferResource *>(resource))->memory();
+    }
+    if (resource->getType()->isChildOf(NullImageResource::staticType()))
+    {
+        return const_cast<NullImageResource *>(static_cast<const NullImageResource *>(resource))->memory();
+    }
+    return nullptr;
+}
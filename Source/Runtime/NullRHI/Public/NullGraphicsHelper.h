@@ -0,0 +1,128 @@
+/*!
+ * \file NullGraphicsHelper.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+#include "NullRHIExports.h"
+#include "RenderInterface/CoreGraphicsTypes.h"
+#include "RenderInterface/GraphicsHelper.h"
+
+class GenericAppWindow;
+
+/**
+ * Graphics helper of null RHI, Every resource is backed by host memory and all the waits returns immediately as nothing is ever executed in GPU
+ */
+class NullGraphicsHelper final : public GraphicsHelperAPI
+{
+public:
+    /* GraphicsHelperAPI overrides */
+    SemaphoreRef createSemaphore(IGraphicsInstance *graphicsInstance, const TChar *semaphoreName) const final;
+    TimelineSemaphoreRef createTimelineSemaphore(IGraphicsInstance *graphicsInstance, const TChar *semaphoreName) const final;
+    void waitTimelineSemaphores(
+        IGraphicsInstance *graphicsInstance, std::vector<TimelineSemaphoreRef> *semaphores, std::vector<uint64> *waitForValues
+    ) const final;
+
+    FenceRef createFence(IGraphicsInstance *graphicsInstance, const TChar *fenceName, bool bIsSignaled = false) const final;
+    void waitFences(IGraphicsInstance *graphicsInstance, std::vector<FenceRef> *fences, bool waitAll) const final;
+
+    SamplerRef createSampler(IGraphicsInstance *graphicsInstance, SamplerCreateInfo createInfo) const final;
+    ESamplerFiltering::Type clampFiltering(
+        IGraphicsInstance *graphicsInstance, ESamplerFiltering::Type sampleFiltering, EPixelDataFormat::Type imageFormat
+    ) const final;
+
+    WindowCanvasRef createWindowCanvas(IGraphicsInstance *graphicsInstance, GenericAppWindow *fromWindow) const final;
+    void cacheSurfaceProperties(IGraphicsInstance *graphicsInstance, const WindowCanvasRef &windowCanvas) const final;
+
+    BufferResourceRef createReadOnlyBuffer(IGraphicsInstance *graphicsInstance, uint32 bufferStride, uint32 bufferCount = 1) const final;
+    BufferResourceRef createWriteOnlyBuffer(IGraphicsInstance *graphicsInstance, uint32 bufferStride, uint32 bufferCount = 1) const final;
+    BufferResourceRef createReadWriteBuffer(IGraphicsInstance *graphicsInstance, uint32 bufferStride, uint32 bufferCount = 1) const final;
+
+    BufferResourceRef
+    createReadOnlyTexels(IGraphicsInstance *graphicsInstance, EPixelDataFormat::Type texelFormat, uint32 bufferCount = 1) const final;
+    BufferResourceRef
+    createWriteOnlyTexels(IGraphicsInstance *graphicsInstance, EPixelDataFormat::Type texelFormat, uint32 bufferCount = 1) const final;
+    BufferResourceRef
+    createReadWriteTexels(IGraphicsInstance *graphicsInstance, EPixelDataFormat::Type texelFormat, uint32 bufferCount = 1) const final;
+
+    BufferResourceRef createReadOnlyIndexBuffer(IGraphicsInstance *graphicsInstance, uint32 bufferStride, uint32 bufferCount = 1) const final;
+    BufferResourceRef createReadOnlyVertexBuffer(IGraphicsInstance *graphicsInstance, uint32 bufferStride, uint32 bufferCount = 1) const final;
+
+    BufferResourceRef
+    createReadOnlyIndirectBuffer(IGraphicsInstance *graphicsInstance, uint32 bufferStride, uint32 bufferCount = 1) const final;
+    BufferResourceRef
+    createWriteOnlyIndirectBuffer(IGraphicsInstance *graphicsInstance, uint32 bufferStride, uint32 bufferCount = 1) const final;
+
+    ImageResourceRef createImage(IGraphicsInstance *graphicsInstance, ImageResourceCreateInfo createInfo, bool bIsStaging = false) const final;
+    ImageResourceRef
+    createCubeImage(IGraphicsInstance *graphicsInstance, ImageResourceCreateInfo createInfo, bool bIsStaging = false) const final;
+    ImageResourceRef createRTImage(
+        IGraphicsInstance *graphicsInstance, ImageResourceCreateInfo createInfo,
+        EPixelSampleCount::Type sampleCount = EPixelSampleCount::SampleCount1
+    ) const final;
+    ImageResourceRef createCubeRTImage(
+        IGraphicsInstance *graphicsInstance, ImageResourceCreateInfo createInfo,
+        EPixelSampleCount::Type sampleCount = EPixelSampleCount::SampleCount1
+    ) const final;
+
+    void mapResource(IGraphicsInstance *graphicsInstance, BufferResourceRef &buffer) const final;
+    void unmapResource(IGraphicsInstance *graphicsInstance, BufferResourceRef &buffer) const final;
+    void mapResource(IGraphicsInstance *graphicsInstance, ImageResourceRef &image) const final;
+    void unmapResource(IGraphicsInstance *graphicsInstance, ImageResourceRef &image) const final;
+    void *borrowMappedPtr(IGraphicsInstance *graphicsInstance, ImageResourceRef &resource) const final;
+    void returnMappedPtr(IGraphicsInstance *graphicsInstance, ImageResourceRef &resource) const final;
+    void flushMappedPtr(IGraphicsInstance *graphicsInstance, const std::vector<ImageResourceRef> &resources) const final;
+    void *borrowMappedPtr(IGraphicsInstance *graphicsInstance, BufferResourceRef &resource) const final;
+    void returnMappedPtr(IGraphicsInstance *graphicsInstance, BufferResourceRef &resource) const final;
+    void flushMappedPtr(IGraphicsInstance *graphicsInstance, const std::vector<BufferResourceRef> &resources) const final;
+
+    // There is no GPU work to wait for so resources are always deleted immediately
+    void markForDeletion(
+        IGraphicsInstance *graphicsInstance, GraphicsResource *resource, EDeferredDelStrategy deleteStrategy, TickRep duration = 1
+    ) const final;
+    void markForDeletion(
+        IGraphicsInstance *graphicsInstance, SimpleSingleCastDelegate deleter, EDeferredDelStrategy deleteStrategy, TickRep duration = 1
+    ) const final;
+
+    PipelineBase *createGraphicsPipeline(IGraphicsInstance *graphicsInstance, const PipelineBase *parent) const final;
+    PipelineBase *createGraphicsPipeline(IGraphicsInstance *graphicsInstance, const GraphicsPipelineConfig &config) const final;
+
+    PipelineBase *createComputePipeline(IGraphicsInstance *graphicsInstance, const PipelineBase *parent) const final;
+    PipelineBase *createComputePipeline(IGraphicsInstance *graphicsInstance) const final;
+
+    GlobalRenderingContextBase *createGlobalRenderingContext() const final;
+    ShaderResource *createShaderResource(const ShaderConfigCollector *inConfig) const final;
+    ShaderParametersRef createShaderParameters(
+        IGraphicsInstance *graphicsInstance, const GraphicsResource *paramLayout, const std::set<uint32> &ignoredSetIds = {}
+    ) const final;
+
+    Framebuffer *createFbInstance() const final;
+    void initializeFb(IGraphicsInstance *graphicsInstance, Framebuffer *fb, const UInt2 &frameSize) const final;
+    void initializeSwapchainFb(IGraphicsInstance *graphicsInstance, Framebuffer *fb, WindowCanvasRef canvas, uint32 swapchainIdx) const final;
+
+    const GraphicsResourceType *readOnlyBufferType() const final;
+    const GraphicsResourceType *writeOnlyBufferType() const final;
+    const GraphicsResourceType *readWriteBufferType() const final;
+    const GraphicsResourceType *readOnlyTexelsType() const final;
+    const GraphicsResourceType *writeOnlyTexelsType() const final;
+    const GraphicsResourceType *readWriteTexelsType() const final;
+    const GraphicsResourceType *readOnlyIndexBufferType() const final;
+    const GraphicsResourceType *readOnlyVertexBufferType() const final;
+    const GraphicsResourceType *readOnlyIndirectBufferType() const final;
+    const GraphicsResourceType *writeOnlyIndirectBufferType() const final;
+
+    const GraphicsResourceType *imageType() const final;
+    const GraphicsResourceType *cubeImageType() const final;
+    const GraphicsResourceType *rtImageType() const final;
+    const GraphicsResourceType *cubeRTImageType() const final;
+    /* End overrides */
+
+    // Host memory of the resource, Valid only after the resource is initialized
+    NULLRHI_EXPORT static uint8 *getHostMemory(const MemoryResource *resource);
+};
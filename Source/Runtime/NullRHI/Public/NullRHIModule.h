@@ -0,0 +1,115 @@
+/*!
+ * \file NullRHIModule.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "NullRHIExports.h"
+#include "RenderInterface/IRHIModule.h"
+#include "Types/CoreTypes.h"
+#include "Types/Time.h"
+
+#include <vector>
+
+class GraphicsResource;
+
+namespace ENullCmdType
+{
+enum Type : uint8
+{
+    CopyBuffer,
+    CopyToImage,
+    CopyImage,
+    ClearImage,
+    TransitionLayout,
+    Barrier,
+    ReleaseQueue,
+    BeginRenderPass,
+    EndRenderPass,
+    BindPipeline,
+    PushConstants,
+    BindDescriptors,
+    BindVertexBuffer,
+    BindIndexBuffer,
+    Dispatch,
+    DrawIndexed,
+    DrawVertices,
+    DrawIndexedIndirect,
+    DrawIndirect,
+    DynamicState,
+    Marker,
+    StartCmd,
+    EndCmd,
+    Submit,
+    Present,
+    MaxCount
+};
+
+NULLRHI_EXPORT const TChar *toString(Type cmdType);
+} // namespace ENullCmdType
+
+// A command recorded by null RHI's command list
+struct NullRecordedCmd
+{
+    ENullCmdType::Type cmdType;
+    // Command buffer this command is recorded into, Null for commands that are executed immediately. Use only for comparison as it might be
+    // freed already
+    const GraphicsResource *cmdBuffer;
+    /**
+     * Command specific arguments
+     * Draws - { first vertex/index, vertex/index count, first instance, instance count }, Indirect draws are read from the indirect buffer
+     * Dispatch - { group size X, Y, Z, 0 }
+     * Copies and clears - { bytes copied or cleared, copies count, 0, 0 }
+     */
+    uint32 args[4];
+};
+
+struct NullRHIFrameStats
+{
+    uint64 frameIdx = 0;
+    uint32 cmdCounts[ENullCmdType::MaxCount] = {};
+
+    uint32 drawCalls = 0;
+    // Vertices or indices drawn including all the instances
+    uint64 verticesDrawn = 0;
+    uint64 instancesDrawn = 0;
+    uint32 dispatches = 0;
+    uint64 bytesCopied = 0;
+
+    uint32 cmdBuffersRecorded = 0;
+    uint32 submits = 0;
+    // Time spent inside command list calls in nanoseconds
+    TickRep recordTime = 0;
+};
+
+/**
+ * Null RHI that executes nothing on GPU. Resources are backed by host memory, copies and clears are done in host memory and every command
+ * is recorded into an inspectable per frame stream.
+ * Useful to run renderer's CPU side in tests and profiling without a GPU. Select it using `--rhi NullRHI` command line.
+ * NullRHI is headless so Application skips creating native windows, NullWindowCanvas works with a headless window or without any window
+ */
+class INullRHIModule : public IRHIModule
+{
+public:
+    virtual IGraphicsInstance *getGraphicsInstance() const = 0;
+
+    /**
+     * Must be accessed from render thread only.
+     * Last frame's data is swapped in when command list's newFrame is called
+     */
+    virtual const NullRHIFrameStats &lastFrameStats() const = 0;
+    virtual const std::vector<NullRecordedCmd> &lastFrameCmds() const = 0;
+    virtual const NullRHIFrameStats &currentFrameStats() const = 0;
+    virtual const std::vector<NullRecordedCmd> &currentFrameCmds() const = 0;
+    // Counts and timings are always collected, Only the command stream recording can be turned off
+    virtual void setRecordCmds(bool bRecord) = 0;
+
+    NULLRHI_EXPORT static INullRHIModule *get();
+};
@@ -0,0 +1,174 @@
+/*!
+ * \file LinuxErrorHandler.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "LinuxErrorHandler.h"
+#include "Logger/Logger.h"
+#include "Types/Platform/PlatformFunctions.h"
+#include "Types/Platform/LFS/PathFunctions.h"
+
+#include <cstdlib>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+
+void LinuxUnexpectedErrorHandler::registerPlatformFilters()
+{
+    if (altStackMemory == nullptr)
+    {
+        altStackMemory = std::malloc(SIGSTKSZ);
+        stack_t altStack;
+        altStack.ss_sp = altStackMemory;
+        altStack.ss_size = SIGSTKSZ;
+        altStack.ss_flags = 0;
+        ::sigaltstack(&altStack, nullptr);
+    }
+
+    struct sigaction sigAction = {};
+    sigAction.sa_sigaction = &LinuxUnexpectedErrorHandler::signalHandler;
+    sigAction.sa_flags = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&sigAction.sa_mask);
+    for (uint32 i = 0; i < HANDLED_SIGNALS_COUNT; ++i)
+    {
+        ::sigaction(HANDLED_SIGNALS[i], &sigAction, &prevSigActions[i]);
+    }
+}
+
+void LinuxUnexpectedErrorHandler::unregisterPlatformFilters()
+{
+    for (uint32 i = 0; i < HANDLED_SIGNALS_COUNT; ++i)
+    {
+        ::sigaction(HANDLED_SIGNALS[i], &prevSigActions[i], nullptr);
+    }
+}
+
+void LinuxUnexpectedErrorHandler::debugBreak() const
+{
+    if (PlatformFunctions::hasAttachedDebugger())
+    {
+        ::raise(SIGTRAP);
+    }
+}
+
+void LinuxUnexpectedErrorHandler::dumpCallStack(bool bShouldCrashApp) const
+{
+    LOG_ERROR("LinuxUnexpectedErrorHandler", "Current call trace -->");
+
+    void *frames[128];
+    const int32 framesCount = ::backtrace(frames, int32(ARRAY_LENGTH(frames)));
+    dumpStack(frames, framesCount, bShouldCrashApp);
+}
+
+void LinuxUnexpectedErrorHandler::dumpStack(void *const *frames, int32 framesCount, bool bCloseApp) const
+{
+    SizeT longestLine = 0;
+    StringStream stackTrace;
+    // First frame is always this function
+    for (int32 frameIdx = 1; frameIdx < framesCount; ++frameIdx)
+    {
+        const UPtrInt pcAddress = reinterpret_cast<UPtrInt>(frames[frameIdx]);
+
+        String moduleName;
+        String symbolName = TCHAR("no mapping from PC to function name");
+        UPtrInt symbolOffset = 0;
+        Dl_info addrInfo;
+        if (::dladdr(frames[frameIdx], &addrInfo) != 0)
+        {
+            if (addrInfo.dli_fname)
+            {
+                moduleName = PathFunctions::fileOrDirectoryName(UTF8_TO_TCHAR(addrInfo.dli_fname));
+            }
+            if (addrInfo.dli_sname)
+            {
+                int32 demangleStatus = 0;
+                AChar *demangledName = abi::__cxa_demangle(addrInfo.dli_sname, nullptr, nullptr, &demangleStatus);
+                symbolName = UTF8_TO_TCHAR(demangleStatus == 0 && demangledName ? demangledName : addrInfo.dli_sname);
+                std::free(demangledName);
+                symbolOffset = pcAddress - reinterpret_cast<UPtrInt>(addrInfo.dli_saddr);
+            }
+        }
+
+        /**
+         * {0} - Module name
+         * {1} - Symbol name
+         * {2} - Offset from symbol start
+         * {3} - Program counter(Instruction address)
+         */
+        String lineStr = StringFormat::vFormat(TCHAR("  {0}!{1} (+{2:#x}) ({3:#018x})"), moduleName, symbolName, symbolOffset, pcAddress);
+        longestLine = longestLine < lineStr.length() ? lineStr.length() : longestLine;
+        stackTrace << lineStr;
+        if (frameIdx + 1 < framesCount)
+        {
+            stackTrace << TCHAR("\n");
+        }
+    }
+
+    const String lineSep{ longestLine, '=' };
+    LOG_ERROR("LinuxUnexpectedErrorHandler", "\n{0}\nCall trace : \n{0}\n{1}\n{0}", lineSep, stackTrace.str().c_str());
+
+    if (bCloseApp)
+    {
+        CALL_ONCE(crashApplication);
+    }
+    else
+    {
+        Logger::flushStream();
+    }
+}
+
+const TChar *signalMessage(int32 signalNum, int32 signalCode)
+{
+    switch (signalNum)
+    {
+    case SIGSEGV:
+        return signalCode == SEGV_ACCERR ? TCHAR("Access violation") : TCHAR("Invalid memory access");
+    case SIGBUS:
+        return signalCode == BUS_ADRALN ? TCHAR("Misaligned data") : TCHAR("Page error");
+    case SIGFPE:
+        switch (signalCode)
+        {
+        case FPE_INTDIV:
+            return TCHAR("Integer divide by zero");
+        case FPE_INTOVF:
+            return TCHAR("Integer overflow");
+        case FPE_FLTDIV:
+            return TCHAR("Float divide by zero");
+        case FPE_FLTOVF:
+            return TCHAR("Float overflow");
+        case FPE_FLTUND:
+            return TCHAR("Float underflow");
+        case FPE_FLTRES:
+            return TCHAR("Decimal point representation not valid");
+        default:
+            return TCHAR("Invalid floating point operation");
+        }
+    case SIGILL:
+        return signalCode == ILL_PRVOPC ? TCHAR("Invalid instruction for machine") : TCHAR("Invalid instruction");
+    case SIGABRT:
+        return TCHAR("Aborted");
+    default:
+        break;
+    }
+    return TCHAR("Generic exception has occurred");
+}
+
+void LinuxUnexpectedErrorHandler::signalHandler(int32 signalNum, siginfo_t *sigInfo, void *) noexcept
+{
+    // Not async signal safe but application is going down anyway, Best effort to get the logs out
+    LOG_ERROR(
+        "LinuxUnexpectedErrorHandler", "Application encountered an error! Error : {} [{:#018x}]", signalMessage(signalNum, sigInfo->si_code),
+        reinterpret_cast<UPtrInt>(sigInfo->si_addr)
+    );
+
+    getHandler()->unregisterFilter();
+    void *frames[128];
+    const int32 framesCount = ::backtrace(frames, int32(ARRAY_LENGTH(frames)));
+    getHandler()->dumpStack(frames, framesCount, true);
+}
@@ -0,0 +1,46 @@
+/*!
+ * \file LinuxErrorHandler.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+#include <signal.h>
+
+class LinuxUnexpectedErrorHandler : public UnexpectedErrorHandler
+{
+public:
+    static LinuxUnexpectedErrorHandler *getHandler()
+    {
+        static LinuxUnexpectedErrorHandler handler;
+        return &handler;
+    }
+
+    /* UnexpectedErrorHandler Implementation */
+    void registerPlatformFilters() override;
+    void unregisterPlatformFilters() override;
+    void dumpCallStack(bool bShouldCrashApp) const override;
+    void debugBreak() const override;
+    /* Ends */
+private:
+    constexpr static const int32 HANDLED_SIGNALS[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+    constexpr static const uint32 HANDLED_SIGNALS_COUNT = sizeof(HANDLED_SIGNALS) / sizeof(HANDLED_SIGNALS[0]);
+
+    struct sigaction prevSigActions[HANDLED_SIGNALS_COUNT];
+    // Alternate stack so that stack overflow can also be reported, Only for the thread that registers the filters
+    void *altStackMemory = nullptr;
+
+    void dumpStack(void *const *frames, int32 framesCount, bool bCloseApp) const;
+
+    static void signalHandler(int32 signalNum, siginfo_t *sigInfo, void *context) noexcept;
+};
+
+typedef LinuxUnexpectedErrorHandler PlatformUnexpectedErrorHandler;
@@ -0,0 +1,187 @@
+/*!
+ * \file LinuxIoUring.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "LFS/LinuxIoUring.h"
+#include "Logger/Logger.h"
+#include "Math/Math.h"
+#include "Memory/Memory.h"
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+bool LinuxIoUring::initialize(uint32 entries) noexcept
+{
+    if (isValid())
+    {
+        return true;
+    }
+
+    io_uring_params params;
+    CBEMemory::memZero(&params, sizeof(io_uring_params));
+    ringFd = int32(::syscall(__NR_io_uring_setup, entries, &params));
+    if (ringFd < 0)
+    {
+        // ENOSYS on old kernels and EPERM when disabled by sysctl or seccomp
+        LOG_WARN("LinuxIoUring", "io_uring setup failed, errno {}", errno);
+        ringFd = -1;
+        return false;
+    }
+    // IORING_OP_READ and IORING_OP_WRITE came along with this feature
+    if (BIT_NOT_SET(params.features, IORING_FEAT_RW_CUR_POS))
+    {
+        LOG_WARN("LinuxIoUring", "io_uring does not support plain read and write operations in this kernel");
+        release();
+        return false;
+    }
+
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool bSingleMmap = BIT_SET(params.features, IORING_FEAT_SINGLE_MMAP);
+    if (bSingleMmap)
+    {
+        sqRingSize = cqRingSize = Math::max(sqRingSize, cqRingSize);
+    }
+
+    sqRingPtr = ::mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+    if (sqRingPtr == MAP_FAILED)
+    {
+        sqRingPtr = nullptr;
+        LOG_ERROR("LinuxIoUring", "Mapping submission ring failed, errno {}", errno);
+        release();
+        return false;
+    }
+    if (bSingleMmap)
+    {
+        cqRingPtr = sqRingPtr;
+    }
+    else
+    {
+        cqRingPtr = ::mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        if (cqRingPtr == MAP_FAILED)
+        {
+            cqRingPtr = nullptr;
+            LOG_ERROR("LinuxIoUring", "Mapping completion ring failed, errno {}", errno);
+            release();
+            return false;
+        }
+    }
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqesPtr = ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+    if (sqesPtr == MAP_FAILED)
+    {
+        LOG_ERROR("LinuxIoUring", "Mapping submission entries failed, errno {}", errno);
+        release();
+        return false;
+    }
+    sqes = (io_uring_sqe *)sqesPtr;
+
+    uint8 *sqRing = (uint8 *)sqRingPtr;
+    sqHead = (uint32 *)(sqRing + params.sq_off.head);
+    sqTail = (uint32 *)(sqRing + params.sq_off.tail);
+    sqArray = (uint32 *)(sqRing + params.sq_off.array);
+    sqMask = *(uint32 *)(sqRing + params.sq_off.ring_mask);
+    sqEntries = *(uint32 *)(sqRing + params.sq_off.ring_entries);
+    sqLocalTail = *sqTail;
+
+    uint8 *cqRing = (uint8 *)cqRingPtr;
+    cqHead = (uint32 *)(cqRing + params.cq_off.head);
+    cqTail = (uint32 *)(cqRing + params.cq_off.tail);
+    cqes = (io_uring_cqe *)(cqRing + params.cq_off.cqes);
+    cqMask = *(uint32 *)(cqRing + params.cq_off.ring_mask);
+    return true;
+}
+
+void LinuxIoUring::release() noexcept
+{
+    if (sqes)
+    {
+        ::munmap(sqes, sqesSize);
+        sqes = nullptr;
+    }
+    if (cqRingPtr && cqRingPtr != sqRingPtr)
+    {
+        ::munmap(cqRingPtr, cqRingSize);
+    }
+    cqRingPtr = nullptr;
+    if (sqRingPtr)
+    {
+        ::munmap(sqRingPtr, sqRingSize);
+        sqRingPtr = nullptr;
+    }
+    if (ringFd >= 0)
+    {
+        ::close(ringFd);
+        ringFd = -1;
+    }
+    sqHead = sqTail = sqArray = cqHead = cqTail = nullptr;
+    cqes = nullptr;
+    sqMask = sqEntries = cqMask = sqLocalTail = kernelInflight = 0;
+}
+
+io_uring_sqe *LinuxIoUring::getSqe() noexcept
+{
+    const uint32 head = std::atomic_ref<uint32>(*sqHead).load(std::memory_order::acquire);
+    if (sqLocalTail - head >= sqEntries)
+    {
+        return nullptr;
+    }
+
+    const uint32 idx = sqLocalTail & sqMask;
+    io_uring_sqe *sqe = &sqes[idx];
+    CBEMemory::memZero(sqe, sizeof(io_uring_sqe));
+    sqArray[idx] = idx;
+    ++sqLocalTail;
+    return sqe;
+}
+
+bool LinuxIoUring::submitAndWait(uint32 minComplete) noexcept
+{
+    // Entries must be visible before tail
+    std::atomic_ref<uint32>(*sqTail).store(sqLocalTail, std::memory_order::release);
+
+    bool bSubmitBlocked = false;
+    while (true)
+    {
+        // Without SQPOLL kernel consumes entries only inside enter, Anything after head is not yet submitted
+        const uint32 headBefore = std::atomic_ref<uint32>(*sqHead).load(std::memory_order::acquire);
+        const uint32 toSubmit = bSubmitBlocked ? 0 : sqLocalTail - headBefore;
+        const uint32 waitCount = bSubmitBlocked ? Math::max(minComplete, 1u) : minComplete;
+        const uint32 enterFlags = waitCount > 0 ? IORING_ENTER_GETEVENTS : 0;
+        const int64 result = ::syscall(__NR_io_uring_enter, ringFd, toSubmit, waitCount, enterFlags, nullptr, 0);
+        kernelInflight += std::atomic_ref<uint32>(*sqHead).load(std::memory_order::acquire) - headBefore;
+        if (result >= 0)
+        {
+            // Entries left unsubmitted after a blocked submit are submitted in next enter
+            return true;
+        }
+
+        switch (errno)
+        {
+        case EINTR:
+            continue;
+        case EAGAIN:
+        case EBUSY:
+            // Completion queue is full or kernel is out of resources, Block until in flight entries complete and caller reaps them.
+            // If nothing is in flight there is nothing to wait for and caller retries the submit
+            if (bSubmitBlocked || kernelInflight == 0)
+            {
+                return true;
+            }
+            bSubmitBlocked = true;
+            continue;
+        default:
+            LOG_ERROR("LinuxIoUring", "io_uring enter failed, errno {}", errno);
+            return false;
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*!
+ * \file LinuxIoUring.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Types/CoreMiscDefines.h"
+#include "Types/CoreTypes.h"
+
+#include <atomic>
+#include <linux/io_uring.h>
+
+/**
+ * Minimal io_uring over raw syscalls, Just enough for file reads and writes.
+ * Not thread safe, Submissions and completions must be done only from the thread that drives the ring.
+ */
+class LinuxIoUring
+{
+private:
+    int32 ringFd = -1;
+
+    void *sqRingPtr = nullptr;
+    SizeT sqRingSize = 0;
+    void *cqRingPtr = nullptr;
+    SizeT cqRingSize = 0;
+    io_uring_sqe *sqes = nullptr;
+    SizeT sqesSize = 0;
+
+    uint32 *sqHead = nullptr;
+    uint32 *sqTail = nullptr;
+    uint32 *sqArray = nullptr;
+    uint32 sqMask = 0;
+    uint32 sqEntries = 0;
+
+    uint32 *cqHead = nullptr;
+    uint32 *cqTail = nullptr;
+    io_uring_cqe *cqes = nullptr;
+    uint32 cqMask = 0;
+
+    // Tail up to which submission entries are filled, Kernel sees it only at submit
+    uint32 sqLocalTail = 0;
+    // Entries consumed by kernel whose completions are not reaped yet
+    uint32 kernelInflight = 0;
+
+public:
+    LinuxIoUring() = default;
+    MAKE_TYPE_NONCOPY_NONMOVE(LinuxIoUring)
+    ~LinuxIoUring() { release(); }
+
+    bool initialize(uint32 entries) noexcept;
+    void release() noexcept;
+    bool isValid() const { return ringFd >= 0; }
+    uint32 capacity() const { return sqEntries; }
+
+    /**
+     * Returns zeroed submission entry to be filled, nullptr if all entries are filled and waiting for submission
+     */
+    io_uring_sqe *getSqe() noexcept;
+    /**
+     * Submits all filled entries and waits until at least minComplete completions are available.
+     * If kernel cannot take more entries it blocks for completions instead, Entries that are not taken are submitted in next call.
+     * Returns false only if ring cannot be entered anymore
+     */
+    bool submitAndWait(uint32 minComplete) noexcept;
+
+    template <typename FuncType>
+    uint32 forEachCompletion(FuncType &&func) noexcept
+    {
+        std::atomic_ref<uint32> cqHeadRef(*cqHead);
+        std::atomic_ref<uint32> cqTailRef(*cqTail);
+
+        uint32 head = cqHeadRef.load(std::memory_order::relaxed);
+        const uint32 tail = cqTailRef.load(std::memory_order::acquire);
+        const uint32 count = tail - head;
+        for (; head != tail; ++head)
+        {
+            func(cqes[head & cqMask]);
+        }
+        // Let kernel reuse the entries
+        cqHeadRef.store(head, std::memory_order::release);
+        kernelInflight -= count;
+        return count;
+    }
+};
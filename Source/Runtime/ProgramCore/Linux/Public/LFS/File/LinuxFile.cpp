@@ -0,0 +1,591 @@
+/*!
+ * \file LinuxFile.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "LFS/File/LinuxFile.h"
+#include "Logger/Logger.h"
+#include "Math/Math.h"
+#include "Types/Platform/LFS/PlatformLFS.h"
+#include "Types/Platform/LFS/PathFunctions.h"
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+#include <algorithm>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FORCE_INLINE PlatformHandle fdToHandle(int32 fd) { return reinterpret_cast<PlatformHandle>(UPtrInt(fd + 1)); }
+
+FORCE_INLINE int64 timespecToNs(const struct timespec &timeSpec) { return int64(timeSpec.tv_sec) * 1'000'000'000ll + timeSpec.tv_nsec; }
+
+PlatformHandle openLinuxFile(const String &filePath, uint8 fileFlags, uint32 fileExtraFlags, uint64 rawFileFlags)
+{
+    int32 openFlags = O_CLOEXEC;
+    {
+        const bool bRead = BIT_SET(fileFlags, EFileFlags::Read);
+        const bool bWrite = BIT_SET(fileFlags, EFileFlags::Write);
+        // Opening with no access is allowed in Windows to query attributes, Read only is closest to it
+        openFlags |= (bRead && bWrite) ? O_RDWR : (bWrite ? O_WRONLY : O_RDONLY);
+    }
+
+    {
+        // Default is OpenAlways same as Windows
+        int32 creationFlags = O_CREAT;
+        const uint8 actionsFlags = fileFlags & FileFlags::OPEN_ACTION_FLAGS;
+        if (ONE_BIT_SET(actionsFlags))
+        {
+            switch (actionsFlags)
+            {
+            case EFileFlags::CreateNew:
+                creationFlags = O_CREAT | O_EXCL;
+                break;
+            case EFileFlags::CreateAlways:
+                creationFlags = O_CREAT | O_TRUNC;
+                break;
+            case EFileFlags::OpenExisting:
+                creationFlags = 0;
+                break;
+            case EFileFlags::ClearExisting:
+                creationFlags = O_TRUNC;
+                break;
+            case EFileFlags::OpenAlways:
+            default:
+                break;
+            }
+        }
+        openFlags |= creationFlags;
+    }
+
+    // NoBuffering(O_DIRECT) needs sector aligned buffers which engine does not guarantee so it is ignored
+    openFlags |= BIT_SET(fileExtraFlags, EFileAdditionalFlags::WriteDirectDisk) ? O_DSYNC : 0;
+    openFlags |= int32(rawFileFlags);
+
+    mode_t createMode = BIT_SET(fileExtraFlags, EFileAdditionalFlags::ReadOnly) ? 0444 : 0644;
+    createMode |= BIT_SET(fileFlags, EFileFlags::Execute) ? 0111 : 0;
+
+    int32 fd;
+    do
+    {
+        fd = ::open(TCHAR_TO_UTF8(filePath.getChar()), openFlags, createMode);
+    }
+    while (fd < 0 && errno == EINTR);
+
+    if (fd < 0)
+    {
+        LOG_ERROR("LinuxFileHandle", "File handle creation/opening failed for {}, errno {}", filePath.getChar(), errno);
+        return nullptr;
+    }
+
+    if (BIT_SET(fileExtraFlags, EFileAdditionalFlags::RandomAccess))
+    {
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_RANDOM);
+    }
+    else if (BIT_SET(fileExtraFlags, EFileAdditionalFlags::SequentialAccess))
+    {
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    return fdToHandle(fd);
+}
+
+bool statPath(const String &filePath, struct stat &outStat) { return ::stat(TCHAR_TO_UTF8(filePath.getChar()), &outStat) == 0; }
+
+//////////////////////////////////////////////////////////////////////////
+/// LinuxFile implementation
+//////////////////////////////////////////////////////////////////////////
+
+LinuxFile::LinuxFile(LinuxFile &&otherFile)
+    : GenericFile()
+{
+    fileHandle = otherFile.fileHandle;
+    otherFile.fileHandle = nullptr;
+    fileFlags = std::move(otherFile.fileFlags);
+    sharingMode = std::move(otherFile.sharingMode);
+    attributes = std::move(otherFile.attributes);
+    advancedFlags = std::move(otherFile.advancedFlags);
+    fileName = std::move(otherFile.fileName);
+    fullPath = std::move(otherFile.fullPath);
+    directoryPath = std::move(otherFile.directoryPath);
+}
+
+LinuxFile::LinuxFile(const LinuxFile &otherFile)
+    : GenericFile()
+{
+    fileFlags = otherFile.fileFlags;
+    sharingMode = otherFile.sharingMode;
+    attributes = otherFile.attributes;
+    advancedFlags = otherFile.advancedFlags;
+    fileName = otherFile.fileName;
+    fullPath = otherFile.fullPath;
+    directoryPath = otherFile.directoryPath;
+}
+
+void LinuxFile::operator= (const LinuxFile &otherFile)
+{
+    fileFlags = otherFile.fileFlags;
+    sharingMode = otherFile.sharingMode;
+    attributes = otherFile.attributes;
+    advancedFlags = otherFile.advancedFlags;
+    fileName = otherFile.fileName;
+    fullPath = otherFile.fullPath;
+    directoryPath = otherFile.directoryPath;
+}
+
+void LinuxFile::operator= (LinuxFile &&otherFile)
+{
+    fileHandle = otherFile.fileHandle;
+    otherFile.fileHandle = nullptr;
+    fileFlags = std::move(otherFile.fileFlags);
+    sharingMode = std::move(otherFile.sharingMode);
+    attributes = std::move(otherFile.attributes);
+    advancedFlags = std::move(otherFile.advancedFlags);
+    fileName = std::move(otherFile.fileName);
+    fullPath = std::move(otherFile.fullPath);
+    directoryPath = std::move(otherFile.directoryPath);
+}
+
+LinuxFile::~LinuxFile()
+{
+    if (getFileHandle() != nullptr)
+    {
+        LOG_WARN("LinuxFile", "File {} is not closed, Please close it before destroying", getFullPath().getChar());
+        closeFile();
+    }
+}
+
+void LinuxFile::flush() const
+{
+    if (getFileHandle())
+    {
+        ::fdatasync(getFd());
+    }
+}
+
+uint64 LinuxFile::fileSize() const
+{
+    struct stat fileStat;
+    if (getFileHandle() ? (::fstat(getFd(), &fileStat) == 0) : statPath(getFullPath(), fileStat))
+    {
+        return uint64(fileStat.st_size);
+    }
+    return 0;
+}
+
+uint64 LinuxFile::filePointer() const
+{
+    if (getFileHandle())
+    {
+        const off_t fPointer = ::lseek(getFd(), 0, SEEK_CUR);
+        return fPointer < 0 ? 0u : uint64(fPointer);
+    }
+    return 0;
+}
+
+void LinuxFile::seekEnd() const
+{
+    if (getFileHandle())
+    {
+        ::lseek(getFd(), 0, SEEK_END);
+        debugAssert(filePointer() == fileSize());
+    }
+}
+
+void LinuxFile::seekBegin() const
+{
+    if (getFileHandle())
+    {
+        ::lseek(getFd(), 0, SEEK_SET);
+        debugAssert(filePointer() == 0);
+    }
+}
+
+void LinuxFile::seek(int64 pointer) const
+{
+    if (getFileHandle())
+    {
+        ::lseek(getFd(), off_t(pointer), SEEK_SET);
+    }
+}
+
+void LinuxFile::offsetCursor(int64 offset) const
+{
+    if (getFileHandle())
+    {
+        ::lseek(getFd(), off_t(offset), SEEK_CUR);
+    }
+}
+
+bool LinuxFile::setFileSize(int64 newSize) const
+{
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Write))
+    {
+        return false;
+    }
+
+    if (::ftruncate(getFd(), off_t(newSize)) != 0)
+    {
+        return false;
+    }
+    // Keep cursor inside the file like in other platforms
+    if (int64(filePointer()) > newSize)
+    {
+        seek(newSize);
+    }
+    return true;
+}
+
+void LinuxFile::read(std::vector<uint8> &readTo, uint32 bytesToRead /*= (~0u)*/) const
+{
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Read))
+    {
+        return;
+    }
+
+    uint64 filePointerCache = filePointer();
+    uint64 availableSizeCanRead = (fileSize() - filePointerCache);
+    dword bytesLeftToRead = (dword)(availableSizeCanRead > bytesToRead ? bytesToRead : availableSizeCanRead);
+    readTo.clear();
+    readTo.resize(bytesLeftToRead, 0);
+
+    read(readTo.data(), bytesLeftToRead);
+}
+
+void LinuxFile::read(uint8 *readTo, uint32 bytesToRead) const
+{
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Read))
+    {
+        return;
+    }
+
+    // Reading does not move the file pointer, pread reads from offset without touching the cursor so no seek back is necessary
+    const uint64 filePointerCache = filePointer();
+    const uint64 availableSizeCanRead = (fileSize() - filePointerCache);
+    uint64 bytesLeftToRead = (availableSizeCanRead > bytesToRead ? bytesToRead : availableSizeCanRead);
+
+    uint64 readOffset = 0;
+    while (bytesLeftToRead > 0)
+    {
+        const ssize_t bytesLastRead = ::pread(getFd(), readTo + readOffset, bytesLeftToRead, off_t(filePointerCache + readOffset));
+        if (bytesLastRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesLastRead <= 0)
+        {
+            LOG_ERROR("LinuxFile", "Failed to read file {}, errno {}", getFullPath().getChar(), errno);
+            break;
+        }
+        bytesLeftToRead -= bytesLastRead;
+        readOffset += bytesLastRead;
+    }
+}
+
+void LinuxFile::write(ArrayView<uint8> writeBytes) const
+{
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Write))
+    {
+        return;
+    }
+
+    SizeT sizeLeft = writeBytes.size();
+    const uint8 *pData = writeBytes.data();
+    while (sizeLeft > 0)
+    {
+        const ssize_t bytesWritten = ::write(getFd(), pData, sizeLeft);
+        if (bytesWritten < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesWritten <= 0)
+        {
+            LOG_ERROR("LinuxFile", "Failed to write file {}, errno {}", getFullPath().getChar(), errno);
+            break;
+        }
+        pData += bytesWritten;
+        sizeLeft -= bytesWritten;
+    }
+}
+
+uint32 LinuxFile::readAt(uint8 *readTo, uint32 bytesToRead, uint64 offset, int32 *outErrorCode /* = nullptr */) const
+{
+    int32 errorCode = 0;
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Read))
+    {
+        if (outErrorCode)
+        {
+            *outErrorCode = EBADF;
+        }
+        return 0;
+    }
+
+    uint32 bytesRead = 0;
+    while (bytesRead < bytesToRead)
+    {
+        const ssize_t bytesLastRead = ::pread(getFd(), readTo + bytesRead, bytesToRead - bytesRead, off_t(offset + bytesRead));
+        if (bytesLastRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesLastRead < 0)
+        {
+            // Logging can overwrite errno
+            errorCode = errno;
+            LOG_ERROR("LinuxFile", "Failed to read file {} at {}, errno {}", getFullPath().getChar(), offset + bytesRead, errorCode);
+            break;
+        }
+        // End of file
+        if (bytesLastRead == 0)
+        {
+            break;
+        }
+        bytesRead += uint32(bytesLastRead);
+    }
+    if (outErrorCode)
+    {
+        *outErrorCode = errorCode;
+    }
+    return bytesRead;
+}
+
+uint32 LinuxFile::writeAt(ArrayView<uint8> writeBytes, uint64 offset, int32 *outErrorCode /* = nullptr */) const
+{
+    int32 errorCode = 0;
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Write))
+    {
+        if (outErrorCode)
+        {
+            *outErrorCode = EBADF;
+        }
+        return 0;
+    }
+
+    const uint32 bytesToWrite = uint32(writeBytes.size());
+    uint32 bytesWritten = 0;
+    while (bytesWritten < bytesToWrite)
+    {
+        const ssize_t bytesLastWritten
+            = ::pwrite(getFd(), writeBytes.data() + bytesWritten, bytesToWrite - bytesWritten, off_t(offset + bytesWritten));
+        if (bytesLastWritten < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesLastWritten <= 0)
+        {
+            // pwrite writing nothing without an error is treated as out of space
+            errorCode = bytesLastWritten < 0 ? errno : ENOSPC;
+            LOG_ERROR("LinuxFile", "Failed to write file {} at {}, errno {}", getFullPath().getChar(), offset + bytesWritten, errorCode);
+            break;
+        }
+        bytesWritten += uint32(bytesLastWritten);
+    }
+    if (outErrorCode)
+    {
+        *outErrorCode = errorCode;
+    }
+    return bytesWritten;
+}
+
+const uint8 *LinuxFile::mapReadOnly(PlatformHandle &outMapping) const
+{
+    outMapping = nullptr;
+    const uint64 mapSize = fileSize();
+    // Zero sized files cannot be mapped
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Read) || mapSize == 0)
+    {
+        return nullptr;
+    }
+
+    void *view = ::mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, getFd(), 0);
+    if (view == MAP_FAILED)
+    {
+        LOG_ERROR("LinuxFile", "Failed to map view of file {}, errno {}", getFullPath().getChar(), errno);
+        return nullptr;
+    }
+    // There is no separate mapping object, Mapped size is needed to unmap so it is stored in mapping handle
+    outMapping = reinterpret_cast<PlatformHandle>(UPtrInt(mapSize));
+    return reinterpret_cast<const uint8 *>(view);
+}
+
+void LinuxFile::unmapView(const uint8 *mappedView, PlatformHandle mapping) const
+{
+    if (mappedView && mapping)
+    {
+        ::munmap(const_cast<uint8 *>(mappedView), SizeT(reinterpret_cast<UPtrInt>(mapping)));
+    }
+}
+
+bool LinuxFile::deleteFile()
+{
+    if (getFileHandle())
+    {
+        closeFile();
+    }
+    return ::unlink(TCHAR_TO_UTF8(getFullPath().getChar())) == 0;
+}
+
+bool LinuxFile::renameFile(String newName)
+{
+    LinuxFile newFile{ PathFunctions::combinePath(getHostDirectory(), newName) };
+
+    if (newFile.exists())
+    {
+        return false;
+    }
+
+    bool reopenFile = false;
+    if (getFileHandle())
+    {
+        closeFile();
+        reopenFile = true;
+    }
+    if (FileSystemFunctions::moveFile(this, &newFile))
+    {
+        setPath(newFile.getFullPath());
+        if (reopenFile)
+        {
+            openFile();
+        }
+        return true;
+    }
+    return false;
+}
+
+bool LinuxFile::createDirectory() const
+{
+    LinuxFile hostDirectoryFile = LinuxFile(getHostDirectory());
+    if (!hostDirectoryFile.exists())
+    {
+        hostDirectoryFile.createDirectory();
+    }
+
+    return ::mkdir(TCHAR_TO_UTF8(getFullPath().getChar()), 0755) == 0;
+}
+
+TickRep LinuxFile::lastWriteTimeStamp() const
+{
+    struct stat fileStat;
+    if (getFileHandle() ? (::fstat(getFd(), &fileStat) == 0) : statPath(getFullPath(), fileStat))
+    {
+        return Time::fromPlatformTime(timespecToNs(fileStat.st_mtim));
+    }
+    return Time::fromPlatformTime(0);
+}
+
+bool LinuxFile::setLastWriteTimeStamp(TickRep timeTick) const
+{
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Write))
+    {
+        return false;
+    }
+
+    const int64 timeNs = Time::toPlatformTime(timeTick);
+    struct timespec fileTimes[2];
+    // Access time is left unchanged
+    fileTimes[0].tv_sec = 0;
+    fileTimes[0].tv_nsec = UTIME_OMIT;
+    fileTimes[1].tv_sec = time_t(timeNs / 1'000'000'000ll);
+    fileTimes[1].tv_nsec = long(timeNs % 1'000'000'000ll);
+    return ::futimens(getFd(), fileTimes) == 0;
+}
+
+TickRep LinuxFile::createTimeStamp() const
+{
+    // Birth time is not available in all file systems, Falls back to last status change time in that case
+    struct statx fileStatx;
+    const int32 statxFlags = getFileHandle() ? AT_EMPTY_PATH : 0;
+    const std::string pathUtf8 = getFileHandle() ? std::string() : std::string(TCHAR_TO_UTF8(getFullPath().getChar()));
+    if (::statx(getFileHandle() ? getFd() : AT_FDCWD, pathUtf8.c_str(), statxFlags, STATX_BTIME | STATX_CTIME, &fileStatx) == 0)
+    {
+        const struct statx_timestamp &timeStamp = BIT_SET(fileStatx.stx_mask, STATX_BTIME) ? fileStatx.stx_btime : fileStatx.stx_ctime;
+        return Time::fromPlatformTime(int64(timeStamp.tv_sec) * 1'000'000'000ll + timeStamp.tv_nsec);
+    }
+    return Time::fromPlatformTime(0);
+}
+
+PlatformHandle LinuxFile::openOrCreateImpl()
+{
+    LinuxFile hostDirectoryFile{ getHostDirectory() };
+    if (!hostDirectoryFile.exists())
+    {
+        hostDirectoryFile.createDirectory();
+    }
+    bool bExists = exists();
+    // If exists CreateNew is the only flag that fails
+    if (bExists)
+    {
+        if (BIT_SET(fileFlags, EFileFlags::CreateNew))
+        {
+            setCreationAction(EFileFlags::OpenExisting);
+            LOG_WARN("LinuxFile", "EFileFlags::CreateNew is set on existing file {}", getFullPath());
+        }
+    }
+    else // In this case OpenExisting and ClearExisting fails check and replace them
+    {
+        if (ANY_BIT_SET(fileFlags, (EFileFlags::OpenExisting | EFileFlags::ClearExisting)))
+        {
+            setCreationAction(EFileFlags::CreateNew);
+            LOG_WARN(
+                "LinuxFile",
+                "EFileFlags::OpenExisting | EFileFlags::ClearExisting is set on non-existing "
+                "file {}",
+                getFullPath()
+            );
+        }
+    }
+
+    return openImpl();
+}
+
+PlatformHandle LinuxFile::openImpl() const { return openLinuxFile(getFullPath(), fileFlags, attributes, advancedFlags); }
+
+bool LinuxFile::closeImpl() const
+{
+    // write goes straight to kernel page cache so there is nothing to flush before close, Durability is only ensured by explicit flush()
+    const bool bClosed = ::close(getFd()) == 0;
+    if (bClosed && BIT_SET(attributes, EFileAdditionalFlags::TemporaryDelete))
+    {
+        ::unlink(TCHAR_TO_UTF8(getFullPath().getChar()));
+    }
+    return bClosed;
+}
+
+bool LinuxFile::dirDelete() const { return ::rmdir(TCHAR_TO_UTF8(getFullPath().getChar())) == 0; }
+
+bool LinuxFile::dirClearAndDelete() const
+{
+    const String dirPath = isDirectory() ? getFullPath() : getHostDirectory();
+    std::vector<String> filesPath = FileSystemFunctions::listAllFiles(dirPath, true);
+    for (const String &filePath : filesPath)
+    {
+        if (::unlink(TCHAR_TO_UTF8(filePath.getChar())) != 0)
+        {
+            return false;
+        }
+    }
+    // rmdir fails on non empty directories so sub directories are removed deepest first
+    std::vector<String> subDirs = FileSystemFunctions::listAllDirectories(dirPath, true);
+    std::sort(
+        subDirs.begin(), subDirs.end(),
+        [](const String &lhs, const String &rhs)
+        {
+            return lhs.length() > rhs.length();
+        }
+    );
+    for (const String &subDir : subDirs)
+    {
+        if (::rmdir(TCHAR_TO_UTF8(subDir.getChar())) != 0)
+        {
+            return false;
+        }
+    }
+    return dirDelete();
+}
@@ -0,0 +1,78 @@
+/*!
+ * \file LinuxFile.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Types/Platform/LFS/File/GenericFile.h"
+
+/**
+ * File descriptor is stored in PlatformHandle as descriptor + 1 so that a valid descriptor 0 is never null handle.
+ * EFileSharing has no equivalent in POSIX and is ignored.
+ */
+class PROGRAMCORE_EXPORT LinuxFile final : public GenericFile
+{
+
+public:
+    LinuxFile(const String &path)
+        : GenericFile(path)
+    {}
+    LinuxFile()
+        : GenericFile(TCHAR(""))
+    {}
+    LinuxFile(LinuxFile &&otherFile);
+    LinuxFile(const LinuxFile &otherFile);
+    ~LinuxFile();
+    void operator= (const LinuxFile &otherFile);
+    void operator= (LinuxFile &&otherFile);
+
+    void flush() const override;
+
+    TickRep lastWriteTimeStamp() const override;
+    bool setLastWriteTimeStamp(TickRep timeTick) const override;
+    TickRep createTimeStamp() const override;
+    uint64 fileSize() const override;
+    uint64 filePointer() const override;
+    void seekEnd() const override;
+    void seekBegin() const override;
+    void seek(int64 pointer) const override;
+    void offsetCursor(int64 offset) const override;
+
+    bool setFileSize(int64 newSize) const override;
+    void read(std::vector<uint8> &readTo, uint32 bytesToRead = (~0u)) const override;
+    void read(uint8 *readTo, uint32 bytesToRead) const override;
+    void write(ArrayView<uint8> writeBytes) const override;
+    uint32 readAt(uint8 *readTo, uint32 bytesToRead, uint64 offset, int32 *outErrorCode = nullptr) const override;
+    uint32 writeAt(ArrayView<uint8> writeBytes, uint64 offset, int32 *outErrorCode = nullptr) const override;
+
+    const uint8 *mapReadOnly(PlatformHandle &outMapping) const override;
+    void unmapView(const uint8 *mappedView, PlatformHandle mapping) const override;
+
+    bool deleteFile() override;
+    bool renameFile(String newName) override;
+
+    bool createDirectory() const override;
+
+    // Native descriptor, -1 if not opened
+    FORCE_INLINE int32 getFd() const { return int32(reinterpret_cast<UPtrInt>(getFileHandle())) - 1; }
+
+protected:
+    virtual PlatformHandle openOrCreateImpl() override;
+    virtual PlatformHandle openImpl() const override;
+    virtual bool closeImpl() const override;
+
+    bool dirDelete() const override;
+    bool dirClearAndDelete() const override;
+};
+
+namespace LFS
+{
+typedef LinuxFile PlatformFile;
+}
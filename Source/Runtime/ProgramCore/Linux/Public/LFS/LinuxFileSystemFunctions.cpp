@@ -0,0 +1,305 @@
+/*!
+ * \file LinuxFileSystemFunctions.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "String/String.h"
+#include "LFS/LinuxFileSystemFunctions.h"
+#include "LFS/File/LinuxFile.h"
+#include "Types/Platform/LFS/PathFunctions.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <queue>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace LinuxFSHelpers
+{
+enum class EEntryType
+{
+    File,
+    Directory,
+    Other
+};
+
+EEntryType getEntryType(const String &dirPath, const struct dirent *entry)
+{
+    switch (entry->d_type)
+    {
+    case DT_REG:
+        return EEntryType::File;
+    case DT_DIR:
+        return EEntryType::Directory;
+    case DT_UNKNOWN:
+    case DT_LNK:
+    {
+        // Some file systems do not fill type, And symbolic links are resolved to what they point to like in Windows
+        struct stat entryStat;
+        const String entryPath = PathFunctions::combinePath(dirPath, UTF8_TO_TCHAR(entry->d_name));
+        if (::stat(TCHAR_TO_UTF8(entryPath.getChar()), &entryStat) != 0)
+        {
+            return EEntryType::Other;
+        }
+        return S_ISREG(entryStat.st_mode) ? EEntryType::File : (S_ISDIR(entryStat.st_mode) ? EEntryType::Directory : EEntryType::Other);
+    }
+    default:
+        return EEntryType::Other;
+    }
+}
+
+FORCE_INLINE bool isRedirector(const AChar *name) { return (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0))); }
+
+/**
+ * Visits entries of directory excluding . and .., Visitor is called with entry's full path and type
+ */
+template <typename VisitorFunc>
+void visitDirectory(const String &dirPath, VisitorFunc &&visitor)
+{
+    DIR *dirHandle = ::opendir(TCHAR_TO_UTF8(dirPath.getChar()));
+    if (dirHandle == nullptr)
+    {
+        return;
+    }
+    while (const struct dirent *entry = ::readdir(dirHandle))
+    {
+        if (isRedirector(entry->d_name))
+        {
+            continue;
+        }
+        visitor(entry, getEntryType(dirPath, entry));
+    }
+    ::closedir(dirHandle);
+}
+} // namespace LinuxFSHelpers
+
+std::vector<String> LinuxFileSystemFunctions::listFiles(const String &directory, bool bRecursive, const String &wildcard)
+{
+    std::vector<String> fileList;
+    {
+        LinuxFile rootDirectory(directory);
+        if (!rootDirectory.isDirectory() || !rootDirectory.exists())
+        {
+            return fileList;
+        }
+    }
+
+    std::vector<String> directories;
+    directories.emplace_back(directory);
+    // If we recurse find and append all subdirectories
+    if (bRecursive)
+    {
+        auto subdirs = listAllDirectories(directory, bRecursive);
+        directories.insert(directories.end(), subdirs.cbegin(), subdirs.cend());
+    }
+
+    const std::string wildcardUtf8{ TCHAR_TO_UTF8(wildcard.getChar()) };
+    for (const String &currentDir : directories)
+    {
+        LinuxFSHelpers::visitDirectory(
+            currentDir,
+            [&](const struct dirent *entry, LinuxFSHelpers::EEntryType entryType)
+            {
+                if (entryType == LinuxFSHelpers::EEntryType::File && ::fnmatch(wildcardUtf8.c_str(), entry->d_name, 0) == 0)
+                {
+                    fileList.emplace_back(PathFunctions::combinePath(currentDir, UTF8_TO_TCHAR(entry->d_name)));
+                }
+            }
+        );
+    }
+    return fileList;
+}
+
+std::vector<String> LinuxFileSystemFunctions::listAllFiles(const String &directory, bool bRecursive)
+{
+    std::vector<String> fileList;
+    {
+        LinuxFile rootDirectory(directory);
+        if (!rootDirectory.isDirectory() || !rootDirectory.exists())
+        {
+            return fileList;
+        }
+    }
+
+    std::queue<String> directories;
+    directories.push(directory);
+
+    while (!directories.empty())
+    {
+        String currentDir = directories.front();
+        directories.pop();
+
+        LinuxFSHelpers::visitDirectory(
+            currentDir,
+            [&](const struct dirent *entry, LinuxFSHelpers::EEntryType entryType)
+            {
+                if (entryType == LinuxFSHelpers::EEntryType::File)
+                {
+                    fileList.emplace_back(PathFunctions::combinePath(currentDir, UTF8_TO_TCHAR(entry->d_name)));
+                }
+                else if (bRecursive && entryType == LinuxFSHelpers::EEntryType::Directory)
+                {
+                    directories.push(PathFunctions::combinePath(currentDir, UTF8_TO_TCHAR(entry->d_name)));
+                }
+            }
+        );
+    }
+    return fileList;
+}
+
+std::vector<String> LinuxFileSystemFunctions::listAllDirectories(const String &directory, bool bRecursive)
+{
+    std::vector<String> folderList;
+    {
+        LinuxFile rootDirectory(directory);
+        if (!rootDirectory.isDirectory() || !rootDirectory.exists())
+        {
+            return folderList;
+        }
+    }
+
+    std::queue<String> directories;
+    directories.push(directory);
+
+    while (!directories.empty())
+    {
+        String currentDir = directories.front();
+        directories.pop();
+
+        LinuxFSHelpers::visitDirectory(
+            currentDir,
+            [&](const struct dirent *entry, LinuxFSHelpers::EEntryType entryType)
+            {
+                if (entryType == LinuxFSHelpers::EEntryType::Directory)
+                {
+                    String path = PathFunctions::combinePath(currentDir, UTF8_TO_TCHAR(entry->d_name));
+                    folderList.emplace_back(path);
+                    if (bRecursive)
+                    {
+                        directories.push(path);
+                    }
+                }
+            }
+        );
+    }
+    return folderList;
+}
+
+String LinuxFileSystemFunctions::applicationPath()
+{
+    AChar exePath[4096];
+    const ssize_t pathLen = ::readlink("/proc/self/exe", exePath, ARRAY_LENGTH(exePath) - 1);
+    if (pathLen <= 0)
+    {
+        return TCHAR("");
+    }
+    exePath[pathLen] = 0;
+    return UTF8_TO_TCHAR(exePath);
+}
+
+bool LinuxFileSystemFunctions::moveFile(GenericFile *moveFrom, GenericFile *moveTo)
+{
+    // MoveFile fails if destination exists, renameat2 with RENAME_NOREPLACE matches it
+    return ::renameat2(
+               AT_FDCWD, TCHAR_TO_UTF8(moveFrom->getFullPath().getChar()), AT_FDCWD, TCHAR_TO_UTF8(moveTo->getFullPath().getChar()),
+               RENAME_NOREPLACE
+           )
+           == 0;
+}
+
+bool LinuxFileSystemFunctions::copyFile(GenericFile *copyFrom, GenericFile *copyTo)
+{
+    const int32 fromFd = ::open(TCHAR_TO_UTF8(copyFrom->getFullPath().getChar()), O_RDONLY | O_CLOEXEC);
+    if (fromFd < 0)
+    {
+        return false;
+    }
+    struct stat fromStat;
+    if (::fstat(fromFd, &fromStat) != 0)
+    {
+        ::close(fromFd);
+        return false;
+    }
+    // Fails if destination exists same as in Windows
+    const int32 toFd = ::open(TCHAR_TO_UTF8(copyTo->getFullPath().getChar()), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, fromStat.st_mode & 0777);
+    if (toFd < 0)
+    {
+        ::close(fromFd);
+        return false;
+    }
+
+    // Copy is done inside kernel without bouncing data through user space buffers
+    bool bSuccess = true;
+    off_t bytesLeft = fromStat.st_size;
+    while (bytesLeft > 0)
+    {
+        const ssize_t bytesCopied = ::sendfile(toFd, fromFd, nullptr, SizeT(bytesLeft));
+        if (bytesCopied < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesCopied <= 0)
+        {
+            bSuccess = false;
+            break;
+        }
+        bytesLeft -= bytesCopied;
+    }
+    ::close(fromFd);
+    ::close(toFd);
+    return bSuccess;
+}
+
+bool LinuxFileSystemFunctions::replaceFile(GenericFile *replaceWith, GenericFile *replacing, GenericFile *backupFile)
+{
+    const std::string replacingPath{ TCHAR_TO_UTF8(replacing->getFullPath().getChar()) };
+    if (backupFile)
+    {
+        // Hard link keeps the old content reachable from backup path after rename replaces the original
+        const std::string backupPath{ TCHAR_TO_UTF8(backupFile->getFullPath().getChar()) };
+        ::unlink(backupPath.c_str());
+        if (::link(replacingPath.c_str(), backupPath.c_str()) != 0)
+        {
+            return false;
+        }
+    }
+    // rename is atomic and replaces existing destination
+    return ::rename(TCHAR_TO_UTF8(replaceWith->getFullPath().getChar()), replacingPath.c_str()) == 0;
+}
+
+bool LinuxFileSystemFunctions::exists(const TChar *fullPath)
+{
+    struct stat pathStat;
+    return ::stat(TCHAR_TO_UTF8(fullPath), &pathStat) == 0;
+}
+
+bool LinuxFileSystemFunctions::fileExists(const TChar *fullPath)
+{
+    struct stat pathStat;
+    if (::stat(TCHAR_TO_UTF8(fullPath), &pathStat) != 0)
+    {
+        return false;
+    }
+    return !S_ISDIR(pathStat.st_mode);
+}
+
+bool LinuxFileSystemFunctions::dirExists(const TChar *fullPath)
+{
+    struct stat pathStat;
+    if (::stat(TCHAR_TO_UTF8(fullPath), &pathStat) != 0)
+    {
+        return false;
+    }
+    return S_ISDIR(pathStat.st_mode);
+}
@@ -0,0 +1,49 @@
+/*!
+ * \file LinuxCoreTypes.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+#include "Types/Platform/GenericPlatformCoreTypes.h"
+
+class LinuxCoreTypes : public GenericPlatformCoreTypes
+{
+private:
+    LinuxCoreTypes() = default;
+
+public:
+    // Linux APIs are UTF-8 native, If changing here also change TCHAR in CoreDefines.h
+    using TChar = AChar;
+    // wchar_t is 4 bytes and holds UTF-32 code points in GCC and Clang
+    using WCharEncodedType = Utf32;
+    using EncodedType = Utf8;
+
+    // unsigned long is 8 bytes in LP64, dword must stay 4 bytes
+    using dword = unsigned int;
+
+    union UInt64
+    {
+#if (defined BIG_ENDIAN) & BIG_ENDIAN
+        struct
+        {
+            dword highPart;
+            dword lowPart;
+        } dwords;
+#else
+        struct
+        {
+            dword lowPart;
+            dword highPart;
+        } dwords;
+#endif
+        uint64 quadPart;
+    };
+};
+
+using PlatformCoreTypes = LinuxCoreTypes;
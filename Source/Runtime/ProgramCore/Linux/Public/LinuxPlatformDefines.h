@@ -0,0 +1,62 @@
+/*!
+ * \file LinuxPlatformDefines.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+// String defines
+// Linux APIs are UTF-8 native, If changing here also change TChar in CoreTypes.h
+#ifndef USING_WIDE_UNICODE
+#define USING_WIDE_UNICODE 0
+#endif
+#ifndef TCHAR_inner
+#if USING_WIDE_UNICODE
+#define TCHAR_inner(x) L##x
+#else // USING_WIDE_UNICODE
+#define TCHAR_inner(x) x
+#endif // USING_WIDE_UNICODE
+#endif
+
+// Other platform specific
+
+// FORCE_INLINE is left to CoreDefines as always_inline is a hard error in GCC when inlining is not possible
+
+// There is no aligned realloc in POSIX so PLATFORM_ALIGNED_MALLOC is not defined and builtin allocator aligns manually.
+// Allocations of at least this many bytes are mapped directly from the OS to keep large buffers from fragmenting the heap
+#ifndef PLATFORM_LARGE_ALLOC_THRESHOLD
+#define PLATFORM_LARGE_ALLOC_THRESHOLD (1024 * 1024)
+#endif
+
+#ifndef LIB_PREFIX
+#define LIB_PREFIX TCHAR("lib")
+#endif
+#ifndef SHARED_LIB_EXTENSION
+#define SHARED_LIB_EXTENSION TCHAR("so")
+#endif
+#ifndef STATIC_LIB_EXTENSION
+#define STATIC_LIB_EXTENSION TCHAR("a")
+#endif
+
+#ifndef DLL_EXPORT
+// Shared objects export everything with default visibility
+#define DLL_EXPORT __attribute__((visibility("default")))
+#endif
+#ifndef DLL_IMPORT
+#define DLL_IMPORT
+#endif
+
+#ifndef LINE_FEED_ACHAR
+#define LINE_FEED_ACHAR "\n"
+#endif
+
+// File System path separator
+#ifndef FS_PATH_SEPARATOR
+#define FS_PATH_SEPARATOR TCHAR("/")
+#endif
@@ -0,0 +1,421 @@
+/*!
+ * \file LinuxPlatformFunctions.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "LinuxPlatformFunctions.h"
+#include "Logger/Logger.h"
+#include "String/TCharString.h"
+#include "Types/Time.h"
+#include "Types/Uid/Guid.h"
+#include "Memory/Memory.h"
+#include "Types/CoreMiscDefines.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <cwctype>
+#include <fstream>
+#include <vector>
+
+#include <dlfcn.h>
+#include <link.h>
+#include <spawn.h>
+#include <sys/random.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <wordexp.h>
+
+/* Time impl functions, No need to enclose in macro as this TU won't be included in other platforms */
+// Linux file times are nanoseconds since epoch(1st Jan 1970) so only the resolution differs
+template <typename Resolution>
+TickRep fromPlatformTimeImpl(int64 platformTick)
+{
+    using namespace std::chrono;
+    return duration_cast<Resolution>(nanoseconds(platformTick)).count();
+}
+template <typename Resolution>
+int64 toPlatformTimeImpl(TickRep timeTick)
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(Resolution(timeTick)).count();
+}
+
+template <typename Resolution>
+TickRep fromPlatformTime(int64 platformTick);
+template <typename Resolution>
+int64 toPlatformTime(TickRep timeTick);
+#define SPECIALIZE_FROM_PLATFORM_TIME(TimeResolution)                                                                                          \
+    template <>                                                                                                                                \
+    TickRep fromPlatformTime<TimeResolution>(int64 platformTick)                                                                               \
+    {                                                                                                                                          \
+        return ::fromPlatformTimeImpl<TimeResolution>(platformTick);                                                                           \
+    }                                                                                                                                          \
+    template <>                                                                                                                                \
+    int64 toPlatformTime<TimeResolution>(TickRep timeTick)                                                                                     \
+    {                                                                                                                                          \
+        return ::toPlatformTimeImpl<TimeResolution>(timeTick);                                                                                 \
+    }
+
+// std::chrono::microseconds
+SPECIALIZE_FROM_PLATFORM_TIME(std::chrono::microseconds)
+SPECIALIZE_FROM_PLATFORM_TIME(std::chrono::nanoseconds)
+
+#undef SPECIALIZE_FROM_PLATFORM_TIME
+
+/**
+ * LibHandle in Linux is the handle returned by dlopen, In glibc it is the link_map of that shared object.
+ * Modules listed from the process are link_map entries as well so both can be used interchangeably.
+ */
+
+LibHandle LinuxPlatformFunctions::openLibrary(const TChar *libName)
+{
+    // RTLD_LOCAL to match Windows where symbols of a dll are not visible to later loaded dlls unless imported
+    return ::dlopen(TCHAR_TO_UTF8(libName), RTLD_NOW | RTLD_LOCAL);
+}
+
+void LinuxPlatformFunctions::releaseLibrary(LibHandle libraryHandle)
+{
+    if (libraryHandle)
+    {
+        ::dlclose(libraryHandle);
+    }
+}
+
+ProcAddress LinuxPlatformFunctions::getProcAddress(LibHandle libraryHandle, const TChar *symName)
+{
+    return ::dlsym(libraryHandle, TCHAR_TO_UTF8(symName));
+}
+
+struct ModuleSizeQuery
+{
+    ElfW(Addr) baseAddress;
+    SizeT imageSize;
+};
+
+void LinuxPlatformFunctions::getModuleInfo(PlatformHandle, LibHandle libraryHandle, LibraryData &moduleData)
+{
+    if (libraryHandle == nullptr)
+    {
+        return;
+    }
+
+    struct link_map *linkMap = nullptr;
+    if (::dlinfo(libraryHandle, RTLD_DI_LINKMAP, &linkMap) != 0 || linkMap == nullptr)
+    {
+        return;
+    }
+
+    // Image size is the extent of all loaded segments of the object
+    ModuleSizeQuery sizeQuery{ linkMap->l_addr, 0 };
+    ::dl_iterate_phdr(
+        [](struct dl_phdr_info *info, size_t, void *userData) -> int
+        {
+            ModuleSizeQuery *query = reinterpret_cast<ModuleSizeQuery *>(userData);
+            if (info->dlpi_addr != query->baseAddress)
+            {
+                return 0;
+            }
+            for (ElfW(Half) i = 0; i < info->dlpi_phnum; ++i)
+            {
+                const ElfW(Phdr) &phdr = info->dlpi_phdr[i];
+                if (phdr.p_type == PT_LOAD)
+                {
+                    query->imageSize = std::max(query->imageSize, SizeT(phdr.p_vaddr + phdr.p_memsz));
+                }
+            }
+            return 1;
+        },
+        &sizeQuery
+    );
+    moduleData.basePtr = reinterpret_cast<void *>(linkMap->l_addr);
+    moduleData.moduleSize = dword(sizeQuery.imageSize);
+
+    // Main executable has empty name in link map
+    String imgPath = (linkMap->l_name && linkMap->l_name[0] != 0) ? UTF8_TO_TCHAR(linkMap->l_name) : TCHAR("");
+    if (imgPath.empty())
+    {
+        AChar exePath[4096];
+        const ssize_t pathLen = ::readlink("/proc/self/exe", exePath, ARRAY_LENGTH(exePath) - 1);
+        if (pathLen > 0)
+        {
+            exePath[pathLen] = 0;
+            imgPath = UTF8_TO_TCHAR(exePath);
+        }
+    }
+    moduleData.imgPath = imgPath;
+    const SizeT nameStart = imgPath.find_last_of(TCHAR('/'));
+    moduleData.name = (nameStart == String::npos) ? imgPath : imgPath.substr(nameStart + 1);
+}
+
+/**
+ * cmdLine is split into arguments the way a shell would split it, without running any command substitutions.
+ * environment holds NAME=VALUE entries separated by null characters like Windows environment block, Empty environment inherits this
+ * process's environment.
+ */
+PlatformHandle
+    LinuxPlatformFunctions::createProcess(const String &applicationPath, const String &cmdLine, const String &environment, const String &workingDirectory)
+{
+    const std::string appPath = TCHAR_TO_UTF8(applicationPath.getChar());
+
+    wordexp_t cmdArgs;
+    if (::wordexp(TCHAR_TO_UTF8(cmdLine.getChar()), &cmdArgs, WRDE_NOCMD) != 0)
+    {
+        LOG_ERROR("LinuxPlatformFunctions", "Failed to parse command line {} for {}", cmdLine, applicationPath);
+        return nullptr;
+    }
+    std::vector<AChar *> argv;
+    argv.reserve(cmdArgs.we_wordc + 2);
+    argv.emplace_back(const_cast<AChar *>(appPath.c_str()));
+    for (SizeT i = 0; i < cmdArgs.we_wordc; ++i)
+    {
+        argv.emplace_back(cmdArgs.we_wordv[i]);
+    }
+    argv.emplace_back(nullptr);
+
+    // TChar is UTF-8 in Linux so the block is used as it is, Converting would stop at first entry's null
+    const std::string envBlock{ environment.getChar(), environment.length() };
+    std::vector<AChar *> envp;
+    if (!envBlock.empty())
+    {
+        for (SizeT entryStart = 0; entryStart < envBlock.length();)
+        {
+            const SizeT entryLen = std::strlen(envBlock.c_str() + entryStart);
+            if (entryLen != 0)
+            {
+                envp.emplace_back(const_cast<AChar *>(envBlock.c_str() + entryStart));
+            }
+            entryStart += entryLen + 1;
+        }
+        envp.emplace_back(nullptr);
+    }
+
+    posix_spawn_file_actions_t fileActions;
+    ::posix_spawn_file_actions_init(&fileActions);
+    const std::string workingDir = TCHAR_TO_UTF8(workingDirectory.getChar());
+    if (!workingDir.empty())
+    {
+        ::posix_spawn_file_actions_addchdir_np(&fileActions, workingDir.c_str());
+    }
+
+    pid_t processId = 0;
+    const int32 spawnErr
+        = ::posix_spawn(&processId, appPath.c_str(), &fileActions, nullptr, argv.data(), envp.empty() ? ::environ : envp.data());
+    ::posix_spawn_file_actions_destroy(&fileActions);
+    ::wordfree(&cmdArgs);
+
+    if (spawnErr != 0)
+    {
+        LOG_ERROR("LinuxPlatformFunctions", "Failed to create process {} {}, error {}", applicationPath, cmdLine, spawnErr);
+        return nullptr;
+    }
+    return reinterpret_cast<PlatformHandle>(UPtrInt(processId));
+}
+
+// There is no process handle in Linux, pid is stored in handle so that it can be passed around like in other platforms
+PlatformHandle LinuxPlatformFunctions::getCurrentProcessHandle() { return reinterpret_cast<PlatformHandle>(UPtrInt(::getpid())); }
+
+// Reaps the process if it already exited so that it does not stay as zombie, Running process is left untouched like closing handle in Windows
+void LinuxPlatformFunctions::closeProcessHandle(PlatformHandle handle)
+{
+    const pid_t processId = pid_t(reinterpret_cast<UPtrInt>(handle));
+    if (processId > 0 && processId != ::getpid())
+    {
+        ::waitpid(processId, nullptr, WNOHANG);
+    }
+}
+
+// Only current process's modules can be queried
+void LinuxPlatformFunctions::getAllModules(PlatformHandle, LibHandle *modules, uint32 &modulesSize)
+{
+    // dlopen of nullptr gives the main program, Its link map is the head of loaded objects list
+    void *mainProgram = ::dlopen(nullptr, RTLD_NOW);
+    struct link_map *linkMap = nullptr;
+    if (mainProgram == nullptr || ::dlinfo(mainProgram, RTLD_DI_LINKMAP, &linkMap) != 0)
+    {
+        modulesSize = 0;
+        return;
+    }
+    ::dlclose(mainProgram);
+
+    uint32 modulesCount = 0;
+    for (; linkMap != nullptr; linkMap = linkMap->l_next)
+    {
+        if (modules != nullptr)
+        {
+            if (modulesCount >= modulesSize)
+            {
+                break;
+            }
+            modules[modulesCount] = linkMap;
+        }
+        ++modulesCount;
+    }
+    modulesSize = modulesCount;
+}
+
+LibHandle LinuxPlatformFunctions::getAddressModule(void *address)
+{
+    Dl_info addressInfo;
+    struct link_map *linkMap = nullptr;
+    if (::dladdr1(address, &addressInfo, reinterpret_cast<void **>(&linkMap), RTLD_DL_LINKMAP) == 0)
+    {
+        return nullptr;
+    }
+    return linkMap;
+}
+
+void LinuxPlatformFunctions::setConsoleForegroundColor(uint8 r, uint8 g, uint8 b)
+{
+    // Virtual terminal sequences are natively supported in Linux terminals
+    AChar colorSeq[24];
+    const int32 seqLen = std::snprintf(colorSeq, ARRAY_LENGTH(colorSeq), "\x1b[38;2;%u;%u;%um", uint32(r), uint32(g), uint32(b));
+    if (::isatty(STDOUT_FILENO))
+    {
+        ::write(STDOUT_FILENO, colorSeq, seqLen);
+    }
+    if (::isatty(STDERR_FILENO))
+    {
+        ::write(STDERR_FILENO, colorSeq, seqLen);
+    }
+}
+
+bool LinuxPlatformFunctions::hasAttachedConsole() { return ::isatty(STDOUT_FILENO) || ::isatty(STDERR_FILENO); }
+
+// Terminal is always inherited from parent process and is UTF-8 already, Nothing to setup
+void LinuxPlatformFunctions::setupAvailableConsole() {}
+
+void LinuxPlatformFunctions::detachCosole() {}
+
+bool LinuxPlatformFunctions::hasAttachedDebugger()
+{
+    // Non zero TracerPid means some process is tracing this process
+    std::ifstream statusFile("/proc/self/status");
+    std::string line;
+    while (std::getline(statusFile, line))
+    {
+        static const std::string_view TRACER_PID{ "TracerPid:" };
+        if (line.starts_with(TRACER_PID))
+        {
+            for (SizeT i = TRACER_PID.length(); i < line.length(); ++i)
+            {
+                if (std::isdigit(static_cast<unsigned char>(line[i])))
+                {
+                    return line[i] != '0';
+                }
+            }
+            return false;
+        }
+    }
+    return false;
+}
+
+// Debuggers in Linux show the process output itself, There is no separate debugger output channel so stderr is used
+void LinuxPlatformFunctions::outputToDebugger(const TChar *msg) noexcept
+{
+    const SizeT msgLen = TCharStr::length(msg);
+    SizeT written = 0;
+    while (written < msgLen)
+    {
+        const ssize_t writeLen = ::write(STDERR_FILENO, msg + written, msgLen - written);
+        if (writeLen <= 0)
+        {
+            break;
+        }
+        written += SizeT(writeLen);
+    }
+}
+
+// Clipboard belongs to the display server and ProgramCore does not connect to one
+String LinuxPlatformFunctions::getClipboard()
+{
+    LOG_WARN("LinuxPlatformFunctions", "Clipboard is not supported without a display server connection");
+    return {};
+}
+
+bool LinuxPlatformFunctions::setClipboard(const String &)
+{
+    LOG_WARN("LinuxPlatformFunctions", "Clipboard is not supported without a display server connection");
+    return false;
+}
+
+uint32 LinuxPlatformFunctions::getSetBitCount(uint8 value) { return uint32(__builtin_popcount(uint32(value))); }
+
+uint32 LinuxPlatformFunctions::getSetBitCount(uint16 value) { return uint32(__builtin_popcount(uint32(value))); }
+
+uint32 LinuxPlatformFunctions::getSetBitCount(uint32 value) { return uint32(__builtin_popcount(value)); }
+
+uint32 LinuxPlatformFunctions::getSetBitCount(uint64 value) { return uint32(__builtin_popcountll(value)); }
+
+bool LinuxPlatformFunctions::createGUID(CBEGuid &outGuid)
+{
+    static_assert(sizeof(CBEGuid) == 16, "GUID must be 16 bytes");
+    uint8 guidBytes[16];
+    if (::getrandom(guidBytes, sizeof(guidBytes), 0) != sizeof(guidBytes))
+    {
+        return false;
+    }
+    // Random(version 4) and RFC4122 variant, Same as what CoCreateGuid generates
+    guidBytes[6] = (guidBytes[6] & 0x0F) | 0x40;
+    guidBytes[8] = (guidBytes[8] & 0x3F) | 0x80;
+    CBEMemory::memCopy(&outGuid, guidBytes, sizeof(guidBytes));
+    return true;
+}
+
+// wchar_t is UTF-32 in Linux, Engine's own converters handles it so returning false to fallback to them
+bool LinuxPlatformFunctions::wcharToUtf8(std::string &, const WChar *) { return false; }
+
+bool LinuxPlatformFunctions::utf8ToWChar(std::wstring &, const AChar *) { return false; }
+
+// AChar strings are UTF-8, Only ASCII characters are case converted as multi byte sequences cannot be converted in place
+bool LinuxPlatformFunctions::toUpper(AChar *inOutStr)
+{
+    for (AChar *ch = inOutStr; *ch != 0; ++ch)
+    {
+        *ch = toUpper(*ch);
+    }
+    return true;
+}
+bool LinuxPlatformFunctions::toUpper(WChar *inOutStr)
+{
+    for (WChar *ch = inOutStr; *ch != 0; ++ch)
+    {
+        *ch = toUpper(*ch);
+    }
+    return true;
+}
+AChar LinuxPlatformFunctions::toUpper(AChar ch)
+{
+    return (ch >= 'a' && ch <= 'z') ? AChar(ch - 'a' + 'A') : ch;
+}
+WChar LinuxPlatformFunctions::toUpper(WChar ch) { return WChar(std::towupper(std::wint_t(ch))); }
+
+bool LinuxPlatformFunctions::toLower(AChar *inOutStr)
+{
+    for (AChar *ch = inOutStr; *ch != 0; ++ch)
+    {
+        *ch = toLower(*ch);
+    }
+    return true;
+}
+bool LinuxPlatformFunctions::toLower(WChar *inOutStr)
+{
+    for (WChar *ch = inOutStr; *ch != 0; ++ch)
+    {
+        *ch = toLower(*ch);
+    }
+    return true;
+}
+AChar LinuxPlatformFunctions::toLower(AChar ch)
+{
+    return (ch >= 'A' && ch <= 'Z') ? AChar(ch - 'A' + 'a') : ch;
+}
+WChar LinuxPlatformFunctions::toLower(WChar ch) { return WChar(std::towlower(std::wint_t(ch))); }
@@ -0,0 +1,41 @@
+/*!
+ * \file LinuxPlatformMemory.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "LinuxPlatformMemory.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+SizeT LinuxPlatformMemory::pageSize()
+{
+    static const SizeT systemPageSize = SizeT(::sysconf(_SC_PAGESIZE));
+    return systemPageSize;
+}
+
+void *LinuxPlatformMemory::mapPages(SizeT size)
+{
+    void *ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+void LinuxPlatformMemory::unmapPages(void *ptr, SizeT size)
+{
+    if (ptr)
+    {
+        ::munmap(ptr, size);
+    }
+}
+
+void *LinuxPlatformMemory::remapPages(void *ptr, SizeT oldSize, SizeT newSize)
+{
+    void *newPtr = ::mremap(ptr, oldSize, newSize, MREMAP_MAYMOVE);
+    return newPtr == MAP_FAILED ? nullptr : newPtr;
+}
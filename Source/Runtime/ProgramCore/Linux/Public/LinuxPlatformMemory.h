@@ -0,0 +1,34 @@
+/*!
+ * \file LinuxPlatformMemory.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Types/CoreTypes.h"
+#include "Types/Platform/GenericPlatformMemory.h"
+
+class PROGRAMCORE_EXPORT LinuxPlatformMemory : public GenericPlatformMemory
+{
+public:
+    /**
+     * Anonymous private page mappings used for allocations at or above PLATFORM_LARGE_ALLOC_THRESHOLD.
+     * Sizes are rounded up to page size by the kernel, Returned memory is zero filled and page aligned.
+     */
+    static SizeT pageSize();
+    static void *mapPages(SizeT size);
+    static void unmapPages(void *ptr, SizeT size);
+    // Grows or shrinks the mapping without copying when possible, Returns nullptr on failure and old mapping stays valid
+    static void *remapPages(void *ptr, SizeT oldSize, SizeT newSize);
+};
+
+namespace GPlatformMemory
+{
+typedef LinuxPlatformMemory PlatformMemory;
+}
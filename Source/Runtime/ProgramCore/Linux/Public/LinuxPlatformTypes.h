@@ -0,0 +1,21 @@
+/*!
+ * \file LinuxPlatformTypes.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Types/Platform/GenericPlatformTypes.h"
+
+class LinuxPlatformTypes : public GenericPlatformTypes
+{
+public:
+};
+
+using PlatformTypes = LinuxPlatformTypes;
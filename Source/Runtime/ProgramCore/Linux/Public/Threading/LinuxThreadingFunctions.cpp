@@ -0,0 +1,338 @@
+/*!
+ * \file LinuxThreadingFunctions.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "Threading/LinuxThreadingFunctions.h"
+#include "String/TCharString.h"
+#include "Types/Platform/PlatformAssertionErrors.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace LinuxThreadingHelpers
+{
+template <typename ValueType>
+bool readSysfsValue(const std::string &filePath, ValueType &outValue)
+{
+    std::ifstream sysFile(filePath);
+    return !!(sysFile >> outValue);
+}
+
+/**
+ * Online CPU ids grouped by their physical core, Cores are ordered by package and core id.
+ * Mapping is done only once as processors going online/offline at runtime is not something engine handles.
+ */
+struct CpuTopology
+{
+    std::vector<std::vector<uint32>> coreCpus;
+    uint32 packagesCount = 0;
+    uint32 logicalCount = 0;
+
+    CpuTopology()
+    {
+        // Key is package id and core id
+        std::map<std::pair<int32, int32>, std::vector<uint32>> packageCoreCpus;
+        const uint32 cpuCount = uint32(std::max(::sysconf(_SC_NPROCESSORS_CONF), 1l));
+        for (uint32 cpuId = 0; cpuId < cpuCount; ++cpuId)
+        {
+            const std::string cpuPath = "/sys/devices/system/cpu/cpu" + std::to_string(cpuId);
+            // cpu0 does not have online file in most systems as it cannot be taken offline
+            int32 bOnline = 1;
+            readSysfsValue(cpuPath + "/online", bOnline);
+            if (bOnline == 0)
+            {
+                continue;
+            }
+
+            int32 packageId = 0, coreId = int32(cpuId);
+            readSysfsValue(cpuPath + "/topology/physical_package_id", packageId);
+            readSysfsValue(cpuPath + "/topology/core_id", coreId);
+            packageCoreCpus[{ packageId, coreId }].emplace_back(cpuId);
+        }
+
+        int32 lastPackageId = -1;
+        for (std::pair<const std::pair<int32, int32>, std::vector<uint32>> &coreCpuIds : packageCoreCpus)
+        {
+            if (coreCpuIds.first.first != lastPackageId)
+            {
+                lastPackageId = coreCpuIds.first.first;
+                packagesCount++;
+            }
+            logicalCount += uint32(coreCpuIds.second.size());
+            coreCpus.emplace_back(std::move(coreCpuIds.second));
+        }
+
+        if (coreCpus.empty())
+        {
+            // sysfs is not available, Treat each processor as a core
+            for (uint32 cpuId = 0; cpuId < cpuCount; ++cpuId)
+            {
+                coreCpus.emplace_back(std::vector<uint32>{ cpuId });
+            }
+            packagesCount = 1;
+            logicalCount = cpuCount;
+        }
+    }
+
+    // Maps engine's global logical processor index to Linux CPU id
+    bool logicalToCpuId(uint32 coreIdx, uint32 logicalIdx, uint32 &outCpuId) const
+    {
+        if (coreIdx >= coreCpus.size() || logicalIdx >= coreCpus[coreIdx].size())
+        {
+            return false;
+        }
+        outCpuId = coreCpus[coreIdx][logicalIdx];
+        return true;
+    }
+};
+
+const CpuTopology &getCpuTopology()
+{
+    static const CpuTopology topology;
+    return topology;
+}
+
+// Parses list like 0-3,8,10-11 and returns number of CPUs in the list
+uint32 cpuListCount(const std::string &cpuList)
+{
+    uint32 count = 0;
+    SizeT start = 0;
+    while (start < cpuList.length())
+    {
+        SizeT end = cpuList.find(',', start);
+        end = (end == std::string::npos) ? cpuList.length() : end;
+
+        const std::string range = cpuList.substr(start, end - start);
+        const SizeT dashAt = range.find('-');
+        if (dashAt == std::string::npos)
+        {
+            count += range.empty() ? 0 : 1;
+        }
+        else
+        {
+            count += uint32(std::stoul(range.substr(dashAt + 1)) - std::stoul(range.substr(0, dashAt)) + 1);
+        }
+        start = end + 1;
+    }
+    return count;
+}
+
+bool setThreadAffinity(const cpu_set_t &cpuSet, PlatformHandle threadHandle)
+{
+    return ::pthread_setaffinity_np(pthread_t(threadHandle), sizeof(cpu_set_t), &cpuSet) == 0;
+}
+} // namespace LinuxThreadingHelpers
+
+bool LinuxThreadingFunctions::createTlsSlot(uint32 &outSlot)
+{
+    pthread_key_t slotKey;
+    if (::pthread_key_create(&slotKey, nullptr) != 0)
+    {
+        return false;
+    }
+    static_assert(sizeof(pthread_key_t) <= sizeof(uint32), "TLS key must fit in uint32");
+    outSlot = uint32(slotKey);
+    return true;
+}
+
+void LinuxThreadingFunctions::releaseTlsSlot(uint32 slot) { ::pthread_key_delete(pthread_key_t(slot)); }
+
+bool LinuxThreadingFunctions::setTlsSlotValue(uint32 slot, void *value) { return ::pthread_setspecific(pthread_key_t(slot), value) == 0; }
+
+void *LinuxThreadingFunctions::getTlsSlotValue(uint32 slot) { return ::pthread_getspecific(pthread_key_t(slot)); }
+
+void LinuxThreadingFunctions::setThreadName(const TChar *name, PlatformHandle threadHandle)
+{
+    // Linux thread names are limited to 16 bytes including null terminator
+    std::string threadName{ TCHAR_TO_UTF8(name) };
+    if (threadName.length() > 15)
+    {
+        threadName.resize(15);
+    }
+    ::pthread_setname_np(pthread_t(threadHandle), threadName.c_str());
+}
+
+String LinuxThreadingFunctions::getThreadName(PlatformHandle threadHandle)
+{
+    AChar threadName[16];
+    if (::pthread_getname_np(pthread_t(threadHandle), threadName, ARRAY_LENGTH(threadName)) == 0)
+    {
+        return UTF8_TO_TCHAR(threadName);
+    }
+    return TCHAR("");
+}
+
+String LinuxThreadingFunctions::getCurrentThreadName() { return getThreadName(getCurrentThreadHandle()); }
+
+PlatformHandle LinuxThreadingFunctions::getCurrentThreadHandle() { return reinterpret_cast<PlatformHandle>(::pthread_self()); }
+
+bool LinuxThreadingFunctions::setThreadProcessor(uint32 coreIdx, uint32 logicalProcessorIdx, PlatformHandle threadHandle)
+{
+    uint32 cpuId;
+    if (!LinuxThreadingHelpers::getCpuTopology().logicalToCpuId(coreIdx, logicalProcessorIdx, cpuId))
+    {
+        return false;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuId, &cpuSet);
+    return LinuxThreadingHelpers::setThreadAffinity(cpuSet, threadHandle);
+}
+
+bool LinuxThreadingFunctions::setThreadGroupAffinity(uint16 grpIdx, uint64 affinityMask, PlatformHandle threadHandle)
+{
+    const LinuxThreadingHelpers::CpuTopology &topology = LinuxThreadingHelpers::getCpuTopology();
+    const uint32 logicalPerCore = uint32(topology.coreCpus.front().size());
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    bool bAnySet = false;
+    for (uint32 bitIdx = 0; bitIdx < 64; ++bitIdx)
+    {
+        if ((affinityMask & (1ull << bitIdx)) == 0)
+        {
+            continue;
+        }
+        // Group affinity mask bits are global logical processor index as in GroupAffinityMaskBuilder
+        const uint32 globalLogicalIdx = grpIdx * 64 + bitIdx;
+        uint32 cpuId;
+        if (topology.logicalToCpuId(globalLogicalIdx / logicalPerCore, globalLogicalIdx % logicalPerCore, cpuId))
+        {
+            CPU_SET(cpuId, &cpuSet);
+            bAnySet = true;
+        }
+    }
+    return bAnySet && LinuxThreadingHelpers::setThreadAffinity(cpuSet, threadHandle);
+}
+
+void LinuxThreadingFunctions::sleep(int64 msTicks)
+{
+    struct timespec sleepTime;
+    sleepTime.tv_sec = time_t(msTicks / 1000);
+    sleepTime.tv_nsec = long((msTicks % 1000) * 1'000'000);
+    // Sleep again for remaining time if interrupted by signal
+    while (::nanosleep(&sleepTime, &sleepTime) != 0 && errno == EINTR)
+    {}
+}
+
+SystemProcessorsInfo LinuxThreadingFunctions::getSystemProcessorInfo()
+{
+    const LinuxThreadingHelpers::CpuTopology &topology = LinuxThreadingHelpers::getCpuTopology();
+
+    SystemProcessorsInfo processorInfo;
+    processorInfo.physicalProcessorCount = topology.packagesCount;
+    processorInfo.coresCount = uint32(topology.coreCpus.size());
+    processorInfo.logicalProcessorsCount = topology.logicalCount;
+    // Same as Windows each group has at most 64 logical processors
+    processorInfo.logicalGroupsCount = (topology.logicalCount + 63) / 64;
+    return processorInfo;
+}
+
+SystemProcessorsCacheInfo LinuxThreadingFunctions::getProcessorCacheInfo()
+{
+    SystemProcessorsCacheInfo cacheInfo;
+
+    // Caches of first CPU is taken as representative, Hybrid CPUs with different cache per core type are not handled
+    const std::string cacheDir = "/sys/devices/system/cpu/cpu0/cache/index";
+    for (uint32 cacheIdx = 0;; ++cacheIdx)
+    {
+        const std::string indexPath = cacheDir + std::to_string(cacheIdx);
+        uint32 level = 0;
+        if (!LinuxThreadingHelpers::readSysfsValue(indexPath + "/level", level))
+        {
+            break;
+        }
+        std::string cacheType, sizeStr, sharedCpus;
+        uint32 lineSize = 0;
+        LinuxThreadingHelpers::readSysfsValue(indexPath + "/type", cacheType);
+        LinuxThreadingHelpers::readSysfsValue(indexPath + "/size", sizeStr);
+        LinuxThreadingHelpers::readSysfsValue(indexPath + "/shared_cpu_list", sharedCpus);
+        LinuxThreadingHelpers::readSysfsValue(indexPath + "/coherency_line_size", lineSize);
+
+        // Size is in the format 32K or 8192K
+        uint32 cacheSize = sizeStr.empty() ? 0 : uint32(std::stoul(sizeStr));
+        if (!sizeStr.empty() && sizeStr.back() == 'K')
+        {
+            cacheSize *= 1024;
+        }
+        else if (!sizeStr.empty() && sizeStr.back() == 'M')
+        {
+            cacheSize *= 1024 * 1024;
+        }
+        if (cacheSize == 0)
+        {
+            continue;
+        }
+
+        if (cacheInfo.cacheLineSize == 0)
+        {
+            cacheInfo.cacheLineSize = lineSize;
+        }
+
+        SystemProcessorsCacheInfo::CacheUnit *cacheUnit = nullptr;
+        uint32 *puShareCount = nullptr;
+        switch (level)
+        {
+        case 1:
+            cacheUnit = &cacheInfo.unitL1ByteSize;
+            puShareCount = &cacheInfo.puSharingL1;
+            break;
+        case 2:
+            cacheUnit = &cacheInfo.unitL2ByteSize;
+            puShareCount = &cacheInfo.puSharingL2;
+            break;
+        case 3:
+            cacheUnit = &cacheInfo.unitL3ByteSize;
+            puShareCount = &cacheInfo.puSharingL3;
+            break;
+        default:
+            break;
+        }
+        if (cacheUnit == nullptr)
+        {
+            continue;
+        }
+
+        if (*puShareCount == 0)
+        {
+            *puShareCount = LinuxThreadingHelpers::cpuListCount(sharedCpus);
+        }
+        if (cacheType == "Unified")
+        {
+            cacheUnit->bSplitDesign = false;
+            cacheUnit->uCacheByteSize = cacheSize;
+        }
+        else if (cacheType == "Instruction")
+        {
+            cacheUnit->bSplitDesign = true;
+            cacheUnit->caches.iCacheByteSize = cacheSize;
+        }
+        else if (cacheType == "Data")
+        {
+            cacheUnit->bSplitDesign = true;
+            cacheUnit->caches.dCacheByteSize = cacheSize;
+        }
+    }
+    return cacheInfo;
+}
+
+void LinuxThreadingFunctions::printSystemThreadingInfo()
+{
+    ThreadingHelpers::INTERNAL_printSystemThreadingInfo(getSystemProcessorInfo(), getProcessorCacheInfo());
+}
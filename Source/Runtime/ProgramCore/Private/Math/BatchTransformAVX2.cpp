@@ -0,0 +1,103 @@
+/*!
+ * \file BatchTransformAVX2.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+/**
+ * Do not include headers with inline functions here. This file is compiled with AVX2 enabled and linker is free to pick this file's copy of
+ * an inline function for every caller, That would crash in CPUs without AVX2
+ */
+#include "Math/BatchTransformAVX2.h"
+#include "Math/MathSIMD.h"
+
+#if MATH_SIMD_AVX2
+
+namespace BatchTransformAVX2
+{
+
+void multiply(float *outMats, const float *lhsMats, SizeT lhsStride, const float *rhsMats, SizeT count)
+{
+    __m256 lhsCols[4];
+    for (SizeT i = 0; i < count; ++i)
+    {
+        if (i == 0 || lhsStride != 0)
+        {
+            const float *lhs = lhsMats + i * lhsStride;
+            lhsCols[0] = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs));
+            lhsCols[1] = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs + 4));
+            lhsCols[2] = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs + 8));
+            lhsCols[3] = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(lhs + 12));
+        }
+
+        // Two result columns per register, All of rhs is loaded before writing so output can alias rhs
+        const float *rhs = rhsMats + i * 16;
+        const __m256 rhsCols01 = _mm256_loadu_ps(rhs);
+        const __m256 rhsCols23 = _mm256_loadu_ps(rhs + 8);
+
+        // Same operation order as SSE and scalar paths, (col0 * x + col1 * y) + (col2 * z + col3 * w)
+        const __m256 res01 = _mm256_add_ps(
+            _mm256_add_ps(
+                _mm256_mul_ps(lhsCols[0], _mm256_shuffle_ps(rhsCols01, rhsCols01, _MM_SHUFFLE(0, 0, 0, 0))),
+                _mm256_mul_ps(lhsCols[1], _mm256_shuffle_ps(rhsCols01, rhsCols01, _MM_SHUFFLE(1, 1, 1, 1)))
+            ),
+            _mm256_add_ps(
+                _mm256_mul_ps(lhsCols[2], _mm256_shuffle_ps(rhsCols01, rhsCols01, _MM_SHUFFLE(2, 2, 2, 2))),
+                _mm256_mul_ps(lhsCols[3], _mm256_shuffle_ps(rhsCols01, rhsCols01, _MM_SHUFFLE(3, 3, 3, 3)))
+            )
+        );
+        const __m256 res23 = _mm256_add_ps(
+            _mm256_add_ps(
+                _mm256_mul_ps(lhsCols[0], _mm256_shuffle_ps(rhsCols23, rhsCols23, _MM_SHUFFLE(0, 0, 0, 0))),
+                _mm256_mul_ps(lhsCols[1], _mm256_shuffle_ps(rhsCols23, rhsCols23, _MM_SHUFFLE(1, 1, 1, 1)))
+            ),
+            _mm256_add_ps(
+                _mm256_mul_ps(lhsCols[2], _mm256_shuffle_ps(rhsCols23, rhsCols23, _MM_SHUFFLE(2, 2, 2, 2))),
+                _mm256_mul_ps(lhsCols[3], _mm256_shuffle_ps(rhsCols23, rhsCols23, _MM_SHUFFLE(3, 3, 3, 3)))
+            )
+        );
+
+        float *outMat = outMats + i * 16;
+        _mm256_storeu_ps(outMat, res01);
+        _mm256_storeu_ps(outMat + 8, res23);
+    }
+}
+
+SizeT transformPoints(
+    float *outX, float *outY, float *outZ, const float *mat, const float *inX, const float *inY, const float *inZ, SizeT count
+)
+{
+    const float *m = mat;
+    const __m256 m0 = _mm256_set1_ps(m[0]), m1 = _mm256_set1_ps(m[1]), m2 = _mm256_set1_ps(m[2]);
+    const __m256 m4 = _mm256_set1_ps(m[4]), m5 = _mm256_set1_ps(m[5]), m6 = _mm256_set1_ps(m[6]);
+    const __m256 m8 = _mm256_set1_ps(m[8]), m9 = _mm256_set1_ps(m[9]), m10 = _mm256_set1_ps(m[10]);
+    const __m256 m12 = _mm256_set1_ps(m[12]), m13 = _mm256_set1_ps(m[13]), m14 = _mm256_set1_ps(m[14]);
+
+    SizeT i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(inX + i);
+        const __m256 y = _mm256_loadu_ps(inY + i);
+        const __m256 z = _mm256_loadu_ps(inZ + i);
+        // Same operation order as SSE and scalar paths
+        _mm256_storeu_ps(
+            outX + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, x), _mm256_mul_ps(m4, y)), _mm256_add_ps(_mm256_mul_ps(m8, z), m12))
+        );
+        _mm256_storeu_ps(
+            outY + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, x), _mm256_mul_ps(m5, y)), _mm256_add_ps(_mm256_mul_ps(m9, z), m13))
+        );
+        _mm256_storeu_ps(
+            outZ + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, x), _mm256_mul_ps(m6, y)), _mm256_add_ps(_mm256_mul_ps(m10, z), m14))
+        );
+    }
+    return i;
+}
+
+} // namespace BatchTransformAVX2
+
+#endif // MATH_SIMD_AVX2
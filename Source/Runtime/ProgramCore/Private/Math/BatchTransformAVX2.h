@@ -0,0 +1,30 @@
+/*!
+ * \file BatchTransformAVX2.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Types/CoreTypes.h"
+
+/**
+ * AVX2 kernels of BatchTransform. BatchTransformAVX2.cpp is compiled with AVX2 enabled only for that file and BatchTransform calls these
+ * only after checking that the CPU supports AVX2.
+ * Kernels work on column major floats, Each matrix is 16 tightly packed floats.
+ */
+namespace BatchTransformAVX2
+{
+// outMats[i] = lhsMats[i * lhsStride] * rhsMats[i], lhsStride is 0 to use same lhs for all. Output can alias inputs for same indexed matrices
+void multiply(float *outMats, const float *lhsMats, SizeT lhsStride, const float *rhsMats, SizeT count);
+
+// Transforms SoA points in multiples of 8 and returns the count of transformed points, Rest must be done by the caller
+SizeT transformPoints(
+    float *outX, float *outY, float *outZ, const float *mat, const float *inX, const float *inY, const float *inZ, SizeT count
+);
+} // namespace BatchTransformAVX2
@@ -11,6 +11,7 @@
 
 #include "Logger/Logger.h"
 #include "CmdLine/CmdLine.h"
+#include "Math/Math.h"
 #include "String/TCharString.h"
 #include "Types/Platform/LFS/PlatformLFS.h"
 #include "Types/Platform/LFS/Paths.h"
@@ -23,6 +24,7 @@
 #include "Profiler/ProgramProfiler.hpp"
 
 #include <mutex>
+#include <unordered_map>
 
 #if LOG_TO_CONSOLE
 #include <iostream>
@@ -83,6 +85,46 @@ private:
     using LoggerWorkerTask = copat::JobSystemWorkerThreadTask;
     using LogPacketsDelegate = Delegate<const String &, const std::vector<Logger::LogMsgPacket> &>;
 
+public:
+    // Header of a structured log record, Recorded arguments data follows the header
+    struct StructuredLogRecord
+    {
+        // Size including header and arguments aligned to record alignment, 0 marks that rest of the ring is unused and the record is at ring's
+        // start
+        uint32 recordSize;
+        uint32 argsSize;
+        Logger::ESeverityID severity;
+        // Logger::ELogOutputType flags that were allowed when recorded
+        uint8 outputs;
+        uint8 argsCount;
+        // Owning thread's log sequence, Used to order structured logs among the thread's other logs
+        uint64 sequence;
+        TickRep timeStamp;
+        const TChar *fmt;
+        const TChar *category;
+        Logger::SourceLocationType srcLoc;
+    };
+    // Single producer(Owning thread) and single consumer(Flush) ring of structured log records
+    struct StructuredLogRing
+    {
+        constexpr static const uint32 RING_SIZE = 64 * 1024;
+        // Record header holds 8 byte values so every record starts at that alignment
+        constexpr static const uint32 RECORD_ALIGNMENT = uint32(alignof(StructuredLogRecord));
+        static_assert(RECORD_ALIGNMENT <= alignof(uint64), "Ring storage is not aligned enough for record");
+
+        // Allocated by the owning thread when it records for the first time
+        std::vector<uint64> storage;
+        // Monotonically increasing byte positions, Offset into ring is position % RING_SIZE
+        std::atomic<uint64> writePos{ 0 };
+        std::atomic<uint64> readPos{ 0 };
+        // End position of record that is reserved by the owning thread and not committed yet
+        uint64 reservedEndPos = 0;
+
+        uint8 *ringData() { return reinterpret_cast<uint8 *>(storage.data()); }
+        bool hasRecords() const { return readPos.load(std::memory_order::relaxed) != writePos.load(std::memory_order::acquire); }
+    };
+
+private:
     struct LoggerPerThreadData
     {
         // Right now we do per thread mute which is not correct, However this is better than solving below multi threaded scenario
@@ -92,8 +134,16 @@ private:
         OStringStream bufferStream = OStringStream(std::ios_base::trunc);
         // Packets to log this frame
         std::vector<Logger::LogMsgPacket> packets;
+        // Log sequence of each packet in packets
+        std::vector<uint64> packetSequences;
+        // Incremented by owning thread for every log and structured log, Structured logs are drained after the packets when flushing and
+        // this is used to restore the order in which they were logged
+        uint64 logSequence = 0;
         // Per thread stream locks when flushing all streams
         CBESpinLock streamRWLock;
+
+        // Does not need any lock, Only the owning thread writes and flush reads
+        StructuredLogRing structuredRing;
     };
 
     uint32 tlsSlot;
@@ -110,6 +160,15 @@ private:
     std::atomic_flag bEnableLogTime;
     PlatformFile logFile;
 
+    // Binary log of structured logs, Created only when a structured log is flushed for the first time
+    PlatformFile binaryLogFile;
+    String binaryLogFilePath;
+    bool bBinaryLogOpenTried = false;
+    bool bBinaryLogOpened = false;
+    // Id of each unique string pointer written into binary log, Accessed only inside flush
+    std::unordered_map<const void *, uint32> binaryLogStringIds;
+    std::vector<uint8> binaryLogBuffer;
+
     LoggerPerThreadData &getOrCreatePerThreadData()
     {
         LoggerPerThreadData *threadLocalData = (LoggerPerThreadData *)PlatformThreadingFunctions::getTlsSlotValue(tlsSlot);
@@ -162,16 +221,36 @@ public:
     {
         LoggerPerThreadData &tlData = getOrCreatePerThreadData();
         debugAssertf(!tlData.streamRWLock.try_lock(), "Packet payload must be retrieved only after locking the logger stream buffer");
+        tlData.packetSequences.emplace_back(tlData.logSequence++);
         return tlData.packets.emplace_back();
     }
     void unlockLoggerBuffer() { getOrCreatePerThreadData().streamRWLock.unlock(); }
 
+    // outSequence will be the record's log sequence if reserved
+    uint8 *reserveStructuredRecord(uint32 recordSize, uint64 &outSequence);
+    void commitStructuredRecord();
+
     void flushStream() noexcept;
 
 private:
     bool openNewLogFile();
     void flushStreamInternal() noexcept;
 
+    /**
+     * Formats all structured logs of this thread and appends the messages to bufferStr and its packets to outPackets, Then reorders
+     * outPackets by log sequence so that structured logs appear at the place they were logged
+     */
+    void drainStructuredLogs(
+        LoggerPerThreadData &tlData, String &bufferStr, SizeT bufferOffset, std::vector<Logger::LogMsgPacket> &outPackets,
+        std::vector<uint64> &outSequences
+    );
+    void writeStructuredToBinaryLog(const StructuredLogRecord &record, const uint8 *argsData, const AChar *fileName, std::string_view funcName);
+    // Strings are identified by its pointer, Format strings, categories and source location strings are all static
+    uint32 binaryLogStringId(const TChar *str);
+    uint32 binaryLogStringId(const void *strPtr, std::string_view utf8Str);
+    void writeStructuredToConsole(const StructuredLogRecord &record, const String &message, const AChar *fileName, std::string_view funcName);
+    void flushBinaryLog();
+
     LoggerWorkerTask flushInWorkerThread(LoggerWorkerTask execAfter) noexcept
     {
         co_await execAfter;
@@ -197,6 +276,7 @@ void LoggerImpl::shutdown()
     lastFlushTask = { nullptr };
     packetsListeners.clear();
     logFile.closeFile();
+    binaryLogFile.closeFile();
 
     PlatformFunctions::detachCosole();
 
@@ -234,10 +314,12 @@ void LoggerImpl::flushStreamInternal() noexcept
     allTlDataLock.lock();
     for (LoggerPerThreadData *tlData : allPerThreadData)
     {
-        if (tlData->bufferStream.tellp() != 0)
+        const bool bHasStructuredLogs = tlData->structuredRing.hasRecords();
+        if (tlData->bufferStream.tellp() != 0 || bHasStructuredLogs)
         {
             SizeT bufferOffset = 0;
             std::vector<Logger::LogMsgPacket> tlPackets;
+            std::vector<uint64> tlSequences;
             // Pull from thread data
             {
                 CBE_PROFILER_SCOPE_DYN(CBE_PROFILER_CHAR("PullThreadLocalLogs"), CBEProfiler::profilerAvailable());
@@ -258,6 +340,12 @@ void LoggerImpl::flushStreamInternal() noexcept
                 tlData->bufferStream.str({});
 
                 tlPackets = std::move(tlData->packets);
+                tlSequences = std::move(tlData->packetSequences);
+            }
+            // Structured logs are formatted here and ordered among the messages that are already formatted
+            if (bHasStructuredLogs)
+            {
+                drainStructuredLogs(*tlData, bufferStr, bufferOffset, tlPackets, tlSequences);
             }
 
             CBE_PROFILER_SCOPE_DYN(CBE_PROFILER_CHAR("WriteThreadLocalLogs"), CBEProfiler::profilerAvailable());
@@ -331,6 +419,8 @@ void LoggerImpl::flushStreamInternal() noexcept
     }
     allTlDataLock.unlock();
 
+    flushBinaryLog();
+
     // Broadcast log packets to other systems
     if (packetsListeners.isBound())
     {
@@ -340,6 +430,277 @@ void LoggerImpl::flushStreamInternal() noexcept
     }
 }
 
+uint8 *LoggerImpl::reserveStructuredRecord(uint32 recordSize, uint64 &outSequence)
+{
+    LoggerPerThreadData &tlData = getOrCreatePerThreadData();
+    StructuredLogRing &ring = tlData.structuredRing;
+    debugAssert(recordSize % StructuredLogRing::RECORD_ALIGNMENT == 0);
+    // Too large records are formatted directly
+    if (recordSize > StructuredLogRing::RING_SIZE / 4)
+    {
+        return nullptr;
+    }
+    if (ring.storage.empty())
+    {
+        ring.storage.resize(StructuredLogRing::RING_SIZE / sizeof(uint64));
+    }
+
+    const uint64 writePos = ring.writePos.load(std::memory_order::relaxed);
+    const uint64 readPos = ring.readPos.load(std::memory_order::acquire);
+    const uint32 writeOffset = uint32(writePos % StructuredLogRing::RING_SIZE);
+    // Records are never split, If it does not fit before the ring's end it will be written at ring's start
+    const uint64 recordStartPos
+        = (writeOffset + recordSize > StructuredLogRing::RING_SIZE) ? writePos + (StructuredLogRing::RING_SIZE - writeOffset) : writePos;
+    const uint64 recordEndPos = recordStartPos + recordSize;
+    if (recordEndPos - readPos > StructuredLogRing::RING_SIZE)
+    {
+        return nullptr;
+    }
+
+    if (recordStartPos != writePos)
+    {
+        // Offset is always aligned so there is space for the marker
+        reinterpret_cast<StructuredLogRecord *>(ring.ringData() + writeOffset)->recordSize = 0;
+    }
+    ring.reservedEndPos = recordEndPos;
+    outSequence = tlData.logSequence++;
+    return ring.ringData() + (recordStartPos % StructuredLogRing::RING_SIZE);
+}
+
+void LoggerImpl::commitStructuredRecord()
+{
+    StructuredLogRing &ring = getOrCreatePerThreadData().structuredRing;
+    ring.writePos.store(ring.reservedEndPos, std::memory_order::release);
+}
+
+void LoggerImpl::drainStructuredLogs(
+    LoggerPerThreadData &tlData, String &bufferStr, SizeT bufferOffset, std::vector<Logger::LogMsgPacket> &outPackets,
+    std::vector<uint64> &outSequences
+)
+{
+    CBE_PROFILER_SCOPE_DYN(CBE_PROFILER_CHAR("FormatStructuredLogs"), CBEProfiler::profilerAvailable());
+
+    StructuredLogRing &ring = tlData.structuredRing;
+    const SizeT formattedPacketsCount = outPackets.size();
+    uint64 readPos = ring.readPos.load(std::memory_order::relaxed);
+    const uint64 writePos = ring.writePos.load(std::memory_order::acquire);
+    while (readPos < writePos)
+    {
+        const uint32 readOffset = uint32(readPos % StructuredLogRing::RING_SIZE);
+        const StructuredLogRecord &record = *reinterpret_cast<const StructuredLogRecord *>(ring.ringData() + readOffset);
+        if (record.recordSize == 0)
+        {
+            readPos += StructuredLogRing::RING_SIZE - readOffset;
+            continue;
+        }
+
+        const uint8 *argsData = reinterpret_cast<const uint8 *>(&record + 1);
+        const String message = StructuredLog::formatArgs(record.fmt, argsData, record.argsSize, record.argsCount);
+        const AChar *fileName = filterFileName(record.srcLoc.file_name());
+        std::string_view funcName = filterFuncName(record.srcLoc.function_name());
+
+        if (BIT_SET(record.outputs, Logger::ELogOutputType::File))
+        {
+            outSequences.emplace_back(record.sequence);
+            Logger::LogMsgPacket &packet = outPackets.emplace_back();
+            packet.srcLoc = record.srcLoc;
+            packet.fileNameOffset = uint32(fileName - record.srcLoc.file_name());
+            packet.funcNameOffset = uint32(funcName.data() - record.srcLoc.function_name());
+            packet.funcNameSize = uint32(funcName.size());
+            packet.timeStamp = record.timeStamp;
+            packet.severity = record.severity;
+            // Offsets are relative to this thread's buffer start
+            packet.categoryStart = bufferStr.length() - bufferOffset;
+            packet.categorySize = uint32(TCharStr::length(record.category));
+            bufferStr.append(record.category);
+            packet.messageStart = bufferStr.length() - bufferOffset;
+            packet.messageSize = uint32(message.length());
+            bufferStr.append(message);
+
+            writeStructuredToBinaryLog(record, argsData, fileName, funcName);
+        }
+        if (BIT_SET(record.outputs, Logger::ELogOutputType::Console))
+        {
+            writeStructuredToConsole(record, message, fileName, funcName);
+        }
+        if (BIT_SET(record.outputs, Logger::ELogOutputType::Profiler))
+        {
+            const Color SEVERITY_PROFILER_COLOR[Logger::ESeverityID::SevID_Max]
+                = { ColorConst::DARK_GRAY, ColorConst::GRAY, ColorConst::WHITE, ColorConst::YELLOW, ColorConst::RED };
+            CBE_PROFILER_MESSAGE_C(message.getChar(), SEVERITY_PROFILER_COLOR[record.severity]);
+        }
+
+        readPos += record.recordSize;
+    }
+    // Releases the space back to the owning thread
+    ring.readPos.store(readPos, std::memory_order::release);
+
+    // Both formatted packets and structured packets are in sequence order, Merge them if structured ones are not all after formatted ones
+    if (formattedPacketsCount == 0 || formattedPacketsCount == outPackets.size()
+        || outSequences[formattedPacketsCount - 1] < outSequences[formattedPacketsCount])
+    {
+        return;
+    }
+    std::vector<Logger::LogMsgPacket> mergedPackets;
+    std::vector<uint64> mergedSequences;
+    mergedPackets.reserve(outPackets.size());
+    mergedSequences.reserve(outSequences.size());
+    SizeT formattedIdx = 0;
+    SizeT structuredIdx = formattedPacketsCount;
+    while (formattedIdx < formattedPacketsCount || structuredIdx < outPackets.size())
+    {
+        const bool bPickFormatted = structuredIdx == outPackets.size()
+                                    || (formattedIdx < formattedPacketsCount && outSequences[formattedIdx] < outSequences[structuredIdx]);
+        const SizeT pickIdx = bPickFormatted ? formattedIdx++ : structuredIdx++;
+        mergedPackets.emplace_back(outPackets[pickIdx]);
+        mergedSequences.emplace_back(outSequences[pickIdx]);
+    }
+    outPackets = std::move(mergedPackets);
+    outSequences = std::move(mergedSequences);
+}
+
+void LoggerImpl::writeStructuredToConsole(
+    const StructuredLogRecord &record, const String &message, const AChar *fileName, std::string_view funcName
+)
+{
+    std::scoped_lock<CBESpinLock> lockConsole(Logger::consoleOutputLock());
+#if LOG_TO_CONSOLE
+    const bool bIsError = record.severity == Logger::ESeverityID::SevID_Error;
+    const bool bToErrStream = bIsError || record.severity == Logger::ESeverityID::SevID_Warning;
+    auto &outStream = bToErrStream ? CERR : COUT;
+
+    if (bToErrStream)
+    {
+#if ENABLE_VIRTUAL_TERMINAL_SEQ
+        outStream << (bIsError ? Logger::CONSOLE_FOREGROUND_RED : Logger::CONSOLE_FOREGROUND_YELLOW);
+#else  // ENABLE_VIRTUAL_TERMINAL_SEQ
+        PlatformFunctions::setConsoleForegroundColor(255, bIsError ? 0 : 255, 0);
+#endif // ENABLE_VIRTUAL_TERMINAL_SEQ
+    }
+
+#if SHORT_MSG_IN_CONSOLE
+    CompilerHacks::ignoreUnused(fileName, funcName);
+    outStream << message.getChar() << std::endl;
+#else  // SHORT_MSG_IN_CONSOLE
+    if (record.timeStamp != 0)
+    {
+        outStream << TCHAR("[") << Time::toString(record.timeStamp, false) << TCHAR("]");
+    }
+    outStream << SEVERITY_OUT_STR[record.severity];
+    outStream << TCHAR("[") << record.category << TCHAR("]");
+    outStream << TCHAR("[") << fileName << TCHAR(":") << record.srcLoc.line() << TCHAR("]");
+    outStream << funcName << TCHAR("() : ");
+    outStream << message.getChar();
+    outStream << std::endl;
+#endif // SHORT_MSG_IN_CONSOLE
+
+    if (bToErrStream)
+    {
+#if ENABLE_VIRTUAL_TERMINAL_SEQ
+        outStream << Logger::CONSOLE_FOREGROUND_DEFAULT;
+#else  // ENABLE_VIRTUAL_TERMINAL_SEQ
+        PlatformFunctions::setConsoleForegroundColor(255, 255, 255);
+#endif // ENABLE_VIRTUAL_TERMINAL_SEQ
+    }
+#else  // LOG_TO_CONSOLE
+    CompilerHacks::ignoreUnused(record, message, fileName, funcName);
+#endif // LOG_TO_CONSOLE
+}
+
+template <typename Type>
+FORCE_INLINE void appendToBinaryLog(std::vector<uint8> &buffer, const Type &value)
+{
+    const uint8 *valueBytes = reinterpret_cast<const uint8 *>(&value);
+    buffer.insert(buffer.end(), valueBytes, valueBytes + sizeof(Type));
+}
+
+uint32 LoggerImpl::binaryLogStringId(const TChar *str)
+{
+    auto itr = binaryLogStringIds.find(str);
+    if (itr != binaryLogStringIds.cend())
+    {
+        return itr->second;
+    }
+    return binaryLogStringId(str, std::string{ TCHAR_TO_UTF8(str) });
+}
+
+uint32 LoggerImpl::binaryLogStringId(const void *strPtr, std::string_view utf8Str)
+{
+    auto itr = binaryLogStringIds.find(strPtr);
+    if (itr != binaryLogStringIds.cend())
+    {
+        return itr->second;
+    }
+
+    const uint32 strId = uint32(binaryLogStringIds.size());
+    binaryLogStringIds[strPtr] = strId;
+
+    appendToBinaryLog(binaryLogBuffer, StructuredLog::EBinaryLogEntry::String);
+    appendToBinaryLog(binaryLogBuffer, strId);
+    appendToBinaryLog(binaryLogBuffer, uint32(utf8Str.size()));
+    binaryLogBuffer.insert(binaryLogBuffer.end(), utf8Str.cbegin(), utf8Str.cend());
+    return strId;
+}
+
+void LoggerImpl::writeStructuredToBinaryLog(
+    const StructuredLogRecord &record, const uint8 *argsData, const AChar *fileName, std::string_view funcName
+)
+{
+    // Strings must be written before the record that uses it
+    const uint32 fmtId = binaryLogStringId(record.fmt);
+    const uint32 categoryId = binaryLogStringId(record.category);
+    const uint32 fileId = binaryLogStringId(fileName, fileName);
+    const uint32 funcId = binaryLogStringId(funcName.data(), funcName);
+
+    appendToBinaryLog(binaryLogBuffer, StructuredLog::EBinaryLogEntry::Record);
+    appendToBinaryLog(binaryLogBuffer, uint8(record.severity));
+    appendToBinaryLog(binaryLogBuffer, int64(record.timeStamp));
+    appendToBinaryLog(binaryLogBuffer, fmtId);
+    appendToBinaryLog(binaryLogBuffer, categoryId);
+    appendToBinaryLog(binaryLogBuffer, fileId);
+    appendToBinaryLog(binaryLogBuffer, funcId);
+    appendToBinaryLog(binaryLogBuffer, uint32(record.srcLoc.line()));
+    appendToBinaryLog(binaryLogBuffer, record.argsCount);
+    appendToBinaryLog(binaryLogBuffer, record.argsSize);
+    binaryLogBuffer.insert(binaryLogBuffer.end(), argsData, argsData + record.argsSize);
+}
+
+void LoggerImpl::flushBinaryLog()
+{
+    if (binaryLogBuffer.empty())
+    {
+        return;
+    }
+
+    if (!bBinaryLogOpenTried)
+    {
+        bBinaryLogOpenTried = true;
+
+        binaryLogFile = PlatformFile(binaryLogFilePath);
+        binaryLogFile.setFileFlags(EFileFlags::CreateAlways | EFileFlags::Write);
+        binaryLogFile.setSharingMode(EFileSharing::ReadOnly);
+        binaryLogFile.setAttributes(EFileAdditionalFlags::Normal);
+        bBinaryLogOpened = binaryLogFile.openOrCreate();
+        if (bBinaryLogOpened)
+        {
+            std::vector<uint8> fileHeader;
+            fileHeader.insert(
+                fileHeader.end(), StructuredLog::BINARY_LOG_MAGIC, StructuredLog::BINARY_LOG_MAGIC + sizeof(StructuredLog::BINARY_LOG_MAGIC)
+            );
+            appendToBinaryLog(fileHeader, StructuredLog::BINARY_LOG_VERSION);
+            appendToBinaryLog(fileHeader, uint32(sizeof(TChar)));
+            binaryLogFile.write(fileHeader);
+        }
+    }
+
+    // Structured logs are still available in text log even if binary log cannot be written
+    if (bBinaryLogOpened)
+    {
+        binaryLogFile.write(binaryLogBuffer);
+    }
+    binaryLogBuffer.clear();
+}
+
 bool LoggerImpl::openNewLogFile()
 {
     String logFileName = Paths::applicationName();
@@ -375,6 +736,9 @@ bool LoggerImpl::openNewLogFile()
         }
     }
 
+    // Binary log is overwritten every run, Text log is the one that is kept for history
+    binaryLogFilePath = PathFunctions::combinePath(logFolderPath, logFileName + UTF8_TO_TCHAR(StructuredLog::BINARY_LOG_EXTENSION));
+
     logFile = PlatformFile(logFilePath);
     logFile.setFileFlags(EFileFlags::OpenAlways | EFileFlags::Write);
     logFile.setSharingMode(EFileSharing::ReadOnly);
@@ -751,6 +1115,72 @@ void Logger::errorInternal(const SourceLocationType srcLoc, const TChar *categor
     }
 }
 
+void Logger::severityInternal(ESeverityID severity, const SourceLocationType srcLoc, const TChar *category, const String &message)
+{
+    switch (severity)
+    {
+    case Logger::SevID_Verbose:
+#if ENABLE_VERBOSE_LOG
+        verboseInternal(srcLoc, category, message);
+#endif // ENABLE_VERBOSE_LOG
+        break;
+    case Logger::SevID_Debug:
+        debugInternal(srcLoc, category, message);
+        break;
+    case Logger::SevID_Log:
+        logInternal(srcLoc, category, message);
+        break;
+    case Logger::SevID_Warning:
+        warnInternal(srcLoc, category, message);
+        break;
+    case Logger::SevID_Error:
+    default:
+        errorInternal(srcLoc, category, message);
+        break;
+    }
+}
+
+uint8 Logger::structuredLogOutputs(ESeverityID severity)
+{
+    const ELogSeverity severityFlag = ELogSeverity(1 << severity);
+    uint8 outputs = 0;
+    outputs |= canLog(severityFlag, ELogOutputType::File) ? ELogOutputType::File : 0;
+    outputs |= canLog(severityFlag, ELogOutputType::Console) ? ELogOutputType::Console : 0;
+    outputs |= canLog(severityFlag, ELogOutputType::Profiler) ? ELogOutputType::Profiler : 0;
+    return outputs;
+}
+
+uint8 *Logger::beginStructured(
+    const SourceLocationType srcLoc, ESeverityID severity, uint8 outputs, const TChar *category, const TChar *fmt, uint32 argsCount,
+    uint32 argsSize
+)
+{
+    using RecordType = LoggerImpl::StructuredLogRecord;
+    const uint32 recordSize
+        = uint32(Math::alignByUnsafe(sizeof(RecordType) + argsSize, SizeT(LoggerImpl::StructuredLogRing::RECORD_ALIGNMENT)));
+    uint64 sequence = 0;
+    uint8 *recordData = loggerImpl->reserveStructuredRecord(recordSize, sequence);
+    if (recordData == nullptr)
+    {
+        return nullptr;
+    }
+
+    RecordType *record = new (recordData) RecordType();
+    record->recordSize = recordSize;
+    record->argsSize = argsSize;
+    record->severity = severity;
+    record->outputs = outputs;
+    record->argsCount = uint8(argsCount);
+    record->sequence = sequence;
+    record->timeStamp = canLogTime() ? Time::localTimeNow() : 0;
+    record->fmt = fmt;
+    record->category = category;
+    record->srcLoc = srcLoc;
+    return recordData + sizeof(RecordType);
+}
+
+void Logger::endStructured() { loggerImpl->commitStructuredRecord(); }
+
 CBESpinLock &Logger::consoleOutputLock()
 {
     static CBESpinLock lock;
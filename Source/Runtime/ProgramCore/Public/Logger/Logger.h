@@ -12,10 +12,13 @@
 #pragma once
 
 #include "ProgramCoreExports.h"
+#include "Logger/StructuredLog.h"
 #include "String/StringFormat.h"
 #include "Types/CompilerDefines.h"
 #include "Reflections/Functions.h"
 
+#include <tuple>
+
 #if HAS_SOURCE_LOCATION_FEATURE
 #include <source_location>
 #endif
@@ -125,6 +128,9 @@ private:
     static LoggerAutoShutdown autoShutdown;
     static LoggerImpl *loggerImpl;
 
+    // Structured logs are written to outputs by LoggerImpl when flushing
+    friend LoggerImpl;
+
     // Cannot have move reference in dynamically linked functions
 #if ENABLE_VERBOSE_LOG
     static void verboseInternal(const SourceLocationType srcLoc, const TChar *category, const String &message);
@@ -134,6 +140,20 @@ private:
     static void warnInternal(const SourceLocationType srcLoc, const TChar *category, const String &message);
     static void errorInternal(const SourceLocationType srcLoc, const TChar *category, const String &message);
 
+    static void severityInternal(ESeverityID severity, const SourceLocationType srcLoc, const TChar *category, const String &message);
+
+    // Returns outputs this severity can be logged to at the calling thread
+    static uint8 structuredLogOutputs(ESeverityID severity);
+    /**
+     * Reserves a record in calling thread's structured log ring and returns where argsSize bytes of arguments must be written.
+     * Returns nullptr if the ring has no space left, endStructured must be called only if a valid pointer is returned
+     */
+    static uint8 *beginStructured(
+        const SourceLocationType srcLoc, ESeverityID severity, uint8 outputs, const TChar *category, const TChar *fmt, uint32 argsCount,
+        uint32 argsSize
+    );
+    static void endStructured();
+
     static CBESpinLock &consoleOutputLock();
     static bool canLog(ELogSeverity severity, ELogOutputType output);
     static bool canLogTime();
@@ -213,6 +233,63 @@ public:
         errorInternal(srcLoc, StringFormat::getChar<CatType>(std::forward<CatType>(category)), std::forward<MsgType>(msg));
     }
 
+    /**
+     * Structured logging records only the format, category and source location pointers along with timestamp and raw argument bytes into
+     * calling thread's lock free ring. Formatting and writing to all outputs happens when the logs are flushed, Binary log file is written
+     * along with the text log.
+     * Format and category must be string literals as they are referenced until flushed. If the ring is full the message is formatted and
+     * logged immediately.
+     */
+    template <ESeverityID Severity, typename... Args>
+    static void structured(const SourceLocationType srcLoc, const TChar *category, const TChar *fmt, Args &&...args)
+    {
+        static_assert(sizeof...(Args) <= StructuredLog::MAX_ARGS, "Too many arguments for structured log");
+        if CONST_EXPR ((Severity == SevID_Debug || Severity == SevID_Verbose) && !DEV_BUILD)
+        {
+            return;
+        }
+
+        const uint8 outputs = structuredLogOutputs(Severity);
+        if (outputs == 0)
+        {
+            return;
+        }
+
+        auto storedArgs = std::make_tuple(StructuredLog::toStoredArg(std::forward<Args>(args))...);
+        const uint32 argsSize = std::apply(
+            [](const auto &...values)
+            {
+                return (uint32(0) + ... + StructuredLog::storedArgSize(values));
+            },
+            storedArgs
+        );
+        uint8 *argsData = beginStructured(srcLoc, Severity, outputs, category, fmt, uint32(sizeof...(Args)), argsSize);
+        if (argsData)
+        {
+            std::apply(
+                [argsData](const auto &...values) mutable
+                {
+                    ((argsData = StructuredLog::writeStoredArg(argsData, values)), ...);
+                },
+                storedArgs
+            );
+            endStructured();
+        }
+        else
+        {
+            severityInternal(
+                Severity, srcLoc, category,
+                std::apply(
+                    [fmt](const auto &...values)
+                    {
+                        return StringFormat::vFormat(fmt, values...);
+                    },
+                    storedArgs
+                )
+            );
+        }
+    }
+
     static void flushStream();
     static void pushMuteSeverities(uint8 muteSeverities);
     static void popMuteSeverities();
@@ -265,6 +342,23 @@ public:
 
 #endif // LOGGER_FORMAT_DIRECT
 
+// Structured logs, Formatted only when flushed. Check Logger::structured
+#if ENABLE_VERBOSE_LOG
+#define SLOG_VERBOSE(Category, Fmt, ...)                                                                                                       \
+    Logger::structured<Logger::SevID_Verbose>(LOG_CURR_SRC_LOC(), TCHAR(Category), TCHAR(Fmt) __VA_OPT__(, ) __VA_ARGS__)
+#else // ENABLE_VERBOSE_LOG
+#define SLOG_VERBOSE(Category, Fmt, ...)
+#endif // ENABLE_VERBOSE_LOG
+
+#define SLOG_DEBUG(Category, Fmt, ...)                                                                                                         \
+    Logger::structured<Logger::SevID_Debug>(LOG_CURR_SRC_LOC(), TCHAR(Category), TCHAR(Fmt) __VA_OPT__(, ) __VA_ARGS__)
+#define SLOG(Category, Fmt, ...)                                                                                                               \
+    Logger::structured<Logger::SevID_Log>(LOG_CURR_SRC_LOC(), TCHAR(Category), TCHAR(Fmt) __VA_OPT__(, ) __VA_ARGS__)
+#define SLOG_WARN(Category, Fmt, ...)                                                                                                          \
+    Logger::structured<Logger::SevID_Warning>(LOG_CURR_SRC_LOC(), TCHAR(Category), TCHAR(Fmt) __VA_OPT__(, ) __VA_ARGS__)
+#define SLOG_ERROR(Category, Fmt, ...)                                                                                                         \
+    Logger::structured<Logger::SevID_Error>(LOG_CURR_SRC_LOC(), TCHAR(Category), TCHAR(Fmt) __VA_OPT__(, ) __VA_ARGS__)
+
 struct ScopedMuteLogServerity
 {
     ScopedMuteLogServerity(uint8 muteSeverities) { Logger::pushMuteSeverities(muteSeverities); }
@@ -0,0 +1,91 @@
+/*!
+ * \file StructuredLog.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "Logger/StructuredLog.h"
+#include "Math/Math.h"
+
+namespace StructuredLog
+{
+
+String formatArgs(const TChar *fmt, const uint8 *argsData, uint32 argsSize, uint32 argsCount) noexcept
+{
+    DeferredArg args[MAX_ARGS];
+
+    const uint8 *readPtr = argsData;
+    const uint8 *readEnd = argsData + argsSize;
+    argsCount = Math::min(argsCount, MAX_ARGS);
+    for (uint32 argIdx = 0; argIdx < argsCount && readPtr < readEnd; ++argIdx)
+    {
+        DeferredArg &arg = args[argIdx];
+        arg.type = EArgType(*readPtr);
+        readPtr += sizeof(EArgType);
+        switch (arg.type)
+        {
+        case EArgType::Bool:
+            std::memcpy(&arg.bValue, readPtr, sizeof(bool));
+            readPtr += sizeof(bool);
+            break;
+        case EArgType::Int64:
+            std::memcpy(&arg.i64Value, readPtr, sizeof(int64));
+            readPtr += sizeof(int64);
+            break;
+        case EArgType::UInt64:
+            std::memcpy(&arg.u64Value, readPtr, sizeof(uint64));
+            readPtr += sizeof(uint64);
+            break;
+        case EArgType::Float32:
+            std::memcpy(&arg.f32Value, readPtr, sizeof(float));
+            readPtr += sizeof(float);
+            break;
+        case EArgType::Float64:
+            std::memcpy(&arg.f64Value, readPtr, sizeof(double));
+            readPtr += sizeof(double);
+            break;
+        case EArgType::Pointer:
+            std::memcpy(&arg.ptrValue, readPtr, sizeof(const void *));
+            readPtr += sizeof(const void *);
+            break;
+        case EArgType::String:
+        {
+            uint32 strLen = 0;
+            std::memcpy(&strLen, readPtr, sizeof(uint32));
+            readPtr += sizeof(uint32);
+            // Recorded data is not aligned for TChar
+            arg.strValue = { reinterpret_cast<const TChar *>(readPtr), strLen };
+            readPtr += strLen * sizeof(TChar);
+            break;
+        }
+        default:
+            // Corrupted data, Nothing after this can be trusted
+            readPtr = readEnd;
+            break;
+        }
+    }
+
+    // Unused arguments are ignored by std::vformat
+    static_assert(MAX_ARGS == 16, "Update the arguments passed to std::vformat");
+    try
+    {
+        return std::vformat(
+            fmt, std::make_format_args<StdFormatContextType>(
+                     args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7], args[8], args[9], args[10], args[11],
+                     args[12], args[13], args[14], args[15]
+                 )
+        );
+    }
+    catch (const std::format_error &formatError)
+    {
+        // Malformed format or a spec that does not match the decoded type, Raw format is still useful to find the log
+        return String(fmt) + TCHAR(" [Log format error: ") + UTF8_TO_TCHAR(formatError.what()) + TCHAR("]");
+    }
+}
+
+} // namespace StructuredLog
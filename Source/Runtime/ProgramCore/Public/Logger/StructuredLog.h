@@ -0,0 +1,257 @@
+/*!
+ * \file StructuredLog.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "ProgramCoreExports.h"
+#include "String/StringFormat.h"
+#include "Types/CoreTypes.h"
+
+#include <cstring>
+
+/**
+ * Encoding of structured(deferred) log arguments. Arguments are stored as raw bytes prefixed with its type and formatted only when the log
+ * is flushed or when binary log file is decoded offline.
+ * Arithmetic types, pointers and strings are stored as is, Every other type is converted to String when recorded.
+ */
+namespace StructuredLog
+{
+constexpr static const uint32 MAX_ARGS = 16;
+
+enum class EArgType : uint8
+{
+    Bool,
+    Int64,
+    UInt64,
+    Float32,
+    Float64,
+    Pointer,
+    // uint32 length followed by length TChars, Not null terminated
+    String
+};
+
+template <typename Type>
+concept CharacterType = std::disjunction_v<
+    std::is_same<Type, AChar>, std::is_same<Type, WChar>, std::is_same<Type, Utf8>, std::is_same<Type, Utf16>, std::is_same<Type, Utf32>>;
+
+/**
+ * Converts the argument to the type that gets written into the record. Done once per argument so that both size calculation and writing
+ * sees the same value.
+ */
+template <typename Type>
+auto toStoredArg(Type &&value) noexcept
+{
+    using CleanType = std::remove_cvref_t<Type>;
+    if constexpr (std::is_same_v<CleanType, bool>)
+    {
+        return bool(value);
+    }
+    else if constexpr (std::is_integral_v<CleanType> && !CharacterType<CleanType>)
+    {
+        if constexpr (std::is_signed_v<CleanType>)
+        {
+            return int64(value);
+        }
+        else
+        {
+            return uint64(value);
+        }
+    }
+    else if constexpr (std::is_same_v<CleanType, float> || std::is_same_v<CleanType, double>)
+    {
+        return value;
+    }
+    else if constexpr (IsString<Type>::value)
+    {
+        if constexpr (std::is_same_v<CleanType, TChar>)
+        {
+            // Referenced value lives until the recording is done
+            return StringView(&value, 1);
+        }
+        else if constexpr (std::is_pointer_v<std::decay_t<Type>>)
+        {
+            const TChar *strPtr = value;
+            return strPtr ? StringView(strPtr) : StringView();
+        }
+        else
+        {
+            return StringView(value);
+        }
+    }
+    else if constexpr (std::is_pointer_v<CleanType> || std::is_null_pointer_v<CleanType>)
+    {
+        return static_cast<const void *>(value);
+    }
+    else
+    {
+        return StringFormat::vFormat(TCHAR("{}"), std::forward<Type>(value));
+    }
+}
+
+template <typename Type>
+consteval EArgType storedArgType() noexcept
+{
+    if constexpr (std::is_same_v<Type, bool>)
+    {
+        return EArgType::Bool;
+    }
+    else if constexpr (std::is_same_v<Type, int64>)
+    {
+        return EArgType::Int64;
+    }
+    else if constexpr (std::is_same_v<Type, uint64>)
+    {
+        return EArgType::UInt64;
+    }
+    else if constexpr (std::is_same_v<Type, float>)
+    {
+        return EArgType::Float32;
+    }
+    else if constexpr (std::is_same_v<Type, double>)
+    {
+        return EArgType::Float64;
+    }
+    else
+    {
+        static_assert(std::is_same_v<Type, const void *>, "Unsupported stored argument type");
+        return EArgType::Pointer;
+    }
+}
+
+template <typename Type>
+FORCE_INLINE uint32 storedArgSize(const Type &) noexcept
+{
+    return uint32(sizeof(EArgType) + sizeof(Type));
+}
+FORCE_INLINE uint32 storedArgSize(StringView value) noexcept { return uint32(sizeof(EArgType) + sizeof(uint32) + value.size() * sizeof(TChar)); }
+FORCE_INLINE uint32 storedArgSize(const String &value) noexcept { return storedArgSize(StringView(value)); }
+
+// Writes the argument at dst and returns the pointer after written bytes, Destination need not be aligned
+template <typename Type>
+FORCE_INLINE uint8 *writeStoredArg(uint8 *dst, const Type &value) noexcept
+{
+    *dst = uint8(storedArgType<Type>());
+    std::memcpy(dst + sizeof(EArgType), &value, sizeof(Type));
+    return dst + sizeof(EArgType) + sizeof(Type);
+}
+FORCE_INLINE uint8 *writeStoredArg(uint8 *dst, StringView value) noexcept
+{
+    *dst = uint8(EArgType::String);
+    dst += sizeof(EArgType);
+    const uint32 strLen = uint32(value.size());
+    std::memcpy(dst, &strLen, sizeof(uint32));
+    dst += sizeof(uint32);
+    std::memcpy(dst, value.data(), strLen * sizeof(TChar));
+    return dst + strLen * sizeof(TChar);
+}
+FORCE_INLINE uint8 *writeStoredArg(uint8 *dst, const String &value) noexcept { return writeStoredArg(dst, StringView(value)); }
+
+// Decoded argument that gets formatted with the format spec given to it in the format string
+struct DeferredArg
+{
+    EArgType type = EArgType::Pointer;
+    union
+    {
+        bool bValue;
+        int64 i64Value;
+        uint64 u64Value;
+        float f32Value;
+        double f64Value;
+        const void *ptrValue = nullptr;
+    };
+    // Points into recorded arguments data
+    StringView strValue;
+};
+
+/**
+ * Formats the message from recorded arguments data.
+ * Nested replacement fields inside a format spec(Like dynamic width {:{}}) are not supported.
+ */
+PROGRAMCORE_EXPORT String formatArgs(const TChar *fmt, const uint8 *argsData, uint32 argsSize, uint32 argsCount) noexcept;
+
+//////////////////////////////////////////////////////////////////////////
+/// Binary log file layout
+//////////////////////////////////////////////////////////////////////////
+
+constexpr static const AChar BINARY_LOG_MAGIC[8] = "CBEBLOG";
+constexpr static const uint32 BINARY_LOG_VERSION = 0;
+constexpr static const AChar BINARY_LOG_EXTENSION[] = ".blog";
+
+/**
+ * File starts with BINARY_LOG_MAGIC, uint32 BINARY_LOG_VERSION and uint32 sizeof(TChar) followed by the entries.
+ * Each entry starts with EBinaryLogEntry
+ * String : uint32 string id, uint32 byte count, UTF-8 bytes. Each unique format, category, file and function name is written once
+ * Record : uint8 severity, int64 timestamp, uint32 format id, uint32 category id, uint32 file name id, uint32 function name id,
+ *          uint32 line, uint8 arguments count, uint32 arguments size, arguments data as recorded
+ * All integers are in little endian
+ */
+enum class EBinaryLogEntry : uint8
+{
+    String = 1,
+    Record = 2
+};
+} // namespace StructuredLog
+
+template <>
+struct std::formatter<StructuredLog::DeferredArg, TChar>
+{
+    // Format spec without the replacement field braces and ':'
+    std::basic_string_view<TChar> spec;
+
+    constexpr typename std::basic_format_parse_context<TChar>::iterator parse(std::basic_format_parse_context<TChar> &parseCtx)
+    {
+        auto itr = parseCtx.begin();
+        while (itr != parseCtx.end() && *itr != TCHAR('}'))
+        {
+            ++itr;
+        }
+        spec = { parseCtx.begin(), itr };
+        return itr;
+    }
+
+    template <class FormatContext>
+    typename FormatContext::iterator format(const StructuredLog::DeferredArg &arg, FormatContext &formatCtx) const
+    {
+        // Reconstruct the replacement field with captured spec so the decoded value gets formatted by its own formatter
+        TChar fieldFmt[64];
+        uint32 fieldFmtLen = 0;
+        fieldFmt[fieldFmtLen++] = TCHAR('{');
+        if (!spec.empty() && spec.size() < ARRAY_LENGTH(fieldFmt) - 3)
+        {
+            fieldFmt[fieldFmtLen++] = TCHAR(':');
+            for (TChar ch : spec)
+            {
+                fieldFmt[fieldFmtLen++] = ch;
+            }
+        }
+        fieldFmt[fieldFmtLen++] = TCHAR('}');
+        const StringView fieldFmtView{ fieldFmt, fieldFmtLen };
+
+        switch (arg.type)
+        {
+        case StructuredLog::EArgType::Bool:
+            return std::vformat_to(formatCtx.out(), fieldFmtView, std::make_format_args<StdFormatContextType>(arg.bValue));
+        case StructuredLog::EArgType::Int64:
+            return std::vformat_to(formatCtx.out(), fieldFmtView, std::make_format_args<StdFormatContextType>(arg.i64Value));
+        case StructuredLog::EArgType::UInt64:
+            return std::vformat_to(formatCtx.out(), fieldFmtView, std::make_format_args<StdFormatContextType>(arg.u64Value));
+        case StructuredLog::EArgType::Float32:
+            return std::vformat_to(formatCtx.out(), fieldFmtView, std::make_format_args<StdFormatContextType>(arg.f32Value));
+        case StructuredLog::EArgType::Float64:
+            return std::vformat_to(formatCtx.out(), fieldFmtView, std::make_format_args<StdFormatContextType>(arg.f64Value));
+        case StructuredLog::EArgType::String:
+            return std::vformat_to(formatCtx.out(), fieldFmtView, std::make_format_args<StdFormatContextType>(arg.strValue));
+        case StructuredLog::EArgType::Pointer:
+        default:
+            return std::vformat_to(formatCtx.out(), fieldFmtView, std::make_format_args<StdFormatContextType>(arg.ptrValue));
+        }
+    }
+};
@@ -12,634 +12,931 @@
 #pragma once
 
 #include "Math/Box.h"
-#include "Math/Grid.h"
-#include "Math/VectorN.h"
-#include "Types/Containers/BitArray.h"
-#include "Types/Containers/SparseVector.h"
+#include "Math/Plane.h"
+#include "Types/Containers/ArrayView.h"
 #include "Types/CoreDefines.h"
 #include "Types/Platform/PlatformAssertionErrors.h"
 
-#define USE_CELLIDX_RANGE_ITR 0
+#include <algorithm>
 
+/**
+ * Dynamic bounding volume hierarchy of AABBs, Each object is a leaf in the binary tree and each internal node bounds its two children.
+ * build() creates the tree top down using binned surface area heuristic(SAH). insert() picks the sibling with least SAH cost increase and
+ * the tree is kept balanced with rotations on insert and remove.
+ *
+ * Leaves store a fat bound that is bigger than the object's bound by the margin, So the objects can move small distances without tree being
+ * modified. Queries test the object's tight bound at the leaves.
+ *
+ * Queries either call the callback for each found object or writes into caller provided buffer. Traversal stack is inline and queries
+ * allocate only if the tree is taller than the inline stack.
+ */
 template <typename StorageType>
-class BoundingVolume
+class DynamicAABBTree
 {
-private:
-    using GridCellIndex = CellIndex<3>;
-    using GridCellIndexRange = CellIndexRange<3>;
-    using ObjectStorageType = SparseVector<StorageType, BitArraySparsityPolicy>;
-    using ObjectIdxType = ObjectStorageType::size_type;
-    using GridCellStorage = std::vector<ObjectIdxType>;
+public:
+    using ProxyIdx = uint32;
+    CONST_EXPR static const ProxyIdx InvalidIdx = ~(ProxyIdx)0;
 
-    UniformGrid<Vector3, 3> volumeGrid;
-    VectorN<GridCellStorage, 3> grid;
+    /**
+     * Inline capacity of query traversal stack. Insert and remove keeps the tree balanced but build() splits by SAH and can create a tree of
+     * any height, So taller trees use heap allocated stack
+     */
+    CONST_EXPR static const uint32 QUERY_STACK_SIZE = 256;
+    CONST_EXPR static const uint32 SAH_BINS_COUNT = 12;
 
-    ObjectStorageType allObjects;
-    FORCE_INLINE void addObject(ObjectIdxType objIdx, const GridCellIndex &atIdx);
-    FORCE_INLINE void removeObject(ObjectIdxType objIdx, const GridCellIndex &atIdx);
-    FORCE_INLINE ObjectIdxType findObjectIndex(const StorageType &object, const AABB &bound) const;
+private:
+    struct Node
+    {
+        // Fat bound for leaf
+        AABB bound;
+        // Only valid for leaf
+        AABB objectBound;
+        StorageType object;
+
+        // Parent for nodes in tree and next free node for nodes in free list
+        ProxyIdx parent = InvalidIdx;
+        ProxyIdx left = InvalidIdx;
+        ProxyIdx right = InvalidIdx;
+        // Leaf has height 0, Free node has -1
+        int32 height = -1;
+
+        FORCE_INLINE bool isLeaf() const { return left == InvalidIdx; }
+    };
 
-    bool isValidBoundIdxs(const GridCellIndex &minBoundIdx, const GridCellIndex &maxBoundIdx, const AABB &box) const;
+    // Depth first traversal never holds more than tree height + 1 entries
+    class QueryStack
+    {
+    private:
+        ProxyIdx inlineEntries[QUERY_STACK_SIZE];
+        std::vector<ProxyIdx> heapEntries;
+        ProxyIdx *entries = inlineEntries;
+        uint32 top = 0;
+
+    public:
+        QueryStack(int32 treeHeight)
+        {
+            const uint32 maxCount = uint32(treeHeight) + 1;
+            if (maxCount > QUERY_STACK_SIZE)
+            {
+                heapEntries.resize(maxCount);
+                entries = heapEntries.data();
+            }
+        }
+        MAKE_TYPE_NONCOPY_NONMOVE(QueryStack)
 
-public:
-    BoundingVolume() = default;
-    BoundingVolume(std::vector<StorageType> &&objectList, const Vector3 &cellSize);
-    BoundingVolume(const std::vector<StorageType> &objectList, const Vector3 &cellSize);
-    ~BoundingVolume();
+        FORCE_INLINE bool empty() const { return top == 0; }
+        FORCE_INLINE void push(ProxyIdx nodeIdx) { entries[top++] = nodeIdx; }
+        FORCE_INLINE ProxyIdx pop() { return entries[--top]; }
+    };
 
-    void reinitialize(const Vector3 &cellSize);
-    void reinitialize(const std::vector<StorageType> &newObjectList, const Vector3 &cellSize);
+    std::vector<Node> nodes;
+    ProxyIdx rootIdx = InvalidIdx;
+    ProxyIdx freeListHead = InvalidIdx;
+    uint32 leafCount = 0;
 
-    void addedNewObject(const StorageType &object);
-    void removeAnObject(const StorageType &object);
+    // Leaf bound is expanded by this margin on each side
+    Vector3 fatMargin{ 0.1f };
+    // Leaf bound is expanded along the displacement direction by displacement times this multiplier when moved
+    float displacementMultiplier = 2.0f;
 
-    template <typename IntersectionSet = std::vector<StorageType>>
-    FORCE_INLINE IntersectionSet findIntersection(const AABB &box, bool bSkipObjChecks)
+public:
+    DynamicAABBTree() = default;
+    explicit DynamicAABBTree(const Vector3 &inFatMargin, float inDisplacementMultiplier = 2.0f)
+        : fatMargin(inFatMargin)
+        , displacementMultiplier(inDisplacementMultiplier)
+    {}
+
+    // Clears and builds the tree from the objects, outProxies will have proxy of each object at same index
+    void build(ArrayView<StorageType> objects, ArrayView<AABB> bounds, std::vector<ProxyIdx> &outProxies);
+    void clear();
+
+    ProxyIdx insert(const StorageType &object, const AABB &bound);
+    void remove(ProxyIdx proxy);
+    /**
+     * Updates the object's bound. The tree is modified only if new bound is not inside the leaf's fat bound.
+     * displacement is the distance moved since last update and is used to predict the next movement.
+     * Returns true if the leaf is reinserted
+     */
+    bool move(ProxyIdx proxy, const AABB &newBound, const Vector3 &displacement = Vector3::ZERO);
+    // Refits the leaf's fat bound to newBound and updates the bounds of its parents without changing the tree structure
+    void refit(ProxyIdx proxy, const AABB &newBound);
+
+    FORCE_INLINE const StorageType &getObject(ProxyIdx proxy) const
+    {
+        debugAssert(isValidProxy(proxy));
+        return nodes[proxy].object;
+    }
+    FORCE_INLINE const AABB &getObjectBound(ProxyIdx proxy) const
+    {
+        debugAssert(isValidProxy(proxy));
+        return nodes[proxy].objectBound;
+    }
+    FORCE_INLINE const AABB &getFatBound(ProxyIdx proxy) const
     {
-        IntersectionSet intersection;
-        findIntersection(intersection, box, bSkipObjChecks);
-        return intersection;
+        debugAssert(isValidProxy(proxy));
+        return nodes[proxy].bound;
     }
+    FORCE_INLINE bool isValidProxy(ProxyIdx proxy) const { return proxy < nodes.size() && nodes[proxy].height == 0; }
+
+    FORCE_INLINE uint32 size() const { return leafCount; }
+    FORCE_INLINE bool empty() const { return leafCount == 0; }
+    FORCE_INLINE int32 getHeight() const { return rootIdx != InvalidIdx ? nodes[rootIdx].height : 0; }
+    // Fat bound of whole tree
+    FORCE_INLINE AABB getBounds() const { return rootIdx != InvalidIdx ? nodes[rootIdx].bound : AABB(); }
+
+    /**
+     * Callback must be of signature bool(ProxyIdx proxy, const StorageType &object) and return false to stop the query.
+     */
+    template <typename CallbackType>
+    void query(const AABB &box, CallbackType &&callback) const;
+    // Planes must be pointing inside the frustum
+    template <typename CallbackType>
+    void queryFrustum(ArrayView<Plane> planes, CallbackType &&callback) const;
+    // Callback also receives the distance along the ray at which it enters the object's bound, Dir must be normalized
+    template <typename CallbackType>
+    void queryRay(const Vector3 &start, const Vector3 &dir, float length, CallbackType &&callback) const;
+
+    /**
+     * Buffer versions writes upto size of outObjects and returns the total count of found objects.
+     * If returned count is larger than the buffer then the buffer must be resized and queried again to get all.
+     */
+    SizeT findIntersection(ArrayRange<StorageType> outObjects, const AABB &box) const;
+    SizeT findInFrustum(ArrayRange<StorageType> outObjects, ArrayView<Plane> planes) const;
+    // If bClosestOnly writes just the closest hit object and returns 1 if any hit
+    SizeT raycast(ArrayRange<StorageType> outObjects, const Vector3 &start, const Vector3 &dir, float length, bool bClosestOnly = true) const;
 
-    template <typename IntersectionSet = std::vector<StorageType>>
-    DEBUG_INLINE void findIntersection(IntersectionSet &intersection, const AABB &box, bool bSkipObjChecks)
+private:
+    FORCE_INLINE static float surfaceArea(const AABB &bound)
     {
-        if (!getBounds().intersect(box))
-        {
-            return;
-        }
+        const Vector3 extent = bound.size();
+        return 2.0f * (extent.x() * extent.y() + extent.y() * extent.z() + extent.z() * extent.x());
+    }
+    FORCE_INLINE static AABB combine(const AABB &a, const AABB &b)
+    {
+        return AABB(Vector3::min(a.minBound, b.minBound), Vector3::max(a.maxBound, b.maxBound));
+    }
+    FORCE_INLINE AABB fatBound(const AABB &bound) const { return AABB(bound.minBound - fatMargin, bound.maxBound + fatMargin); }
+    // Returns true if the ray enters the bound within length and sets the entering distance
+    FORCE_INLINE static bool
+    rayIntersect(const AABB &bound, const Vector3 &start, const Vector3 &invDir, const bool *parallel, float length, float &outEnter);
+    // Returns -1 if bound is outside any plane, 1 if inside all planes and 0 if intersecting
+    FORCE_INLINE static int32 classifyFrustum(const AABB &bound, ArrayView<Plane> planes);
+
+    ProxyIdx allocateNode();
+    void freeNode(ProxyIdx nodeIdx);
+    ProxyIdx buildRecursive(ProxyIdx *leaves, uint32 count);
+    void insertLeaf(ProxyIdx leaf);
+    void removeLeaf(ProxyIdx leaf);
+    // Recomputes heights and bounds from nodeIdx to root while balancing each node
+    void fixUpwards(ProxyIdx nodeIdx);
+    ProxyIdx balance(ProxyIdx nodeIdx);
+    void replaceChild(ProxyIdx parentIdx, ProxyIdx oldChild, ProxyIdx newChild);
+};
 
-        struct ObjectIdxHashBypass
-        {
-            NODISCARD FORCE_INLINE SizeT operator() (ObjectIdxType idx) const noexcept { return idx; }
-        };
-        BitArray<uint64> resultIdxAdded(allObjects.totalCount());
-        std::vector<ObjectIdxType> resultIdxs;
-        resultIdxs.reserve(allObjects.size());
+//////////////////////////////////////////////////////////////////////////
+/// DynamicAABBTree implementations
+//////////////////////////////////////////////////////////////////////////
 
-        GridCellIndex minBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(box.minBound)));
-        GridCellIndex maxBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(box.maxBound)));
-#if USE_CELLIDX_RANGE_ITR
-        for (const GridCellIndex &currentIdx : GridCellIndexRange(minBoundIdx, maxBoundIdx))
-        {
-            const GridCellStorage &objs = grid[currentIdx];
-            if (bSkipObjChecks)
-            {
-                for (const ObjectIdxType &objIdx : objs)
-                {
-                    debugAssert(allObjects.isValid(objIdx));
-                    if (!resultIdxAdded[objIdx])
-                    {
-                        resultIdxs.emplace_back(objIdx);
-                        resultIdxAdded[objIdx] = true;
-                    }
-                }
-            }
-            else
-            {
-                for (const ObjectIdxType &objIdx : objs)
-                {
-                    debugAssert(allObjects.isValid(objIdx));
-                    if (!resultIdxAdded[objIdx] && box.intersect(allObjects[objIdx].getBounds()))
-                    {
-                        resultIdxs.emplace_back(objIdx);
-                        resultIdxAdded[objIdx] = true;
-                    }
-                }
-            }
-        }
-#else  // USE_CELLIDX_RANGE_ITR
-        GridCellIndex currentIdx;
-        for (currentIdx[2] = minBoundIdx.idx[2]; currentIdx[2] <= maxBoundIdx[2]; currentIdx[2]++)
-        {
-            for (currentIdx[1] = minBoundIdx.idx[1]; currentIdx[1] <= maxBoundIdx[1]; currentIdx[1]++)
-            {
-                for (currentIdx[0] = minBoundIdx.idx[0]; currentIdx[0] <= maxBoundIdx[0]; currentIdx[0]++)
-                {
-                    const GridCellStorage &objs = grid[currentIdx];
-                    if (bSkipObjChecks)
-                    {
-                        for (const ObjectIdxType &objIdx : objs)
-                        {
-                            debugAssert(allObjects.isValid(objIdx));
-                            if (!resultIdxAdded[objIdx])
-                            {
-                                resultIdxs.emplace_back(objIdx);
-                                resultIdxAdded[objIdx] = true;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        for (const ObjectIdxType &objIdx : objs)
-                        {
-                            debugAssert(allObjects.isValid(objIdx));
-                            if (!resultIdxAdded[objIdx] && box.intersect(allObjects[objIdx].getBounds()))
-                            {
-                                resultIdxs.emplace_back(objIdx);
-                                resultIdxAdded[objIdx] = true;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-#endif // USE_CELLIDX_RANGE_ITR
+template <typename StorageType>
+void DynamicAABBTree<StorageType>::build(ArrayView<StorageType> objects, ArrayView<AABB> bounds, std::vector<ProxyIdx> &outProxies)
+{
+    debugAssert(objects.size() == bounds.size());
+    clear();
 
-        for (const ObjectIdxType &objIdx : resultIdxs)
-        {
-            debugAssert(allObjects.isValid(objIdx));
-            intersection.emplace_back(allObjects[objIdx]);
-        }
+    outProxies.resize(objects.size());
+    if (objects.size() == 0)
+    {
+        return;
     }
 
-    bool raycast(std::vector<StorageType> &result, const Vector3 &start, const Vector3 &dir, float length, bool bExistOnHit = true);
+    // Reserving all nodes upfront, So there will be no reallocation when building
+    nodes.reserve(2 * objects.size() - 1);
+    for (SizeT i = 0; i < objects.size(); ++i)
+    {
+        ProxyIdx leaf = allocateNode();
+        Node &leafNode = nodes[leaf];
+        leafNode.object = objects[i];
+        leafNode.objectBound = bounds[i];
+        leafNode.bound = fatBound(bounds[i]);
+        leafNode.height = 0;
+        outProxies[i] = leaf;
+    }
+    leafCount = uint32(objects.size());
 
-    void updateBounds(const StorageType &object, const AABB &oldBox, const AABB &newBox);
-    bool isSameBounds(const AABB &boxOne, const AABB &boxTwo);
-    AABB getBounds() const;
-};
+    std::vector<ProxyIdx> leaves = outProxies;
+    rootIdx = buildRecursive(leaves.data(), uint32(leaves.size()));
+    nodes[rootIdx].parent = InvalidIdx;
+}
 
 template <typename StorageType>
-void BoundingVolume<StorageType>::removeObject(ObjectIdxType objIdx, const GridCellIndex &atIdx)
+void DynamicAABBTree<StorageType>::clear()
 {
-    GridCellStorage &objects = grid[atIdx];
-    std::erase(objects, objIdx);
+    nodes.clear();
+    rootIdx = InvalidIdx;
+    freeListHead = InvalidIdx;
+    leafCount = 0;
 }
 
 template <typename StorageType>
-void BoundingVolume<StorageType>::addObject(ObjectIdxType objIdx, const GridCellIndex &atIdx)
+DynamicAABBTree<StorageType>::ProxyIdx DynamicAABBTree<StorageType>::insert(const StorageType &object, const AABB &bound)
 {
-    GridCellStorage &objects = grid[atIdx];
-#if DEBUG_VALIDATIONS
-    alertAlwaysf(std::find(objects.cbegin(), objects.cend(), objIdx) == objects.cend(), "Object of index {} duplicate insertion", objIdx);
-#endif
-    objects.emplace_back(objIdx);
+    ProxyIdx leaf = allocateNode();
+    Node &leafNode = nodes[leaf];
+    leafNode.object = object;
+    leafNode.objectBound = bound;
+    leafNode.bound = fatBound(bound);
+    leafNode.height = 0;
+
+    insertLeaf(leaf);
+    leafCount++;
+    return leaf;
 }
 
 template <typename StorageType>
-BoundingVolume<StorageType>::ObjectIdxType BoundingVolume<StorageType>::findObjectIndex(const StorageType &object, const AABB &bound) const
+void DynamicAABBTree<StorageType>::remove(ProxyIdx proxy)
 {
-    debugAssert(getBounds().intersect(bound));
+    debugAssert(isValidProxy(proxy));
+    removeLeaf(proxy);
+    freeNode(proxy);
+    leafCount--;
+}
 
-    ObjectIdxType foundIdx = allObjects.totalCount();
-    auto objectFinderPredicate = [this, &object](ObjectIdxType objIdx)
+template <typename StorageType>
+bool DynamicAABBTree<StorageType>::move(ProxyIdx proxy, const AABB &newBound, const Vector3 &displacement /*= Vector3::ZERO*/)
+{
+    debugAssert(isValidProxy(proxy));
+
+    nodes[proxy].objectBound = newBound;
+    if (nodes[proxy].bound.contains(newBound))
     {
-        return allObjects.isValid(objIdx) && allObjects[objIdx] == object;
-    };
+        return false;
+    }
+
+    removeLeaf(proxy);
 
-    GridCellIndex minBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(bound.minBound)));
-    GridCellIndex maxBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(bound.maxBound)));
-#if USE_CELLIDX_RANGE_ITR
-    for (const GridCellIndex &currentIdx : GridCellIndexRange(minBoundIdx, maxBoundIdx))
+    // Predict the movement and expand the bound towards it
+    AABB newFatBound = fatBound(newBound);
+    const Vector3 predictedDisp = displacement * displacementMultiplier;
+    for (uint32 axis = 0; axis < 3; ++axis)
     {
-        const GridCellStorage &objs = grid[currentIdx];
-        auto itr = std::find_if(objs.cbegin(), objs.cend(), objectFinderPredicate);
-        if (itr != objs.cend())
+        if (predictedDisp[axis] < 0.0f)
         {
-            foundIdx = *itr;
-            break;
+            newFatBound.minBound[axis] += predictedDisp[axis];
         }
-    }
-#else  // USE_CELLIDX_RANGE_ITR
-    GridCellIndex currentIdx;
-    for (currentIdx[2] = minBoundIdx.idx[2]; currentIdx[2] <= maxBoundIdx[2]; currentIdx[2]++)
-    {
-        for (currentIdx[1] = minBoundIdx.idx[1]; currentIdx[1] <= maxBoundIdx[1]; currentIdx[1]++)
+        else
         {
-            for (currentIdx[0] = minBoundIdx.idx[0]; currentIdx[0] <= maxBoundIdx[0]; currentIdx[0]++)
-            {
-                const GridCellStorage &objs = grid[currentIdx];
-                auto itr = std::find_if(objs.cbegin(), objs.cend(), objectFinderPredicate);
-                if (itr != objs.cend())
-                {
-                    foundIdx = *itr;
-                    break;
-                }
-            }
+            newFatBound.maxBound[axis] += predictedDisp[axis];
         }
     }
-#endif // USE_CELLIDX_RANGE_ITR
-    return foundIdx;
+    nodes[proxy].bound = newFatBound;
+
+    insertLeaf(proxy);
+    return true;
 }
 
 template <typename StorageType>
-bool BoundingVolume<StorageType>::isValidBoundIdxs(const GridCellIndex &minBoundIdx, const GridCellIndex &maxBoundIdx, const AABB &box) const
+void DynamicAABBTree<StorageType>::refit(ProxyIdx proxy, const AABB &newBound)
 {
-    // if any dimension is clamped because of being outside the volume bound
-    bool bIsAnyDimensionClamped = false;
-    Vector3 boxExtend = box.size();
-    for (int32 i = 0; i < 3; ++i)
+    debugAssert(isValidProxy(proxy));
+
+    nodes[proxy].objectBound = newBound;
+    nodes[proxy].bound = fatBound(newBound);
+    for (ProxyIdx nodeIdx = nodes[proxy].parent; nodeIdx != InvalidIdx; nodeIdx = nodes[nodeIdx].parent)
     {
-        uint32 cellExtend = maxBoundIdx[i] - minBoundIdx[i];
-        // Invalid cell extend in volume bound while box is not thin plane
-        bIsAnyDimensionClamped = bIsAnyDimensionClamped || (cellExtend == 0 && !Math::isEqual(boxExtend[i], 0.0f));
+        nodes[nodeIdx].bound = combine(nodes[nodes[nodeIdx].left].bound, nodes[nodes[nodeIdx].right].bound);
     }
-    return !bIsAnyDimensionClamped;
 }
 
 template <typename StorageType>
-AABB BoundingVolume<StorageType>::getBounds() const
+template <typename CallbackType>
+void DynamicAABBTree<StorageType>::query(const AABB &box, CallbackType &&callback) const
 {
-    AABB retVal;
-    volumeGrid.getBound(retVal.minBound, retVal.maxBound);
-    return retVal;
-}
-
-template <typename StorageType>
-BoundingVolume<StorageType>::BoundingVolume(std::vector<StorageType> &&objectList, const Vector3 &cellSize)
-{
-    allObjects = std::move(objectList);
-    reinitialize(cellSize);
-}
+    if (rootIdx == InvalidIdx)
+    {
+        return;
+    }
 
-template <typename StorageType>
-BoundingVolume<StorageType>::BoundingVolume(const std::vector<StorageType> &objectList, const Vector3 &cellSize)
-{
-    allObjects = objectList;
-    reinitialize(cellSize);
-}
+    QueryStack stack(getHeight());
+    stack.push(rootIdx);
+    while (!stack.empty())
+    {
+        const ProxyIdx nodeIdx = stack.pop();
+        const Node &node = nodes[nodeIdx];
+        if (!node.bound.intersect(box))
+        {
+            continue;
+        }
 
-template <typename StorageType>
-BoundingVolume<StorageType>::~BoundingVolume()
-{
-    allObjects.clear();
-    grid.clear();
+        if (node.isLeaf())
+        {
+            if (node.objectBound.intersect(box) && !callback(nodeIdx, node.object))
+            {
+                return;
+            }
+        }
+        else
+        {
+            stack.push(node.left);
+            stack.push(node.right);
+        }
+    }
 }
 
 template <typename StorageType>
-void BoundingVolume<StorageType>::reinitialize(const Vector3 &cellSize)
+template <typename CallbackType>
+void DynamicAABBTree<StorageType>::queryFrustum(ArrayView<Plane> planes, CallbackType &&callback) const
 {
-    if (allObjects.size() <= 0)
+    if (rootIdx == InvalidIdx)
     {
         return;
     }
 
-    AABB globalBound;
+    // Nodes that are fully inside are tagged with the top bit, Their subtree needs no more plane tests
+    CONST_EXPR static const ProxyIdx INSIDE_TAG = ProxyIdx(1) << (sizeof(ProxyIdx) * 8 - 1);
 
-    for (const StorageType &obj : allObjects)
+    QueryStack stack(getHeight());
+    stack.push(rootIdx);
+    while (!stack.empty())
     {
-        const AABB &bound = obj.getBounds();
-        globalBound.grow(bound);
-    }
+        const ProxyIdx stackEntry = stack.pop();
+        const ProxyIdx nodeIdx = stackEntry & ~INSIDE_TAG;
+        const Node &node = nodes[nodeIdx];
 
-    LOG_DEBUG(
-        "BVH", "Before correcting cell size global bounding box size is ({}, {}, {})", globalBound.size().x(), globalBound.size().y(),
-        globalBound.size().z()
-    );
+        ProxyIdx childTag = stackEntry & INSIDE_TAG;
+        if (childTag == 0)
+        {
+            const int32 classification = classifyFrustum(node.isLeaf() ? node.objectBound : node.bound, planes);
+            if (classification < 0)
+            {
+                continue;
+            }
+            childTag = classification > 0 ? INSIDE_TAG : 0;
+        }
 
-    volumeGrid.InitWithSize(globalBound.minBound, globalBound.maxBound, cellSize);
-    volumeGrid.getBound(globalBound.minBound, globalBound.maxBound);
+        if (node.isLeaf())
+        {
+            if (!callback(nodeIdx, node.object))
+            {
+                return;
+            }
+        }
+        else
+        {
+            stack.push(node.left | childTag);
+            stack.push(node.right | childTag);
+        }
+    }
+}
 
-    LOG_DEBUG(
-        "BVH", "After correcting cell size global bounding box size is ({}, {}, {})", globalBound.size().x(), globalBound.size().y(),
-        globalBound.size().z()
-    );
+template <typename StorageType>
+template <typename CallbackType>
+void DynamicAABBTree<StorageType>::queryRay(const Vector3 &start, const Vector3 &dir, float length, CallbackType &&callback) const
+{
+    if (rootIdx == InvalidIdx)
+    {
+        return;
+    }
 
-    GridCellIndex cellCount = volumeGrid.cellCount();
-    grid = VectorN<GridCellStorage, 3>(cellCount);
+    bool parallel[3];
+    Vector3 invDir;
+    for (uint32 axis = 0; axis < 3; ++axis)
+    {
+        parallel[axis] = (dir[axis] == 0);
+        invDir[axis] = parallel[axis] ? 0 : 1 / dir[axis];
+    }
 
-    for (ObjectIdxType objIdx = 0; objIdx < allObjects.totalCount(); ++objIdx)
+    QueryStack stack(getHeight());
+    stack.push(rootIdx);
+    while (!stack.empty())
     {
-        debugAssert(allObjects.isValid(objIdx));
-        const AABB &bound = allObjects[objIdx].getBounds();
-        GridCellIndex minBoundIdx = volumeGrid.cell(bound.minBound);
-        GridCellIndex maxBoundIdx = volumeGrid.cell(bound.maxBound);
+        const ProxyIdx nodeIdx = stack.pop();
+        const Node &node = nodes[nodeIdx];
 
-#if USE_CELLIDX_RANGE_ITR
-        for (const GridCellIndex &currentIdx : GridCellIndexRange(minBoundIdx, maxBoundIdx))
+        float enterLength;
+        if (!rayIntersect(node.bound, start, invDir, parallel, length, enterLength))
         {
-            addObject(objIdx, currentIdx);
+            continue;
         }
-#else  // USE_CELLIDX_RANGE_ITR
-        GridCellIndex currentIdx;
-        for (currentIdx[2] = minBoundIdx.idx[2]; currentIdx[2] <= maxBoundIdx[2]; currentIdx[2]++)
+
+        if (node.isLeaf())
         {
-            for (currentIdx[1] = minBoundIdx.idx[1]; currentIdx[1] <= maxBoundIdx[1]; currentIdx[1]++)
+            if (rayIntersect(node.objectBound, start, invDir, parallel, length, enterLength) && !callback(nodeIdx, node.object, enterLength))
             {
-                for (currentIdx[0] = minBoundIdx.idx[0]; currentIdx[0] <= maxBoundIdx[0]; currentIdx[0]++)
-                {
-                    // LOG_DEBUG("BVH", "Adding {} to ({},{},{})", obj,
-                    // x, y, z);
-                    addObject(objIdx, currentIdx);
-                }
+                return;
             }
         }
-#endif // USE_CELLIDX_RANGE_ITR
+        else
+        {
+            stack.push(node.left);
+            stack.push(node.right);
+        }
     }
 }
 
 template <typename StorageType>
-void BoundingVolume<StorageType>::reinitialize(const std::vector<StorageType> &newObjectList, const Vector3 &cellSize)
+SizeT DynamicAABBTree<StorageType>::findIntersection(ArrayRange<StorageType> outObjects, const AABB &box) const
 {
-    allObjects = newObjectList;
-    reinitialize(cellSize);
+    SizeT foundCount = 0;
+    query(
+        box,
+        [&outObjects, &foundCount](ProxyIdx, const StorageType &object)
+        {
+            if (foundCount < outObjects.size())
+            {
+                outObjects[foundCount] = object;
+            }
+            foundCount++;
+            return true;
+        }
+    );
+    return foundCount;
 }
 
 template <typename StorageType>
-void BoundingVolume<StorageType>::addedNewObject(const StorageType &object)
+SizeT DynamicAABBTree<StorageType>::findInFrustum(ArrayRange<StorageType> outObjects, ArrayView<Plane> planes) const
 {
-    const AABB &objBound = object.getBounds();
-    ObjectIdxType objIdx = allObjects.get(object);
-
-    {
-        GridCellIndex newCellCount = volumeGrid.cellCount();
-        Vector3 newMinCorner;
-        Vector3 newMaxCorner;
-        volumeGrid.getBound(newMinCorner, newMaxCorner);
-        Vector3 currMinCorner = newMinCorner;
-        Vector3 currMaxCorner = newMaxCorner;
-
-        bool bChanged = false;
-        for (uint32 axis = 0; axis < 3; ++axis)
+    SizeT foundCount = 0;
+    queryFrustum(
+        planes,
+        [&outObjects, &foundCount](ProxyIdx, const StorageType &object)
         {
-            if (objBound.minBound[axis] < currMinCorner[axis])
+            if (foundCount < outObjects.size())
             {
-                uint32 numNewCells = (uint32)((currMinCorner[axis] - objBound.minBound[axis]) / volumeGrid.cellSize()[axis]);
-                newCellCount.idx[axis] += numNewCells;
-                newMinCorner[axis] -= numNewCells * volumeGrid.cellSize()[axis];
-                bChanged = true;
+                outObjects[foundCount] = object;
             }
-            if (objBound.maxBound[axis] > currMaxCorner[axis])
+            foundCount++;
+            return true;
+        }
+    );
+    return foundCount;
+}
+
+template <typename StorageType>
+SizeT DynamicAABBTree<StorageType>::raycast(
+    ArrayRange<StorageType> outObjects, const Vector3 &start, const Vector3 &dir, float length, bool bClosestOnly /*= true*/
+) const
+{
+    if (bClosestOnly)
+    {
+        ProxyIdx closestProxy = InvalidIdx;
+        float closestLength = length;
+        queryRay(
+            start, dir, length,
+            [&closestProxy, &closestLength](ProxyIdx proxy, const StorageType &, float enterLength)
             {
-                uint32 numNewCells = (uint32)((objBound.maxBound[axis] - currMaxCorner[axis]) / volumeGrid.cellSize()[axis]);
-                newCellCount.idx[axis] += numNewCells;
-                newMaxCorner[axis] += numNewCells * volumeGrid.cellSize()[axis];
-                bChanged = true;
+                if (closestProxy == InvalidIdx || enterLength < closestLength)
+                {
+                    closestProxy = proxy;
+                    closestLength = enterLength;
+                }
+                return true;
             }
+        );
+        if (closestProxy == InvalidIdx)
+        {
+            return 0;
         }
-        if (bChanged)
+        if (outObjects.size() > 0)
         {
-            VectorN<GridCellStorage, 3> newElements(newCellCount);
-            UniformGrid<Vector3, 3> newGrid;
-            newGrid.InitWithCount(newMinCorner, newMaxCorner, newCellCount);
-            for (uint32 i = 0; i < volumeGrid.cellCount().size(); ++i)
-            {
-                GridCellIndex gridIndex = newGrid.cell(volumeGrid.center(i));
-                newElements[gridIndex] = grid[volumeGrid.getNdIndex(i)];
-            }
-            volumeGrid.InitWithCount(newMinCorner, newMaxCorner, newCellCount);
-            grid = std::move(newElements);
+            outObjects[0] = nodes[closestProxy].object;
         }
+        return 1;
     }
 
-    GridCellIndex minBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(objBound.minBound));
-    GridCellIndex maxBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(objBound.maxBound));
+    SizeT foundCount = 0;
+    queryRay(
+        start, dir, length,
+        [&outObjects, &foundCount](ProxyIdx, const StorageType &object, float)
+        {
+            if (foundCount < outObjects.size())
+            {
+                outObjects[foundCount] = object;
+            }
+            foundCount++;
+            return true;
+        }
+    );
+    return foundCount;
+}
 
-#if USE_CELLIDX_RANGE_ITR
-    for (const GridCellIndex &currentIdx : GridCellIndexRange(minBoundIdx, maxBoundIdx))
-    {
-        addObject(objIdx, currentIdx);
-    }
-#else  // USE_CELLIDX_RANGE_ITR
-    GridCellIndex currentIdx;
-    for (currentIdx[2] = minBoundIdx.idx[2]; currentIdx[2] <= maxBoundIdx[2]; currentIdx[2]++)
+template <typename StorageType>
+bool DynamicAABBTree<StorageType>::rayIntersect(
+    const AABB &bound, const Vector3 &start, const Vector3 &invDir, const bool *parallel, float length, float &outEnter
+)
+{
+    float enter = 0.0f;
+    float exit = length;
+    for (uint32 axis = 0; axis < 3; ++axis)
     {
-        for (currentIdx[1] = minBoundIdx.idx[1]; currentIdx[1] <= maxBoundIdx[1]; currentIdx[1]++)
+        if (parallel[axis])
         {
-            for (currentIdx[0] = minBoundIdx.idx[0]; currentIdx[0] <= maxBoundIdx[0]; currentIdx[0]++)
+            if (start[axis] < bound.minBound[axis] || start[axis] > bound.maxBound[axis])
             {
-                addObject(objIdx, currentIdx);
+                return false;
             }
+            continue;
+        }
+        float t0 = (bound.minBound[axis] - start[axis]) * invDir[axis];
+        float t1 = (bound.maxBound[axis] - start[axis]) * invDir[axis];
+        if (t0 > t1)
+        {
+            std::swap(t0, t1);
+        }
+        enter = Math::max(enter, t0);
+        exit = Math::min(exit, t1);
+        if (enter > exit)
+        {
+            return false;
         }
     }
-#endif // USE_CELLIDX_RANGE_ITR
+    outEnter = enter;
+    return true;
 }
 
 template <typename StorageType>
-void BoundingVolume<StorageType>::removeAnObject(const StorageType &object)
+int32 DynamicAABBTree<StorageType>::classifyFrustum(const AABB &bound, ArrayView<Plane> planes)
 {
-    const AABB &objBound = object.getBounds();
-    if (!getBounds().intersect(objBound))
+    bool bFullyInside = true;
+    for (const Plane &plane : planes)
     {
-        return;
+        // Corner farthest along the plane normal, If that is outside then whole box is outside
+        const Vector3 pVertex(
+            plane.x() >= 0 ? bound.maxBound.x() : bound.minBound.x(), plane.y() >= 0 ? bound.maxBound.y() : bound.minBound.y(),
+            plane.z() >= 0 ? bound.maxBound.z() : bound.minBound.z()
+        );
+        if ((plane | pVertex) < 0)
+        {
+            return -1;
+        }
+        // Corner nearest along the plane normal, If that is outside then box intersects the plane
+        const Vector3 nVertex(
+            plane.x() >= 0 ? bound.minBound.x() : bound.maxBound.x(), plane.y() >= 0 ? bound.minBound.y() : bound.maxBound.y(),
+            plane.z() >= 0 ? bound.minBound.z() : bound.maxBound.z()
+        );
+        bFullyInside = bFullyInside && (plane | nVertex) >= 0;
     }
-    ObjectIdxType objIdx = findObjectIndex(object, objBound);
-    debugAssert(allObjects.isValid(objIdx));
-
-    GridCellIndex minBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(objBound.minBound)));
-    GridCellIndex maxBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(objBound.maxBound)));
+    return bFullyInside ? 1 : 0;
+}
 
-#if USE_CELLIDX_RANGE_ITR
-    for (const GridCellIndex &currentIdx : GridCellIndexRange(minBoundIdx, maxBoundIdx))
+template <typename StorageType>
+DynamicAABBTree<StorageType>::ProxyIdx DynamicAABBTree<StorageType>::allocateNode()
+{
+    ProxyIdx nodeIdx;
+    if (freeListHead != InvalidIdx)
     {
-        removeObject(objIdx, currentIdx);
+        nodeIdx = freeListHead;
+        freeListHead = nodes[nodeIdx].parent;
+        nodes[nodeIdx] = Node();
     }
-#else  // USE_CELLIDX_RANGE_ITR
-    GridCellIndex currentIdx;
-    for (currentIdx[2] = minBoundIdx.idx[2]; currentIdx[2] <= maxBoundIdx[2]; currentIdx[2]++)
+    else
     {
-        for (currentIdx[1] = minBoundIdx.idx[1]; currentIdx[1] <= maxBoundIdx[1]; currentIdx[1]++)
-        {
-            for (currentIdx[0] = minBoundIdx.idx[0]; currentIdx[0] <= maxBoundIdx[0]; currentIdx[0]++)
-            {
-                removeObject(objIdx, currentIdx);
-            }
-        }
+        nodeIdx = ProxyIdx(nodes.size());
+        nodes.emplace_back();
     }
-#endif // USE_CELLIDX_RANGE_ITR
-
-    allObjects.reset(objIdx);
+    return nodeIdx;
 }
 
 template <typename StorageType>
-bool BoundingVolume<StorageType>::raycast(
-    std::vector<StorageType> &result, const Vector3 &start, const Vector3 &dir, float length, bool bExitOnHit /* = true */
-)
+void DynamicAABBTree<StorageType>::freeNode(ProxyIdx nodeIdx)
 {
-    AABB globalBound;
-    volumeGrid.getBound(globalBound.minBound, globalBound.maxBound);
-
-    Vector3 invDir;
-    float invLength = 1.0f / length;
+    nodes[nodeIdx].parent = freeListHead;
+    nodes[nodeIdx].left = nodes[nodeIdx].right = InvalidIdx;
+    nodes[nodeIdx].height = -1;
+    freeListHead = nodeIdx;
+}
 
-    bool parallel[3];
-    for (uint32 i = 0; i < 3; i++)
+template <typename StorageType>
+DynamicAABBTree<StorageType>::ProxyIdx DynamicAABBTree<StorageType>::buildRecursive(ProxyIdx *leaves, uint32 count)
+{
+    if (count == 1)
     {
-        parallel[i] = (dir[i] == 0);
-        invDir[i] = parallel[i] ? 0 : 1 / dir[i];
+        return leaves[0];
     }
 
-    float enterAtLengthFrac, exitAtLengthFrac;
-    Vector3 nextStart, nextExit;
-
-    Vector3 tmpPos;
-
-    bool cellsInPath = globalBound.raycastFast(
-        start, dir, invDir, length, invLength, &parallel[0], enterAtLengthFrac, nextStart, exitAtLengthFrac, nextExit
-    );
-
-    std::vector<ObjectIdxType> resultIdxs;
-    resultIdxs.reserve(allObjects.size());
-    if (cellsInPath)
+    AABB nodeBound;
+    AABB centroidBound;
+    for (uint32 i = 0; i < count; ++i)
     {
-        BitArray<uint64> resultIdxAdded(allObjects.totalCount());
+        nodeBound.grow(nodes[leaves[i]].bound);
+        centroidBound.grow(nodes[leaves[i]].bound.center());
+    }
 
-        Vector3 halfCellSize = volumeGrid.cellSize() * 0.5f;
-        GridCellIndex nextCellIdx = volumeGrid.cell(nextStart);
-        nextCellIdx = volumeGrid.clampCellIndex(nextCellIdx);
-        float leftLength = length;
+    // Split along the axis with largest centroid spread
+    const Vector3 centroidExtent = centroidBound.size();
+    uint32 axis = 0;
+    axis = centroidExtent[1] > centroidExtent[axis] ? 1 : axis;
+    axis = centroidExtent[2] > centroidExtent[axis] ? 2 : axis;
 
-        while (leftLength > 0)
+    uint32 leftCount = 0;
+    if (centroidExtent[axis] > SMALL_EPSILON)
+    {
+        struct SAHBin
         {
-            const GridCellStorage &objs = grid[nextCellIdx];
-            for (const ObjectIdxType &objIdx : objs)
-            {
-                debugAssert(allObjects.isValid(objIdx));
-                const StorageType &obj = allObjects[objIdx];
-                const AABB &objBound = obj.getBounds();
-
-                if (objBound.raycastFast(
-                        start, dir, invDir, length, invLength, &parallel[0], enterAtLengthFrac, tmpPos, exitAtLengthFrac, nextExit
-                    )
-                    && !resultIdxAdded[objIdx])
-                {
-                    resultIdxs.emplace_back(objIdx);
-                    resultIdxAdded[objIdx] = true;
+            AABB bound;
+            uint32 count = 0;
+        };
+        SAHBin bins[SAH_BINS_COUNT];
+        const float binScale = SAH_BINS_COUNT / centroidExtent[axis];
+        auto binIdxOf = [this, binScale, axis, &centroidBound](ProxyIdx leaf)
+        {
+            const float centroid = nodes[leaf].bound.center()[axis];
+            return Math::min(uint32((centroid - centroidBound.minBound[axis]) * binScale), SAH_BINS_COUNT - 1);
+        };
+        for (uint32 i = 0; i < count; ++i)
+        {
+            SAHBin &bin = bins[binIdxOf(leaves[i])];
+            bin.bound.grow(nodes[leaves[i]].bound);
+            bin.count++;
+        }
 
-                    if (bExitOnHit)
-                    {
-                        break;
-                    }
-                }
-            }
-            if (bExitOnHit && !resultIdxs.empty())
+        // Cost of splitting after bin i is leftArea * leftCount + rightArea * rightCount
+        float leftCosts[SAH_BINS_COUNT - 1];
+        AABB sweepBound;
+        uint32 sweepCount = 0;
+        for (uint32 i = 0; i < SAH_BINS_COUNT - 1; ++i)
+        {
+            sweepBound.grow(bins[i].bound);
+            sweepCount += bins[i].count;
+            leftCosts[i] = sweepCount > 0 ? surfaceArea(sweepBound) * sweepCount : 0.0f;
+        }
+        float bestCost = FLT_MAX;
+        uint32 bestSplit = 0;
+        sweepBound = AABB();
+        sweepCount = 0;
+        for (uint32 i = SAH_BINS_COUNT - 1; i > 0; --i)
+        {
+            sweepBound.grow(bins[i].bound);
+            sweepCount += bins[i].count;
+            const float cost = leftCosts[i - 1] + (sweepCount > 0 ? surfaceArea(sweepBound) * sweepCount : 0.0f);
+            if (cost < bestCost)
             {
-                break;
+                bestCost = cost;
+                bestSplit = i - 1;
             }
+        }
 
-            Vector3 cellCenter = volumeGrid.location(nextCellIdx);
-
-            float timesPerAxis[3];
-            float bestTime = leftLength;
-
-            bool bReachedEnd = true;
-            for (uint32 axis = 0; axis < 3; axis++)
+        ProxyIdx *mid = std::partition(
+            leaves, leaves + count,
+            [&binIdxOf, bestSplit](ProxyIdx leaf)
             {
-                if (!parallel[axis])
-                {
-                    const float crossPlanePt = dir[axis] > 0 ? cellCenter[axis] + halfCellSize[axis] : cellCenter[axis] - halfCellSize[axis];
-                    const float distance = crossPlanePt - nextStart[axis];
-                    const float time = distance * invDir[axis];
-                    timesPerAxis[axis] = time;
-                    if (bestTime > time)
-                    {
-                        bestTime = time;
-                        bReachedEnd = false;
-                    }
-                }
-                else
-                {
-                    timesPerAxis[axis] = FLT_MAX;
-                }
+                return binIdxOf(leaf) <= bestSplit;
             }
+        );
+        leftCount = uint32(mid - leaves);
+    }
 
-            if (bReachedEnd)
+    // All centroids are same or SAH could not split, Split at median
+    if (leftCount == 0 || leftCount == count)
+    {
+        leftCount = count / 2;
+        std::nth_element(
+            leaves, leaves + leftCount, leaves + count,
+            [this, axis](ProxyIdx lhs, ProxyIdx rhs)
             {
-                break;
+                return nodes[lhs].bound.center()[axis] < nodes[rhs].bound.center()[axis];
             }
+        );
+    }
 
-            for (uint32 axis = 0; axis < 3; axis++)
-            {
-                if (parallel[axis])
-                {
-                    continue;
-                }
-                nextCellIdx.idx[axis] += (timesPerAxis[axis] <= bestTime + SMALL_EPSILON) ? (dir[axis] > 0) ? 1 : -1 : 0;
-                if (nextCellIdx[axis] >= volumeGrid.cellCount()[axis] || nextCellIdx[axis] < 0)
-                {
-                    bReachedEnd = true;
-                    break;
-                }
-            }
+    const ProxyIdx leftIdx = buildRecursive(leaves, leftCount);
+    const ProxyIdx rightIdx = buildRecursive(leaves + leftCount, count - leftCount);
+
+    const ProxyIdx nodeIdx = allocateNode();
+    Node &node = nodes[nodeIdx];
+    node.bound = nodeBound;
+    node.left = leftIdx;
+    node.right = rightIdx;
+    node.height = 1 + Math::max(nodes[leftIdx].height, nodes[rightIdx].height);
+    nodes[leftIdx].parent = nodeIdx;
+    nodes[rightIdx].parent = nodeIdx;
+    return nodeIdx;
+}
 
-            if (bReachedEnd)
-            {
-                break;
-            }
+template <typename StorageType>
+void DynamicAABBTree<StorageType>::insertLeaf(ProxyIdx leaf)
+{
+    if (rootIdx == InvalidIdx)
+    {
+        rootIdx = leaf;
+        nodes[leaf].parent = InvalidIdx;
+        return;
+    }
+
+    // Find the best sibling, Descend to the child that increases the total surface area the least
+    const AABB leafBound = nodes[leaf].bound;
+    ProxyIdx siblingIdx = rootIdx;
+    while (!nodes[siblingIdx].isLeaf())
+    {
+        const Node &node = nodes[siblingIdx];
+        const float area = surfaceArea(node.bound);
+        const float combinedArea = surfaceArea(combine(node.bound, leafBound));
 
-            nextStart += dir * bestTime;
-            leftLength -= (dir * bestTime).length();
+        // Cost of creating new parent for this node and the leaf
+        const float cost = 2.0f * combinedArea;
+        // Minimum cost of pushing the leaf further down the tree
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [this, &leafBound, inheritanceCost](ProxyIdx childIdx)
+        {
+            const Node &child = nodes[childIdx];
+            const float newArea = surfaceArea(combine(leafBound, child.bound));
+            return child.isLeaf() ? newArea + inheritanceCost : (newArea - surfaceArea(child.bound)) + inheritanceCost;
+        };
+        const float leftCost = childCost(node.left);
+        const float rightCost = childCost(node.right);
+
+        if (cost < leftCost && cost < rightCost)
+        {
+            break;
         }
+        siblingIdx = leftCost < rightCost ? node.left : node.right;
+    }
+
+    // Create a new parent for the sibling and the leaf
+    const ProxyIdx oldParentIdx = nodes[siblingIdx].parent;
+    const ProxyIdx newParentIdx = allocateNode();
+    Node &newParent = nodes[newParentIdx];
+    newParent.parent = oldParentIdx;
+    newParent.bound = combine(leafBound, nodes[siblingIdx].bound);
+    newParent.height = nodes[siblingIdx].height + 1;
+    newParent.left = siblingIdx;
+    newParent.right = leaf;
+    nodes[siblingIdx].parent = newParentIdx;
+    nodes[leaf].parent = newParentIdx;
+
+    if (oldParentIdx != InvalidIdx)
+    {
+        replaceChild(oldParentIdx, siblingIdx, newParentIdx);
     }
-    for (const ObjectIdxType &objIdx : resultIdxs)
+    else
     {
-        result.emplace_back(allObjects[objIdx]);
+        rootIdx = newParentIdx;
     }
 
-    return result.size() > 0;
+    fixUpwards(newParentIdx);
 }
 
 template <typename StorageType>
-void BoundingVolume<StorageType>::updateBounds(const StorageType &object, const AABB &oldBox, const AABB &newBox)
+void DynamicAABBTree<StorageType>::removeLeaf(ProxyIdx leaf)
 {
-    // If not present already then we must add new object
-    if (!getBounds().intersect(oldBox))
+    if (leaf == rootIdx)
     {
-        addedNewObject(object);
+        rootIdx = InvalidIdx;
         return;
     }
 
-    ObjectIdxType objIdx = findObjectIndex(object, oldBox);
-    debugAssert(allObjects.isValid(objIdx));
+    const ProxyIdx parentIdx = nodes[leaf].parent;
+    const ProxyIdx grandParentIdx = nodes[parentIdx].parent;
+    const ProxyIdx siblingIdx = nodes[parentIdx].left == leaf ? nodes[parentIdx].right : nodes[parentIdx].left;
+
+    // Sibling takes the place of the parent
+    nodes[siblingIdx].parent = grandParentIdx;
+    if (grandParentIdx != InvalidIdx)
+    {
+        replaceChild(grandParentIdx, parentIdx, siblingIdx);
+        freeNode(parentIdx);
+        fixUpwards(grandParentIdx);
+    }
+    else
+    {
+        rootIdx = siblingIdx;
+        freeNode(parentIdx);
+    }
+    nodes[leaf].parent = InvalidIdx;
+}
+
+template <typename StorageType>
+void DynamicAABBTree<StorageType>::fixUpwards(ProxyIdx nodeIdx)
+{
+    while (nodeIdx != InvalidIdx)
+    {
+        nodeIdx = balance(nodeIdx);
+
+        Node &node = nodes[nodeIdx];
+        node.height = 1 + Math::max(nodes[node.left].height, nodes[node.right].height);
+        node.bound = combine(nodes[node.left].bound, nodes[node.right].bound);
 
-    GridCellIndex minBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(oldBox.minBound)));
-    GridCellIndex maxBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(oldBox.maxBound)));
+        nodeIdx = node.parent;
+    }
+}
 
-#if USE_CELLIDX_RANGE_ITR
-    for (const GridCellIndex &currentIdx : GridCellIndexRange(minBoundIdx, maxBoundIdx))
+template <typename StorageType>
+DynamicAABBTree<StorageType>::ProxyIdx DynamicAABBTree<StorageType>::balance(ProxyIdx aIdx)
+{
+    Node &a = nodes[aIdx];
+    if (a.isLeaf() || a.height < 2)
     {
-        removeObject(objIdx, currentIdx);
+        return aIdx;
     }
-#else  // USE_CELLIDX_RANGE_ITR
-    GridCellIndex currentIdx;
-    for (currentIdx[2] = minBoundIdx.idx[2]; currentIdx[2] <= maxBoundIdx[2]; currentIdx[2]++)
+
+    const ProxyIdx bIdx = a.left;
+    const ProxyIdx cIdx = a.right;
+    Node &b = nodes[bIdx];
+    Node &c = nodes[cIdx];
+
+    const int32 balanceFactor = c.height - b.height;
+    // Rotate C up
+    if (balanceFactor > 1)
     {
-        for (currentIdx[1] = minBoundIdx.idx[1]; currentIdx[1] <= maxBoundIdx[1]; currentIdx[1]++)
+        const ProxyIdx fIdx = c.left;
+        const ProxyIdx gIdx = c.right;
+        Node &f = nodes[fIdx];
+        Node &g = nodes[gIdx];
+
+        // Swap A and C
+        c.left = aIdx;
+        c.parent = a.parent;
+        a.parent = cIdx;
+        if (c.parent != InvalidIdx)
         {
-            for (currentIdx[0] = minBoundIdx.idx[0]; currentIdx[0] <= maxBoundIdx[0]; currentIdx[0]++)
-            {
-                removeObject(objIdx, currentIdx);
-            }
+            replaceChild(c.parent, aIdx, cIdx);
+        }
+        else
+        {
+            rootIdx = cIdx;
         }
-    }
-#endif // USE_CELLIDX_RANGE_ITR
 
-    if (getBounds().intersect(newBox))
+        // Taller child of C stays with C
+        if (f.height > g.height)
+        {
+            c.right = fIdx;
+            a.right = gIdx;
+            g.parent = aIdx;
+            a.bound = combine(b.bound, g.bound);
+            c.bound = combine(a.bound, f.bound);
+            a.height = 1 + Math::max(b.height, g.height);
+            c.height = 1 + Math::max(a.height, f.height);
+        }
+        else
+        {
+            c.right = gIdx;
+            a.right = fIdx;
+            f.parent = aIdx;
+            a.bound = combine(b.bound, f.bound);
+            c.bound = combine(a.bound, g.bound);
+            a.height = 1 + Math::max(b.height, f.height);
+            c.height = 1 + Math::max(a.height, g.height);
+        }
+        return cIdx;
+    }
+    // Rotate B up
+    if (balanceFactor < -1)
     {
-        minBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(newBox.minBound)));
-        maxBoundIdx = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(newBox.maxBound)));
+        const ProxyIdx dIdx = b.left;
+        const ProxyIdx eIdx = b.right;
+        Node &d = nodes[dIdx];
+        Node &e = nodes[eIdx];
+
+        // Swap A and B
+        b.left = aIdx;
+        b.parent = a.parent;
+        a.parent = bIdx;
+        if (b.parent != InvalidIdx)
+        {
+            replaceChild(b.parent, aIdx, bIdx);
+        }
+        else
+        {
+            rootIdx = bIdx;
+        }
 
-#if USE_CELLIDX_RANGE_ITR
-        for (const GridCellIndex &currentIdx : GridCellIndexRange(minBoundIdx, maxBoundIdx))
+        // Taller child of B stays with B
+        if (d.height > e.height)
         {
-            addObject(objIdx, currentIdx);
+            b.right = dIdx;
+            a.left = eIdx;
+            e.parent = aIdx;
+            a.bound = combine(c.bound, e.bound);
+            b.bound = combine(a.bound, d.bound);
+            a.height = 1 + Math::max(c.height, e.height);
+            b.height = 1 + Math::max(a.height, d.height);
         }
-#else  // USE_CELLIDX_RANGE_ITR
-        for (currentIdx[2] = minBoundIdx.idx[2]; currentIdx[2] <= maxBoundIdx[2]; currentIdx[2]++)
+        else
         {
-            for (currentIdx[1] = minBoundIdx.idx[1]; currentIdx[1] <= maxBoundIdx[1]; currentIdx[1]++)
-            {
-                for (currentIdx[0] = minBoundIdx.idx[0]; currentIdx[0] <= maxBoundIdx[0]; currentIdx[0]++)
-                {
-                    addObject(objIdx, currentIdx);
-                }
-            }
+            b.right = eIdx;
+            a.left = dIdx;
+            d.parent = aIdx;
+            a.bound = combine(c.bound, d.bound);
+            b.bound = combine(a.bound, e.bound);
+            a.height = 1 + Math::max(c.height, d.height);
+            b.height = 1 + Math::max(a.height, e.height);
         }
-#endif // USE_CELLIDX_RANGE_ITR
+        return bIdx;
     }
+    return aIdx;
 }
 
 template <typename StorageType>
-bool BoundingVolume<StorageType>::isSameBounds(const AABB &boxOne, const AABB &boxTwo)
+void DynamicAABBTree<StorageType>::replaceChild(ProxyIdx parentIdx, ProxyIdx oldChild, ProxyIdx newChild)
 {
-    GridCellIndex minBoundIdx1 = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(boxOne.minBound)));
-    GridCellIndex maxBoundIdx1 = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(boxOne.maxBound)));
-
-    GridCellIndex minBoundIdx2 = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(boxTwo.minBound)));
-    GridCellIndex maxBoundIdx2 = volumeGrid.clampCellIndex(volumeGrid.cell(volumeGrid.clampLocation(boxTwo.maxBound)));
-
-    return minBoundIdx1 == minBoundIdx2 && maxBoundIdx1 == maxBoundIdx2;
+    Node &parent = nodes[parentIdx];
+    if (parent.left == oldChild)
+    {
+        parent.left = newChild;
+    }
+    else
+    {
+        debugAssert(parent.right == oldChild);
+        parent.right = newChild;
+    }
 }
-
-#undef USE_CELLIDX_RANGE_ITR
\ No newline at end of file
@@ -0,0 +1,415 @@
+/*!
+ * \file BatchTransform.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "Math/BatchTransform.h"
+#include "Math/MathSIMD.h"
+#include "Math/BatchTransformAVX2.h"
+#include "Memory/Memory.h"
+
+#if MATH_SIMD_AVX2_DISPATCH && !MATH_SIMD_AVX2 && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Kernels work directly on the column major floats of glm types
+static_assert(sizeof(Matrix4) == 16 * sizeof(float), "Matrix4 must be 16 tightly packed floats");
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be 3 tightly packed floats");
+
+FORCE_INLINE const float *matrixData(const Matrix4 &mat) { return reinterpret_cast<const float *>(&mat); }
+FORCE_INLINE float *matrixData(Matrix4 &mat) { return reinterpret_cast<float *>(&mat); }
+
+//////////////////////////////////////////////////////////////////////////
+/// Kernels
+//////////////////////////////////////////////////////////////////////////
+
+#if MATH_SIMD_SSE
+
+struct SSEMatrix
+{
+    __m128 cols[4];
+
+    FORCE_INLINE void load(const float *mat)
+    {
+        cols[0] = _mm_loadu_ps(mat);
+        cols[1] = _mm_loadu_ps(mat + 4);
+        cols[2] = _mm_loadu_ps(mat + 8);
+        cols[3] = _mm_loadu_ps(mat + 12);
+    }
+
+    // cols[0] * x + cols[1] * y + cols[2] * z + cols[3] * w
+    FORCE_INLINE __m128 combine(__m128 x, __m128 y, __m128 z, __m128 w) const
+    {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(cols[0], x), _mm_mul_ps(cols[1], y)), _mm_add_ps(_mm_mul_ps(cols[2], z), _mm_mul_ps(cols[3], w)));
+    }
+    FORCE_INLINE __m128 transformPoint(float x, float y, float z) const
+    {
+        return _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(cols[0], _mm_set1_ps(x)), _mm_mul_ps(cols[1], _mm_set1_ps(y))),
+            _mm_add_ps(_mm_mul_ps(cols[2], _mm_set1_ps(z)), cols[3])
+        );
+    }
+};
+
+FORCE_INLINE Vector3 toVector3(__m128 value)
+{
+    alignas(16) float values[4];
+    _mm_store_ps(values, value);
+    return Vector3(values[0], values[1], values[2]);
+}
+
+// Loads all of rhs before writing so outMat can be same as lhs or rhs
+FORCE_INLINE void multiplyKernel(float *outMat, const SSEMatrix &lhs, const float *rhs)
+{
+    __m128 results[4];
+    for (uint32 col = 0; col < 4; ++col)
+    {
+        const float *rhsCol = rhs + col * 4;
+        results[col] = lhs.combine(_mm_set1_ps(rhsCol[0]), _mm_set1_ps(rhsCol[1]), _mm_set1_ps(rhsCol[2]), _mm_set1_ps(rhsCol[3]));
+    }
+    _mm_storeu_ps(outMat, results[0]);
+    _mm_storeu_ps(outMat + 4, results[1]);
+    _mm_storeu_ps(outMat + 8, results[2]);
+    _mm_storeu_ps(outMat + 12, results[3]);
+}
+
+FORCE_INLINE AABB transformAABBKernel(const SSEMatrix &mat, const SSEMatrix &absMat, const AABB &bound)
+{
+    const Vector3 center = bound.center();
+    const Vector3 halfExtent = bound.size() * 0.5f;
+
+    const __m128 newCenter = mat.transformPoint(center.x(), center.y(), center.z());
+    // Extent along each axis after transform is sum of absolute projection of each extent
+    const __m128 newHalfExtent = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(absMat.cols[0], _mm_set1_ps(halfExtent.x())), _mm_mul_ps(absMat.cols[1], _mm_set1_ps(halfExtent.y()))),
+        _mm_mul_ps(absMat.cols[2], _mm_set1_ps(halfExtent.z()))
+    );
+    return AABB(toVector3(_mm_sub_ps(newCenter, newHalfExtent)), toVector3(_mm_add_ps(newCenter, newHalfExtent)));
+}
+
+FORCE_INLINE SSEMatrix absMatrix(const SSEMatrix &mat)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    SSEMatrix absMat;
+    absMat.cols[0] = _mm_andnot_ps(signMask, mat.cols[0]);
+    absMat.cols[1] = _mm_andnot_ps(signMask, mat.cols[1]);
+    absMat.cols[2] = _mm_andnot_ps(signMask, mat.cols[2]);
+    absMat.cols[3] = mat.cols[3];
+    return absMat;
+}
+
+#else // MATH_SIMD_SSE
+
+struct ScalarMatrix
+{
+    float values[16];
+
+    FORCE_INLINE void load(const float *mat) { CBEMemory::memCopy(values, mat, sizeof(values)); }
+    FORCE_INLINE Vector3 transformPoint(float x, float y, float z) const
+    {
+        return Vector3(
+            values[0] * x + values[4] * y + values[8] * z + values[12], values[1] * x + values[5] * y + values[9] * z + values[13],
+            values[2] * x + values[6] * y + values[10] * z + values[14]
+        );
+    }
+};
+
+FORCE_INLINE void multiplyKernel(float *outMat, const ScalarMatrix &lhs, const float *rhs)
+{
+    float results[16];
+    for (uint32 col = 0; col < 4; ++col)
+    {
+        const float *rhsCol = rhs + col * 4;
+        for (uint32 row = 0; row < 4; ++row)
+        {
+            results[col * 4 + row] = lhs.values[row] * rhsCol[0] + lhs.values[4 + row] * rhsCol[1] + lhs.values[8 + row] * rhsCol[2]
+                                     + lhs.values[12 + row] * rhsCol[3];
+        }
+    }
+    CBEMemory::memCopy(outMat, results, sizeof(results));
+}
+
+FORCE_INLINE AABB transformAABBKernel(const ScalarMatrix &mat, const ScalarMatrix &absMat, const AABB &bound)
+{
+    const Vector3 center = bound.center();
+    const Vector3 halfExtent = bound.size() * 0.5f;
+
+    const Vector3 newCenter = mat.transformPoint(center.x(), center.y(), center.z());
+    const Vector3 newHalfExtent(
+        absMat.values[0] * halfExtent.x() + absMat.values[4] * halfExtent.y() + absMat.values[8] * halfExtent.z(),
+        absMat.values[1] * halfExtent.x() + absMat.values[5] * halfExtent.y() + absMat.values[9] * halfExtent.z(),
+        absMat.values[2] * halfExtent.x() + absMat.values[6] * halfExtent.y() + absMat.values[10] * halfExtent.z()
+    );
+    return AABB(newCenter - newHalfExtent, newCenter + newHalfExtent);
+}
+
+FORCE_INLINE ScalarMatrix absMatrix(const ScalarMatrix &mat)
+{
+    ScalarMatrix absMat;
+    for (uint32 i = 0; i < ARRAY_LENGTH(mat.values); ++i)
+    {
+        absMat.values[i] = Math::abs(mat.values[i]);
+    }
+    return absMat;
+}
+
+#endif // MATH_SIMD_SSE
+
+#if MATH_SIMD_SSE
+using KernelMatrix = SSEMatrix;
+#else
+using KernelMatrix = ScalarMatrix;
+#endif
+
+#if MATH_SIMD_AVX2
+CONST_EXPR bool canUseAVX2() { return true; }
+#elif MATH_SIMD_AVX2_DISPATCH
+bool cpuHasAVX2()
+{
+#ifdef _MSC_VER
+    int32 cpuInfo[4];
+    __cpuid(cpuInfo, 0);
+    if (cpuInfo[0] < 7)
+    {
+        return false;
+    }
+    // OS must also save the AVX registers, OSXSAVE and AVX bits and XMM, YMM state enabled in XCR0
+    __cpuid(cpuInfo, 1);
+    const bool bOsSavesAVX = (cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    if (!bOsSavesAVX)
+    {
+        return false;
+    }
+    __cpuidex(cpuInfo, 7, 0);
+    return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+    // Also checks that OS saves the AVX registers
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+FORCE_INLINE bool canUseAVX2()
+{
+    static const bool bHasAVX2 = cpuHasAVX2();
+    return bHasAVX2;
+}
+#endif
+
+// outMats[i] = lhsMats[i * lhsStride] * rhsMats[i], lhsStride is 0 to use same lhs for all
+void multiplyMatrices(float *outMats, const float *lhsMats, SizeT lhsStride, const float *rhsMats, SizeT count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+#if MATH_SIMD_AVX2 || MATH_SIMD_AVX2_DISPATCH
+    if (canUseAVX2())
+    {
+        BatchTransformAVX2::multiply(outMats, lhsMats, lhsStride, rhsMats, count);
+        return;
+    }
+#endif
+
+    KernelMatrix lhsMat;
+    lhsMat.load(lhsMats);
+    for (SizeT i = 0; i < count; ++i)
+    {
+        if (i != 0 && lhsStride != 0)
+        {
+            lhsMat.load(lhsMats + i * lhsStride);
+        }
+        multiplyKernel(outMats + i * 16, lhsMat, rhsMats + i * 16);
+    }
+}
+
+// Transforms are converted to matrices in chunks of this size so that the multiplications can be batched
+CONST_EXPR static const SizeT TRANSFORM_CHUNK_SIZE = 32;
+
+//////////////////////////////////////////////////////////////////////////
+/// BatchTransform
+//////////////////////////////////////////////////////////////////////////
+
+void BatchTransform::multiply(ArrayRange<Matrix4> outMats, ArrayView<Matrix4> lhs, ArrayView<Matrix4> rhs)
+{
+    debugAssert(lhs.size() == rhs.size() && outMats.size() >= lhs.size());
+
+    multiplyMatrices(matrixData(*outMats.data()), matrixData(*lhs.data()), 16, matrixData(*rhs.data()), lhs.size());
+}
+
+void BatchTransform::multiply(ArrayRange<Matrix4> outMats, const Matrix4 &lhs, ArrayView<Matrix4> rhs)
+{
+    debugAssert(outMats.size() >= rhs.size());
+
+    multiplyMatrices(matrixData(*outMats.data()), matrixData(lhs), 0, matrixData(*rhs.data()), rhs.size());
+}
+
+void BatchTransform::toMatrices(ArrayRange<Matrix4> outMats, ArrayView<Transform3D> transforms)
+{
+    debugAssert(outMats.size() >= transforms.size());
+
+    // Rotation to matrix conversion is trigonometric and stays scalar
+    for (SizeT i = 0; i < transforms.size(); ++i)
+    {
+        outMats[i] = transforms[i].getTransformMatrix();
+    }
+}
+
+void BatchTransform::transform(ArrayRange<Transform3D> outTfs, ArrayView<Transform3D> parents, ArrayView<Transform3D> children)
+{
+    debugAssert(parents.size() == children.size() && outTfs.size() >= parents.size());
+
+    Matrix4 parentMats[TRANSFORM_CHUNK_SIZE];
+    Matrix4 childMats[TRANSFORM_CHUNK_SIZE];
+    for (SizeT chunkStart = 0; chunkStart < parents.size(); chunkStart += TRANSFORM_CHUNK_SIZE)
+    {
+        const SizeT chunkCount = Math::min(parents.size() - chunkStart, TRANSFORM_CHUNK_SIZE);
+        for (SizeT i = 0; i < chunkCount; ++i)
+        {
+            parentMats[i] = parents[chunkStart + i].getTransformMatrix();
+            childMats[i] = children[chunkStart + i].getTransformMatrix();
+        }
+        multiplyMatrices(matrixData(childMats[0]), matrixData(parentMats[0]), 16, matrixData(childMats[0]), chunkCount);
+        for (SizeT i = 0; i < chunkCount; ++i)
+        {
+            outTfs[chunkStart + i] = childMats[i];
+        }
+    }
+}
+
+void BatchTransform::transform(ArrayRange<Transform3D> outTfs, const Transform3D &parent, ArrayView<Transform3D> children)
+{
+    debugAssert(outTfs.size() >= children.size());
+
+    const Matrix4 parentMat = parent.getTransformMatrix();
+    Matrix4 childMats[TRANSFORM_CHUNK_SIZE];
+    for (SizeT chunkStart = 0; chunkStart < children.size(); chunkStart += TRANSFORM_CHUNK_SIZE)
+    {
+        const SizeT chunkCount = Math::min(children.size() - chunkStart, TRANSFORM_CHUNK_SIZE);
+        for (SizeT i = 0; i < chunkCount; ++i)
+        {
+            childMats[i] = children[chunkStart + i].getTransformMatrix();
+        }
+        multiplyMatrices(matrixData(childMats[0]), matrixData(parentMat), 0, matrixData(childMats[0]), chunkCount);
+        for (SizeT i = 0; i < chunkCount; ++i)
+        {
+            outTfs[chunkStart + i] = childMats[i];
+        }
+    }
+}
+
+void BatchTransform::invTransform(ArrayRange<Transform3D> outTfs, ArrayView<Transform3D> parents, ArrayView<Transform3D> children)
+{
+    debugAssert(parents.size() == children.size() && outTfs.size() >= parents.size());
+
+    Matrix4 parentInvMats[TRANSFORM_CHUNK_SIZE];
+    Matrix4 childMats[TRANSFORM_CHUNK_SIZE];
+    for (SizeT chunkStart = 0; chunkStart < parents.size(); chunkStart += TRANSFORM_CHUNK_SIZE)
+    {
+        const SizeT chunkCount = Math::min(parents.size() - chunkStart, TRANSFORM_CHUNK_SIZE);
+        for (SizeT i = 0; i < chunkCount; ++i)
+        {
+            parentInvMats[i] = parents[chunkStart + i].inverseNonUniformScaledMatrix();
+            childMats[i] = children[chunkStart + i].getTransformMatrix();
+        }
+        multiplyMatrices(matrixData(childMats[0]), matrixData(parentInvMats[0]), 16, matrixData(childMats[0]), chunkCount);
+        for (SizeT i = 0; i < chunkCount; ++i)
+        {
+            outTfs[chunkStart + i] = childMats[i];
+        }
+    }
+}
+
+void BatchTransform::transformPoints(ArrayRange<Vector3> outPoints, const Matrix4 &mat, ArrayView<Vector3> points)
+{
+    debugAssert(outPoints.size() >= points.size());
+
+    KernelMatrix kernelMat;
+    kernelMat.load(matrixData(mat));
+    for (SizeT i = 0; i < points.size(); ++i)
+    {
+        const Vector3 &point = points[i];
+#if MATH_SIMD_SSE
+        outPoints[i] = toVector3(kernelMat.transformPoint(point.x(), point.y(), point.z()));
+#else
+        outPoints[i] = kernelMat.transformPoint(point.x(), point.y(), point.z());
+#endif
+    }
+}
+
+void BatchTransform::transformPoints(
+    float *outX, float *outY, float *outZ, const Matrix4 &mat, const float *inX, const float *inY, const float *inZ, SizeT count
+)
+{
+    const float *m = matrixData(mat);
+    SizeT i = 0;
+
+#if MATH_SIMD_AVX2 || MATH_SIMD_AVX2_DISPATCH
+    if (canUseAVX2())
+    {
+        i = BatchTransformAVX2::transformPoints(outX, outY, outZ, m, inX, inY, inZ, count);
+    }
+#endif
+#if MATH_SIMD_SSE
+    {
+        const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]);
+        const __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]), m6 = _mm_set1_ps(m[6]);
+        const __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]), m10 = _mm_set1_ps(m[10]);
+        const __m128 m12 = _mm_set1_ps(m[12]), m13 = _mm_set1_ps(m[13]), m14 = _mm_set1_ps(m[14]);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 x = _mm_loadu_ps(inX + i);
+            const __m128 y = _mm_loadu_ps(inY + i);
+            const __m128 z = _mm_loadu_ps(inZ + i);
+            _mm_storeu_ps(outX + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_add_ps(_mm_mul_ps(m8, z), m12)));
+            _mm_storeu_ps(outY + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_add_ps(_mm_mul_ps(m9, z), m13)));
+            _mm_storeu_ps(outZ + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_add_ps(_mm_mul_ps(m10, z), m14)));
+        }
+    }
+#endif // MATH_SIMD_SSE
+
+    // Remaining points, Same operation order as SIMD path
+    for (; i < count; ++i)
+    {
+        const float x = inX[i], y = inY[i], z = inZ[i];
+        outX[i] = (m[0] * x + m[4] * y) + (m[8] * z + m[12]);
+        outY[i] = (m[1] * x + m[5] * y) + (m[9] * z + m[13]);
+        outZ[i] = (m[2] * x + m[6] * y) + (m[10] * z + m[14]);
+    }
+}
+
+void BatchTransform::transformAABBs(ArrayRange<AABB> outBounds, ArrayView<Matrix4> mats, ArrayView<AABB> bounds)
+{
+    debugAssert(mats.size() == bounds.size() && outBounds.size() >= bounds.size());
+
+    KernelMatrix kernelMat;
+    for (SizeT i = 0; i < bounds.size(); ++i)
+    {
+        kernelMat.load(matrixData(mats[i]));
+        outBounds[i] = transformAABBKernel(kernelMat, absMatrix(kernelMat), bounds[i]);
+    }
+}
+
+void BatchTransform::transformAABBs(ArrayRange<AABB> outBounds, const Matrix4 &mat, ArrayView<AABB> bounds)
+{
+    debugAssert(outBounds.size() >= bounds.size());
+
+    KernelMatrix kernelMat;
+    kernelMat.load(matrixData(mat));
+    const KernelMatrix absMat = absMatrix(kernelMat);
+    for (SizeT i = 0; i < bounds.size(); ++i)
+    {
+        outBounds[i] = transformAABBKernel(kernelMat, absMat, bounds[i]);
+    }
+}
+
+AABB BatchTransform::transformAABB(const Matrix4 &mat, const AABB &bound)
+{
+    KernelMatrix kernelMat;
+    kernelMat.load(matrixData(mat));
+    return transformAABBKernel(kernelMat, absMatrix(kernelMat), bound);
+}
@@ -0,0 +1,58 @@
+/*!
+ * \file BatchTransform.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Math/Box.h"
+#include "Math/CoreMathTypes.h"
+#include "Math/Transform3D.h"
+#include "Types/Containers/ArrayView.h"
+
+/**
+ * Batch versions of Transform3D, Matrix4 and AABB transform operations.
+ * Uses SSE when available and AVX2 when the CPU supports it(See MathSIMD.h) else falls back to scalar code that gives same results.
+ * Output range must have atleast as many elements as the inputs, Output can alias the inputs for same indexed elements.
+ */
+class PROGRAMCORE_EXPORT BatchTransform
+{
+private:
+    BatchTransform() = default;
+
+public:
+    // outMats[i] = lhs[i] * rhs[i]
+    static void multiply(ArrayRange<Matrix4> outMats, ArrayView<Matrix4> lhs, ArrayView<Matrix4> rhs);
+    // outMats[i] = lhs * rhs[i], Useful to transform children by a parent
+    static void multiply(ArrayRange<Matrix4> outMats, const Matrix4 &lhs, ArrayView<Matrix4> rhs);
+
+    // outMats[i] = transforms[i].getTransformMatrix()
+    static void toMatrices(ArrayRange<Matrix4> outMats, ArrayView<Transform3D> transforms);
+    // outTfs[i] = parents[i].transform(children[i])
+    static void transform(ArrayRange<Transform3D> outTfs, ArrayView<Transform3D> parents, ArrayView<Transform3D> children);
+    // outTfs[i] = parent.transform(children[i])
+    static void transform(ArrayRange<Transform3D> outTfs, const Transform3D &parent, ArrayView<Transform3D> children);
+    // outTfs[i] = parents[i].invTransform(children[i])
+    static void invTransform(ArrayRange<Transform3D> outTfs, ArrayView<Transform3D> parents, ArrayView<Transform3D> children);
+
+    // AoS points, outPoints[i] = mat * points[i] with w = 1
+    static void transformPoints(ArrayRange<Vector3> outPoints, const Matrix4 &mat, ArrayView<Vector3> points);
+    // SoA points, Each of the arrays must have count elements. Output arrays can be same as input arrays
+    static void transformPoints(
+        float *outX, float *outY, float *outZ, const Matrix4 &mat, const float *inX, const float *inY, const float *inZ, SizeT count
+    );
+
+    /**
+     * Transforms the AABBs and returns the tightest AABB containing the transformed boxes(Same as growing the bound with all transformed
+     * corners). Bounds must be valid AABBs
+     */
+    static void transformAABBs(ArrayRange<AABB> outBounds, ArrayView<Matrix4> mats, ArrayView<AABB> bounds);
+    static void transformAABBs(ArrayRange<AABB> outBounds, const Matrix4 &mat, ArrayView<AABB> bounds);
+    static AABB transformAABB(const Matrix4 &mat, const AABB &bound);
+};
@@ -0,0 +1,44 @@
+/*!
+ * \file MathSIMD.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+/**
+ * SIMD instruction sets available for the target, Selected at compile time from compiler's target flags.
+ * MATH_SIMD_AVX2 requires the module to be compiled with AVX2 enabled(/arch:AVX2 or -mavx2).
+ * MATH_SIMD_AVX2_DISPATCH is set by ProgramCore build on x64, Its AVX2 kernels are compiled with AVX2 only in their own file and picked at
+ * runtime if the CPU supports AVX2.
+ * Code using these must always have a scalar fallback for targets without them.
+ */
+
+#ifndef MATH_SIMD_SSE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD_SSE 1
+#else
+#define MATH_SIMD_SSE 0
+#endif
+#endif // MATH_SIMD_SSE
+
+#ifndef MATH_SIMD_AVX2
+#if MATH_SIMD_SSE && defined(__AVX2__)
+#define MATH_SIMD_AVX2 1
+#else
+#define MATH_SIMD_AVX2 0
+#endif
+#endif // MATH_SIMD_AVX2
+
+#ifndef MATH_SIMD_AVX2_DISPATCH
+#define MATH_SIMD_AVX2_DISPATCH 0
+#endif // MATH_SIMD_AVX2_DISPATCH
+
+#if MATH_SIMD_SSE
+#include <immintrin.h>
+#endif
@@ -25,6 +25,7 @@ private:
 
     template <ArchiveTypeName ArchiveType>
     friend ArchiveType &operator<< (ArchiveType &archive, Transform3D &value);
+    friend class BatchTransform;
 
 public:
     static Transform3D ZERO_TRANSFORM;
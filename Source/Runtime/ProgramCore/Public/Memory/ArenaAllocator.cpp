@@ -0,0 +1,58 @@
+/*!
+ * \file ArenaAllocator.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "Memory/ArenaAllocator.h"
+
+#include <atomic>
+
+namespace ScratchArena
+{
+
+struct ThreadScratchData
+{
+    ArenaAllocator arena{ SCRATCH_BLOCK_SIZE };
+    uint64 lastResetFrame = 0;
+    uint32 activeScopes = 0;
+};
+
+// Incremented every frame, Each thread resets its arena lazily when it sees a new frame
+static std::atomic<uint64> scratchFrameIdx{ 0 };
+
+ThreadScratchData &threadScratchData()
+{
+    static thread_local ThreadScratchData scratchData;
+    return scratchData;
+}
+
+ArenaAllocator &threadArena()
+{
+    ThreadScratchData &scratchData = threadScratchData();
+    const uint64 currFrameIdx = scratchFrameIdx.load(std::memory_order::relaxed);
+    // Cannot reset if some scope is still using the arena, Will be reset at next access after the scopes are done
+    if (scratchData.lastResetFrame != currFrameIdx && scratchData.activeScopes == 0)
+    {
+        scratchData.arena.reset();
+        scratchData.lastResetFrame = currFrameIdx;
+    }
+    return scratchData.arena;
+}
+
+void onFrameBoundary() { scratchFrameIdx.fetch_add(1, std::memory_order::relaxed); }
+
+void pushScope() { threadScratchData().activeScopes++; }
+void popScope()
+{
+    ThreadScratchData &scratchData = threadScratchData();
+    debugAssert(scratchData.activeScopes > 0);
+    scratchData.activeScopes--;
+}
+
+} // namespace ScratchArena
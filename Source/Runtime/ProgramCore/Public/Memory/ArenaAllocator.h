@@ -13,68 +13,89 @@
 
 #include "Types/CoreTypes.h"
 #include "Types/CoreDefines.h"
+#include "Types/CoreMiscDefines.h"
 #include "Math/Math.h"
 #include "Memory/Memory.h"
+#include "ProgramCoreExports.h"
 
-#include <list>
-
+/**
+ * Bump allocator that allocates from blocks of memory, Individual allocations are never freed.
+ * Memory can be released in bulk either by reset() or by rewinding to a marker. Blocks are kept for reuse unless releaseUnused() is called.
+ * Not thread safe, For per thread scratch memory use ScratchArena::threadArena()
+ */
 class ArenaAllocator
 {
+private:
+    // Header at the start of each block
+    struct ArenaBlock
+    {
+        // Next block in either used blocks or free blocks chain
+        ArenaBlock *next;
+        // Size including header
+        SizeT size;
+
+        FORCE_INLINE uint8 *dataStart() { return reinterpret_cast<uint8 *>(this) + BLOCK_HEADER_SIZE; }
+    };
+
+public:
+    constexpr static const SizeT BLOCK_HEADER_SIZE = Math::alignByUnsafe(sizeof(ArenaBlock), CBEMemAlloc::DEFAULT_ALIGNMENT);
+
+    // Point in the arena that can be rewound to
+    struct Marker
+    {
+        ArenaBlock *block = nullptr;
+        SizeT top = 0;
+    };
+
 public:
     ArenaAllocator(SizeT size)
         : allocSize(size)
-        , currentTop(0)
-        , currentSize(allocSize)
     {
-        currentBlock = (uint8 *)CBEMemory::memAlloc(currentSize);
+        debugAssert(allocSize > 0);
+        currentBlock = newBlock(allocSize, CBEMemAlloc::DEFAULT_ALIGNMENT);
     }
 
+    MAKE_TYPE_NONCOPY_NONMOVE(ArenaAllocator)
+
     ~ArenaAllocator()
     {
-        for (const std::pair<SizeT, uint8 *> &dynAlloc : dynUsed)
-        {
-            CBEMemory::memFree(dynAlloc.second);
-        }
-        dynUsed.clear();
-
-        if (currentBlock)
-        {
-            CBEMemory::memFree(currentBlock);
-        }
+        freeBlocks(currentBlock);
+        freeBlocks(unusedBlocks);
+        currentBlock = unusedBlocks = nullptr;
     }
 
     void *allocate(SizeT bytesCount)
     {
-        if (currentTop + bytesCount >= currentSize)
+        if (currentTop + bytesCount > usableSize(currentBlock))
         {
-            if (currentBlock)
-            {
-                dynUsed.push_back({ currentTop, currentBlock });
-                currentBlock = nullptr;
-                currentTop = 0;
-            }
-
-            currentSize = std::max(bytesCount, allocSize);
-            currentBlock = (uint8 *)CBEMemory::memAlloc(currentSize);
+            switchToNewBlock(bytesCount, CBEMemAlloc::DEFAULT_ALIGNMENT);
         }
 
-        void *ptr = currentBlock + currentTop;
+        void *ptr = currentBlock->dataStart() + currentTop;
         currentTop += bytesCount;
         return ptr;
     }
 
+    // Only pads by the bytes needed to align current top
     void *allocateAligned(SizeT bytesPerElement, SizeT elementsCount, uint32 alignment)
     {
-        SizeT bytesCount = bytesPerElement * elementsCount;
-        // Allocating the entire alignment size, This is to preserve block's top to be always well aligned(alignment - 1, breaks it when using
-        // unaligned alloc)
-        bytesCount += alignment;
+        debugAssert(Math::isPowOf2(alignment));
+        const SizeT bytesCount = bytesPerElement * elementsCount;
 
-        void *ptr = allocate(bytesCount);
-        UPtrInt intptr = reinterpret_cast<UPtrInt>(ptr);
-        intptr = Math::alignBy(intptr, alignment);
+        UPtrInt topPtr = reinterpret_cast<UPtrInt>(currentBlock->dataStart() + currentTop);
+        SizeT padding = Math::alignByUnsafe(topPtr, alignment) - topPtr;
+        if (currentTop + padding + bytesCount > usableSize(currentBlock))
+        {
+            // New block's data start is aligned to alignment
+            switchToNewBlock(bytesCount, alignment);
+            topPtr = reinterpret_cast<UPtrInt>(currentBlock->dataStart());
+            padding = Math::alignByUnsafe(topPtr, alignment) - topPtr;
+        }
 
-        return reinterpret_cast<void *>(intptr);
+        currentTop += padding;
+        void *ptr = currentBlock->dataStart() + currentTop;
+        currentTop += bytesCount;
+        return ptr;
     }
 
     template <typename T>
@@ -89,11 +110,185 @@ public:
         return reinterpret_cast<T *>(allocateAligned(sizeof(T), count, alignof(T)));
     }
 
+    FORCE_INLINE Marker getMarker() const { return { currentBlock, currentTop }; }
+    /**
+     * Frees everything allocated after the marker was taken, Blocks used after the marker are kept for reuse.
+     * Markers taken after this marker becomes invalid.
+     */
+    void rewind(const Marker &marker)
+    {
+        debugAssert(marker.block != nullptr);
+        while (currentBlock != marker.block)
+        {
+            // Marker must be from this arena and must not be rewound past already
+            debugAssert(currentBlock->next);
+            ArenaBlock *prevBlock = currentBlock->next;
+            currentBlock->next = unusedBlocks;
+            unusedBlocks = currentBlock;
+            currentBlock = prevBlock;
+        }
+        debugAssert(marker.top <= currentTop);
+        currentTop = marker.top;
+    }
+
+    // Frees all allocations, All the blocks are kept for reuse
+    void reset()
+    {
+        // Keep the last block in used chain which is the first allocated block
+        while (currentBlock->next)
+        {
+            ArenaBlock *prevBlock = currentBlock->next;
+            currentBlock->next = unusedBlocks;
+            unusedBlocks = currentBlock;
+            currentBlock = prevBlock;
+        }
+        currentTop = 0;
+    }
+
+    // Frees the blocks that are not used right now
+    void releaseUnused()
+    {
+        freeBlocks(unusedBlocks);
+        unusedBlocks = nullptr;
+    }
+
+    // Bytes allocated after the marker, Includes the unused bytes at the end of blocks
+    SizeT bytesSince(const Marker &marker) const
+    {
+        SizeT bytesCount = currentTop;
+        for (const ArenaBlock *block = currentBlock; block != marker.block; block = block->next)
+        {
+            bytesCount += usableSize(block->next);
+        }
+        return bytesCount - marker.top;
+    }
+
+private:
+    FORCE_INLINE static SizeT usableSize(const ArenaBlock *block) { return block->size - BLOCK_HEADER_SIZE; }
+
+    ArenaBlock *newBlock(SizeT bytesCount, uint32 alignment)
+    {
+        alignment = Math::max(alignment, uint32(CBEMemAlloc::DEFAULT_ALIGNMENT));
+        // Allocating enough to align the data start even if header is not aligned by alignment
+        const SizeT blockSize = Math::max(allocSize, bytesCount + alignment) + BLOCK_HEADER_SIZE;
+        ArenaBlock *block = static_cast<ArenaBlock *>(CBEMemory::memAlloc(blockSize, alignment));
+        block->next = nullptr;
+        block->size = blockSize;
+        return block;
+    }
+
+    void switchToNewBlock(SizeT bytesCount, uint32 alignment)
+    {
+        // Try to find a free block that is large enough for this allocation
+        ArenaBlock *block = nullptr;
+        for (ArenaBlock **blockPtr = &unusedBlocks; *blockPtr != nullptr; blockPtr = &(*blockPtr)->next)
+        {
+            const UPtrInt dataStart = reinterpret_cast<UPtrInt>((*blockPtr)->dataStart());
+            const SizeT padding = Math::alignByUnsafe(dataStart, alignment) - dataStart;
+            if (padding + bytesCount <= usableSize(*blockPtr))
+            {
+                block = *blockPtr;
+                *blockPtr = block->next;
+                break;
+            }
+        }
+        if (block == nullptr)
+        {
+            block = newBlock(bytesCount, alignment);
+        }
+
+        block->next = currentBlock;
+        currentBlock = block;
+        currentTop = 0;
+    }
+
+    static void freeBlocks(ArenaBlock *block)
+    {
+        while (block)
+        {
+            ArenaBlock *nextBlock = block->next;
+            CBEMemory::memFree(block);
+            block = nextBlock;
+        }
+    }
+
 private:
     SizeT allocSize;
 
-    uint8 *currentBlock = nullptr;
+    // Chain of blocks in use, Current block is the newest and the chain goes to the oldest block
+    ArenaBlock *currentBlock = nullptr;
     SizeT currentTop = 0;
-    SizeT currentSize = 0;
-    std::list<std::pair<SizeT, uint8 *>> dynUsed;
-};
\ No newline at end of file
+    // Blocks kept for reuse after reset or rewind
+    ArenaBlock *unusedBlocks = nullptr;
+};
+
+// Rewinds the arena to the point where this marker is created when going out of scope
+class ScopedArenaMarker
+{
+private:
+    ArenaAllocator &arena;
+    ArenaAllocator::Marker marker;
+
+public:
+    ScopedArenaMarker(ArenaAllocator &inArena)
+        : arena(inArena)
+        , marker(inArena.getMarker())
+    {}
+    MAKE_TYPE_NONCOPY_NONMOVE(ScopedArenaMarker)
+    ~ScopedArenaMarker() { arena.rewind(marker); }
+};
+
+/**
+ * Per thread scratch arenas, Each thread(CoPaT workers included) gets its own arena that can be used without any locking.
+ * Scratch allocations must not outlive the job or frame that allocated it. Jobs must wrap their scratch usage inside ScopedScratch so that
+ * the memory is returned at the end of the job. Anything left is freed when the thread accesses its arena after a frame boundary.
+ */
+namespace ScratchArena
+{
+// Size of each block in thread's scratch arena
+constexpr static const SizeT SCRATCH_BLOCK_SIZE = 256 * 1024;
+
+/**
+ * Returns the calling thread's scratch arena, It gets reset if a frame boundary happened after last access and no ScopedScratch is active in
+ * this thread
+ */
+PROGRAMCORE_EXPORT ArenaAllocator &threadArena();
+// Must be called once per frame from the thread that drives the frame
+PROGRAMCORE_EXPORT void onFrameBoundary();
+
+// Internal, Tracks active scopes so that the frame reset does not free memory of an active scope
+PROGRAMCORE_EXPORT void pushScope();
+PROGRAMCORE_EXPORT void popScope();
+} // namespace ScratchArena
+
+/**
+ * Scoped scratch memory from calling thread's scratch arena, Must be created and destroyed in same thread.
+ * So it must not be alive across a co_await that might resume the coroutine in another thread.
+ */
+class ScopedScratch
+{
+private:
+    ArenaAllocator &arena;
+    ArenaAllocator::Marker marker;
+
+public:
+    ScopedScratch()
+        : arena(ScratchArena::threadArena())
+        , marker(arena.getMarker())
+    {
+        ScratchArena::pushScope();
+    }
+    MAKE_TYPE_NONCOPY_NONMOVE(ScopedScratch)
+    ~ScopedScratch()
+    {
+        arena.rewind(marker);
+        ScratchArena::popScope();
+    }
+
+    FORCE_INLINE ArenaAllocator &allocator() const { return arena; }
+    template <typename T>
+    T *allocate(SizeT count = 1)
+    {
+        return arena.allocateAligned<T>(count);
+    }
+};
@@ -52,13 +52,27 @@ FORCE_INLINE void *CBEBuiltinMemAlloc::writeAllocMeta(void *allocatedPtr, SizeT
     return outPtr;
 }
 
+#ifndef PLATFORM_ALIGNED_MALLOC
+FORCE_INLINE void CBEBuiltinMemAlloc::moveToAligned(void *allocatedPtr, SizeT oldOffset, SizeT copySize, uint32 alignment) const noexcept
+{
+    uint8 *alignedPtr = (uint8 *)(Math::alignByUnsafe((UPtrInt)(allocatedPtr) + calcHeaderPadding(alignment), alignment));
+    uint8 *oldPtr = ((uint8 *)allocatedPtr) + oldOffset;
+    if (alignedPtr != oldPtr)
+    {
+        CBEMemory::memMove(alignedPtr, oldPtr, copySize);
+    }
+}
+#endif // PLATFORM_ALIGNED_MALLOC
+
 FORCE_INLINE void *CBEBuiltinMemAlloc::getAllocationInfo(void *ptr, SizeT &outSize, uint32 &outAlignment) const noexcept
 {
     AllocHeader &allocHeader = *(((AllocHeader *)ptr) - 1);
     outSize = allocHeader.size;
     outAlignment = allocHeader.alignment;
 
-#ifndef PLATFORM_ALIGNED_MALLOC
+#if BUILTIN_MEM_MAPPED_ALLOCS
+    return ((uint8 *)ptr) - (allocHeader.offset & ~MAPPED_ALLOC_FLAG);
+#elif !defined(PLATFORM_ALIGNED_MALLOC)
     return ((uint8 *)ptr) - allocHeader.offset;
 #else  // PLATFORM_ALIGNED_MALLOC
     return ((uint8 *)ptr) - calcHeaderPadding(allocHeader.alignment);
@@ -75,6 +89,18 @@ void *CBEBuiltinMemAlloc::tryMalloc(SizeT size, uint32 alignment /*= DEFAULT_ALI
 
     alignment = uint32(Math::max(alignof(AllocHeader), adjustAlignment(size, alignment)));
     SizeT canonicalSize = size + calcExtraWidth(alignment);
+#if BUILTIN_MEM_MAPPED_ALLOCS
+    if (shouldMapAlloc(canonicalSize, alignment))
+    {
+        if (void *ptr = CBEMemory::builtinMapPages(canonicalSize))
+        {
+            void *outPtr = writeAllocMeta(ptr, size, alignment);
+            markMappedAlloc(outPtr);
+            return outPtr;
+        }
+        return nullptr;
+    }
+#endif // BUILTIN_MEM_MAPPED_ALLOCS
 #ifndef PLATFORM_ALIGNED_MALLOC
     if (void *ptr = CBEMemory::builtinMalloc(canonicalSize))
 #else  // PLATFORM_ALIGNED_MALLOC
@@ -98,25 +124,62 @@ void *CBEBuiltinMemAlloc::tryRealloc(void *currentPtr, SizeT size, uint32 alignm
 {
     debugAssert(Math::isPowOf2(alignment));
 
-    AllocHeader allocInfo;
-    void *actualPtr = getAllocationInfo(currentPtr, allocInfo.size, allocInfo.alignment);
-
     if (size == 0)
     {
-        CBEMemory::builtinFree(actualPtr);
+        memFree(currentPtr);
         return nullptr;
     }
 
+    AllocHeader allocInfo;
+    void *actualPtr = getAllocationInfo(currentPtr, allocInfo.size, allocInfo.alignment);
+    const SizeT oldOffset = (uint8 *)currentPtr - (uint8 *)actualPtr;
+
     alignment = uint32(Math::max(alignof(AllocHeader), adjustAlignment(size, alignment)));
+    SizeT canonicalSize = size + calcExtraWidth(alignment);
+
+#if BUILTIN_MEM_MAPPED_ALLOCS
+    const bool bWasMapped = isMappedAlloc(currentPtr);
+    const bool bMapNew = shouldMapAlloc(canonicalSize, alignment);
+    if (bWasMapped && bMapNew)
+    {
+        // Kernel moves the pages if it cannot grow in place, No copy happens
+        void *ptr = CBEMemory::builtinRemapPages(actualPtr, allocInfo.size + calcExtraWidth(allocInfo.alignment), canonicalSize);
+        if (ptr == nullptr)
+        {
+            return nullptr;
+        }
+        moveToAligned(ptr, oldOffset, Math::min(allocInfo.size, size), alignment);
+        void *outPtr = writeAllocMeta(ptr, size, alignment);
+        markMappedAlloc(outPtr);
+        return outPtr;
+    }
+    else if (bWasMapped || bMapNew)
+    {
+        // Moving between heap and mapped pages, Must copy
+        void *outPtr = tryMalloc(size, alignment);
+        if (outPtr == nullptr)
+        {
+            return nullptr;
+        }
+        CBEMemory::memCopy(outPtr, currentPtr, Math::min(allocInfo.size, size));
+        memFree(currentPtr);
+        return outPtr;
+    }
+#endif // BUILTIN_MEM_MAPPED_ALLOCS
 
 #ifndef PLATFORM_ALIGNED_MALLOC
-    if (void *ptr = CBEMemory::builtinRealloc(actualPtr, size + calcExtraWidth(alignment)))
+    if (void *ptr = CBEMemory::builtinRealloc(actualPtr, canonicalSize))
+    {
+        // realloc only preserves bytes from allocated ptr, Aligned offset might differ in new allocation
+        moveToAligned(ptr, oldOffset, Math::min(allocInfo.size, size), alignment);
+        return writeAllocMeta(ptr, size, alignment);
+    }
 #else  // PLATFORM_ALIGNED_MALLOC
-    if (void *ptr = CBEMemory::builtinAlignedRealloc(actualPtr, size + calcExtraWidth(alignment), alignment))
-#endif // PLATFORM_ALIGNED_MALLOC
+    if (void *ptr = CBEMemory::builtinAlignedRealloc(actualPtr, canonicalSize, alignment))
     {
         return writeAllocMeta(ptr, size, alignment);
     }
+#endif // PLATFORM_ALIGNED_MALLOC
     return nullptr;
 }
 
@@ -144,6 +207,14 @@ void CBEBuiltinMemAlloc::memFree(void *ptr) noexcept
     allocHeader.size = 0;
 
 #ifndef PLATFORM_ALIGNED_MALLOC
+#if BUILTIN_MEM_MAPPED_ALLOCS
+    if (allocHeader.offset & MAPPED_ALLOC_FLAG)
+    {
+        allocHeader.offset = 0;
+        CBEMemory::builtinUnmapPages(actualPtr, allocInfo.size + calcExtraWidth(allocInfo.alignment));
+        return;
+    }
+#endif // BUILTIN_MEM_MAPPED_ALLOCS
     allocHeader.offset = 0;
     CBEMemory::builtinFree(actualPtr);
 #else  // PLATFORM_ALIGNED_MALLOC
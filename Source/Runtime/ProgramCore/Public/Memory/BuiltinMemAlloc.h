@@ -12,6 +12,14 @@
 #pragma once
 
 #include "Memory/MemAllocator.h"
+#include "Types/Platform/PlatformMemory.h"
+
+// Large allocations are mapped directly from OS pages, Only possible when header stores offset to allocated ptr
+#if defined(PLATFORM_LARGE_ALLOC_THRESHOLD) && !defined(PLATFORM_ALIGNED_MALLOC)
+#define BUILTIN_MEM_MAPPED_ALLOCS 1
+#else
+#define BUILTIN_MEM_MAPPED_ALLOCS 0
+#endif
 
 // Not very good for small allocations, for small allocation below 32bytes do not use this as allocation
 // header data occupies above 50% of each allocation
@@ -23,10 +31,20 @@ private:
         SizeT size;
         uint32 alignment;
 #ifndef PLATFORM_ALIGNED_MALLOC
-        // Alignment offset from allocated ptr, for freeing
+        // Alignment offset from allocated ptr, for freeing. Highest bit is set if allocation is page mapped
         uint32 offset;
 #endif
     };
+#if BUILTIN_MEM_MAPPED_ALLOCS
+    static constexpr const uint32 MAPPED_ALLOC_FLAG = 0x80000000u;
+
+    FORCE_INLINE static bool isMappedAlloc(void *ptr) noexcept { return ((((AllocHeader *)ptr) - 1)->offset & MAPPED_ALLOC_FLAG) != 0; }
+    FORCE_INLINE static void markMappedAlloc(void *ptr) noexcept { (((AllocHeader *)ptr) - 1)->offset |= MAPPED_ALLOC_FLAG; }
+    FORCE_INLINE static bool shouldMapAlloc(SizeT canonicalSize, uint32 alignment) noexcept
+    {
+        return canonicalSize >= PLATFORM_LARGE_ALLOC_THRESHOLD && alignment <= PlatformMemory::pageSize();
+    }
+#endif
 
     FORCE_INLINE SizeT calcHeaderPadding(uint32 alignment) const noexcept;
     FORCE_INLINE SizeT calcExtraWidth(uint32 alignment) const noexcept;
@@ -35,6 +53,12 @@ private:
      */
     FORCE_INLINE void *writeAllocMeta(void *allocatedPtr, SizeT size, uint32 alignment) const noexcept;
     FORCE_INLINE void *getAllocationInfo(void *ptr, SizeT &outSize, uint32 &outAlignment) const noexcept;
+#ifndef PLATFORM_ALIGNED_MALLOC
+    /**
+     * Moves copySize bytes at oldOffset from allocatedPtr to the offset writeAllocMeta will use for this alignment
+     */
+    FORCE_INLINE void moveToAligned(void *allocatedPtr, SizeT oldOffset, SizeT copySize, uint32 alignment) const noexcept;
+#endif
 
 public:
     void *tryMalloc(SizeT size, uint32 alignment = DEFAULT_ALIGNMENT) noexcept final;
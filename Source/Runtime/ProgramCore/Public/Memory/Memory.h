@@ -15,6 +15,7 @@
 #include "ProgramCoreExports.h"
 #include "String/String.h"
 #include "Types/Platform/PlatformAssertionErrors.h"
+#include "Types/Platform/PlatformMemory.h"
 #include "Profiler/ProgramProfiler.hpp"
 
 template <typename MemAllocType, typename AllocatorCreatePolicy>
@@ -144,10 +145,34 @@ public:
         PLATFORM_ALIGNED_FREE(ptr);
 #else
         fatalAssert(!"Aligned free unsupported!");
-        return nullptr;
 #endif
     }
 
+#ifdef PLATFORM_LARGE_ALLOC_THRESHOLD
+    // Page mapped allocations straight from OS, Size must be same at map and unmap
+    FORCE_INLINE static void *builtinMapPages(SizeT size) noexcept
+    {
+        void *ptr = PlatformMemory::mapPages(size);
+        CBE_PROFILER_ALLOC_N(ptr, size, MAPPED_ALLOC_NAME);
+        return ptr;
+    }
+    FORCE_INLINE static void *builtinRemapPages(void *ptr, SizeT oldSize, SizeT size) noexcept
+    {
+        void *outPtr = PlatformMemory::remapPages(ptr, oldSize, size);
+        if (outPtr && outPtr != ptr)
+        {
+            CBE_PROFILER_FREE_N(ptr, MAPPED_ALLOC_NAME);
+            CBE_PROFILER_ALLOC_N(outPtr, size, MAPPED_ALLOC_NAME);
+        }
+        return outPtr;
+    }
+    FORCE_INLINE static void builtinUnmapPages(void *ptr, SizeT size) noexcept
+    {
+        CBE_PROFILER_FREE_N(ptr, MAPPED_ALLOC_NAME);
+        PlatformMemory::unmapPages(ptr, size);
+    }
+#endif // PLATFORM_LARGE_ALLOC_THRESHOLD
+
     FUNCTION_QUALIFIER static void *tryMalloc(SizeT size, uint32 alignment = CBEMemAllocWrapper::AllocType::DEFAULT_ALIGNMENT) noexcept;
     FUNCTION_QUALIFIER static void *memAlloc(SizeT size, uint32 alignment = CBEMemAllocWrapper::AllocType::DEFAULT_ALIGNMENT) noexcept;
     FUNCTION_QUALIFIER static void *
@@ -162,6 +187,9 @@ private:
 
     static constexpr const CBEProfilerChar *BUILTIN_ALLOC_NAME = CBE_PROFILER_CHAR("BuiltinMalloc");
     static constexpr const CBEProfilerChar *ALIGNED_ALLOC_NAME = CBE_PROFILER_CHAR("AlignedMalloc");
+#ifdef PLATFORM_LARGE_ALLOC_THRESHOLD
+    static constexpr const CBEProfilerChar *MAPPED_ALLOC_NAME = CBE_PROFILER_CHAR("MappedMalloc");
+#endif // PLATFORM_LARGE_ALLOC_THRESHOLD
 };
 
 #if INLINE_MEMORY_FUNCS
@@ -172,22 +200,22 @@ private:
 #undef FUNCTION_QUALIFIER
 
 #define CBE_NEW_OPERATOR(MemAllocFunc, FuncQual, FuncSpec, ...)                                                                                \
-    NODISCARD FuncQual void *operator new (size_t size, __VA_ARGS__) FuncSpec { return MemAllocFunc((SizeT)size); }                            \
-    NODISCARD FuncQual void *operator new[] (size_t size, __VA_ARGS__) FuncSpec { return MemAllocFunc((SizeT)size); }                          \
-    NODISCARD FuncQual void *operator new (size_t size, std::align_val_t alignment, __VA_ARGS__) FuncSpec                                      \
+    NODISCARD FuncQual void *operator new (size_t size __VA_OPT__(, ) __VA_ARGS__) FuncSpec { return MemAllocFunc((SizeT)size); }              \
+    NODISCARD FuncQual void *operator new[] (size_t size __VA_OPT__(, ) __VA_ARGS__) FuncSpec { return MemAllocFunc((SizeT)size); }            \
+    NODISCARD FuncQual void *operator new (size_t size, std::align_val_t alignment __VA_OPT__(, ) __VA_ARGS__) FuncSpec                        \
     {                                                                                                                                          \
         return MemAllocFunc((SizeT)size, (uint32)alignment);                                                                                   \
     }                                                                                                                                          \
-    NODISCARD FuncQual void *operator new[] (size_t size, std::align_val_t alignment, __VA_ARGS__) FuncSpec                                    \
+    NODISCARD FuncQual void *operator new[] (size_t size, std::align_val_t alignment __VA_OPT__(, ) __VA_ARGS__) FuncSpec                      \
     {                                                                                                                                          \
         return MemAllocFunc((SizeT)size, (uint32)alignment);                                                                                   \
     }
 
 #define CBE_DELETE_OPERATOR(MemFreeFunc, FuncQual, ...)                                                                                        \
-    FuncQual void operator delete (void *ptr, __VA_ARGS__) noexcept { MemFreeFunc(ptr); }                                                      \
-    FuncQual void operator delete[] (void *ptr, __VA_ARGS__) noexcept { MemFreeFunc(ptr); }                                                    \
-    FuncQual void operator delete (void *ptr, std::align_val_t, __VA_ARGS__) noexcept { MemFreeFunc(ptr); }                                    \
-    FuncQual void operator delete[] (void *ptr, std::align_val_t, __VA_ARGS__) noexcept { MemFreeFunc(ptr); }
+    FuncQual void operator delete (void *ptr __VA_OPT__(, ) __VA_ARGS__) noexcept { MemFreeFunc(ptr); }                                        \
+    FuncQual void operator delete[] (void *ptr __VA_OPT__(, ) __VA_ARGS__) noexcept { MemFreeFunc(ptr); }                                      \
+    FuncQual void operator delete (void *ptr, std::align_val_t __VA_OPT__(, ) __VA_ARGS__) noexcept { MemFreeFunc(ptr); }                      \
+    FuncQual void operator delete[] (void *ptr, std::align_val_t __VA_OPT__(, ) __VA_ARGS__) noexcept { MemFreeFunc(ptr); }
 
 #define CBE_NOALLOC_PLACEMENT_NEW_OPERATOR(...)                                                                                                \
     NODISCARD __VA_ARGS__ void *operator new (size_t /*count*/, void *allocatedPtr) noexcept { return allocatedPtr; }                          \
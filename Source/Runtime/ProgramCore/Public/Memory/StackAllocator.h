@@ -17,6 +17,7 @@
 #include "Memory/Memory.h"
 #include "Types/Platform/Threading/SyncPrimitives.h"
 
+#include <mutex>
 #include <shared_mutex>
 
 /**
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "Types/CoreTypes.h"
+#include "Types/Templates/TemplateTypes.h"
 
 #ifdef USE_TRACY_PROFILER
 
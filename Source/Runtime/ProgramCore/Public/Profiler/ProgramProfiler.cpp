@@ -106,17 +106,17 @@ static_assert(
 
 #define CBE_PROFILER_ALLOC_internal(ptr, size)
 #define CBE_PROFILER_ALLOC_N_internal(ptr, size, name)
-#define CBE_PROFILER_FREE_internal(ptr, size)
-#define CBE_PROFILER_FREE_N_internal(ptr, size, name)
+#define CBE_PROFILER_FREE_internal(ptr)
+#define CBE_PROFILER_FREE_N_internal(ptr, name)
 
 #define CBE_PROFILER_ENTERFIBER_internal(Text)
 #define CBE_PROFILER_LEAVEFIBER_internal()
 
-#define CBE_PROFILER_ALLOCATE_SRC_LOC(FuncName, FileName, Line, Colour)
-#define CBE_PROFILER_ALLOCATE_SRC_LOC_N(Name, FuncName, FileName, Line, Colour)
+#define CBE_PROFILER_ALLOCATE_SRC_LOC(FuncName, FileName, Line, Colour) {}
+#define CBE_PROFILER_ALLOCATE_SRC_LOC_N(Name, FuncName, FileName, Line, Colour) {}
 
-#define CBE_PROFILER_BEGIN_STATIC_SCOPE(SrcLoc, Active)
-#define CBE_PROFILER_BEGIN_TRANSIENT_SCOPE(SrcLoc, Active)
+#define CBE_PROFILER_BEGIN_STATIC_SCOPE(SrcLoc, Active) {}
+#define CBE_PROFILER_BEGIN_TRANSIENT_SCOPE(SrcLoc, Active) {}
 #define CBE_PROFILER_END_SCOPE(Ctx)
 
 #define CBE_PROFILER_SCOPE_SETTEXT(Ctx, Text)
@@ -280,20 +280,22 @@ public:
 #define CBE_PROFILER_ALLOC(Ptr, Size)
 #define CBE_PROFILER_ALLOC_N(Ptr, Size, Name)
 #define CBE_PROFILER_FREE(Ptr, Size)
-#define CBE_PROFILER_FREE_N(Ptr, Size, Name)
+#define CBE_PROFILER_FREE_N(Ptr, Name)
 
 #define CBE_PROFILER_ENTERFIBER(Text)
 #define CBE_PROFILER_LEAVEFIBER()
 #define CBE_PROFILER_SCOPE_FIBER(Text)
 
-// Below are for Persistent scopes
-#define CBE_PROFILER_SCOPE_VAR_FULL(VarName, Name, ControlVar, Text, Colour, Value)
-#define CBE_PROFILER_SCOPE_VAR_TC(VarName, Name, ControlVar, Text, Colour)
-#define CBE_PROFILER_SCOPE_VAR_C(VarName, Name, ControlVar, Colour)
-#define CBE_PROFILER_SCOPE_VAR(VarName, Name, ControlVar)
+// Below are for Persistent scopes, Declares an empty variable as CBE_PROFILER_SCOPE_DYN* prefixes these with static constexpr
+#define CBE_PROFILER_SCOPE_VAR_FULL(VarName, Name, ControlVar, Text, Colour, Value) NullType VarName {}
+#define CBE_PROFILER_SCOPE_VAR_VC(VarName, Name, ControlVar, Colour, Value) NullType VarName {}
+#define CBE_PROFILER_SCOPE_VAR_TC(VarName, Name, ControlVar, Text, Colour) NullType VarName {}
+#define CBE_PROFILER_SCOPE_VAR_C(VarName, Name, ControlVar, Colour) NullType VarName {}
+#define CBE_PROFILER_SCOPE_VAR(VarName, Name, ControlVar) NullType VarName {}
 
 // Below are Transient variant of scopes
 #define CBE_PROFILER_TSCOPE_VAR_FULL(VarName, Name, ControlVar, Text, Colour, Value)
+#define CBE_PROFILER_TSCOPE_VAR_VC(VarName, Name, ControlVar, Colour, Value)
 #define CBE_PROFILER_TSCOPE_VAR_TC(VarName, Name, ControlVar, Text, Colour)
 #define CBE_PROFILER_TSCOPE_VAR_C(VarName, Name, ControlVar, Colour)
 #define CBE_PROFILER_TSCOPE_VAR(VarName, Name, ControlVar)
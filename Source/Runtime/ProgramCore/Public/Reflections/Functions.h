@@ -19,6 +19,7 @@
 #if USE_STDFUNC_FOR_LAMDA
 #include <functional>
 #else
+#include <cstring>
 #include <type_traits>
 #endif
 
@@ -170,18 +170,72 @@ public:
     virtual ArchiveBase &serialize(String &) = 0;
     virtual ArchiveBase &serialize(TChar *) = 0;
 
+    /**
+     * Serializes componentCount contiguous components of componentSize bytes each as a single block.
+     * Returns false if this archive cannot serialize raw blocks, In which case caller must fallback to serializing each element
+     */
+    virtual bool serializeBlock(void * /*data*/, SizeT /*componentSize*/, SizeT /*componentCount*/) { return false; }
+
 private:
     void serializeArchiveMeta();
 };
 
 #undef SERIALIZE_VIRTUAL
 
+/**
+ * Types whose serialized bytes are same as their in memory bytes, except for the endianness of each ComponentType.
+ * Contiguous arrays of such types are serialized as one block instead of per element.
+ * Specialize this for POD types whose memory layout matches the serialized layout exactly(No padding).
+ */
+template <typename Type>
+struct ArchiveBulkSerializable : public std::false_type
+{
+    using ComponentType = Type;
+};
+
+#define BULK_SERIALIZABLE_CORE_TYPE(TypeName)                                                                                                  \
+    template <>                                                                                                                                \
+    struct ArchiveBulkSerializable<TypeName> : public std::true_type                                                                           \
+    {                                                                                                                                          \
+        using ComponentType = TypeName;                                                                                                        \
+    };
+FOR_EACH_CORE_TYPES(BULK_SERIALIZABLE_CORE_TYPE)
+#undef BULK_SERIALIZABLE_CORE_TYPE
+
+template <typename Type>
+concept ArchiveBulkSerializableType = ArchiveBulkSerializable<std::remove_cv_t<Type>>::value && std::is_trivially_copyable_v<Type>;
+
+/**
+ * Tries to serialize count elements starting at data as one block, Returns false if archive needs per element serialization
+ */
+template <ArchiveBulkSerializableType ValueType>
+FORCE_INLINE bool serializeArchiveBlock(ArchiveBase &archive, ValueType *data, SizeT count)
+{
+    using ComponentType = typename ArchiveBulkSerializable<ValueType>::ComponentType;
+    static_assert(sizeof(ValueType) % sizeof(ComponentType) == 0, "Bulk serializable type must be made of components without padding");
+
+    return count == 0 || archive.serializeBlock(data, sizeof(ComponentType), count * (sizeof(ValueType) / sizeof(ComponentType)));
+}
+
 template <ArchiveTypeName ArchiveType, typename ValueType>
 ArchiveType &operator<< (ArchiveType &archive, ValueType &value)
 {
     return static_cast<ArchiveType &>(archive.serialize(value));
 }
 
+/**
+ * SizeT is not uint64 in every platform(unsigned long in LP64 Linux), Serialize it as uint64 to keep the archive layout same across platforms
+ */
+template <ArchiveTypeName ArchiveType>
+requires (!std::same_as<SizeT, uint64>)
+ArchiveType &operator<< (ArchiveType &archive, SizeT &value)
+{
+    uint64 value64 = uint64(value);
+    archive.serialize(value64);
+    value = SizeT(value64);
+    return archive;
+}
+
 template <ArchiveTypeName ArchiveType, typename KeyType, typename ValueType>
 ArchiveType &operator<< (ArchiveType &archive, std::pair<KeyType, ValueType> &value)
 {
@@ -198,6 +252,14 @@ ArchiveType &operator<< (ArchiveType &archive, std::vector<ValueType, AllocType>
         value.resize(len);
     }
 
+    // std::vector<bool> is not contiguous
+    if constexpr (ArchiveBulkSerializableType<ValueType> && !std::same_as<ValueType, bool>)
+    {
+        if (serializeArchiveBlock(archive, value.data(), len))
+        {
+            return archive;
+        }
+    }
     for (SizeT i = 0; i < len; ++i)
     {
         archive << value[i];
@@ -212,7 +274,12 @@ ArchiveType &operator<< (ArchiveType &archive, ArrayRange<ValueType> &value)
     archive << len;
 
     SizeT serializeCount = Math::min(len, value.size());
-    for (SizeT i = 0; i < serializeCount; ++i)
+    bool bSerializedAsBlock = false;
+    if constexpr (ArchiveBulkSerializableType<ValueType>)
+    {
+        bSerializedAsBlock = serializeArchiveBlock(archive, value.data(), serializeCount);
+    }
+    for (SizeT i = 0; !bSerializedAsBlock && i < serializeCount; ++i)
     {
         archive << value[i];
     }
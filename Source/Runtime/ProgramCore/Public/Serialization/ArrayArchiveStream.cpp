@@ -74,3 +74,39 @@ uint8 ArrayArchiveStream::readBackwardAt(SizeT idx) const
 bool ArrayArchiveStream::hasMoreData(SizeT requiredByteCount) const { return isAvailable() && (cursor + requiredByteCount) <= buffer.size(); }
 
 uint64 ArrayArchiveStream::cursorPos() const { return cursor; }
+
+void ArrayViewArchiveStream::read(void *toPtr, SizeT byteLen)
+{
+    if (hasMoreData(byteLen))
+    {
+        CBEMemory::memCopy(toPtr, bufferView.data() + cursor, byteLen);
+    }
+    cursor = Math::min(cursor + byteLen, bufferView.size());
+}
+
+void ArrayViewArchiveStream::moveForward(SizeT byteCount) { cursor = Math::min(cursor + byteCount, bufferView.size()); }
+
+void ArrayViewArchiveStream::moveBackward(SizeT byteCount) { cursor = Math::max((int64)cursor - (int64)byteCount, 0); }
+
+uint8 ArrayViewArchiveStream::readForwardAt(SizeT idx) const
+{
+    if (bufferView.size() <= (cursor + idx))
+    {
+        return 0;
+    }
+    return bufferView[cursor + idx];
+}
+
+uint8 ArrayViewArchiveStream::readBackwardAt(SizeT idx) const
+{
+    if (cursor < idx)
+    {
+        return 0;
+    }
+    return bufferView[cursor - idx];
+}
+
+bool ArrayViewArchiveStream::hasMoreData(SizeT requiredByteCount) const
+{
+    return isAvailable() && (cursor + requiredByteCount) <= bufferView.size();
+}
\ No newline at end of file
@@ -37,4 +37,40 @@ public:
 
     void setBuffer(const std::vector<uint8> &inBuffer) { buffer = inBuffer; }
     const std::vector<uint8> &getBuffer() const { return buffer; }
+};
+
+/**
+ * Read only stream over borrowed bytes. Used to read the same buffer from several threads each with its own cursor
+ */
+class PROGRAMCORE_EXPORT ArrayViewArchiveStream : public ArchiveStream
+{
+private:
+    ArrayView<uint8> bufferView;
+    SizeT cursor = 0;
+
+public:
+    ArrayViewArchiveStream() = default;
+    ArrayViewArchiveStream(ArrayView<uint8> inBufferView)
+        : bufferView(inBufferView)
+    {}
+
+    /* ArrayArchiveStream overrides */
+    void read(void *toPtr, SizeT byteLen) override;
+    // Writing is not supported by view stream
+    void write(const void *, SizeT) override {}
+    void moveForward(SizeT byteCount) override;
+    void moveBackward(SizeT byteCount) override;
+    bool allocate(SizeT) override { return false; }
+    uint8 readForwardAt(SizeT idx) const override;
+    uint8 readBackwardAt(SizeT idx) const override;
+    uint64 cursorPos() const override { return cursor; }
+    bool isAvailable() const override { return bufferView.data() != nullptr; }
+    bool hasMoreData(SizeT requiredByteCount) const override;
+    /* Overrides ends */
+
+    void setBufferView(ArrayView<uint8> inBufferView)
+    {
+        bufferView = inBufferView;
+        cursor = 0;
+    }
 };
\ No newline at end of file
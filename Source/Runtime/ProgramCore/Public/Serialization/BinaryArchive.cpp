@@ -115,13 +115,107 @@ FORCE_INLINE void serializeBytesOrdered(Type &data, BinaryArchive &archive)
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// Block serialization
+//////////////////////////////////////////////////////////////////////////
+
+// Simple shift and mask swaps over arrays, Compilers turn these loops into vector byte shuffles
+template <typename UIntType>
+FORCE_INLINE void bytesSwapBlock(UIntType *data, SizeT count)
+{
+    for (SizeT i = 0; i < count; ++i)
+    {
+        UIntType value = data[i];
+        if constexpr (sizeof(UIntType) == 2)
+        {
+            value = UIntType((value << 8) | (value >> 8));
+        }
+        else if constexpr (sizeof(UIntType) == 4)
+        {
+            value = ((value >> 8) & 0x00FF00FFu) | ((value << 8) & 0xFF00FF00u);
+            value = (value >> 16) | (value << 16);
+        }
+        else
+        {
+            value = ((value >> 8) & 0x00FF00FF00FF00FFull) | ((value << 8) & 0xFF00FF00FF00FF00ull);
+            value = ((value >> 16) & 0x0000FFFF0000FFFFull) | ((value << 16) & 0xFFFF0000FFFF0000ull);
+            value = (value >> 32) | (value << 32);
+        }
+        data[i] = value;
+    }
+}
+
+FORCE_INLINE void bytesSwapBlock(void *data, SizeT componentSize, SizeT componentCount)
+{
+    switch (componentSize)
+    {
+    case 1:
+        break;
+    case 2:
+        bytesSwapBlock(reinterpret_cast<uint16 *>(data), componentCount);
+        break;
+    case 4:
+        bytesSwapBlock(reinterpret_cast<uint32 *>(data), componentCount);
+        break;
+    case 8:
+        bytesSwapBlock(reinterpret_cast<uint64 *>(data), componentCount);
+        break;
+    default:
+    {
+        uint8 *bytePtr = reinterpret_cast<uint8 *>(data);
+        for (SizeT i = 0; i < componentCount; ++i)
+        {
+            FileHelper::bytesSwap(bytePtr + i * componentSize, componentSize);
+        }
+        break;
+    }
+    }
+}
+
+bool BinaryArchive::serializeBlock(void *data, SizeT componentSize, SizeT componentCount)
+{
+    const SizeT byteLen = componentSize * componentCount;
+    if (isLoading())
+    {
+        stream()->read(data, byteLen);
+        if (ifSwapBytes())
+        {
+            bytesSwapBlock(data, componentSize, componentCount);
+        }
+        return true;
+    }
+
+    if (!ifSwapBytes() || componentSize == 1)
+    {
+        stream()->write(data, byteLen);
+        return true;
+    }
+
+    // Source must not be modified when writing, So swap chunks in a stack buffer and write them
+    alignas(16) uint8 swapBuffer[4096];
+    if (componentSize > ARRAY_LENGTH(swapBuffer))
+    {
+        return false;
+    }
+    const SizeT chunkComponents = ARRAY_LENGTH(swapBuffer) / componentSize;
+    const uint8 *srcPtr = reinterpret_cast<const uint8 *>(data);
+    for (SizeT componentIdx = 0; componentIdx < componentCount; componentIdx += chunkComponents)
+    {
+        const SizeT count = Math::min(chunkComponents, componentCount - componentIdx);
+        CBEMemory::memCopy(swapBuffer, srcPtr + componentIdx * componentSize, count * componentSize);
+        bytesSwapBlock(swapBuffer, componentSize, count);
+        stream()->write(swapBuffer, count * componentSize);
+    }
+    return true;
+}
+
 ArchiveBase &BinaryArchive::serialize(TChar *value)
 {
     // Up to 512 bytes in stack
     uint8 buffer[512];
     std::pmr::monotonic_buffer_resource memRes(buffer, ARRAY_LENGTH(buffer));
 
-    SizeT len;
+    uint64 len;
     // We always serialize as utf8
     if (isLoading())
     {
@@ -150,7 +244,7 @@ ArchiveBase &BinaryArchive::serialize(String &value)
     uint8 buffer[512];
     std::pmr::monotonic_buffer_resource memRes(buffer, ARRAY_LENGTH(buffer));
 
-    SizeT len;
+    uint64 len;
     // We always serialize as utf8s
     if (isLoading())
     {
@@ -31,5 +31,6 @@ public:
     ArchiveBase &serialize(uint8 &value) override;
     ArchiveBase &serialize(String &value) override;
     ArchiveBase &serialize(TChar *value) override;
+    bool serializeBlock(void *data, SizeT componentSize, SizeT componentCount) override;
     /* Overrides ends */
 };
\ No newline at end of file
@@ -19,6 +19,30 @@
 #include "String/StringID.h"
 #include "String/NameString.h"
 
+// Vectors are serialized component by component in memory order, So contiguous vectors can be bulk serialized
+template <glm::length_t Count, typename ElementType, glm::qualifier Qualifier>
+struct ArchiveBulkSerializable<glm::vec<Count, ElementType, Qualifier>>
+    : public std::bool_constant<
+          ArchiveBulkSerializable<ElementType>::value && sizeof(glm::vec<Count, ElementType, Qualifier>) == Count * sizeof(ElementType)>
+{
+    using ComponentType = ElementType;
+};
+template <>
+struct ArchiveBulkSerializable<Vector2> : public std::bool_constant<sizeof(Vector2) == 2 * sizeof(float)>
+{
+    using ComponentType = float;
+};
+template <>
+struct ArchiveBulkSerializable<Vector3> : public std::bool_constant<sizeof(Vector3) == 3 * sizeof(float)>
+{
+    using ComponentType = float;
+};
+template <>
+struct ArchiveBulkSerializable<Vector4> : public std::bool_constant<sizeof(Vector4) == 4 * sizeof(float)>
+{
+    using ComponentType = float;
+};
+
 // serialize glm types
 struct SerializeGlmVec
 {
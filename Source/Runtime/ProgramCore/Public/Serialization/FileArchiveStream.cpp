@@ -11,6 +11,7 @@
 
 #include "Serialization/FileArchiveStream.h"
 #include "Types/Platform/LFS/PlatformLFS.h"
+#include "Memory/Memory.h"
 
 FileArchiveStream::FileArchiveStream(const String &filePath, bool bReading)
     : file(new PlatformFile(filePath))
@@ -140,3 +141,317 @@ bool FileArchiveStream::hasMoreData(SizeT requiredByteCount) const
 {
     return isAvailable() && (fileCursor + requiredByteCount) <= file->fileSize();
 }
+
+//////////////////////////////////////////////////////////////////////////
+/// BufferedFileArchiveStream implementation
+//////////////////////////////////////////////////////////////////////////
+
+BufferedFileArchiveStream::BufferedFileArchiveStream(
+    const String &filePath, bool bReading, SizeT bufferSize /*= DEFAULT_BUFFER_SIZE*/
+)
+    : file(new PlatformFile(filePath))
+    , bufferStart(0)
+    , bufferFilled(0)
+    , fileCursor(0)
+    , fileSizeCache(0)
+    , bIsReadOnly(bReading)
+    , bIsOpened(false)
+{
+    buffer.resize(Math::max(bufferSize, 1));
+
+    file->setFileFlags(EFileFlags::Read | (bReading ? 0 : EFileFlags::Write));
+    file->setCreationAction(bReading ? EFileFlags::OpenExisting : EFileFlags::CreateAlways);
+    file->setSharingMode(EFileSharing::ReadOnly);
+    if (file->isFile())
+    {
+        bIsOpened = file->openOrCreate();
+    }
+    if (bIsOpened)
+    {
+        fileSizeCache = file->fileSize();
+    }
+}
+
+BufferedFileArchiveStream::~BufferedFileArchiveStream()
+{
+    flushWrites();
+    file->closeFile();
+    delete file;
+    file = nullptr;
+}
+
+void BufferedFileArchiveStream::read(void *toPtr, SizeT byteLen)
+{
+    if (!hasMoreData(byteLen))
+    {
+        fileCursor = Math::min(fileCursor + byteLen, logicalSize());
+        return;
+    }
+
+    if (bIsReadOnly && isInReadWindow(fileCursor, byteLen))
+    {
+        CBEMemory::memCopy(toPtr, buffer.data() + (fileCursor - bufferStart), byteLen);
+    }
+    else if (bIsReadOnly && byteLen < buffer.size())
+    {
+        fillReadWindow(fileCursor);
+        CBEMemory::memCopy(toPtr, buffer.data(), byteLen);
+    }
+    else
+    {
+        // Large reads skip the buffer, Writer must flush so that the file has the latest data
+        flushWrites();
+        file->seek(fileCursor);
+        file->read(reinterpret_cast<uint8 *>(toPtr), uint32(byteLen));
+    }
+    fileCursor += byteLen;
+}
+
+void BufferedFileArchiveStream::write(const void *ptr, SizeT byteLen)
+{
+    if (bIsReadOnly)
+    {
+        return;
+    }
+
+    // Pending writes must be contiguous, Any write that does not append to it or does not fit starts a new pending range
+    if (fileCursor != (bufferStart + bufferFilled) || (bufferFilled + byteLen) > buffer.size())
+    {
+        flushWrites();
+        bufferStart = fileCursor;
+    }
+
+    if (byteLen >= buffer.size())
+    {
+        file->seek(fileCursor);
+        file->write({ reinterpret_cast<const uint8 *>(ptr), byteLen });
+        fileSizeCache = Math::max(fileSizeCache, fileCursor + byteLen);
+        bufferStart = fileCursor + byteLen;
+    }
+    else
+    {
+        CBEMemory::memCopy(buffer.data() + bufferFilled, ptr, byteLen);
+        bufferFilled += byteLen;
+    }
+    fileCursor += byteLen;
+}
+
+void BufferedFileArchiveStream::moveForward(SizeT byteCount)
+{
+    if (byteCount == 0)
+    {
+        return;
+    }
+
+    fileCursor += byteCount;
+    if (logicalSize() < fileCursor)
+    {
+        if (bIsReadOnly)
+        {
+            fileCursor = fileSizeCache;
+        }
+        else
+        {
+            flushWrites();
+            file->setFileSize(fileCursor);
+            fileSizeCache = file->fileSize();
+            fileCursor = fileSizeCache;
+        }
+    }
+}
+
+void BufferedFileArchiveStream::moveBackward(SizeT byteCount)
+{
+    fileCursor = (uint64)Math::max(0, (int64)(fileCursor) - (int64)(byteCount));
+}
+
+bool BufferedFileArchiveStream::allocate(SizeT byteCount)
+{
+    if (bIsReadOnly)
+    {
+        return false;
+    }
+
+    flushWrites();
+    if (file->setFileSize(fileSizeCache + byteCount))
+    {
+        fileSizeCache += byteCount;
+        return true;
+    }
+    return false;
+}
+
+uint8 BufferedFileArchiveStream::readForwardAt(SizeT idx) const
+{
+    const uint64 offset = fileCursor + idx;
+    if (logicalSize() <= offset)
+    {
+        return 0;
+    }
+
+    if (bIsReadOnly)
+    {
+        if (!isInReadWindow(offset, 1))
+        {
+            // Peeks are mostly sequential forward so window starts at the peeked byte
+            fillReadWindow(offset);
+        }
+        return buffer[offset - bufferStart];
+    }
+
+    if (offset >= bufferStart && offset < (bufferStart + bufferFilled))
+    {
+        return buffer[offset - bufferStart];
+    }
+    uint8 outVal = 0;
+    file->seek(offset);
+    file->read(&outVal, 1);
+    return outVal;
+}
+
+uint8 BufferedFileArchiveStream::readBackwardAt(SizeT idx) const
+{
+    if (fileCursor < idx || logicalSize() <= (fileCursor - idx))
+    {
+        return 0;
+    }
+
+    const uint64 offset = fileCursor - idx;
+    if (bIsReadOnly)
+    {
+        if (!isInReadWindow(offset, 1))
+        {
+            // Peeking backward so window ends at the peeked byte
+            const uint64 windowSize = Math::min(uint64(buffer.size()), offset + 1);
+            fillReadWindow(offset + 1 - windowSize);
+        }
+        return buffer[offset - bufferStart];
+    }
+
+    if (offset >= bufferStart && offset < (bufferStart + bufferFilled))
+    {
+        return buffer[offset - bufferStart];
+    }
+    uint8 outVal = 0;
+    file->seek(offset);
+    file->read(&outVal, 1);
+    return outVal;
+}
+
+uint64 BufferedFileArchiveStream::cursorPos() const { return fileCursor; }
+
+bool BufferedFileArchiveStream::isAvailable() const { return bIsOpened; }
+
+bool BufferedFileArchiveStream::hasMoreData(SizeT requiredByteCount) const
+{
+    return isAvailable() && (fileCursor + requiredByteCount) <= logicalSize();
+}
+
+void BufferedFileArchiveStream::flush()
+{
+    flushWrites();
+    file->flush();
+}
+
+void BufferedFileArchiveStream::fillReadWindow(uint64 fromOffset) const
+{
+    debugAssert(bIsReadOnly && fromOffset <= fileSizeCache);
+
+    bufferStart = fromOffset;
+    bufferFilled = SizeT(Math::min(uint64(buffer.size()), fileSizeCache - fromOffset));
+    file->seek(fromOffset);
+    file->read(buffer.data(), uint32(bufferFilled));
+}
+
+void BufferedFileArchiveStream::flushWrites() const
+{
+    if (bIsReadOnly || bufferFilled == 0)
+    {
+        return;
+    }
+
+    file->seek(bufferStart);
+    file->write({ buffer.data(), bufferFilled });
+    fileSizeCache = Math::max(fileSizeCache, bufferStart + bufferFilled);
+    bufferStart += bufferFilled;
+    bufferFilled = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// MappedFileArchiveStream implementation
+//////////////////////////////////////////////////////////////////////////
+
+MappedFileArchiveStream::MappedFileArchiveStream(const String &filePath)
+    : file(new PlatformFile(filePath))
+    , mapping(nullptr)
+    , mappedData(nullptr)
+    , mappedSize(0)
+    , cursor(0)
+    , bIsOpened(false)
+{
+    file->setFileFlags(EFileFlags::Read);
+    file->setCreationAction(EFileFlags::OpenExisting);
+    file->setSharingMode(EFileSharing::ReadOnly);
+    if (file->isFile() && file->openOrCreate())
+    {
+        mappedSize = file->fileSize();
+        mappedData = file->mapReadOnly(mapping);
+        // Empty file is still a valid stream with no data
+        bIsOpened = mappedData != nullptr || mappedSize == 0;
+        if (!bIsOpened)
+        {
+            mappedSize = 0;
+        }
+    }
+}
+
+MappedFileArchiveStream::~MappedFileArchiveStream()
+{
+    file->unmapView(mappedData, mapping);
+    mappedData = nullptr;
+    mapping = nullptr;
+
+    file->closeFile();
+    delete file;
+    file = nullptr;
+}
+
+void MappedFileArchiveStream::read(void *toPtr, SizeT byteLen)
+{
+    if (hasMoreData(byteLen))
+    {
+        CBEMemory::memCopy(toPtr, mappedData + cursor, byteLen);
+        cursor += byteLen;
+    }
+    else
+    {
+        cursor = Math::min(cursor + byteLen, mappedSize);
+    }
+}
+
+void MappedFileArchiveStream::moveForward(SizeT byteCount) { cursor = Math::min(cursor + byteCount, mappedSize); }
+
+void MappedFileArchiveStream::moveBackward(SizeT byteCount) { cursor = (uint64)Math::max(0, (int64)(cursor) - (int64)(byteCount)); }
+
+uint8 MappedFileArchiveStream::readForwardAt(SizeT idx) const
+{
+    if (mappedSize <= cursor + idx)
+    {
+        return 0;
+    }
+    return mappedData[cursor + idx];
+}
+
+uint8 MappedFileArchiveStream::readBackwardAt(SizeT idx) const
+{
+    if (cursor < idx || mappedSize <= (cursor - idx))
+    {
+        return 0;
+    }
+    return mappedData[cursor - idx];
+}
+
+bool MappedFileArchiveStream::hasMoreData(SizeT requiredByteCount) const
+{
+    return isAvailable() && (cursor + requiredByteCount) <= mappedSize;
+}
@@ -12,6 +12,8 @@
 #pragma once
 
 #include "Serialization/ArchiveBase.h"
+#include "Math/Math.h"
+#include "Types/Platform/PlatformTypes.h"
 
 class GenericFile;
 
@@ -39,4 +41,96 @@ public:
     bool isAvailable() const override;
     bool hasMoreData(SizeT requiredByteCount) const override;
     /* Overrides ends */
-};
\ No newline at end of file
+};
+
+/**
+ * Reads and writes through an intermediate buffer so that small reads, Peeks from readForwardAt/readBackwardAt and small writes do not
+ * become a file system call each. Buffer is either a read window or a pending write range depending on bReading.
+ */
+class PROGRAMCORE_EXPORT BufferedFileArchiveStream : public ArchiveStream
+{
+public:
+    constexpr static const SizeT DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+private:
+    GenericFile *file;
+    // Read window or pending write bytes, Mutable since peeking refills the read window
+    mutable std::vector<uint8> buffer;
+    // File offset of buffer[0]
+    mutable uint64 bufferStart;
+    // Number of valid bytes in buffer
+    mutable SizeT bufferFilled;
+    uint64 fileCursor;
+    // Cached to avoid querying file system for every bounds check
+    mutable uint64 fileSizeCache;
+    bool bIsReadOnly;
+    bool bIsOpened;
+
+public:
+    BufferedFileArchiveStream(const String &filePath, bool bReading, SizeT bufferSize = DEFAULT_BUFFER_SIZE);
+    ~BufferedFileArchiveStream();
+
+    /* ArchiveStream overrides */
+    void read(void *toPtr, SizeT byteLen) override;
+    void write(const void *ptr, SizeT byteLen) override;
+    void moveForward(SizeT byteCount) override;
+    void moveBackward(SizeT byteCount) override;
+    bool allocate(SizeT byteCount) override;
+    uint8 readForwardAt(SizeT idx) const override;
+    uint8 readBackwardAt(SizeT idx) const override;
+    uint64 cursorPos() const override;
+    bool isAvailable() const override;
+    bool hasMoreData(SizeT requiredByteCount) const override;
+    /* Overrides ends */
+
+    // Writes pending bytes to the file
+    void flush();
+
+private:
+    // Fills read window starting at fromOffset
+    void fillReadWindow(uint64 fromOffset) const;
+    void flushWrites() const;
+    // Size including the pending writes
+    FORCE_INLINE uint64 logicalSize() const { return bIsReadOnly ? fileSizeCache : Math::max(fileSizeCache, bufferStart + bufferFilled); }
+    FORCE_INLINE bool isInReadWindow(uint64 offset, SizeT byteLen) const
+    {
+        return offset >= bufferStart && (offset + byteLen) <= (bufferStart + bufferFilled);
+    }
+};
+
+/**
+ * Read only stream backed by a read only mapping of the entire file. Reads and peeks are plain memory accesses and paging is left to OS.
+ */
+class PROGRAMCORE_EXPORT MappedFileArchiveStream : public ArchiveStream
+{
+private:
+    GenericFile *file;
+    PlatformHandle mapping;
+    const uint8 *mappedData;
+    uint64 mappedSize;
+    uint64 cursor;
+    bool bIsOpened;
+
+public:
+    MappedFileArchiveStream(const String &filePath);
+    ~MappedFileArchiveStream();
+
+    /* ArchiveStream overrides */
+    void read(void *toPtr, SizeT byteLen) override;
+    // Writing is not supported by mapped stream
+    void write(const void *, SizeT) override {}
+    void moveForward(SizeT byteCount) override;
+    void moveBackward(SizeT byteCount) override;
+    bool allocate(SizeT) override { return false; }
+    uint8 readForwardAt(SizeT idx) const override;
+    uint8 readBackwardAt(SizeT idx) const override;
+    uint64 cursorPos() const override { return cursor; }
+    bool isAvailable() const override { return bIsOpened; }
+    bool hasMoreData(SizeT requiredByteCount) const override;
+    /* Overrides ends */
+
+    // Direct view to data at current cursor, nullptr if nothing is mapped
+    const uint8 *dataAtCursor() const { return mappedData ? mappedData + cursor : nullptr; }
+    // View of entire mapped file, Can be read from any thread while this stream is alive
+    ArrayView<uint8> mappedView() const { return mappedData ? ArrayView<uint8>(mappedData, mappedSize) : ArrayView<uint8>(); }
+};
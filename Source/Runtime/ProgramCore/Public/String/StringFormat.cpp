@@ -131,7 +131,7 @@ MustacheFormatArg &MustacheFormatArg::operator= (const MustacheFormatArg &arg) n
     return *this;
 }
 
-#define FORMAT_FUNDAMENTALS(VarName) STR_FORMAT("{}", value.fundamentalVals.##VarName)
+#define FORMAT_FUNDAMENTALS(VarName) STR_FORMAT("{}", value.fundamentalVals.VarName)
 String MustacheFormatArg::toString() const noexcept
 {
     switch (type)
@@ -14,37 +14,255 @@
 #if ENABLE_STRID_DEBUG
 
 #include "Logger/Logger.h"
+#include "Math/Math.h"
 #include "Memory/BuiltinMemAlloc.h"
+#include "Memory/Memory.h"
+#include "Types/Platform/Threading/SyncPrimitives.h"
 
-#include <unordered_map>
-#include <unordered_set>
-#include <shared_mutex>
+#include <atomic>
+#include <mutex>
 
-// Using built in malloc as CBEMemory::memAlloc sometimes causing error on exit
-using DebugStringsType = std::basic_string<TChar, std::char_traits<TChar>, CBEStlMallocAllocator<TChar>>;
-using DebugStringsMapValueType = std::unordered_set<
-    DebugStringsType, std::hash<DebugStringsType>, std::equal_to<DebugStringsType>, CBEStlMallocAllocator<DebugStringsType>>;
-using DebugStringsMap = std::unordered_map<
-    StringID::IDType, DebugStringsMapValueType, std::hash<StringID::IDType>, std::equal_to<StringID::IDType>,
-    CBEStlMallocAllocator<std::pair<const StringID::IDType, DebugStringsMapValueType>>>;
+/**
+ * Debug strings are stored in sharded open addressing tables keyed by the id. Lookups and the check for already registered strings do not
+ * take any lock, Only inserting a new id or string takes the shard's lock.
+ * Tables are never shrunk, On growing the old table is retired but kept alive until exit so that lock free readers can still read from it.
+ * Strings are copied once into an append only arena per shard.
+ */
+
+constexpr static const uint32 STRID_DEBUG_SHARD_BITS = 6;
+constexpr static const uint32 STRID_DEBUG_SHARD_COUNT = 1 << STRID_DEBUG_SHARD_BITS;
+constexpr static const uint32 STRID_DEBUG_INITIAL_SLOTS = 256;
+constexpr static const SizeT STRID_DEBUG_ARENA_BLOCK_SIZE = 64 * 1024;
+
+// Ids are hash values so the lower bits are good enough to distribute between shards
+FORCE_INLINE uint32 debugStringShardIdx(StringID::IDType strId) { return strId & (STRID_DEBUG_SHARD_COUNT - 1); }
+
+struct DebugStringEntry
+{
+    // Different strings that resulted in same id, Appended only under shard's lock
+    std::atomic<const DebugStringEntry *> nextOverlap{ nullptr };
+    uint32 length;
+
+    // Null terminated characters follows the entry
+    const TChar *getChar() const { return reinterpret_cast<const TChar *>(this + 1); }
+    StringView view() const { return { getChar(), length }; }
+};
+
+struct DebugStringsSlot
+{
+    // 0 if slot is empty, Written after entry is written
+    std::atomic<StringID::IDType> id{ 0 };
+    std::atomic<const DebugStringEntry *> entry{ nullptr };
+};
+
+struct DebugStringsTable
+{
+    // Always power of 2
+    uint32 capacity;
+    uint32 count;
+    // Smaller table this table replaced
+    DebugStringsTable *retired;
+
+    DebugStringsSlot *slots() { return reinterpret_cast<DebugStringsSlot *>(this + 1); }
+    const DebugStringsSlot *slots() const { return reinterpret_cast<const DebugStringsSlot *>(this + 1); }
+
+    const DebugStringsSlot *findSlot(StringID::IDType strId) const
+    {
+        const uint32 slotMask = capacity - 1;
+        // Table is never full so there will always be an empty slot to stop probing
+        for (uint32 slotIdx = (strId >> STRID_DEBUG_SHARD_BITS) & slotMask;; slotIdx = (slotIdx + 1) & slotMask)
+        {
+            const StringID::IDType slotId = slots()[slotIdx].id.load(std::memory_order::acquire);
+            if (slotId == strId)
+            {
+                return &slots()[slotIdx];
+            }
+            if (slotId == 0)
+            {
+                return nullptr;
+            }
+        }
+    }
+};
+
+struct alignas(CACHELINE_SIZE) DebugStringsShard
+{
+    std::atomic<DebugStringsTable *> table{ nullptr };
+    CBESpinLock lock;
+
+    // Current arena block, Each block's first bytes points to the previous block
+    uint8 *arenaBlock = nullptr;
+    SizeT arenaOffset = 0;
+    SizeT arenaSize = 0;
+
+    static const DebugStringEntry *findString(const DebugStringsSlot *slot, StringView str)
+    {
+        for (const DebugStringEntry *entry = slot->entry.load(std::memory_order::acquire); entry != nullptr;
+             entry = entry->nextOverlap.load(std::memory_order::acquire))
+        {
+            if (entry->view() == str)
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    // Below functions must be called with lock held
+    DebugStringEntry *allocEntry(CBEBuiltinMemAlloc &allocator, StringView str);
+    DebugStringsTable *allocTable(CBEBuiltinMemAlloc &allocator, uint32 capacity);
+    void insert(CBEBuiltinMemAlloc &allocator, StringID::IDType strId, StringView str);
+
+    void release(CBEBuiltinMemAlloc &allocator);
+};
+
+DebugStringEntry *DebugStringsShard::allocEntry(CBEBuiltinMemAlloc &allocator, StringView str)
+{
+    const SizeT entrySize = Math::alignByUnsafe(sizeof(DebugStringEntry) + (str.length() + 1) * sizeof(TChar), alignof(DebugStringEntry));
+    if (arenaOffset + entrySize > arenaSize)
+    {
+        // Strings larger than a block gets its own block
+        const SizeT blockSize = Math::max(STRID_DEBUG_ARENA_BLOCK_SIZE, entrySize + sizeof(uint8 *));
+        uint8 *newBlock = static_cast<uint8 *>(allocator.memAlloc(blockSize, alignof(DebugStringEntry)));
+        *reinterpret_cast<uint8 **>(newBlock) = arenaBlock;
+        arenaBlock = newBlock;
+        arenaOffset = Math::alignByUnsafe(sizeof(uint8 *), alignof(DebugStringEntry));
+        arenaSize = blockSize;
+    }
+
+    DebugStringEntry *entry = new (arenaBlock + arenaOffset) DebugStringEntry();
+    arenaOffset += entrySize;
+
+    entry->length = uint32(str.length());
+    TChar *chars = reinterpret_cast<TChar *>(entry + 1);
+    CBEMemory::memCopy(chars, str.data(), str.length() * sizeof(TChar));
+    chars[str.length()] = TCHAR('\0');
+    return entry;
+}
+
+DebugStringsTable *DebugStringsShard::allocTable(CBEBuiltinMemAlloc &allocator, uint32 capacity)
+{
+    DebugStringsTable *newTable = static_cast<DebugStringsTable *>(
+        allocator.memAlloc(sizeof(DebugStringsTable) + capacity * sizeof(DebugStringsSlot), alignof(DebugStringsSlot))
+    );
+    newTable->capacity = capacity;
+    newTable->count = 0;
+    newTable->retired = nullptr;
+    for (uint32 i = 0; i < capacity; ++i)
+    {
+        new (newTable->slots() + i) DebugStringsSlot();
+    }
+    return newTable;
+}
+
+void DebugStringsShard::insert(CBEBuiltinMemAlloc &allocator, StringID::IDType strId, StringView str)
+{
+    DebugStringsTable *currTable = table.load(std::memory_order::relaxed);
+    if (currTable == nullptr)
+    {
+        currTable = allocTable(allocator, STRID_DEBUG_INITIAL_SLOTS);
+        table.store(currTable, std::memory_order::release);
+    }
+
+    // Another thread might have inserted after the lock free check
+    if (DebugStringsSlot *slot = const_cast<DebugStringsSlot *>(currTable->findSlot(strId)))
+    {
+        if (findString(slot, str))
+        {
+            return;
+        }
+        // Collision, Append the new string at end of overlaps
+        DebugStringEntry *entry = allocEntry(allocator, str);
+        const DebugStringEntry *lastEntry = slot->entry.load(std::memory_order::relaxed);
+        while (const DebugStringEntry *nextEntry = lastEntry->nextOverlap.load(std::memory_order::relaxed))
+        {
+            lastEntry = nextEntry;
+        }
+        const_cast<DebugStringEntry *>(lastEntry)->nextOverlap.store(entry, std::memory_order::release);
+        return;
+    }
+
+    // Keeping the load factor under 3/4
+    if ((currTable->count + 1) * 4 > currTable->capacity * 3)
+    {
+        DebugStringsTable *newTable = allocTable(allocator, currTable->capacity * 2);
+        const uint32 newSlotMask = newTable->capacity - 1;
+        for (uint32 i = 0; i < currTable->capacity; ++i)
+        {
+            const DebugStringsSlot &oldSlot = currTable->slots()[i];
+            const StringID::IDType oldId = oldSlot.id.load(std::memory_order::relaxed);
+            if (oldId == 0)
+            {
+                continue;
+            }
+            uint32 slotIdx = (oldId >> STRID_DEBUG_SHARD_BITS) & newSlotMask;
+            while (newTable->slots()[slotIdx].id.load(std::memory_order::relaxed) != 0)
+            {
+                slotIdx = (slotIdx + 1) & newSlotMask;
+            }
+            newTable->slots()[slotIdx].entry.store(oldSlot.entry.load(std::memory_order::relaxed), std::memory_order::relaxed);
+            newTable->slots()[slotIdx].id.store(oldId, std::memory_order::relaxed);
+        }
+        newTable->count = currTable->count;
+        newTable->retired = currTable;
+        // Publishes all the slots above
+        table.store(newTable, std::memory_order::release);
+        currTable = newTable;
+    }
+
+    const uint32 slotMask = currTable->capacity - 1;
+    uint32 slotIdx = (strId >> STRID_DEBUG_SHARD_BITS) & slotMask;
+    while (currTable->slots()[slotIdx].id.load(std::memory_order::relaxed) != 0)
+    {
+        slotIdx = (slotIdx + 1) & slotMask;
+    }
+    DebugStringsSlot &slot = currTable->slots()[slotIdx];
+    slot.entry.store(allocEntry(allocator, str), std::memory_order::relaxed);
+    // Readers seeing the id must see the entry
+    slot.id.store(strId, std::memory_order::release);
+    currTable->count++;
+}
+
+void DebugStringsShard::release(CBEBuiltinMemAlloc &allocator)
+{
+    DebugStringsTable *currTable = table.exchange(nullptr, std::memory_order::acq_rel);
+    while (currTable)
+    {
+        DebugStringsTable *retiredTable = currTable->retired;
+        allocator.memFree(currTable);
+        currTable = retiredTable;
+    }
+    while (arenaBlock)
+    {
+        uint8 *prevBlock = *reinterpret_cast<uint8 **>(arenaBlock);
+        allocator.memFree(arenaBlock);
+        arenaBlock = prevBlock;
+    }
+    arenaOffset = arenaSize = 0;
+}
 
 struct DebugStringIDsData
 {
-    std::shared_mutex lock;
-    DebugStringsMap stringsDb;
+    // Using built in malloc as CBEMemory::memAlloc sometimes causing error on exit
+    CBEBuiltinMemAlloc allocator;
+    DebugStringsShard shards[STRID_DEBUG_SHARD_COUNT];
 
-    // Holds pointer to debugStringsDB which will be used by debug to visualize string
-    static DebugStringsMap *debugStrings;
+    // Holds pointer to shards which will be used by debug to visualize string
+    static DebugStringsShard *debugStrings;
 
-    DebugStringIDsData() { debugStrings = &stringsDb; }
+    DebugStringIDsData() { debugStrings = shards; }
     MAKE_TYPE_NONCOPY_NONMOVE(DebugStringIDsData)
     ~DebugStringIDsData()
     {
-        std::unique_lock<std::shared_mutex> writeLock{ lock };
         debugStrings = nullptr;
+        for (DebugStringsShard &shard : shards)
+        {
+            std::scoped_lock<CBESpinLock> writeLock{ shard.lock };
+            shard.release(allocator);
+        }
     }
 };
-DebugStringsMap *DebugStringIDsData::debugStrings = nullptr;
+DebugStringsShard *DebugStringIDsData::debugStrings = nullptr;
 
 DebugStringIDsData &debugStringDB()
 {
@@ -54,31 +272,50 @@ DebugStringIDsData &debugStringDB()
 
 const TChar *StringID::findDebugString(IDType strId)
 {
-    DebugStringIDsData &stringsDbData = debugStringDB();
-
-    std::shared_lock<std::shared_mutex> readLock{ stringsDbData.lock };
-    auto itr = stringsDbData.stringsDb.find(strId);
-    if (itr == stringsDbData.stringsDb.cend())
+    const DebugStringsTable *table
+        = debugStringDB().shards[debugStringShardIdx(strId)].table.load(std::memory_order::acquire);
+    const DebugStringsSlot *slot = table ? table->findSlot(strId) : nullptr;
+    if (slot == nullptr)
     {
         return nullptr;
     }
-    if (itr->second.size() > 1)
+
+    const DebugStringEntry *entry = slot->entry.load(std::memory_order::acquire);
+    if (entry->nextOverlap.load(std::memory_order::acquire))
     {
-        LOG("StringID", "StringID {} has overlaps with values {}", strId, itr->second);
+        String overlaps;
+        for (const DebugStringEntry *overlap = entry; overlap != nullptr; overlap = overlap->nextOverlap.load(std::memory_order::acquire))
+        {
+            overlaps.append(overlaps.empty() ? TCHAR("") : TCHAR(", "));
+            overlaps.append(overlap->view());
+        }
+        LOG("StringID", "StringID {} has overlaps with values [{}]", strId, overlaps);
     }
-    return itr->second.cbegin()->c_str();
+    return entry->getChar();
 }
 
 void StringID::insertDbgStr(StringView str) noexcept
 {
-    if (str.empty())
+    // 0 is used as empty slot
+    if (str.empty() || id == 0)
     {
         return;
     }
     DebugStringIDsData &stringsDbData = debugStringDB();
+    DebugStringsShard &shard = stringsDbData.shards[debugStringShardIdx(id)];
+
+    // Fast path, Most of the StringIDs are created from already registered strings
+    if (const DebugStringsTable *table = shard.table.load(std::memory_order::acquire))
+    {
+        const DebugStringsSlot *slot = table->findSlot(id);
+        if (slot && DebugStringsShard::findString(slot, str))
+        {
+            return;
+        }
+    }
 
-    std::unique_lock<std::shared_mutex> writeLock{ stringsDbData.lock };
-    stringsDbData.stringsDb[id].insert(DebugStringsType{ str });
+    std::scoped_lock<CBESpinLock> writeLock{ shard.lock };
+    shard.insert(stringsDbData.allocator, id, str);
 }
 
 #endif // DEV_BUILD
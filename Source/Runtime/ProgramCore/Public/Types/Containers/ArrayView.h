@@ -13,6 +13,8 @@
 
 #include "Math/Math.h"
 
+#include <initializer_list>
+
 template <typename ElemType>
 class ArrayView;
 template <typename ElemType>
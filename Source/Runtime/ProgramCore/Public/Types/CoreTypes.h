@@ -14,7 +14,7 @@
 #if PLATFORM_WINDOWS
 #include "WindowsCoreTypes.h"
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+#include "LinuxCoreTypes.h"
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
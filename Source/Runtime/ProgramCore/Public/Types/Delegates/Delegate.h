@@ -76,7 +76,7 @@ struct FunctionExecutor
     template <typename ReturnType, typename FunctionType, typename ObjectType, typename... Params>
     ReturnType execute(const FunctionType &function, ObjectType *object, Params... params) const
     {
-        return ExeHelper<FunctionType, ReturnType, Params...>{}.execute<ObjectType>(
+        return ExeHelper<FunctionType, ReturnType, Params...>{}.template execute<ObjectType>(
             object, function, std::forward<Params>(params)..., varStore, IndexSeq{}
         );
     }
@@ -123,7 +123,7 @@ public:
     ReturnType invoke(Params... params) const override
     {
         // Has to send full Params variadic types as l-value references are getting lost
-        return executor.execute<ReturnType, FunctionPtr, decltype(delegateData.objectPtr), Params...>(
+        return executor.template execute<ReturnType, FunctionPtr, decltype(delegateData.objectPtr), Params...>(
             delegateData.functionPtr, delegateData.objectPtr, std::forward<Params>(params)...
         );
     }
@@ -179,7 +179,7 @@ public:
     ReturnType invoke(Params... params) const override
     {
         // Has to send full Params variadic types as l-value references are getting lost
-        return executor.execute<ReturnType, FunctionPtr, decltype(delegateData.objectPtr), Params...>(
+        return executor.template execute<ReturnType, FunctionPtr, decltype(delegateData.objectPtr), Params...>(
             delegateData.functionPtr, delegateData.objectPtr, std::forward<Params>(params)...
         );
     }
@@ -241,7 +241,7 @@ private:
     ReturnType invoke(Params... params) const override
     {
         // Has to send full Params variadic types as l-value references are getting lost
-        return executor.execute<ReturnType, FunctionPtr, Params...>(fPtr, params...);
+        return executor.template execute<ReturnType, FunctionPtr, Params...>(fPtr, params...);
     }
 
 private:
@@ -281,7 +281,7 @@ private:
     ReturnType invoke(Params... params) const override
     {
         // Has to send full Params variadic types as l-value references are getting lost
-        return executor.execute<ReturnType, FunctionPtr, Params...>(fPtr, params...);
+        return executor.template execute<ReturnType, FunctionPtr, Params...>(fPtr, params...);
     }
 
 private:
@@ -349,7 +349,7 @@ public:
     void bindLambda(LambdaType &&lambda, Variables... vars)
     {
         delegatePtr.reset(new LambdaDelegateType<Variables...>(
-            LambdaDelegateType<Variables...>::FunctionPtr(std::forward<LambdaType &&>(lambda)), std::forward<Variables>(vars)...
+            typename LambdaDelegateType<Variables...>::FunctionPtr(std::forward<LambdaType &&>(lambda)), std::forward<Variables>(vars)...
         ));
     }
 
@@ -517,7 +517,7 @@ public:
     {
         DelegateHandle handle;
         handle.value = (int32)allDelegates.get(new LambdaDelegateType<Variables...>(
-            LambdaDelegateType<Variables...>::FunctionPtr(std::forward<LambdaType>(lambda)), std::forward<Variables>(vars)...
+            typename LambdaDelegateType<Variables...>::FunctionPtr(std::forward<LambdaType>(lambda)), std::forward<Variables>(vars)...
         ));
         return handle;
     }
@@ -625,7 +625,7 @@ public:
 
     void invoke(Params... params) const
     {
-        invokeHelper<StorageContainer::SparsityPolicy, Params...>(allDelegates, std::forward<Params>(params)...);
+        invokeHelper<typename StorageContainer::SparsityPolicy, Params...>(allDelegates, std::forward<Params>(params)...);
     }
     void operator() (Params... params) const { invoke(std::forward<Params>(params)...); }
 };
@@ -651,7 +651,7 @@ private:
 
     void invoke(Params... params) const
     {
-        invokeHelper<StorageContainer::SparsityPolicy, Params...>(allDelegates, std::forward<Params>(params)...);
+        invokeHelper<typename StorageContainer::SparsityPolicy, Params...>(allDelegates, std::forward<Params>(params)...);
     }
 
 public:
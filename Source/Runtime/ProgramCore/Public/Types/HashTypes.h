@@ -16,6 +16,7 @@
 #include "Types/CompilerDefines.h"
 #include "Types/Templates/TypeTraits.h"
 
+#include <cmath>
 #include <functional>
 
 template <class T>
@@ -105,7 +106,12 @@ struct std::hash<std::pair<FirstType, SecondType>>
     }
 };
 
-// For Transparent hash containers, equality and comparer.
+/**
+ * For Transparent hash containers, equality and comparer.
+ * libstdc++ and libc++ already specialize hash for pointers and libstdc++ does the same for less and greater, Those cannot be redefined so
+ * heterogeneous pointer lookups are only available with MSVC's standard library
+ */
+#if !defined(__GLIBCXX__) && !defined(_LIBCPP_VERSION)
 template <typename PtrType>
 struct std::hash<PtrType *>
 {
@@ -114,6 +120,8 @@ struct std::hash<PtrType *>
 
     NODISCARD size_t operator() (ConstPtr const &ptr) const noexcept { return HashUtility::hash(ptr); }
 };
+#endif
+
 template <typename PtrType>
 struct std::equal_to<PtrType *>
 {
@@ -124,6 +132,7 @@ struct std::equal_to<PtrType *>
     NODISCARD constexpr bool operator() (UPtrInt lhs, ConstPtr const &rhs) const { return reinterpret_cast<ConstPtr>(lhs) == rhs; }
     NODISCARD constexpr bool operator() (ConstPtr const &lhs, UPtrInt rhs) const { return lhs == reinterpret_cast<ConstPtr>(rhs); }
 };
+#ifndef __GLIBCXX__
 template <typename PtrType>
 struct std::less<PtrType *>
 {
@@ -143,4 +152,5 @@ struct std::greater<PtrType *>
     NODISCARD constexpr bool operator() (ConstPtr const &lhs, ConstPtr const &rhs) const { return lhs > rhs; }
     NODISCARD constexpr bool operator() (UPtrInt lhs, ConstPtr const &rhs) const { return reinterpret_cast<ConstPtr>(lhs) > rhs; }
     NODISCARD constexpr bool operator() (ConstPtr const &lhs, UPtrInt rhs) const { return lhs > reinterpret_cast<ConstPtr>(rhs); }
-};
\ No newline at end of file
+};
+#endif // __GLIBCXX__
\ No newline at end of file
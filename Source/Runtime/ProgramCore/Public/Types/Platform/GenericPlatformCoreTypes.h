@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstddef>
+
 class GenericPlatformCoreTypes
 {
 public:
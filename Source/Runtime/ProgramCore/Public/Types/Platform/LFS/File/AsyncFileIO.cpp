@@ -0,0 +1,366 @@
+/*!
+ * \file AsyncFileIO.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "Types/Platform/LFS/File/AsyncFileIO.h"
+#include "Logger/Logger.h"
+#include "Types/Platform/LFS/File/GenericFile.h"
+#include "Types/Platform/LFS/PlatformLFS.h"
+#include "Types/Platform/Threading/CoPaT/DispatchHelpers.h"
+
+#if PLATFORM_LINUX
+#include "LFS/LinuxIoUring.h"
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+copat::JobSystemWorkerThreadTask blockingFileIOTask(copat::JobSystem &jobSystem, copat::EJobPriority jobPriority, AsyncFileRequest *request)
+{
+    AsyncFileIO::executeBlocking(*request);
+    request->completion->onRequestDone();
+    co_return;
+}
+
+void submitBlocking(copat::JobSystem &jobSystem, copat::EJobPriority jobPriority, AsyncFileRequest *request)
+{
+    copat::fireAndForget(&blockingFileIOTask, jobSystem, jobPriority, request);
+}
+} // namespace
+
+#if PLATFORM_LINUX
+
+/**
+ * Requests from any thread are pushed to a lock free list. The pump running in IOThread drains it into ring, submits all of them in one
+ * enter and waits for completions. Pump exits once nothing is in flight, Next submit starts it again.
+ * An eventfd read is kept in ring to wake up the pump from waiting, if new requests are pushed while it waits for completions.
+ */
+class IoUringFileIO
+{
+private:
+    using IOPumpTask = copat::JobSystemEnqTask<copat::EJobThreadType::IOThread, copat::EJobPriority::Priority_Critical>;
+
+    enum ERingState : uint32
+    {
+        NotInitialized,
+        Ready,
+        Failed
+    };
+
+    constexpr static const uint32 RING_ENTRIES = 256;
+    // No request will be at address 0
+    constexpr static const uint64 WAKE_USER_DATA = 0;
+
+    std::atomic<uint32> ringState{ ERingState::NotInitialized };
+    std::atomic<AsyncFileRequest *> submittedHead{ nullptr };
+    std::atomic_flag bPumpActive;
+    int32 wakeFd = -1;
+
+    /* Accessed only inside pump */
+    LinuxIoUring ring;
+    // Requests that are drained but not yet in ring, In FIFO order
+    AsyncFileRequest *pendingHead = nullptr;
+    AsyncFileRequest *pendingTail = nullptr;
+    uint32 inflightCount = 0;
+    uint64 wakeValue = 0;
+    bool bWakeArmed = false;
+    // Wake read failed with EAGAIN, It is armed again only after a request completes so that pump does not spin on it
+    bool bWakeDeferred = false;
+
+public:
+    // Must be blocking, io_uring completes reads of non blocking files with EAGAIN immediately in some kernels instead of waiting.
+    // Only ring reads it and writes never block unless counter reaches its max
+    IoUringFileIO() { wakeFd = ::eventfd(0, EFD_CLOEXEC); }
+    ~IoUringFileIO()
+    {
+        ring.release();
+        if (wakeFd >= 0)
+        {
+            ::close(wakeFd);
+        }
+    }
+
+    bool canSubmit(copat::JobSystem &jobSystem) const
+    {
+        return wakeFd >= 0 && ringState.load(std::memory_order::acquire) != ERingState::Failed
+               && jobSystem.enqToThreadType(copat::EJobThreadType::IOThread) == copat::EJobThreadType::IOThread;
+    }
+
+    void submit(ArrayRange<AsyncFileRequest> requests, copat::JobSystem &jobSystem) noexcept
+    {
+        // Linked in reverse so that whole list reversed in pump will be in submission order
+        AsyncFileRequest *first = requests.data();
+        AsyncFileRequest *last = first + (requests.size() - 1);
+        for (AsyncFileRequest *request = last; request != first; --request)
+        {
+            request->pNext = request - 1;
+        }
+
+        // Requests must not be accessed after pushing as they can get completed anytime after that
+        first->pNext = submittedHead.load(std::memory_order::relaxed);
+        while (!submittedHead.compare_exchange_weak(first->pNext, last, std::memory_order::release, std::memory_order::relaxed))
+        {}
+
+        if (!bPumpActive.test_and_set(std::memory_order::acq_rel))
+        {
+            copat::fireAndForget(&IoUringFileIO::pumpTask, jobSystem, this);
+        }
+        else
+        {
+            // Pump might be waiting for completions
+            const uint64 wakeInc = 1;
+            [[maybe_unused]] const ssize_t written = ::write(wakeFd, &wakeInc, sizeof(uint64));
+        }
+    }
+
+private:
+    static IOPumpTask pumpTask(copat::JobSystem &jobSystem, IoUringFileIO *fileIO) noexcept
+    {
+        fileIO->pump(jobSystem);
+        co_return;
+    }
+
+    void pump(copat::JobSystem &jobSystem) noexcept
+    {
+        if (ringState.load(std::memory_order::relaxed) == ERingState::NotInitialized)
+        {
+            ringState.store(ring.initialize(RING_ENTRIES) ? ERingState::Ready : ERingState::Failed, std::memory_order::release);
+        }
+
+        while (true)
+        {
+            drainSubmitted();
+            if (ringState.load(std::memory_order::relaxed) == ERingState::Failed)
+            {
+                failoverPending(jobSystem);
+            }
+            else
+            {
+                fillRing();
+            }
+
+            if (inflightCount == 0 && pendingHead == nullptr)
+            {
+                bPumpActive.clear(std::memory_order::release);
+                // Requests pushed after last drain would have seen pump as active and did not start a new pump
+                if (submittedHead.load(std::memory_order::acquire) == nullptr || bPumpActive.test_and_set(std::memory_order::acq_rel))
+                {
+                    break;
+                }
+                continue;
+            }
+
+            const bool bEntered = ring.submitAndWait(1);
+            // In flight requests are owned by kernel now, There is no way to complete their awaiters
+            fatalAssertf(bEntered, "io_uring enter failed with {} requests in flight", inflightCount);
+            ring.forEachCompletion(
+                [this](const io_uring_cqe &cqe)
+                {
+                    onCompletion(cqe);
+                }
+            );
+        }
+    }
+
+    void drainSubmitted() noexcept
+    {
+        AsyncFileRequest *submitted = submittedHead.exchange(nullptr, std::memory_order::acquire);
+        if (submitted == nullptr)
+        {
+            return;
+        }
+        // Pushed list is in LIFO order
+        AsyncFileRequest *reversed = nullptr;
+        AsyncFileRequest *reversedTail = submitted;
+        while (submitted)
+        {
+            AsyncFileRequest *next = submitted->pNext;
+            submitted->pNext = reversed;
+            reversed = submitted;
+            submitted = next;
+        }
+        if (pendingTail)
+        {
+            pendingTail->pNext = reversed;
+        }
+        else
+        {
+            pendingHead = reversed;
+        }
+        pendingTail = reversedTail;
+    }
+
+    void pushFrontPending(AsyncFileRequest *request) noexcept
+    {
+        request->pNext = pendingHead;
+        pendingHead = request;
+        if (pendingTail == nullptr)
+        {
+            pendingTail = request;
+        }
+    }
+
+    AsyncFileRequest *popPending() noexcept
+    {
+        AsyncFileRequest *request = pendingHead;
+        pendingHead = request->pNext;
+        if (pendingHead == nullptr)
+        {
+            pendingTail = nullptr;
+        }
+        request->pNext = nullptr;
+        return request;
+    }
+
+    void failoverPending(copat::JobSystem &jobSystem) noexcept
+    {
+        while (pendingHead)
+        {
+            AsyncFileRequest *request = popPending();
+            submitBlocking(jobSystem, request->completion->jobPriority, request);
+        }
+    }
+
+    void fillRing() noexcept
+    {
+        if (!bWakeArmed && !bWakeDeferred)
+        {
+            if (io_uring_sqe *sqe = ring.getSqe())
+            {
+                sqe->opcode = IORING_OP_READ;
+                sqe->fd = wakeFd;
+                sqe->addr = UPtrInt(&wakeValue);
+                sqe->len = sizeof(uint64);
+                sqe->user_data = WAKE_USER_DATA;
+                bWakeArmed = true;
+            }
+        }
+
+        // One slot is always left for wake read, Completion queue is twice the size so it never overflows
+        while (pendingHead && inflightCount + 1 < ring.capacity())
+        {
+            io_uring_sqe *sqe = ring.getSqe();
+            if (sqe == nullptr)
+            {
+                break;
+            }
+
+            AsyncFileRequest *request = popPending();
+            const int32 fd = static_cast<const LFS::PlatformFile *>(request->file)->getFd();
+            sqe->opcode = request->op == EAsyncFileOp::Read ? IORING_OP_READ : IORING_OP_WRITE;
+            sqe->fd = fd;
+            sqe->off = request->offset + request->bytesTransferred;
+            sqe->addr = UPtrInt(request->buffer + request->bytesTransferred);
+            sqe->len = request->bytesToTransfer - request->bytesTransferred;
+            sqe->user_data = UPtrInt(request);
+            ++inflightCount;
+        }
+    }
+
+    void onCompletion(const io_uring_cqe &cqe) noexcept
+    {
+        if (cqe.user_data == WAKE_USER_DATA)
+        {
+            bWakeArmed = false;
+            bWakeDeferred = cqe.res == -EAGAIN;
+            return;
+        }
+
+        AsyncFileRequest *request = (AsyncFileRequest *)(cqe.user_data);
+        --inflightCount;
+        bWakeDeferred = false;
+        if (cqe.res > 0)
+        {
+            request->bytesTransferred += uint32(cqe.res);
+            // Short transfer, Remaining is requested again. Reads at end of file completes with 0 in next try
+            if (request->bytesTransferred < request->bytesToTransfer)
+            {
+                pushFrontPending(request);
+                return;
+            }
+        }
+        else if (cqe.res == -EINTR || cqe.res == -EAGAIN)
+        {
+            pushFrontPending(request);
+            return;
+        }
+        else if (cqe.res < 0)
+        {
+            request->errorCode = -cqe.res;
+            LOG_ERROR(
+                "AsyncFileIO", "Async {} failed for file {} at {}, errno {}",
+                (request->op == EAsyncFileOp::Read ? TCHAR("read") : TCHAR("write")), request->file->getFullPath().getChar(),
+                request->offset + request->bytesTransferred, request->errorCode
+            );
+        }
+        request->completion->onRequestDone();
+    }
+};
+
+IoUringFileIO &getIoUringFileIO()
+{
+    static IoUringFileIO ioUringFileIO;
+    return ioUringFileIO;
+}
+
+#endif // PLATFORM_LINUX
+
+void AsyncFileIO::submit(ArrayRange<AsyncFileRequest> requests, AsyncFileCompletion &completion) noexcept
+{
+    debugAssert(completion.jobSystem && completion.awaitingCoro);
+    if (requests.empty())
+    {
+        completion.jobSystem->enqueueJob(completion.awaitingCoro, completion.resumeInThread, completion.jobPriority);
+        return;
+    }
+
+    copat::JobSystem &jobSystem = *completion.jobSystem;
+    const copat::EJobPriority jobPriority = completion.jobPriority;
+    completion.pendingCount.store(uint32(requests.size()), std::memory_order::relaxed);
+    for (AsyncFileRequest &request : requests)
+    {
+        request.completion = &completion;
+        request.pNext = nullptr;
+        request.bytesTransferred = 0;
+        request.errorCode = 0;
+    }
+
+#if PLATFORM_LINUX
+    IoUringFileIO &ioUringFileIO = getIoUringFileIO();
+    if (ioUringFileIO.canSubmit(jobSystem))
+    {
+        ioUringFileIO.submit(requests, jobSystem);
+        return;
+    }
+#endif // PLATFORM_LINUX
+
+    // Completion and any request must not be touched once last request is submitted
+    AsyncFileRequest *request = requests.data();
+    AsyncFileRequest *requestsEnd = request + requests.size();
+    for (; request != requestsEnd; ++request)
+    {
+        submitBlocking(jobSystem, jobPriority, request);
+    }
+}
+
+void AsyncFileIO::executeBlocking(AsyncFileRequest &request) noexcept
+{
+    if (request.op == EAsyncFileOp::Read)
+    {
+        request.bytesTransferred = request.file->readAt(request.buffer, request.bytesToTransfer, request.offset, &request.errorCode);
+    }
+    else
+    {
+        request.bytesTransferred = request.file->writeAt({ request.buffer, request.bytesToTransfer }, request.offset, &request.errorCode);
+    }
+}
@@ -0,0 +1,202 @@
+/*!
+ * \file AsyncFileIO.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "ProgramCoreExports.h"
+#include "Types/Containers/ArrayView.h"
+#include "Types/CoreTypes.h"
+#include "Types/Platform/Threading/CoPaT/JobSystem.h"
+#include "Types/Platform/Threading/CoPaT/JobSystemCoroutine.h"
+
+#include <atomic>
+
+class GenericFile;
+struct AsyncFileCompletion;
+
+namespace EAsyncFileOp
+{
+enum Type : uint8
+{
+    Read,
+    Write
+};
+} // namespace EAsyncFileOp
+
+/**
+ * Single read or write at an offset of an opened file. Must stay alive and in same address until it is completed
+ */
+struct AsyncFileRequest
+{
+    const GenericFile *file = nullptr;
+    uint8 *buffer = nullptr;
+    uint64 offset = 0;
+    uint32 bytesToTransfer = 0;
+    EAsyncFileOp::Type op = EAsyncFileOp::Read;
+
+    // Valid once completed, Less than bytesToTransfer if read reached end of file or failed
+    uint32 bytesTransferred = 0;
+    // Platform error code of the failure, 0 if succeeded
+    int32 errorCode = 0;
+
+    /* Used by AsyncFileIO while the request is in flight */
+    AsyncFileCompletion *completion = nullptr;
+    AsyncFileRequest *pNext = nullptr;
+};
+
+/**
+ * Resumes the awaiting coroutine in its job system once all the requests submitted with this are completed
+ */
+struct AsyncFileCompletion
+{
+    std::atomic<uint32> pendingCount{ 0 };
+    std::coroutine_handle<> awaitingCoro;
+    copat::JobSystem *jobSystem = nullptr;
+    copat::EJobThreadType resumeInThread = copat::EJobThreadType::WorkerThreads;
+    copat::EJobPriority jobPriority = copat::EJobPriority::Priority_Normal;
+
+    template <typename PromiseType>
+    void setAwaitingCoro(std::coroutine_handle<PromiseType> coro) noexcept
+    {
+        awaitingCoro = coro;
+        if CONST_EXPR (copat::JobSystemPromiseType<PromiseType>)
+        {
+            jobSystem = coro.promise().enqToJobSystem;
+            jobPriority = coro.promise().jobPriority;
+        }
+        if (jobSystem == nullptr)
+        {
+            jobSystem = copat::JobSystem::get();
+        }
+        resumeInThread = jobSystem->getCurrentThreadType();
+        // Awaited from a thread that is not part of the job system
+        if (resumeInThread == copat::EJobThreadType::MaxThreads)
+        {
+            resumeInThread = copat::EJobThreadType::WorkerThreads;
+        }
+    }
+
+    /**
+     * Must be the last access to request or completion from the finishing thread, Awaiting coroutine might be resumed and destroy both
+     */
+    void onRequestDone() noexcept
+    {
+        if (pendingCount.fetch_sub(1, std::memory_order::acq_rel) == 1)
+        {
+            jobSystem->enqueueJob(awaitingCoro, resumeInThread, jobPriority);
+        }
+    }
+};
+
+/**
+ * Requests are batched and submitted to io_uring from the IOThread special thread of job system in Linux.
+ * If there is no IO thread or no io_uring, Each request is done using blocking readAt/writeAt in a worker thread.
+ */
+class PROGRAMCORE_EXPORT AsyncFileIO
+{
+private:
+    AsyncFileIO() = default;
+
+public:
+    /**
+     * Completion must have its awaiting coroutine set. Requests and completion must be alive until the coroutine is resumed
+     */
+    static void submit(ArrayRange<AsyncFileRequest> requests, AsyncFileCompletion &completion) noexcept;
+    // Does the request in calling thread
+    static void executeBlocking(AsyncFileRequest &request) noexcept;
+    // If there is no job system to resume the coroutines from, Requests must be done immediately
+    static bool canSuspend() noexcept { return copat::JobSystem::get() != nullptr; }
+};
+
+/**
+ * Awaiter of single request, co_await returns bytes transferred
+ */
+class AsyncFileAwaiter
+{
+private:
+    AsyncFileRequest request;
+    AsyncFileCompletion completion;
+
+public:
+    AsyncFileAwaiter(const GenericFile *file, EAsyncFileOp::Type op, uint8 *buffer, uint32 bytesToTransfer, uint64 offset)
+    {
+        request.file = file;
+        request.op = op;
+        request.buffer = buffer;
+        request.bytesToTransfer = bytesToTransfer;
+        request.offset = offset;
+    }
+    MAKE_TYPE_NONCOPY_NONMOVE(AsyncFileAwaiter)
+
+    bool await_ready() noexcept
+    {
+        if (request.bytesToTransfer == 0)
+        {
+            return true;
+        }
+        if (!AsyncFileIO::canSuspend())
+        {
+            AsyncFileIO::executeBlocking(request);
+            return true;
+        }
+        return false;
+    }
+    template <typename PromiseType>
+    void await_suspend(std::coroutine_handle<PromiseType> awaitingCoro) noexcept
+    {
+        completion.setAwaitingCoro(awaitingCoro);
+        AsyncFileIO::submit({ &request, 1 }, completion);
+    }
+    uint32 await_resume() const noexcept { return request.bytesTransferred; }
+
+    int32 getErrorCode() const { return request.errorCode; }
+};
+
+/**
+ * Awaiter of several requests that are all put in flight together, Resumes after all of them are done.
+ * Results are in each request after co_await
+ */
+class AsyncFileBatchAwaiter
+{
+private:
+    ArrayRange<AsyncFileRequest> requests;
+    AsyncFileCompletion completion;
+
+public:
+    AsyncFileBatchAwaiter(ArrayRange<AsyncFileRequest> inRequests)
+        : requests(inRequests)
+    {}
+    MAKE_TYPE_NONCOPY_NONMOVE(AsyncFileBatchAwaiter)
+
+    bool await_ready() noexcept
+    {
+        if (requests.empty())
+        {
+            return true;
+        }
+        if (!AsyncFileIO::canSuspend())
+        {
+            for (AsyncFileRequest &request : requests)
+            {
+                AsyncFileIO::executeBlocking(request);
+            }
+            return true;
+        }
+        return false;
+    }
+    template <typename PromiseType>
+    void await_suspend(std::coroutine_handle<PromiseType> awaitingCoro) noexcept
+    {
+        completion.setAwaitingCoro(awaitingCoro);
+        AsyncFileIO::submit(requests, completion);
+    }
+    constexpr void await_resume() const noexcept {}
+};
@@ -9,7 +9,9 @@
  *  License can be read in LICENSE file at this repository's root
  */
 #include "Types/Platform/LFS/File/FileHelper.h"
+#include "Math/Math.h"
 #include "Types/Containers/ArrayView.h"
+#include "Types/Platform/LFS/File/AsyncFileIO.h"
 #include "Types/Platform/LFS/PlatformLFS.h"
 #include "Types/Platform/PlatformFunctions.h"
 
@@ -250,6 +252,44 @@ bool FileHelper::readBytes(std::vector<uint8> &outBytes, const String &fileName)
     return false;
 }
 
+FileHelper::AsyncReadBytesTask FileHelper::readBytesAsync(std::vector<uint8> &outBytes, String fileName) noexcept
+{
+    // Large enough to not flood the ring and small enough for several chunks of big files to be read in parallel
+    constexpr static const uint32 READ_CHUNK_SIZE = 8 * 1024 * 1024;
+
+    PlatformFile file(fileName);
+    file.setSharingMode(EFileSharing::ReadOnly);
+    file.setCreationAction(EFileFlags::OpenExisting);
+    file.setFileFlags(EFileFlags::Read);
+    if (!file.openFile())
+    {
+        co_return false;
+    }
+
+    const uint64 fileSize = file.fileSize();
+    outBytes.resize(fileSize);
+
+    std::vector<AsyncFileRequest> requests((fileSize + READ_CHUNK_SIZE - 1) / READ_CHUNK_SIZE);
+    for (SizeT i = 0; i != requests.size(); ++i)
+    {
+        const uint64 offset = i * READ_CHUNK_SIZE;
+        requests[i].file = &file;
+        requests[i].op = EAsyncFileOp::Read;
+        requests[i].buffer = outBytes.data() + offset;
+        requests[i].offset = offset;
+        requests[i].bytesToTransfer = uint32(Math::min(fileSize - offset, uint64(READ_CHUNK_SIZE)));
+    }
+    co_await AsyncFileBatchAwaiter({ requests.data(), requests.size() });
+    file.closeFile();
+
+    bool bAllRead = true;
+    for (const AsyncFileRequest &request : requests)
+    {
+        bAllRead = bAllRead && request.bytesTransferred == request.bytesToTransfer;
+    }
+    co_return bAllRead;
+}
+
 bool FileHelper::writeString(const String &content, const String &fileName) noexcept
 {
     std::string utf8Str{ TCHAR_TO_UTF8(content.getChar()) };
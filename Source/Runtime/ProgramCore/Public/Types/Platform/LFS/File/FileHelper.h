@@ -12,6 +12,7 @@
 
 #include "ProgramCoreExports.h"
 #include "String/String.h"
+#include "Types/Platform/Threading/CoPaT/JobSystemCoroutine.h"
 
 class PROGRAMCORE_EXPORT FileHelper
 {
@@ -34,6 +35,13 @@ public:
     static bool readString(String &outStr, const String &fileName) noexcept;
     static bool readUtf8String(std::string &outStr, const String &fileName) noexcept;
     static bool readBytes(std::vector<uint8> &outBytes, const String &fileName) noexcept;
+    /**
+     * Reads entire file with all its chunks in flight together, Task returns true if all bytes are read.
+     * Task starts in a worker thread so that it can be waited on from any thread. outBytes must be alive until the task is completed
+     */
+    using AsyncReadBytesTask
+        = copat::JobSystemReturnableTask<bool, true, copat::EJobThreadType::WorkerThreads, copat::EJobPriority::Priority_Normal>;
+    static AsyncReadBytesTask readBytesAsync(std::vector<uint8> &outBytes, String fileName) noexcept;
     // Always writes to new file, overwrites if existing
     static bool writeString(const String &content, const String &fileName) noexcept;
     static bool writeBytes(const std::vector<uint8> &bytes, const String &fileName) noexcept;
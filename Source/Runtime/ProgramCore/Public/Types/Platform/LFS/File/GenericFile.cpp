@@ -10,6 +10,7 @@
  */
 
 #include "Types/Platform/LFS/File/GenericFile.h"
+#include "Types/Platform/LFS/File/AsyncFileIO.h"
 #include "Types/Platform/PlatformAssertionErrors.h"
 #include "Types/CoreDefines.h"
 #include "Types/Platform/LFS/PathFunctions.h"
@@ -202,3 +203,14 @@ void GenericFile::removeFileFlags(uint8 flags) { fileFlags &= ~flags; }
 void GenericFile::addAttributes(uint32 attribs) { attributes |= attribs; }
 
 void GenericFile::removeAttributes(uint32 attribs) { attributes &= ~attribs; }
+
+AsyncFileAwaiter GenericFile::readAsync(uint64 offset, ArrayRange<uint8> readTo) const
+{
+    return AsyncFileAwaiter(this, EAsyncFileOp::Read, readTo.data(), uint32(readTo.size()), offset);
+}
+
+AsyncFileAwaiter GenericFile::writeAsync(uint64 offset, ArrayView<uint8> writeBytes) const
+{
+    // Buffer is never written to in write operation
+    return AsyncFileAwaiter(this, EAsyncFileOp::Write, const_cast<uint8 *>(writeBytes.data()), uint32(writeBytes.size()), offset);
+}
@@ -18,6 +18,8 @@
 
 #include <memory>
 
+class AsyncFileAwaiter;
+
 namespace EFileFlags
 {
 enum EFileFlags : uint8
@@ -176,24 +178,44 @@ public:
     virtual void read(std::vector<uint8> &readTo, uint32 bytesToRead = (~0u)) const = 0;
     virtual void read(uint8 *readTo, uint32 bytesToRead) const = 0;
     virtual void write(ArrayView<uint8> writeBytes) const = 0;
+    /**
+     * Reads or writes at offset and returns bytes transferred. Safe to be called from several threads at once.
+     * Cursor is not used and its position after the call is unspecified.
+     * outErrorCode receives platform error code(errno or GetLastError) if transfer failed, 0 if it succeeded or read reached end of file
+     */
+    virtual uint32 readAt(uint8 *readTo, uint32 bytesToRead, uint64 offset, int32 *outErrorCode = nullptr) const = 0;
+    virtual uint32 writeAt(ArrayView<uint8> writeBytes, uint64 offset, int32 *outErrorCode = nullptr) const = 0;
+
+    /**
+     * co_await the returned awaiter to get bytes transferred, The awaiting coroutine is resumed in same job system thread type it awaited
+     * from. File must stay opened and buffer must be alive until the awaiter resumes.
+     */
+    NODISCARD AsyncFileAwaiter readAsync(uint64 offset, ArrayRange<uint8> readTo) const;
+    NODISCARD AsyncFileAwaiter writeAsync(uint64 offset, ArrayView<uint8> writeBytes) const;
+
+    /**
+     * Maps entire opened file as read only view. Returns nullptr if file is not opened for read, Is empty or mapping failed.
+     * outMapping must be passed back to unmapView and file must not be closed before unmapping
+     */
+    virtual const uint8 *mapReadOnly(PlatformHandle &outMapping) const = 0;
+    virtual void unmapView(const uint8 *mappedView, PlatformHandle mapping) const = 0;
 
     virtual bool deleteFile() = 0;
     virtual bool renameFile(String newName) = 0;
 
     // Works only if directory
+    // Explicit specialization in class scope is MSVC only, So branching at compile time instead
     template <bool ClearFiles>
-    bool deleteDirectory() const;
-
-    template <>
-    bool deleteDirectory<true>() const
-    {
-        return dirClearAndDelete();
-    }
-
-    template <>
-    bool deleteDirectory<false>() const
+    bool deleteDirectory() const
     {
-        return dirDelete();
+        if CONST_EXPR (ClearFiles)
+        {
+            return dirClearAndDelete();
+        }
+        else
+        {
+            return dirDelete();
+        }
     }
 
     virtual bool createDirectory() const = 0;
@@ -11,12 +11,11 @@
 
 #pragma once
 
+#include <vector>
+
 class GenericFile;
 class String;
 
-template <class _Ty, class _Alloc>
-class std::vector;
-
 template <typename FileSystemType>
 class GenericFileSystemFunctions
 {
@@ -43,7 +42,7 @@ public:
 
     static bool moveFile(GenericFile *moveFrom, GenericFile *moveTo) { return FileSystemType::moveFile(moveFrom, moveTo); }
 
-    static bool copyFile(GenericFile *copyFrom, GenericFile *copyTo) { return FileSystemType::moveFile(copyFrom, copyTo); }
+    static bool copyFile(GenericFile *copyFrom, GenericFile *copyTo) { return FileSystemType::copyFile(copyFrom, copyTo); }
     static bool replaceFile(GenericFile *replaceWith, GenericFile *replacing, GenericFile *backupFile)
     {
         return FileSystemType::replaceFile(replaceWith, replacing, backupFile);
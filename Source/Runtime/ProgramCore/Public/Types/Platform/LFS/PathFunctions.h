@@ -13,11 +13,10 @@
 
 #include "ProgramCoreExports.h"
 #include "Types/CoreDefines.h"
+#include "String/String.h"
 
 #include <type_traits>
 
-class String;
-
 class PROGRAMCORE_EXPORT PathFunctions
 {
 private:
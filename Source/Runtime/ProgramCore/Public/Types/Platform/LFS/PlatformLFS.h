@@ -15,7 +15,8 @@
 #include "LFS/File/WindowsFile.h"
 #include "LFS/WindowsFileSystemFunctions.h"
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+#include "LFS/File/LinuxFile.h"
+#include "LFS/LinuxFileSystemFunctions.h"
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
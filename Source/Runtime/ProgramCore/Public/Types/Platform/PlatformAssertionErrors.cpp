@@ -16,7 +16,9 @@
 #include "ErrorsAsserts/WindowsErrorHandler.h"
 
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+
+#include "ErrorsAsserts/LinuxErrorHandler.h"
+
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
@@ -49,7 +49,8 @@ private:
 #endif
 };
 
-#define LOG_ASSERTION_FORMATTED(Expr, Category, Message, ...) LOG_ERROR(Category, "Assert expression failed [" #Expr "] " Message, __VA_ARGS__)
+#define LOG_ASSERTION_FORMATTED(Expr, Category, Message, ...)                                                                                  \
+    LOG_ERROR(Category, "Assert expression failed [" #Expr "] " Message __VA_OPT__(, ) __VA_ARGS__)
 #define LOG_ASSERTION(Expr, Category) LOG_ERROR(Category, "Assert expression failed " #Expr)
 
 #if DEBUG_VALIDATIONS
@@ -76,7 +77,7 @@ private:
     {                                                                                                                                          \
         if (!(Expr)) [[unlikely]]                                                                                                              \
         {                                                                                                                                      \
-            LOG_ASSERTION_FORMATTED(Expr, "DebugAssertion", Message, __VA_ARGS__);                                                             \
+            LOG_ASSERTION_FORMATTED(Expr, "DebugAssertion", Message __VA_OPT__(, ) __VA_ARGS__);                                               \
             UnexpectedErrorHandler::getHandler()->dumpCallStack(false);                                                                        \
             assert(!#Expr); /* Using assert macro to make use of assert window to crash or debug */                                            \
         }                                                                                                                                      \
@@ -86,7 +87,7 @@ private:
 
 #else // DEBUG_VALIDATIONS
 #define debugAssert(Expr) CompilerHacks::ignoreUnused((Expr))
-#define debugAssertf(Expr, Message, ...) CompilerHacks::ignoreUnused((Expr), Message, __VA_ARGS__)
+#define debugAssertf(Expr, Message, ...) CompilerHacks::ignoreUnused((Expr), Message __VA_OPT__(, ) __VA_ARGS__)
 #endif // DEBUG_VALIDATIONS
 
 #ifndef fatalAssert
@@ -108,7 +109,7 @@ private:
     {                                                                                                                                          \
         if (!(Expr)) [[unlikely]]                                                                                                              \
         {                                                                                                                                      \
-            LOG_ASSERTION_FORMATTED(Expr, "FatalAssertion", Message, __VA_ARGS__);                                                             \
+            LOG_ASSERTION_FORMATTED(Expr, "FatalAssertion", Message __VA_OPT__(, ) __VA_ARGS__);                                               \
             UnexpectedErrorHandler::getHandler()->debugBreak();                                                                                \
             UnexpectedErrorHandler::getHandler()->dumpCallStack(true);                                                                         \
         }                                                                                                                                      \
@@ -127,7 +128,7 @@ private:
 #define ALERT_FORMATTED_internal(Expr, DebugBreakCaller, Message, ...)                                                                         \
     if (!(Expr)) [[unlikely]]                                                                                                                  \
     {                                                                                                                                          \
-        LOG_ASSERTION_FORMATTED(Expr, "AlertAssertion", Message, __VA_ARGS__);                                                                 \
+        LOG_ASSERTION_FORMATTED(Expr, "AlertAssertion", Message __VA_OPT__(, ) __VA_ARGS__);                                                   \
         UnexpectedErrorHandler::getHandler()->dumpCallStack(false);                                                                            \
         DebugBreakCaller(UnexpectedErrorHandler::getHandler()->debugBreak());                                                                  \
     }
@@ -144,7 +145,7 @@ private:
 #define alertAlwaysf(Expr, Message, ...)                                                                                                       \
     do                                                                                                                                         \
     {                                                                                                                                          \
-        ALERT_FORMATTED_internal(Expr, EXPAND_ARGS, Message, __VA_ARGS__)                                                                      \
+        ALERT_FORMATTED_internal(Expr, EXPAND_ARGS, Message __VA_OPT__(, ) __VA_ARGS__)                                                        \
     }                                                                                                                                          \
     while (0)
 #endif
@@ -170,7 +171,7 @@ private:
     do                                                                                                                                         \
     {                                                                                                                                          \
         /* We have to dump any way */                                                                                                          \
-        ALERT_FORMATTED_internal(Expr, ALERT_ONCE_DEBUG_BREAK_internal, Message, __VA_ARGS__);                                                 \
+        ALERT_FORMATTED_internal(Expr, ALERT_ONCE_DEBUG_BREAK_internal, Message __VA_OPT__(, ) __VA_ARGS__);                                   \
     }                                                                                                                                          \
     while (0)
 #endif
\ No newline at end of file
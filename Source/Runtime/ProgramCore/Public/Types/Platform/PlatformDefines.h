@@ -36,7 +36,9 @@
 #include "WindowsPlatformDefines.h"
 
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+
+#include "LinuxPlatformDefines.h"
+
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
\ No newline at end of file
@@ -16,7 +16,9 @@
 #include "WindowsPlatformFunctions.h"
 
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+
+#include "LinuxPlatformFunctions.h"
+
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
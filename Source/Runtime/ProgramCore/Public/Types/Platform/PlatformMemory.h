@@ -16,7 +16,9 @@
 #include "WindowsPlatformMemory.h"
 
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+
+#include "LinuxPlatformMemory.h"
+
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
@@ -16,7 +16,9 @@
 #include "WindowsPlatformTypes.h"
 
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+
+#include "LinuxPlatformTypes.h"
+
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
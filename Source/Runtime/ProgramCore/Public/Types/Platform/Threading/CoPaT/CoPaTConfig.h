@@ -30,7 +30,13 @@
 //      LastMacroName(ThreadN)
 //
 // #define FOR_EACH_THREAD_TYPES_UNIQUE_FIRST_LAST(FirstMacroName, MacroName, LastMacroName) FirstMacroName(RenderThread)
+#if PLATFORM_LINUX
+// IOThread drives io_uring for AsyncFileIO, Other platforms do async file IO in worker threads and would leave this thread idle
+#define FOR_EACH_UDTHREAD_TYPES_UNIQUE_FIRST_LAST(FirstMacroName, MacroName, LastMacroName)                                                    \
+    FirstMacroName(RenderThread) LastMacroName(IOThread)
+#else
 #define FOR_EACH_UDTHREAD_TYPES_UNIQUE_FIRST_LAST(FirstMacroName, MacroName, LastMacroName) FirstMacroName(RenderThread)
+#endif
 #define FOR_EACH_UDTHREAD_TYPES(MacroName) FOR_EACH_UDTHREAD_TYPES_UNIQUE_FIRST_LAST(MacroName, MacroName, MacroName)
 
 #define USER_DEFINED_THREAD(ThreadType) ThreadType,
@@ -182,7 +182,7 @@ public:
         constexpr std::suspend_never initial_suspend() const noexcept { return {}; }
         constexpr std::suspend_never final_suspend() const noexcept { return {}; }
         constexpr void return_void() const noexcept {}
-        constexpr void unhandled_exception() const noexcept { COPAT_UNHANDLED_EXCEPT(); }
+        void unhandled_exception() const noexcept { COPAT_UNHANDLED_EXCEPT(); }
     };
 };
 
@@ -215,8 +215,10 @@ public:
         {}
         PromiseType(EJobPriority priority, auto...)
             : PromiseType()
-            , jobPriority(priority)
-        {}
+        {
+            // Delegating constructor cannot have other member initializers
+            jobPriority = priority;
+        }
 
         COPAT_EXPORT_SYM PromiseType();
 
@@ -224,7 +226,7 @@ public:
         constexpr std::suspend_never initial_suspend() const noexcept { return {}; }
         constexpr std::suspend_never final_suspend() const noexcept { return {}; }
         constexpr void return_void() const noexcept {}
-        constexpr void unhandled_exception() const noexcept { COPAT_UNHANDLED_EXCEPT(); }
+        void unhandled_exception() const noexcept { COPAT_UNHANDLED_EXCEPT(); }
     };
 
     using promise_type = PromiseType;
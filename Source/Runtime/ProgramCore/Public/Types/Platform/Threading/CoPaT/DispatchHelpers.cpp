@@ -14,9 +14,145 @@
 #include "JobSystemCoroutine.h"
 #include "CoroutineWait.h"
 
+#include <memory>
+
 COPAT_NS_INLINED
 namespace copat
 {
+
+//////////////////////////////////////////////////////////////////////////
+/// RangeStealingPartitioner implementation
+//////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+RangeStealingPartitioner::RangeStealingPartitioner(u32 count, u32 inParticipantsCount) noexcept
+{
+    participantsCount = inParticipantsCount < count ? inParticipantsCount : count;
+    participantsCount = participantsCount == 0 ? 1 : participantsCount;
+
+    participants = reinterpret_cast<ParticipantRange *>(
+        CoPaTMemAlloc::memAlloc(sizeof(ParticipantRange) * participantsCount, alignof(ParticipantRange))
+    );
+
+    // Initial split is same as static partition, Stealing takes over only when the load is uneven
+    const u32 indicesPerParticipant = count / participantsCount;
+    const u32 participantsWithMore = count % participantsCount;
+    u32 beginIdx = 0;
+    for (u32 i = 0; i < participantsCount; ++i)
+    {
+        const u32 endIdx = beginIdx + indicesPerParticipant + (i < participantsWithMore ? 1 : 0);
+        ParticipantRange *participant = new (participants + i) ParticipantRange();
+        participant->range.store(packRange(beginIdx, endIdx), std::memory_order::relaxed);
+        beginIdx = endIdx;
+    }
+    std::atomic_thread_fence(std::memory_order::release);
+}
+
+RangeStealingPartitioner::~RangeStealingPartitioner() noexcept
+{
+    for (u32 i = 0; i < participantsCount; ++i)
+    {
+        participants[i].~ParticipantRange();
+    }
+    CoPaTMemAlloc::memFree(participants);
+    participants = nullptr;
+    participantsCount = 0;
+}
+
+bool RangeStealingPartitioner::claimChunk(u32 participantIdx, u32 &outBegin, u32 &outEnd) noexcept
+{
+    COPAT_ASSERT(participantIdx < participantsCount);
+    ParticipantRange &participant = participants[participantIdx];
+
+    u64 packedRange = participant.range.load(std::memory_order::acquire);
+    while (rangeBegin(packedRange) < rangeEnd(packedRange))
+    {
+        const u32 beginIdx = rangeBegin(packedRange);
+        const u32 endIdx = rangeEnd(packedRange);
+        // Always leave at least half of remaining indices to be stolen, This also makes cheap indices ramp up the grain in few steps
+        const u32 halfRemaining = (endIdx - beginIdx) / 2;
+        const u32 takeCount = participant.grainSize < halfRemaining ? participant.grainSize : (halfRemaining > 0 ? halfRemaining : 1);
+
+        if (participant.range.compare_exchange_weak(
+                packedRange, packRange(beginIdx + takeCount, endIdx), std::memory_order::acq_rel, std::memory_order::acquire
+            ))
+        {
+            outBegin = beginIdx;
+            outEnd = beginIdx + takeCount;
+            return true;
+        }
+    }
+    return stealChunk(participantIdx, outBegin, outEnd);
+}
+
+bool RangeStealingPartitioner::stealChunk(u32 participantIdx, u32 &outBegin, u32 &outEnd) noexcept
+{
+    ParticipantRange &participant = participants[participantIdx];
+    while (true)
+    {
+        COPAT_PROFILER_SCOPE(COPAT_PROFILER_CHAR("CopatStealRange"));
+
+        // Steal from the participant with most remaining indices, Participants count is small so a linear scan is cheap
+        u32 victimIdx = participantsCount;
+        u32 victimRemaining = 0;
+        u64 victimRange = 0;
+        for (u32 i = 1; i < participantsCount; ++i)
+        {
+            const u32 idx = (participantIdx + i) % participantsCount;
+            const u64 packedRange = participants[idx].range.load(std::memory_order::acquire);
+            const u32 remaining = rangeEnd(packedRange) > rangeBegin(packedRange) ? rangeEnd(packedRange) - rangeBegin(packedRange) : 0;
+            if (remaining > victimRemaining)
+            {
+                victimIdx = idx;
+                victimRemaining = remaining;
+                victimRange = packedRange;
+            }
+        }
+        if (victimIdx == participantsCount)
+        {
+            return false;
+        }
+
+        // Thief takes the upper half and victim keeps the lower half, If only one index remains thief takes it
+        const u32 beginIdx = rangeBegin(victimRange);
+        const u32 endIdx = rangeEnd(victimRange);
+        const u32 midIdx = beginIdx + victimRemaining / 2;
+        if (participants[victimIdx].range.compare_exchange_strong(
+                victimRange, packRange(beginIdx, midIdx), std::memory_order::acq_rel, std::memory_order::relaxed
+            ))
+        {
+            /**
+             * Own range is empty so no thief will touch it until we publish the stolen range.
+             * Keep first chunk to ourselves and publish the rest so others can steal from it as well.
+             */
+            const u32 halfStolen = (endIdx - midIdx) / 2;
+            const u32 takeCount = participant.grainSize < halfStolen ? participant.grainSize : (halfStolen > 0 ? halfStolen : 1);
+            outBegin = midIdx;
+            outEnd = midIdx + takeCount;
+            participant.range.store(packRange(outEnd, endIdx), std::memory_order::release);
+            return true;
+        }
+    }
+}
+
+void RangeStealingPartitioner::onChunkDone(u32 participantIdx, u32 indicesCount, u64 elapsedNs) noexcept
+{
+    ParticipantRange &participant = participants[participantIdx];
+
+    u64 indexNs = elapsedNs / (indicesCount > 0 ? indicesCount : 1);
+    indexNs = indexNs > 0 ? indexNs : 1;
+    // Moving average so that a single slow index does not collapse the grain
+    participant.avgIndexNs = participant.avgIndexNs == 0 ? indexNs : (participant.avgIndexNs * 3 + indexNs) / 4;
+
+    const u64 newGrain = TARGET_CHUNK_NS / participant.avgIndexNs;
+    participant.grainSize = newGrain == 0 ? 1 : (newGrain > MAX_GRAIN_SIZE ? MAX_GRAIN_SIZE : u32(newGrain));
+}
+} // namespace impl
+
+//////////////////////////////////////////////////////////////////////////
+/// Dispatch functions
+//////////////////////////////////////////////////////////////////////////
 // Just copying the callback so a copy exists inside dispatch
 DispatchAwaitableType dispatchOneTask(JobSystem &jobSys, EJobPriority jobPriority, DispatchFunctionType callback, u32 jobIdx) noexcept
 {
@@ -33,9 +169,25 @@ dispatchTaskGroup(JobSystem &jobSys, EJobPriority jobPriority, DispatchFunctionT
     }
     co_return;
 }
+// Partitioner is shared by all dispatched participants and the last one to finish frees it
+DispatchAwaitableType dispatchStealingGroup(
+    JobSystem &jobSys, EJobPriority jobPriority, DispatchFunctionType callback, std::shared_ptr<impl::RangeStealingPartitioner> partitioner,
+    u32 participantIdx
+) noexcept
+{
+    partitioner->forEachIndex(
+        participantIdx,
+        [&callback](u32 jobIdx)
+        {
+            callback(jobIdx);
+        }
+    );
+    co_return;
+}
 
 AwaitAllTasks<std::vector<DispatchAwaitableType>> dispatch(
-    JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority /* = EJobPriority::Priority_Normal */
+    JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority /* = EJobPriority::Priority_Normal */,
+    EDispatchPartition partition /* = EDispatchPartition::WorkStealing */
 ) noexcept
 {
     if (count == 0)
@@ -61,6 +213,18 @@ AwaitAllTasks<std::vector<DispatchAwaitableType>> dispatch(
 
     std::vector<DispatchAwaitableType> dispatchedJobs;
 
+    if (partition == EDispatchPartition::WorkStealing)
+    {
+        std::shared_ptr<impl::RangeStealingPartitioner> partitioner = std::make_shared<impl::RangeStealingPartitioner>(count, grpCount);
+        const u32 participantsCount = partitioner->getParticipantsCount();
+        dispatchedJobs.reserve(participantsCount);
+        for (u32 i = 0; i < participantsCount; ++i)
+        {
+            dispatchedJobs.emplace_back(std::move(dispatchStealingGroup(*jobSys, jobPriority, callback, partitioner, i)));
+        }
+        return awaitAllTasks(std::move(dispatchedJobs));
+    }
+
     u32 jobsPerGrp = count / grpCount;
     // If dispatching count is less than max workers count
     if (jobsPerGrp == 0)
@@ -93,7 +257,8 @@ AwaitAllTasks<std::vector<DispatchAwaitableType>> dispatch(
 }
 
 void parallelFor(
-    JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority /*= EJobPriority::Priority_Normal */
+    JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority /*= EJobPriority::Priority_Normal */,
+    EDispatchPartition partition /* = EDispatchPartition::WorkStealing */
 ) noexcept
 {
     if (count == 0)
@@ -103,6 +268,30 @@ void parallelFor(
 
     COPAT_ASSERT(jobSys);
 
+    if (partition == EDispatchPartition::WorkStealing)
+    {
+        /**
+         * Partitioner outlives all participants as we wait here, So each participant is dispatched with static partition of one index each.
+         * Calling thread runs the last participant.
+         */
+        impl::RangeStealingPartitioner partitioner{ count, jobSys->getWorkersCount() };
+        auto participantFunc = [&partitioner, &callback](u32 participantIdx)
+        {
+            partitioner.forEachIndex(
+                participantIdx,
+                [&callback](u32 jobIdx)
+                {
+                    callback(jobIdx);
+                }
+            );
+        };
+        parallelFor(
+            jobSys, DispatchFunctionType::createLambda(participantFunc), partitioner.getParticipantsCount(), jobPriority,
+            EDispatchPartition::Static
+        );
+        return;
+    }
+
     const u32 grpCount = jobSys->getWorkersCount();
 
     // If dispatching count is less than max workers count then jobsPerGrp will be 1
@@ -110,7 +299,8 @@ void parallelFor(
     u32 jobsPerGrp = count / grpCount;
     jobsPerGrp += (count % grpCount) > 0;
 
-    AwaitAllTasks<std::vector<DispatchAwaitableType>> allAwaits = dispatch(jobSys, callback, count - jobsPerGrp, jobPriority);
+    AwaitAllTasks<std::vector<DispatchAwaitableType>> allAwaits
+        = dispatch(jobSys, callback, count - jobsPerGrp, jobPriority, EDispatchPartition::Static);
     for (u32 jobIdx = count - jobsPerGrp; jobIdx < count; ++jobIdx)
     {
         callback(jobIdx);
@@ -12,6 +12,9 @@
 #pragma once
 
 #include "JobSystem.h"
+#include "CoroutineUtilities.h"
+
+#include <chrono>
 
 COPAT_NS_INLINED
 namespace copat
@@ -36,12 +39,98 @@ using DispatchFunctionTypeWithRet = FunctionType<RetType, u32>;
 using DispatchAwaitableType = DispatchAwaitableTypeWithRet<void>;
 using DispatchFunctionType = DispatchFunctionTypeWithRet<void>;
 
-COPAT_EXPORT_SYM AwaitAllTasks<std::vector<DispatchAwaitableType>>
-dispatch(JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority = EJobPriority::Priority_Normal) noexcept;
+/**
+ * Determines how the indices of a dispatch gets distributed among the workers
+ * Static - Indices are split equally into workers count groups upfront and each group is run serially by one job
+ * WorkStealing - Each participant owns a splittable range, Takes chunks from the front of its range and once its range is empty steals half
+ * of the largest remaining range from other participants. Chunk size adapts to measured time per index
+ */
+enum class EDispatchPartition
+{
+    Static,
+    WorkStealing
+};
+
+namespace impl
+{
+/**
+ * Splits [0, count) into one range per participant and lets participants steal from each other once their own range is consumed.
+ * Each participant's range is packed into one 64bit atomic so that owner's claim from front and thief's split from back are single CAS.
+ * Any index is handed out exactly once, Chunk that is claimed will be executed by the claiming participant.
+ */
+class COPAT_EXPORT_SYM RangeStealingPartitioner
+{
+public:
+    // Target time spent executing one claimed chunk, Small enough to keep stealing granularity fine and large enough to amortize the CAS
+    constexpr static const u64 TARGET_CHUNK_NS = 50000;
+    constexpr static const u32 MAX_GRAIN_SIZE = 4096;
+
+private:
+    struct alignas(CACHE_LINE_SIZE) ParticipantRange
+    {
+        // Begin index in upper 32bits and end index in lower 32bits
+        std::atomic<u64> range;
+        // Below are accessed only by owning participant
+        u32 grainSize = 1;
+        u64 avgIndexNs = 0;
+    };
+
+    ParticipantRange *participants = nullptr;
+    u32 participantsCount = 0;
+
+public:
+    RangeStealingPartitioner(u32 count, u32 inParticipantsCount) noexcept;
+    ~RangeStealingPartitioner() noexcept;
+
+    RangeStealingPartitioner(RangeStealingPartitioner &&) = delete;
+    RangeStealingPartitioner(const RangeStealingPartitioner &) = delete;
+    RangeStealingPartitioner &operator= (RangeStealingPartitioner &&) = delete;
+    RangeStealingPartitioner &operator= (const RangeStealingPartitioner &) = delete;
+
+    u32 getParticipantsCount() const noexcept { return participantsCount; }
+
+    /**
+     * Claims next chunk [outBegin, outEnd) for participantIdx either from its own range or by stealing from others.
+     * Returns false once there is nothing left to claim from any of the participants.
+     */
+    bool claimChunk(u32 participantIdx, u32 &outBegin, u32 &outEnd) noexcept;
+    void onChunkDone(u32 participantIdx, u32 indicesCount, u64 elapsedNs) noexcept;
+
+    template <typename FuncType>
+    void forEachIndex(u32 participantIdx, FuncType &&func) noexcept
+    {
+        u32 beginIdx = 0;
+        u32 endIdx = 0;
+        while (claimChunk(participantIdx, beginIdx, endIdx))
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+            for (u32 jobIdx = beginIdx; jobIdx < endIdx; ++jobIdx)
+            {
+                func(jobIdx);
+            }
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+            onChunkDone(participantIdx, endIdx - beginIdx, u64(elapsed.count()));
+        }
+    }
+
+private:
+    static u64 packRange(u32 beginIdx, u32 endIdx) noexcept { return (u64(beginIdx) << 32) | u64(endIdx); }
+    static u32 rangeBegin(u64 packedRange) noexcept { return u32(packedRange >> 32); }
+    static u32 rangeEnd(u64 packedRange) noexcept { return u32(packedRange); }
+
+    bool stealChunk(u32 participantIdx, u32 &outBegin, u32 &outEnd) noexcept;
+};
+} // namespace impl
+
+COPAT_EXPORT_SYM AwaitAllTasks<std::vector<DispatchAwaitableType>> dispatch(
+    JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority = EJobPriority::Priority_Normal,
+    EDispatchPartition partition = EDispatchPartition::WorkStealing
+) noexcept;
 
 // Dispatch and wait immediately
 COPAT_EXPORT_SYM void parallelFor(
-    JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority = EJobPriority::Priority_Normal
+    JobSystem *jobSys, const DispatchFunctionType &callback, u32 count, EJobPriority jobPriority = EJobPriority::Priority_Normal,
+    EDispatchPartition partition = EDispatchPartition::WorkStealing
 ) noexcept;
 
 template <typename FuncType, typename... Args>
@@ -161,7 +250,8 @@ std::vector<RetType> converge(AwaitAllTasks<std::vector<DispatchAwaitableTypeWit
 // diverge, converge immediately and returns the result
 template <typename RetType>
 std::vector<RetType> parallelForReturn(
-    JobSystem *jobSys, const DispatchFunctionTypeWithRet<RetType> &callback, u32 count, EJobPriority jobPriority = EJobPriority::Priority_Normal
+    JobSystem *jobSys, const DispatchFunctionTypeWithRet<RetType> &callback, u32 count, EJobPriority jobPriority = EJobPriority::Priority_Normal,
+    EDispatchPartition partition = EDispatchPartition::WorkStealing
 ) noexcept
 {
     using AwaitableType = typename DispatchWithReturn<RetType>::AwaitableType;
@@ -173,6 +263,39 @@ std::vector<RetType> parallelForReturn(
 
     COPAT_ASSERT(jobSys);
 
+    if (partition == EDispatchPartition::WorkStealing)
+    {
+        /**
+         * Each index writes its return value directly into its slot so the order is same as static path.
+         * Raw storage is used to avoid requiring RetType to be default constructible.
+         */
+        RetType *retStorage = reinterpret_cast<RetType *>(CoPaTMemAlloc::memAlloc(sizeof(RetType) * count, alignof(RetType)));
+        impl::RangeStealingPartitioner partitioner{ count, jobSys->getWorkersCount() };
+        auto participantFunc = [&partitioner, &callback, retStorage](u32 participantIdx)
+        {
+            partitioner.forEachIndex(
+                participantIdx,
+                [&callback, retStorage](u32 jobIdx)
+                {
+                    new (retStorage + jobIdx) RetType(callback(jobIdx));
+                }
+            );
+        };
+        parallelFor(
+            jobSys, DispatchFunctionType::createLambda(participantFunc), partitioner.getParticipantsCount(), jobPriority,
+            EDispatchPartition::Static
+        );
+
+        retVals.reserve(count);
+        for (u32 jobIdx = 0; jobIdx < count; ++jobIdx)
+        {
+            retVals.emplace_back(std::move(retStorage[jobIdx]));
+            retStorage[jobIdx].~RetType();
+        }
+        CoPaTMemAlloc::memFree(retStorage);
+        return retVals;
+    }
+
     const u32 grpCount = jobSys->getWorkersCount();
 
     // If dispatching count is less than max workers count then jobsPerGrp will be 1
@@ -15,6 +15,12 @@
 #include <thread>
 #include <bit>
 
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 COPAT_NS_INLINED
 namespace copat
 {
@@ -30,6 +36,20 @@ void getCoreCount(u32 &outCoreCount, u32 &outLogicalProcessorCount)
     }
 }
 
+#ifdef __linux__
+static_assert(sizeof(std::atomic<u32>) == sizeof(u32), "Futex word must be plain 32bit integer");
+
+void INTERNAL_futexWait(std::atomic<u32> *address, u32 expectedValue) noexcept
+{
+    ::syscall(SYS_futex, reinterpret_cast<u32 *>(address), FUTEX_WAIT_PRIVATE, expectedValue, nullptr, nullptr, 0);
+}
+
+void INTERNAL_futexWakeOne(std::atomic<u32> *address) noexcept
+{
+    ::syscall(SYS_futex, reinterpret_cast<u32 *>(address), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+#endif
+
 JobSystem::EThreadingConstraint getThreadingConstraint(u32 constraints)
 {
     return JobSystem::EThreadingConstraint(constraints & (JobSystem::BitMasksStart - 1));
@@ -56,10 +76,10 @@ JobSystem::JobSystem(u32 inWorkerCount, u32 constraints)
     }
 }
 
-#define NO_SPECIALTHREADS_INDIR_SETUP(ThreadType) enqIndirection[u32(EJobThreadType::##ThreadType)] = EJobThreadType::MainThread;
+#define NO_SPECIALTHREADS_INDIR_SETUP(ThreadType) enqIndirection[u32(EJobThreadType::ThreadType)] = EJobThreadType::MainThread;
 #define SPECIALTHREAD_INDIR_SETUP(ThreadType)                                                                                                  \
-    enqIndirection[u32(EJobThreadType::##ThreadType)]                                                                                          \
-        = (threadingConstraints & NOSPECIALTHREAD_ENUM_TO_FLAGBIT(ThreadType)) ? EJobThreadType::MainThread : EJobThreadType::##ThreadType;
+    enqIndirection[u32(EJobThreadType::ThreadType)]                                                                                            \
+        = (threadingConstraints & NOSPECIALTHREAD_ENUM_TO_FLAGBIT(ThreadType)) ? EJobThreadType::MainThread : EJobThreadType::ThreadType;
 
 void JobSystem::initialize(MainThreadTickFunc &&mainTick, void *inUserData) noexcept
 {
@@ -202,10 +222,26 @@ void JobSystem::enqueueJob(
     }
 }
 
+void JobSystem::enqueueJobLocal(std::coroutine_handle<> coro, EJobPriority priority /*= EJobPriority::Priority_Normal*/) noexcept
+{
+    PerThreadData *threadData = getPerThreadData();
+    if (threadData && threadData->threadType == EJobThreadType::WorkerThreads
+        && enqToThreadType(EJobThreadType::WorkerThreads) == EJobThreadType::WorkerThreads)
+    {
+        COPAT_PROFILER_SCOPE(COPAT_PROFILER_CHAR("CopatEnqueueToLocalWorker"));
+        workerThreadsPool.enqueueJobLocal(coro, threadData->workerIdx, priority, threadData->workerQsTokens);
+    }
+    else
+    {
+        enqueueJob(coro, EJobThreadType::WorkerThreads, priority);
+    }
+}
+
 JobSystem::PerThreadData::PerThreadData(
     SpecialThreadQueueType *mainQs, WorkerThreadsPool &workerThreadPool, SpecialThreadsPoolType &specialThreadPool
 )
     : threadType(EJobThreadType::WorkerThreads)
+    , workerIdx(0)
     , mainQTokens{ mainQs[Priority_Critical].getHazardToken(), mainQs[Priority_Normal].getHazardToken(), mainQs[Priority_Low].getHazardToken() }
     , workerQsTokens(workerThreadPool.allocateEnqTokens())
     , specialQsTokens(specialThreadPool.allocateEnqTokens())
@@ -264,10 +300,31 @@ void JobSystem::runMain() noexcept
     }
 }
 
+bool JobSystem::tryRunMainJob() noexcept
+{
+    COPAT_ASSERT(getCurrentThreadType() == EJobThreadType::MainThread);
+
+    void *coroPtr = nullptr;
+    for (EJobPriority priority = Priority_Critical; priority < Priority_MaxPriority && coroPtr == nullptr;
+         priority = EJobPriority(priority + 1))
+    {
+        coroPtr = mainThreadJobs[priority].dequeue();
+    }
+    if (coroPtr == nullptr)
+    {
+        return false;
+    }
+
+    COPAT_PROFILER_SCOPE(COPAT_PROFILER_CHAR("CopatMainJob"));
+    std::coroutine_handle<>::from_address(coroPtr).resume();
+    return true;
+}
+
 void JobSystem::doWorkerJobs(u32 threadIdx) noexcept
 {
     PerThreadData *tlData = &getOrCreatePerThreadData();
     tlData->threadType = EJobThreadType::WorkerThreads;
+    tlData->workerIdx = threadIdx;
 
     auto randomNum = [seed = threadIdx]() mutable
     {
@@ -311,7 +368,18 @@ void JobSystem::doWorkerJobs(u32 threadIdx) noexcept
             if (bEnableJobStealing)
             {
                 COPAT_PROFILER_SCOPE(COPAT_PROFILER_CHAR("CopatStealJob"));
-                u32 stealFromThreadIdx = randomNum() % getWorkersCount();
+                /* Previous worker wakes us when it enqueues local jobs so try it first before a random worker */
+                const u32 prevWorkerIdx = (threadIdx + getWorkersCount() - 1) % getWorkersCount();
+                u32 stealFromThreadIdx = prevWorkerIdx;
+                for (EJobPriority priority = Priority_Critical; priority < Priority_MaxPriority && coroPtr == nullptr;
+                     priority = EJobPriority(priority + 1))
+                {
+                    coroPtr = workerThreadsPool.stealJob(stealFromThreadIdx, priority, tlData->workerQsTokens);
+                }
+                if (coroPtr == nullptr)
+                {
+                    stealFromThreadIdx = randomNum() % getWorkersCount();
+                }
                 for (EJobPriority priority = Priority_Critical; priority < Priority_MaxPriority && coroPtr == nullptr;
                      priority = EJobPriority(priority + 1))
                 {
@@ -365,11 +433,13 @@ void INTERNAL_runSpecialThread(INTERNAL_DoSpecialThreadFuncType threadFunc, EJob
                                {
                                    (jobSystem->*threadFunc)();
                                } };
-    PlatformThreadingFuncs::setThreadName(JobSystem::SpecialThreadsPoolType::NAMES[threadIdx], specialThread.native_handle());
+    // native_handle is pthread_t integer in pthreads
+    void *threadHandle = reinterpret_cast<void *>(specialThread.native_handle());
+    PlatformThreadingFuncs::setThreadName(JobSystem::SpecialThreadsPoolType::NAMES[threadIdx], threadHandle);
     if (coreCount > u32(threadType))
     {
         // If not enough core just run as free thread
-        PlatformThreadingFuncs::setThreadProcessor(u32(threadType), 0, specialThread.native_handle());
+        PlatformThreadingFuncs::setThreadProcessor(u32(threadType), 0, threadHandle);
     }
     // Destroy when finishes
     specialThread.detach();
@@ -448,11 +518,12 @@ void WorkerThreadsPool::run(INTERNAL_DoWorkerThreadFuncType doWorkerJobFunc, boo
                             {
                                 (ownerJobSystem->*doWorkerJobFunc)(i);
                             } };
-        PlatformThreadingFuncs::setThreadName((COPAT_TCHAR("WorkerThread_") + COPAT_TOSTRING(i)).c_str(), worker.native_handle());
+        void *threadHandle = reinterpret_cast<void *>(worker.native_handle());
+        PlatformThreadingFuncs::setThreadName((COPAT_TCHAR("WorkerThread_") + COPAT_TOSTRING(i)).c_str(), threadHandle);
         /* If Worker is strictly tied to a logic processor */
         if (bSetAffinity)
         {
-            PlatformThreadingFuncs::setThreadProcessor(coreIdx, htIdx, worker.native_handle());
+            PlatformThreadingFuncs::setThreadProcessor(coreIdx, htIdx, threadHandle);
         }
         else
         {
@@ -461,7 +532,7 @@ void WorkerThreadsPool::run(INTERNAL_DoWorkerThreadFuncType doWorkerJobFunc, boo
             affinityBuilder.setGroupFrom(coreIdx);
             affinityBuilder.clearUpto(nonWorkerCount, 0);
             PlatformThreadingFuncs::setThreadGroupAffinity(
-                affinityBuilder.getGroupIdx(), affinityBuilder.getAffinityMask(), worker.native_handle()
+                affinityBuilder.getGroupIdx(), affinityBuilder.getAffinityMask(), threadHandle
             );
         }
 
@@ -515,6 +586,19 @@ void WorkerThreadsPool::enqueueJob(std::coroutine_handle<> coro, EJobPriority pr
     workerJobEvents[threadIdx].notify();
 }
 
+void WorkerThreadsPool::enqueueJobLocal(
+    std::coroutine_handle<> coro, u32 workerIdx, EJobPriority priority, WorkerQHazardToken *fromThreadTokens
+) noexcept
+{
+    COPAT_ASSERT(!allWorkersExitEvent.try_wait());
+    COPAT_ASSERT(fromThreadTokens && workerIdx < workersCount);
+
+    const u32 qIdx = pAndTTypeToIdx(workerIdx, priority);
+    workerQs[qIdx].enqueue(coro.address(), fromThreadTokens[qIdx]);
+    /* Enqueuing worker is busy so wake the next one to steal */
+    workerJobEvents[(workerIdx + 1) % workersCount].notify();
+}
+
 void *WorkerThreadsPool::dequeueJob(u32 threadIdx, EJobPriority priority, WorkerQHazardToken *fromThreadTokens) noexcept
 {
     COPAT_ASSERT(fromThreadTokens);
@@ -33,6 +33,56 @@ using WorkerQHazardToken = WorkerThreadQueueType::HazardToken;
 using INTERNAL_DoSpecialThreadFuncType = void (JobSystem::*)();
 void INTERNAL_runSpecialThread(INTERNAL_DoSpecialThreadFuncType threadFunc, EJobThreadType threadType, u32 threadIdx, JobSystem *jobSystem);
 
+#ifdef __linux__
+/**
+ * Sleeps on futex word of address until it is woken up or the value at address is no longer expectedValue.
+ * std::atomic_flag::wait in libstdc++ goes through a shared hashed waiter pool as flag is not futex sized, So futex is used directly.
+ */
+COPAT_EXPORT_SYM void INTERNAL_futexWait(std::atomic<u32> *address, u32 expectedValue) noexcept;
+COPAT_EXPORT_SYM void INTERNAL_futexWakeOne(std::atomic<u32> *address) noexcept;
+
+struct alignas(2 * CACHE_LINE_SIZE) JobReceivedEvent
+{
+    // Only one thread ever waits on an event
+    enum EState : u32
+    {
+        NoJob = 0,
+        JobReceived = 1,
+        // Waiter is or is about to be sleeping in futex wait, Notifier must wake it
+        Sleeping = 2
+    };
+    std::atomic<u32> state{ NoJob };
+
+    void notify() noexcept
+    {
+        // Syscall is only made when the waiter is sleeping
+        if (state.exchange(JobReceived, std::memory_order::release) == Sleeping)
+        {
+            INTERNAL_futexWakeOne(&state);
+        }
+    }
+
+    void wait() noexcept
+    {
+        u32 currentState = JobReceived;
+        while (!state.compare_exchange_weak(currentState, NoJob, std::memory_order::acquire, std::memory_order::relaxed))
+        {
+            if (currentState == NoJob && !state.compare_exchange_weak(currentState, Sleeping, std::memory_order::relaxed))
+            {
+                // Job received in between or spurious failure, Try consuming again
+                currentState = JobReceived;
+                continue;
+            }
+            if (currentState != JobReceived)
+            {
+                // Kernel returns immediately if state is no longer Sleeping
+                INTERNAL_futexWait(&state, Sleeping);
+            }
+            currentState = JobReceived;
+        }
+    }
+};
+#else  // __linux__
 struct alignas(2 * CACHE_LINE_SIZE) JobReceivedEvent
 {
     std::atomic_flag flag;
@@ -50,6 +100,7 @@ struct alignas(2 * CACHE_LINE_SIZE) JobReceivedEvent
         flag.clear(std::memory_order::relaxed);
     }
 };
+#endif // __linux__
 
 #define SPECIALTHREAD_NAME_FIRST(ThreadType) COPAT_TCHAR(#ThreadType)
 #define SPECIALTHREAD_NAME(ThreadType) , COPAT_TCHAR(#ThreadType)
@@ -218,6 +269,8 @@ public:
     void shutdown() noexcept;
 
     void enqueueJob(std::coroutine_handle<> coro, EJobPriority priority, WorkerQHazardToken *fromThreadTokens) noexcept;
+    /* Enqueues to workerIdx's own queue and wakes the next worker so that it can steal from workerIdx */
+    void enqueueJobLocal(std::coroutine_handle<> coro, u32 workerIdx, EJobPriority priority, WorkerQHazardToken *fromThreadTokens) noexcept;
     void *dequeueJob(u32 threadIdx, EJobPriority priority, WorkerQHazardToken *fromThreadTokens) noexcept;
     void *stealJob(u32 stealFromIdx, EJobPriority stealPriority, WorkerQHazardToken *fromThreadTokens) noexcept;
 
@@ -241,7 +294,7 @@ private:
 };
 
 #define THREADCONSTRAINT_ENUM_TO_FLAGBIT(ConstraintName)                                                                                       \
-    (copat::JobSystem::BitMasksStart << (copat::JobSystem::##ConstraintName - copat::JobSystem::BitMasksStart))
+    (copat::JobSystem::BitMasksStart << (copat::JobSystem::ConstraintName - copat::JobSystem::BitMasksStart))
 #define NOSPECIALTHREAD_ENUM_TO_FLAGBIT(ThreadType) THREADCONSTRAINT_ENUM_TO_FLAGBIT(No##ThreadType)
 
 class COPAT_EXPORT_SYM JobSystem
@@ -253,6 +306,8 @@ public:
     struct PerThreadData
     {
         EJobThreadType threadType;
+        /* Valid only if threadType is WorkerThreads */
+        u32 workerIdx;
         SpecialQHazardToken mainQTokens[Priority_MaxPriority];
         WorkerQHazardToken *workerQsTokens;
         SpecialQHazardToken *specialQsTokens;
@@ -326,6 +381,16 @@ public:
         std::coroutine_handle<> coro, EJobThreadType enqueueToThread = EJobThreadType::WorkerThreads,
         EJobPriority priority = EJobPriority::Priority_Normal
     ) noexcept;
+    /**
+     * If called from a worker thread the job is pushed to that worker's own queue instead of round robin distribution.
+     * Idle workers can still steal it. Any other thread falls back to enqueueJob to worker threads.
+     */
+    void enqueueJobLocal(std::coroutine_handle<> coro, EJobPriority priority = EJobPriority::Priority_Normal) noexcept;
+    /**
+     * Runs one queued main thread job in highest priority first order, Must be called from main thread.
+     * Allows main thread to make progress on main thread jobs it is blocking on. Returns false if there was no job to run
+     */
+    bool tryRunMainJob() noexcept;
 
     EJobThreadType getCurrentThreadType() const noexcept
     {
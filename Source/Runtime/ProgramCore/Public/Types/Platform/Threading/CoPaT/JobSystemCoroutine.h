@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "JobSystem.h"
 #include "SyncPrimitives.h"
 #include "CoroutineUtilities.h"
 #include "CoPaTTypes.h"
@@ -109,7 +110,7 @@ public:
     }
 
     FinalSuspendAwaiter final_suspend() noexcept { return {}; }
-    constexpr void unhandled_exception() const { COPAT_UNHANDLED_EXCEPT(); }
+    void unhandled_exception() const { COPAT_UNHANDLED_EXCEPT(); }
 };
 
 struct ContinuationEventChain
@@ -236,7 +237,7 @@ public:
     }
 
     FinalSuspendAwaiter final_suspend() noexcept { return {}; }
-    constexpr void unhandled_exception() const { COPAT_UNHANDLED_EXCEPT(); }
+    void unhandled_exception() const { COPAT_UNHANDLED_EXCEPT(); }
 };
 
 /**
@@ -554,13 +555,15 @@ public:
     template <typename PromiseT>
     bool await_suspend(std::coroutine_handle<PromiseT> awaitingAtCoro) noexcept
     {
-        std::coroutine_handle<PromiseType> ownerCoroutine = std::coroutine_handle<>::from_address(ownerCoroutinePtr.get());
+        std::coroutine_handle<PromiseType> ownerCoroutine = std::coroutine_handle<PromiseType>::from_address(ownerCoroutinePtr.get());
         return ownerCoroutine.promise().trySetContinuation(awaitingAtCoro);
     }
     RetTypeStorage::reference_type await_resume() const noexcept
     {
-        COPAT_ASSERT(ownerCoroutinePtr && ownerCoroutinePtr->promise().returnStore.isValid());
-        return ownerCoroutinePtr.promise().returnStore.get();
+        COPAT_ASSERT(ownerCoroutinePtr);
+        std::coroutine_handle<PromiseType> ownerCoroutine = std::coroutine_handle<PromiseType>::from_address(ownerCoroutinePtr.get());
+        COPAT_ASSERT(ownerCoroutine.promise().returnStore.isValid());
+        return ownerCoroutine.promise().returnStore.get();
     }
 };
 
@@ -645,7 +648,7 @@ public:
     template <typename PromiseT>
     bool await_suspend(std::coroutine_handle<PromiseT> awaitingAtCoro) noexcept
     {
-        std::coroutine_handle<PromiseType> ownerCoroutine = std::coroutine_handle<>::from_address(ownerCoroutinePtr.get());
+        std::coroutine_handle<PromiseType> ownerCoroutine = std::coroutine_handle<PromiseType>::from_address(ownerCoroutinePtr.get());
         return ownerCoroutine.promise().trySetContinuation(awaitingAtCoro);
     }
     constexpr void await_resume() const {}
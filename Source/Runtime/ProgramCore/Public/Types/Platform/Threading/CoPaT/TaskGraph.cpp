@@ -0,0 +1,261 @@
+/*!
+ * \file TaskGraph.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "TaskGraph.h"
+#include "CoroutineWait.h"
+
+COPAT_NS_INLINED
+namespace copat
+{
+
+std::coroutine_handle<> impl::TaskGraphNodeDoneAwaiter::await_suspend(std::coroutine_handle<>) const noexcept
+{
+    return graph->onNodeDone(nodeIdx);
+}
+
+impl::TaskGraphNodeRunner runTaskGraphNode(TaskGraph *graph, TaskGraph::NodeIdx nodeIdx) noexcept
+{
+    while (true)
+    {
+        // Nodes are not modified after build so the reference is stable
+        TaskGraph::Node &node = graph->nodes[nodeIdx];
+        if (bool(node.coroFunc))
+        {
+            co_await node.coroFunc();
+        }
+        else
+        {
+            COPAT_PROFILER_SCOPE(COPAT_PROFILER_CHAR("CopatTaskGraphNode"));
+            node.func();
+        }
+        co_await impl::TaskGraphNodeDoneAwaiter{ graph, nodeIdx };
+    }
+}
+
+TaskGraph::NodeIdx TaskGraph::addNode(NodeFuncType &&func, EJobPriority priority /*= EJobPriority::Priority_Normal*/) noexcept
+{
+    COPAT_ASSERT(!bBuilt && bool(func));
+
+    Node &node = nodes.emplace_back();
+    node.func = std::forward<NodeFuncType>(func);
+    node.priority = priority;
+    return NodeIdx(nodes.size() - 1);
+}
+
+TaskGraph::NodeIdx TaskGraph::addCoroutineNode(NodeCoroFuncType &&coroFunc, EJobPriority priority /*= EJobPriority::Priority_Normal*/) noexcept
+{
+    COPAT_ASSERT(!bBuilt && bool(coroFunc));
+
+    Node &node = nodes.emplace_back();
+    node.coroFunc = std::forward<NodeCoroFuncType>(coroFunc);
+    node.priority = priority;
+    return NodeIdx(nodes.size() - 1);
+}
+
+void TaskGraph::addDependency(NodeIdx node, NodeIdx dependsOn) noexcept
+{
+    COPAT_ASSERT(!bBuilt);
+    COPAT_ASSERT(node < nodes.size() && dependsOn < nodes.size() && node != dependsOn);
+    edges.emplace_back(Edge{ .from = dependsOn, .to = node });
+}
+
+bool TaskGraph::build(JobSystem *jobSys) noexcept
+{
+    COPAT_ASSERT(!bBuilt && jobSys);
+    COPAT_PROFILER_SCOPE(COPAT_PROFILER_CHAR("CopatTaskGraphBuild"));
+
+    jobSystem = jobSys;
+
+    /* Flatten successors of each node into one array */
+    for (const Edge &edge : edges)
+    {
+        nodes[edge.from].successorsCount++;
+        nodes[edge.to].predecessorsCount++;
+    }
+    u32 successorsStart = 0;
+    for (Node &node : nodes)
+    {
+        node.successorsStart = successorsStart;
+        successorsStart += node.successorsCount;
+        // Reused as fill cursor below
+        node.successorsCount = 0;
+    }
+    allSuccessors.resize(edges.size());
+    for (const Edge &edge : edges)
+    {
+        Node &fromNode = nodes[edge.from];
+        allSuccessors[fromNode.successorsStart + fromNode.successorsCount] = edge.to;
+        fromNode.successorsCount++;
+    }
+    edges.clear();
+    edges.shrink_to_fit();
+
+    rootNodes.clear();
+    for (NodeIdx nodeIdx = 0; nodeIdx < nodes.size(); ++nodeIdx)
+    {
+        if (nodes[nodeIdx].predecessorsCount == 0)
+        {
+            rootNodes.emplace_back(nodeIdx);
+        }
+    }
+
+    /* Cycle check, Every node must be reachable in topological order */
+    {
+        std::vector<u32> predsLeft;
+        predsLeft.reserve(nodes.size());
+        for (const Node &node : nodes)
+        {
+            predsLeft.emplace_back(node.predecessorsCount);
+        }
+        std::vector<NodeIdx> readyNodes = rootNodes;
+        u32 visitedCount = 0;
+        while (!readyNodes.empty())
+        {
+            const Node &node = nodes[readyNodes.back()];
+            readyNodes.pop_back();
+            visitedCount++;
+            for (u32 i = 0; i < node.successorsCount; ++i)
+            {
+                const NodeIdx successor = allSuccessors[node.successorsStart + i];
+                if (--predsLeft[successor] == 0)
+                {
+                    readyNodes.emplace_back(successor);
+                }
+            }
+        }
+        // Cyclic graph never finishes executing, Reject it in all builds instead of deadlocking later
+        if (visitedCount != nodes.size())
+        {
+            COPAT_ASSERT(!"TaskGraph has cyclic dependencies");
+            clear();
+            return false;
+        }
+    }
+
+    if (!nodes.empty())
+    {
+        nodeCounters = reinterpret_cast<NodeCounter *>(CoPaTMemAlloc::memAlloc(sizeof(NodeCounter) * nodes.size(), alignof(NodeCounter)));
+    }
+    for (NodeIdx nodeIdx = 0; nodeIdx < nodes.size(); ++nodeIdx)
+    {
+        new (nodeCounters + nodeIdx) NodeCounter();
+        nodes[nodeIdx].runner = runTaskGraphNode(this, nodeIdx).runnerCoro;
+    }
+    bBuilt = true;
+    return true;
+}
+
+void TaskGraph::clear() noexcept
+{
+    // Must not be cleared while executing
+    COPAT_ASSERT(pendingNodes.load(std::memory_order::acquire) == 0);
+
+    for (Node &node : nodes)
+    {
+        if (node.runner)
+        {
+            node.runner.destroy();
+            node.runner = nullptr;
+        }
+    }
+    if (nodeCounters)
+    {
+        for (u32 i = 0; i < nodes.size(); ++i)
+        {
+            nodeCounters[i].~NodeCounter();
+        }
+        CoPaTMemAlloc::memFree(nodeCounters);
+        nodeCounters = nullptr;
+    }
+    nodes.clear();
+    edges.clear();
+    allSuccessors.clear();
+    rootNodes.clear();
+    jobSystem = nullptr;
+    bBuilt = false;
+}
+
+void TaskGraph::executeAndWait() noexcept
+{
+    COPAT_ASSERT(bBuilt);
+    if (!bBuilt)
+    {
+        return;
+    }
+    waitOnAwaitable(execute());
+}
+
+void TaskGraph::startExecution(std::coroutine_handle<> awaitingAt) noexcept
+{
+    COPAT_ASSERT(pendingNodes.load(std::memory_order::acquire) == 0 && "TaskGraph executed before previous execution finished");
+    COPAT_PROFILER_SCOPE(COPAT_PROFILER_CHAR("CopatTaskGraphExecute"));
+
+    awaitingCoro = awaitingAt;
+    for (NodeIdx nodeIdx = 0; nodeIdx < nodes.size(); ++nodeIdx)
+    {
+        nodeCounters[nodeIdx].pendingPredecessors.store(nodes[nodeIdx].predecessorsCount, std::memory_order::relaxed);
+    }
+    // Enqueue below releases all the stores above
+    pendingNodes.store(u32(nodes.size()), std::memory_order::relaxed);
+
+    /**
+     * Graph cannot finish before the last root is enqueued, So graph data is safe to read until then.
+     * Once the last root is enqueued the whole graph might finish and the awaiting coroutine might destroy this graph, So only locals are
+     * touched after that.
+     */
+    JobSystem *jobSys = jobSystem;
+    const Node *allNodes = nodes.data();
+    const NodeIdx *roots = rootNodes.data();
+    const u32 rootsCount = u32(rootNodes.size());
+    for (u32 i = 0; i < rootsCount; ++i)
+    {
+        const Node &rootNode = allNodes[roots[i]];
+        jobSys->enqueueJob(rootNode.runner, EJobThreadType::WorkerThreads, rootNode.priority);
+    }
+}
+
+std::coroutine_handle<> TaskGraph::onNodeDone(NodeIdx nodeIdx) noexcept
+{
+    const Node &node = nodes[nodeIdx];
+    // Coroutine nodes might have switched to some special thread, Successors must not be run in those threads
+    const bool bRunInPlace = jobSystem->isInThread(EJobThreadType::WorkerThreads);
+
+    std::coroutine_handle<> resumeNext = nullptr;
+    for (u32 i = 0; i < node.successorsCount; ++i)
+    {
+        const NodeIdx successor = allSuccessors[node.successorsStart + i];
+        if (nodeCounters[successor].pendingPredecessors.fetch_sub(1, std::memory_order::acq_rel) != 1)
+        {
+            continue;
+        }
+
+        if (bRunInPlace && !resumeNext)
+        {
+            resumeNext = nodes[successor].runner;
+        }
+        else
+        {
+            jobSystem->enqueueJobLocal(nodes[successor].runner, nodes[successor].priority);
+        }
+    }
+
+    // Last node to finish resumes the awaiting coroutine, Graph must not be touched after this as awaiting coroutine might destroy it
+    if (pendingNodes.fetch_sub(1, std::memory_order::acq_rel) == 1)
+    {
+        COPAT_ASSERT(!resumeNext);
+        std::coroutine_handle<> continuation = awaitingCoro;
+        awaitingCoro = nullptr;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+    return resumeNext ? resumeNext : std::noop_coroutine();
+}
+
+} // namespace copat
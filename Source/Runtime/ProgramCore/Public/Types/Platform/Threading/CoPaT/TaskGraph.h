@@ -0,0 +1,182 @@
+/*!
+ * \file TaskGraph.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "JobSystem.h"
+#include "JobSystemCoroutine.h"
+
+#include <vector>
+
+COPAT_NS_INLINED
+namespace copat
+{
+class TaskGraph;
+
+namespace impl
+{
+/**
+ * Persistent coroutine that runs one node of the TaskGraph every time it is resumed.
+ * Created once when graph is built and destroyed along with the graph, So executing the graph again does not allocate any coroutine frames.
+ */
+class TaskGraphNodeRunner
+{
+public:
+    struct PromiseType
+    {
+    public:
+        TaskGraphNodeRunner get_return_object() noexcept
+        {
+            return TaskGraphNodeRunner(std::coroutine_handle<PromiseType>::from_promise(*this));
+        }
+        // Suspended until the node is scheduled for the first time
+        constexpr std::suspend_always initial_suspend() const noexcept { return {}; }
+        // Never reached as the runner loops forever, Destroyed by the owning graph
+        constexpr std::suspend_always final_suspend() const noexcept { return {}; }
+        constexpr void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { COPAT_UNHANDLED_EXCEPT(); }
+    };
+    using promise_type = PromiseType;
+
+    std::coroutine_handle<PromiseType> runnerCoro;
+
+public:
+    TaskGraphNodeRunner(std::coroutine_handle<PromiseType> coro)
+        : runnerCoro(coro)
+    {}
+};
+
+/**
+ * Awaited by node runner after running the node. Successors are released only after the runner is suspended so that runner can be
+ * resumed again safely from any thread for the next execution of the graph.
+ */
+struct TaskGraphNodeDoneAwaiter
+{
+    TaskGraph *graph;
+    u32 nodeIdx;
+
+    constexpr bool await_ready() const noexcept { return false; }
+    COPAT_EXPORT_SYM std::coroutine_handle<> await_suspend(std::coroutine_handle<>) const noexcept;
+    constexpr void await_resume() const noexcept {}
+};
+} // namespace impl
+
+/**
+ * Graph of nodes and the dependencies between them. Nodes are either normal callables or coroutines(JobSystemTask) that may suspend.
+ * Once built the graph can be executed any number of times without any allocation from the graph, Graph must not be executed again before
+ * the previous execution is finished.
+ *
+ * When a node finishes, each successor's predecessor counter is decremented and the successors that become ready are run on the finishing
+ * worker. First ready successor is resumed in place and rest are pushed to finishing worker's local queue.
+ */
+class COPAT_EXPORT_SYM TaskGraph
+{
+public:
+    using NodeIdx = u32;
+    using NodeFuncType = FunctionType<void>;
+    using NodeCoroFuncType = FunctionType<JobSystemTask>;
+
+    constexpr static const NodeIdx INVALID_NODE = ~0u;
+
+private:
+    struct Node
+    {
+        NodeFuncType func;
+        NodeCoroFuncType coroFunc;
+        EJobPriority priority = EJobPriority::Priority_Normal;
+        // Range into allSuccessors
+        u32 successorsStart = 0;
+        u32 successorsCount = 0;
+        u32 predecessorsCount = 0;
+        std::coroutine_handle<> runner;
+    };
+    struct alignas(CACHE_LINE_SIZE) NodeCounter
+    {
+        std::atomic<u32> pendingPredecessors{ 0 };
+    };
+    struct Edge
+    {
+        NodeIdx from;
+        NodeIdx to;
+    };
+
+    JobSystem *jobSystem = nullptr;
+    std::vector<Node> nodes;
+    // Dependency edges added before build, Cleared once graph is built
+    std::vector<Edge> edges;
+
+    /* Built data */
+    std::vector<NodeIdx> allSuccessors;
+    std::vector<NodeIdx> rootNodes;
+    // Separate from nodes to avoid false sharing between counters and read only node data
+    NodeCounter *nodeCounters = nullptr;
+    std::atomic<u32> pendingNodes{ 0 };
+    std::coroutine_handle<> awaitingCoro;
+    bool bBuilt = false;
+
+    friend impl::TaskGraphNodeDoneAwaiter;
+
+public:
+    struct ExecuteAwaiter
+    {
+        TaskGraph *graph;
+
+        // Graph that failed to build is never executed
+        bool await_ready() const noexcept { return !graph->bBuilt || graph->nodes.empty(); }
+        void await_suspend(std::coroutine_handle<> awaitingAt) const noexcept { graph->startExecution(awaitingAt); }
+        constexpr void await_resume() const noexcept {}
+    };
+
+public:
+    TaskGraph() = default;
+    ~TaskGraph() noexcept { clear(); }
+
+    TaskGraph(TaskGraph &&) = delete;
+    TaskGraph(const TaskGraph &) = delete;
+    TaskGraph &operator= (TaskGraph &&) = delete;
+    TaskGraph &operator= (const TaskGraph &) = delete;
+
+    NodeIdx addNode(NodeFuncType &&func, EJobPriority priority = EJobPriority::Priority_Normal) noexcept;
+    /**
+     * Coroutine node, The function is invoked every execution and the returned task is awaited before successors are released.
+     * The task's coroutine frame is allocated by the task itself on each invocation.
+     */
+    NodeIdx addCoroutineNode(NodeCoroFuncType &&coroFunc, EJobPriority priority = EJobPriority::Priority_Normal) noexcept;
+    // node will run only after dependsOn is finished
+    void addDependency(NodeIdx node, NodeIdx dependsOn) noexcept;
+
+    /**
+     * Bakes the nodes and edges into flat arrays and creates persistent runners for each node.
+     * No nodes or dependencies can be added after building.
+     * Returns false and clears the graph if the dependencies have a cycle.
+     */
+    bool build(JobSystem *jobSys) noexcept;
+    void clear() noexcept;
+    bool isBuilt() const noexcept { return bBuilt; }
+    u32 nodesCount() const noexcept { return u32(nodes.size()); }
+
+    // co_await graph.execute() to run all nodes and resume once all are finished
+    ExecuteAwaiter execute() noexcept
+    {
+        COPAT_ASSERT(bBuilt);
+        return { this };
+    }
+    // Executes and blocks the calling thread until all nodes are finished
+    void executeAndWait() noexcept;
+
+private:
+    void startExecution(std::coroutine_handle<> awaitingAt) noexcept;
+    std::coroutine_handle<> onNodeDone(NodeIdx nodeIdx) noexcept;
+
+    friend impl::TaskGraphNodeRunner runTaskGraphNode(TaskGraph *graph, NodeIdx nodeIdx) noexcept;
+};
+
+} // namespace copat
@@ -128,7 +128,7 @@ public:
     FORCE_INLINE static void *getTlsSlotValue(uint32 slot) { return PlatformClass::getTlsSlotValue(slot); }
 
     FORCE_INLINE static void setThreadName(const TChar *name, PlatformHandle threadHandle) { PlatformClass::setThreadName(name, threadHandle); }
-    FORCE_INLINE static void setCurrentThreadName(const TChar *name) { setThreadName(name, getCurrentThreadHandle); }
+    FORCE_INLINE static void setCurrentThreadName(const TChar *name) { setThreadName(name, getCurrentThreadHandle()); }
 
     FORCE_INLINE static String getThreadName(PlatformHandle threadHandle) { return PlatformClass::getThreadName(threadHandle); }
     FORCE_INLINE static String getCurrentThreadName() { return PlatformClass::getCurrentThreadName(); }
@@ -16,7 +16,9 @@
 #include "Threading/WindowsThreadingFunctions.h"
 
 #elif PLATFORM_LINUX
-#error "Platform not supported!"
+
+#include "Threading/LinuxThreadingFunctions.h"
+
 #elif PLATFORM_APPLE
 #error "Platform not supported!"
 #endif
@@ -14,6 +14,7 @@
 #include "Types/CoreDefines.h"
 
 #include <concepts>
+#include <cstdint>
 
 // Just some common types
 struct NullType
@@ -64,26 +64,28 @@ public:
 #endif // BIG_ENDIAN
         uint32 dw;
     };
+    // Types cannot be declared inside anonymous union in standard C++
+    struct IDComponents
+    {
+        Component a;
+        Component b;
+        Component c;
+        Component d;
+    };
+    struct IDParts
+    {
+        uint32 a;
+        uint32 b;
+        uint32 c;
+        uint32 d;
+    };
+
     // Actual data union
     union
     {
         uint32 components[4];
-
-        struct IDComponents
-        {
-            Component a;
-            Component b;
-            Component c;
-            Component d;
-        } _comps;
-
-        struct IDParts
-        {
-            uint32 a;
-            uint32 b;
-            uint32 c;
-            uint32 d;
-        } parts;
+        IDComponents _comps;
+        IDParts parts;
     };
 
 public:
@@ -357,6 +357,141 @@ void WindowsFile::write(ArrayView<uint8> writeBytes) const
     }
 }
 
+uint32 WindowsFile::readAt(uint8 *readTo, uint32 bytesToRead, uint64 offset, int32 *outErrorCode /* = nullptr */) const
+{
+    dword errorCode = ERROR_SUCCESS;
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Read))
+    {
+        if (outErrorCode)
+        {
+            *outErrorCode = int32(ERROR_INVALID_HANDLE);
+        }
+        return 0;
+    }
+
+    const dword readBufferSize = 10 * 1024 * 1024; // 10MB
+
+    uint32 bytesRead = 0;
+    while (bytesRead < bytesToRead)
+    {
+        UInt64 readFrom;
+        readFrom.quadPart = offset + bytesRead;
+        // Offset in OVERLAPPED is honored even for synchronous handles, Overlapped handles are waited until completion
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = readFrom.dwords.lowPart;
+        overlapped.OffsetHigh = readFrom.dwords.highPart;
+
+        const dword readSize = (bytesToRead - bytesRead) > readBufferSize ? readBufferSize : (bytesToRead - bytesRead);
+        dword bytesLastRead = 0;
+        if (!::ReadFile(getFileHandle(), readTo + bytesRead, readSize, &bytesLastRead, &overlapped)
+            && (::GetLastError() != ERROR_IO_PENDING || !::GetOverlappedResult(getFileHandle(), &overlapped, &bytesLastRead, TRUE)))
+        {
+            // ERROR_HANDLE_EOF is also an end of read
+            errorCode = ::GetLastError();
+            if (errorCode == ERROR_HANDLE_EOF)
+            {
+                errorCode = ERROR_SUCCESS;
+            }
+            break;
+        }
+        if (bytesLastRead == 0)
+        {
+            break;
+        }
+        bytesRead += bytesLastRead;
+    }
+    if (outErrorCode)
+    {
+        *outErrorCode = int32(errorCode);
+    }
+    return bytesRead;
+}
+
+uint32 WindowsFile::writeAt(ArrayView<uint8> writeBytes, uint64 offset, int32 *outErrorCode /* = nullptr */) const
+{
+    dword errorCode = ERROR_SUCCESS;
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Write))
+    {
+        if (outErrorCode)
+        {
+            *outErrorCode = int32(ERROR_INVALID_HANDLE);
+        }
+        return 0;
+    }
+
+    const dword writeBufferSize = 5 * 1024 * 1024; // 5MB
+
+    const uint32 bytesToWrite = uint32(writeBytes.size());
+    uint32 bytesWritten = 0;
+    while (bytesWritten < bytesToWrite)
+    {
+        UInt64 writeFrom;
+        writeFrom.quadPart = offset + bytesWritten;
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = writeFrom.dwords.lowPart;
+        overlapped.OffsetHigh = writeFrom.dwords.highPart;
+
+        const dword writeSize = (bytesToWrite - bytesWritten) > writeBufferSize ? writeBufferSize : (bytesToWrite - bytesWritten);
+        dword bytesLastWritten = 0;
+        if (!::WriteFile(getFileHandle(), writeBytes.data() + bytesWritten, writeSize, &bytesLastWritten, &overlapped)
+            && (::GetLastError() != ERROR_IO_PENDING || !::GetOverlappedResult(getFileHandle(), &overlapped, &bytesLastWritten, TRUE)))
+        {
+            errorCode = ::GetLastError();
+            LOG_ERROR("WindowsFile", "Failed to write file {} at {}, error {}", getFullPath().getChar(), writeFrom.quadPart, errorCode);
+            break;
+        }
+        if (bytesLastWritten == 0)
+        {
+            errorCode = ERROR_DISK_FULL;
+            break;
+        }
+        bytesWritten += bytesLastWritten;
+    }
+    if (outErrorCode)
+    {
+        *outErrorCode = int32(errorCode);
+    }
+    return bytesWritten;
+}
+
+const uint8 *WindowsFile::mapReadOnly(PlatformHandle &outMapping) const
+{
+    outMapping = nullptr;
+    // Zero sized files cannot be mapped
+    if (!getFileHandle() || BIT_NOT_SET(fileFlags, EFileFlags::Read) || fileSize() == 0)
+    {
+        return nullptr;
+    }
+
+    HANDLE mapping = ::CreateFileMapping(getFileHandle(), nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        LOG_ERROR("WindowsFile", "Failed to create file mapping for {}", getFullPath().getChar());
+        return nullptr;
+    }
+    void *view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        LOG_ERROR("WindowsFile", "Failed to map view of file {}", getFullPath().getChar());
+        ::CloseHandle(mapping);
+        return nullptr;
+    }
+    outMapping = mapping;
+    return reinterpret_cast<const uint8 *>(view);
+}
+
+void WindowsFile::unmapView(const uint8 *mappedView, PlatformHandle mapping) const
+{
+    if (mappedView)
+    {
+        ::UnmapViewOfFile(mappedView);
+    }
+    if (mapping)
+    {
+        ::CloseHandle((HANDLE)mapping);
+    }
+}
+
 bool WindowsFile::deleteFile()
 {
     if (getFileHandle())
@@ -45,6 +45,11 @@ public:
     void read(std::vector<uint8> &readTo, uint32 bytesToRead = (~0u)) const override;
     void read(uint8 *readTo, uint32 bytesToRead) const override;
     void write(ArrayView<uint8> writeBytes) const override;
+    uint32 readAt(uint8 *readTo, uint32 bytesToRead, uint64 offset, int32 *outErrorCode = nullptr) const override;
+    uint32 writeAt(ArrayView<uint8> writeBytes, uint64 offset, int32 *outErrorCode = nullptr) const override;
+
+    const uint8 *mapReadOnly(PlatformHandle &outMapping) const override;
+    void unmapView(const uint8 *mappedView, PlatformHandle mapping) const override;
 
     bool deleteFile() override;
     bool renameFile(String newName) override;
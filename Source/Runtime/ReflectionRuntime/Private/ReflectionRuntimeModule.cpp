@@ -12,6 +12,8 @@
 #include "ReflectionRuntimeModule.h"
 #include "Modules/ModuleManager.h"
 #include "Property/Property.h"
+#include "Property/CustomProperty.h"
+#include "Types/PropertyTypes.h"
 #include "Property/PropertyMetaData.h"
 #include "String/String.h"
 #include "Types/Platform/PlatformAssertionErrors.h"
@@ -567,6 +569,125 @@ uint64 ReflectionRuntimeModule::getPropertyMetaFlags(const BaseProperty *prop) c
     return 0;
 }
 
+const ClassReferenceMap *ReflectionRuntimeModule::getReferenceMap(const ClassProperty *clazz)
+{
+    {
+        std::shared_lock<std::shared_mutex> readLock{ referenceMapsLock };
+        auto itr = classReferenceMaps.find(clazz);
+        if (itr != classReferenceMaps.cend())
+        {
+            return &itr->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> writeLock{ referenceMapsLock };
+    return buildReferenceMap(clazz);
+}
+
+const ClassReferenceMap *ReflectionRuntimeModule::buildReferenceMap(const ClassProperty *clazz)
+{
+    // Might have been built by other thread or when building an outer class
+    auto itr = classReferenceMaps.find(clazz);
+    if (itr != classReferenceMaps.cend())
+    {
+        return &itr->second;
+    }
+
+    ClassReferenceMap refMap;
+    if (clazz->baseClass)
+    {
+        // Base class members are accessed using the same object pointer, So the offsets are valid as is
+        refMap = *buildReferenceMap(clazz->baseClass);
+    }
+    for (const FieldProperty *field : clazz->memberFields)
+    {
+        const SizeT fieldOffset = static_cast<const MemberFieldWrapper *>(field->fieldPtr)->fieldOffset();
+        const TypedProperty *fieldProp = static_cast<const TypedProperty *>(field->field);
+        switch (fieldProp->type)
+        {
+        case EPropertyType::QualifiedType:
+            if (isObjectPointerType(fieldProp))
+            {
+                const ReflectTypeInfo *ptrTypeInfo = fieldProp->typeInfo;
+                const bool bInnerConst
+                    = ptrTypeInfo->innerType && BIT_SET(ptrTypeInfo->innerType->qualifiers, EReflectTypeQualifiers::Constant);
+                const bool bConst = bInnerConst || BIT_SET(ptrTypeInfo->qualifiers, EReflectTypeQualifiers::Constant);
+                refMap.pointerFields.emplace_back(fieldOffset, field, fieldProp, bConst);
+            }
+            break;
+        case EPropertyType::ClassType:
+        {
+            // Only structs can be stored by value, Flatten its references into this class
+            const ClassReferenceMap *structRefMap = buildReferenceMap(static_cast<const ClassProperty *>(fieldProp));
+            for (const ClassReferenceMap::PointerField &ptrField : structRefMap->pointerFields)
+            {
+                refMap.pointerFields.emplace_back(fieldOffset + ptrField.offset, field, ptrField.pointerProp, ptrField.bConst);
+            }
+            for (const ClassReferenceMap::ContainerField &containerField : structRefMap->containerFields)
+            {
+                refMap.containerFields.emplace_back(fieldOffset + containerField.offset, field, containerField.containerProp);
+            }
+            break;
+        }
+        case EPropertyType::MapType:
+        case EPropertyType::SetType:
+        case EPropertyType::ArrayType:
+        case EPropertyType::PairType:
+            if (typeHasReferences(fieldProp))
+            {
+                refMap.containerFields.emplace_back(fieldOffset, field, fieldProp);
+            }
+            break;
+        case EPropertyType::FundamentalType:
+        case EPropertyType::SpecialType:
+        case EPropertyType::EnumType:
+        default:
+            break;
+        }
+    }
+    // Element pointers stays valid even if the map rehashes
+    return &classReferenceMaps.emplace(clazz, std::move(refMap)).first->second;
+}
+
+bool ReflectionRuntimeModule::typeHasReferences(const BaseProperty *prop)
+{
+    switch (prop->type)
+    {
+    case EPropertyType::QualifiedType:
+        return isObjectPointerType(prop);
+    case EPropertyType::ClassType:
+        return buildReferenceMap(static_cast<const ClassProperty *>(prop))->hasReferences();
+    case EPropertyType::MapType:
+    {
+        const MapProperty *mapProp = static_cast<const MapProperty *>(prop);
+        return typeHasReferences(mapProp->keyProp) || typeHasReferences(mapProp->valueProp);
+    }
+    case EPropertyType::SetType:
+    case EPropertyType::ArrayType:
+        return typeHasReferences(static_cast<const ContainerProperty *>(prop)->elementProp);
+    case EPropertyType::PairType:
+    {
+        const PairProperty *pairProp = static_cast<const PairProperty *>(prop);
+        return typeHasReferences(pairProp->keyProp) || typeHasReferences(pairProp->valueProp);
+    }
+    default:
+        break;
+    }
+    return false;
+}
+
+bool ReflectionRuntimeModule::isObjectPointerType(const BaseProperty *prop) const
+{
+    if (prop->type != EPropertyType::QualifiedType
+        || BIT_NOT_SET(static_cast<const TypedProperty *>(prop)->typeInfo->qualifiers, EReflectTypeQualifiers::Pointer))
+    {
+        return false;
+    }
+    const TypedProperty *unqualProp = static_cast<const TypedProperty *>(static_cast<const QualifiedProperty *>(prop)->unqualTypeProperty);
+    // Pointers to structs are not references
+    return unqualProp->type == EPropertyType::ClassType && !dbStructTypes.contains(unqualProp->typeInfo);
+}
+
 void ReflectionRuntimeModule::init() { initCommonProperties(); }
 
 void ReflectionRuntimeModule::release()
@@ -599,4 +720,5 @@ void ReflectionRuntimeModule::release()
     // Clear all meta data
     propertiesMetaFlags.clear();
     propertiesMetaData.clear();
+    classReferenceMaps.clear();
 }
\ No newline at end of file
@@ -12,11 +12,13 @@
 #pragma once
 
 #include "IReflectionRuntime.h"
+#include "Property/ClassReferenceMap.h"
 #include "String/StringID.h"
 #include "Types/HashTypes.h"
 #include "Types/Containers/FlatTree.h"
 #include "Types/Containers/ArrayView.h"
 
+#include <shared_mutex>
 #include <unordered_map>
 
 using ClassTreeType = FlatTree<const ClassProperty *, uint32>;
@@ -49,6 +51,11 @@ private:
     // Creates common none reflect types to property database
     void initCommonProperties() const;
 
+    // Must be called with referenceMapsLock locked for write
+    const ClassReferenceMap *buildReferenceMap(const ClassProperty *clazz);
+    bool typeHasReferences(const BaseProperty *prop);
+    bool isObjectPointerType(const BaseProperty *prop) const;
+
     // Property database
     ClassTreeType dbClasses;
     std::unordered_map<const ReflectTypeInfo *, ClassTreeType::NodeIdx> dbClassTypes;
@@ -66,6 +73,9 @@ private:
     std::unordered_map<PropertyMetaDataKey, const PropertyMetaDataBase *> propertiesMetaData;
     std::unordered_map<const BaseProperty *, uint64> propertiesMetaFlags;
 
+    std::unordered_map<const ClassProperty *, ClassReferenceMap> classReferenceMaps;
+    std::shared_mutex referenceMapsLock;
+
 public:
     void setMetaData(const BaseProperty *forProperty, ArrayView<const PropertyMetaDataBase *> propertyMeta, uint64 propertyMetaFlags);
 
@@ -88,6 +98,8 @@ public:
     const PropertyMetaDataBase *getPropertyMetaData(const BaseProperty *prop, const ReflectTypeInfo *typeInfo) const final;
     uint64 getPropertyMetaFlags(const BaseProperty *prop) const final;
 
+    const ClassReferenceMap *getReferenceMap(const ClassProperty *clazz) final;
+
     /* IModuleBase finals */
     void init() final;
     void release() final;
@@ -24,6 +24,7 @@ class BaseProperty;
 class StringID;
 class TypedProperty;
 struct PropertyMetaDataBase;
+struct ClassReferenceMap;
 
 // Has to separate init and create to avoid race condition between creating a property and using the
 // created property on property that is created in this property init
@@ -122,6 +123,9 @@ public:
     virtual const PropertyMetaDataBase *getPropertyMetaData(const BaseProperty *prop, const ReflectTypeInfo *typeInfo) const = 0;
     virtual uint64 getPropertyMetaFlags(const BaseProperty *prop) const = 0;
 
+    // Reference map is built once for each class or struct when first requested. Thread safe
+    virtual const ClassReferenceMap *getReferenceMap(const ClassProperty *clazz) = 0;
+
     static IReflectionRuntimeModule *get();
     static void
     registerClassFactory(const StringID &className, const ReflectTypeInfo *classTypeInfo, const ClassPropertyFactoryCell &factoryCell);
@@ -0,0 +1,53 @@
+/*!
+ * \file ClassReferenceMap.h
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#pragma once
+
+#include "Types/CoreDefines.h"
+#include "Types/CoreTypes.h"
+
+#include <vector>
+
+class FieldProperty;
+class TypedProperty;
+
+/**
+ * Precomputed locations inside an instance of a class where pointers to other reflected class objects(references) can be found.
+ * Built once per ClassProperty by IReflectionRuntimeModule::getReferenceMap(), Base classes and structs stored by value are flattened into
+ * the map of the class.
+ */
+struct ClassReferenceMap
+{
+    // Pointer to a reflected class object at offset bytes from start of the instance
+    struct PointerField
+    {
+        SizeT offset;
+        // Top most member field of the class that contains this pointer
+        const FieldProperty *field;
+        // Qualified pointer property
+        const TypedProperty *pointerProp;
+        // Either the pointer or the pointed object is const, Must be visited as const void **
+        bool bConst;
+    };
+    // Container or pair at offset bytes from start of the instance whose elements might hold references
+    struct ContainerField
+    {
+        SizeT offset;
+        // Top most member field of the class that contains this container
+        const FieldProperty *field;
+        const TypedProperty *containerProp;
+    };
+
+    std::vector<PointerField> pointerFields;
+    std::vector<ContainerField> containerFields;
+
+    FORCE_INLINE bool hasReferences() const { return !pointerFields.empty() || !containerFields.empty(); }
+};
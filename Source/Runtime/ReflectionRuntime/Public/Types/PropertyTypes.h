@@ -91,6 +91,8 @@ public:
     virtual void *get(void *object) const = 0;
     virtual const void *get(const void *object) const = 0;
     virtual void setTypeless(void *value, void *object) const = 0;
+    // Byte offset of this member from start of the object
+    virtual SizeT fieldOffset() const = 0;
 
     // Will return pointer to value else null
     template <typename AsType, typename ObjectType>
@@ -314,6 +316,13 @@ public:
             memberField.set(outerObject, *valuePtr);
         }
     }
+    SizeT fieldOffset() const override
+    {
+        // Object is never accessed, Only address of the member is computed relative to a suitably aligned storage
+        alignas(ObjectType) uint8 objectStorage[sizeof(ObjectType)];
+        const ObjectType *outerObject = reinterpret_cast<const ObjectType *>(objectStorage);
+        return SizeT(reinterpret_cast<const uint8 *>(&memberField.get(outerObject)) - objectStorage);
+    }
     /* Override ends */
 };
 
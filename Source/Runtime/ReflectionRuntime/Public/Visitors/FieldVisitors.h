@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include "IReflectionRuntime.h"
 #include "Math/CoreMathTypes.h"
+#include "Property/ClassReferenceMap.h"
 #include "Property/CustomProperty.h"
 #include "Property/Property.h"
 #include "ReflectionMacros.h"
@@ -266,6 +268,47 @@ public:
         }
     }
 
+    /**
+     * Visits only the member fields that can hold references using root's precomputed reference map, Much faster than visitFields as
+     * fields without references are never touched.
+     *
+     * typename Visitable;
+     * Must have below visit functions
+     *      static void visit(void **ptr, const PropertyInfo& propInfo, void* userData); - For pointers to reflected class objects
+     *      static void visit(const void **ptr, const PropertyInfo& propInfo, void* userData); - For const pointers to reflected class objects
+     *      static void visit(void *val, const PropertyInfo& propInfo, void* userData); - For containers and pairs
+     */
+    template <typename Visitable>
+    static void visitReferences(const ClassProperty *root, const ClassReferenceMap *refMap, void *rootObject, void *userData)
+    {
+        PropertyInfo propInfo{ .rootProperty = root };
+        for (const ClassReferenceMap::PointerField &ptrField : refMap->pointerFields)
+        {
+            propInfo.fieldProperty = ptrField.field;
+            propInfo.thisProperty = ptrField.pointerProp;
+            void *ptrPtr = static_cast<uint8 *>(rootObject) + ptrField.offset;
+            if (ptrField.bConst)
+            {
+                Visitable::visit(reinterpret_cast<const void **>(ptrPtr), propInfo, userData);
+            }
+            else
+            {
+                Visitable::visit(reinterpret_cast<void **>(ptrPtr), propInfo, userData);
+            }
+        }
+        for (const ClassReferenceMap::ContainerField &containerField : refMap->containerFields)
+        {
+            propInfo.fieldProperty = containerField.field;
+            propInfo.thisProperty = containerField.containerProp;
+            Visitable::visit(static_cast<void *>(static_cast<uint8 *>(rootObject) + containerField.offset), propInfo, userData);
+        }
+    }
+    template <typename Visitable>
+    static void visitReferences(const ClassProperty *root, void *rootObject, void *userData)
+    {
+        visitReferences<Visitable>(root, IReflectionRuntimeModule::get()->getReferenceMap(root), rootObject, userData);
+    }
+
     // Just simple visits a visitable with given template typename and passes in userdata
     template <typename Visitable>
     static void visit(const TypedProperty *prop, void *userData)
@@ -2761,7 +2761,8 @@ void VulkanCommandList::copyToImage_Internal(ImageResourceRef dst, const BufferR
     VkPipelineStageFlags postCopyStages = VkPipelineStageFlags(resourceShaderStageFlags());
 
     // TODO(Jeslas) : change this to get current layout from some resource tracked layout
-    VkImageLayout currentLayout = VkImageLayout::VK_IMAGE_LAYOUT_UNDEFINED;
+    // Transitioning from undefined layout allows discarding contents, So preserving copies starts from layout after previous copy
+    VkImageLayout currentLayout = copyInfo.bPreserveContents ? postCopyLayout : VkImageLayout::VK_IMAGE_LAYOUT_UNDEFINED;
 
     std::vector<VkBufferImageCopy> copies;
     if (copyInfo.bGenerateMips)
@@ -2797,7 +2798,9 @@ void VulkanCommandList::copyToImage_Internal(ImageResourceRef dst, const BufferR
         }
     }
 
-    const bool bRequiresGraphicsQ = copyInfo.bGenerateMips || EPixelDataFormat::isDepthFormat(dst->imageFormat());
+    // Previous copy transferred the image to graphics queue, Preserving copy must be done there to keep its contents
+    const bool bRequiresGraphicsQ
+        = copyInfo.bGenerateMips || copyInfo.bPreserveContents || EPixelDataFormat::isDepthFormat(dst->imageFormat());
     const GraphicsResource *cmdBuffer = cmdBufferManager.beginTempCmdBuffer(
         TCHAR("CopyPixelToImage_") + dst->getResourceName(), bRequiresGraphicsQ ? EQueueFunction::Graphics : EQueueFunction::Transfer
     );
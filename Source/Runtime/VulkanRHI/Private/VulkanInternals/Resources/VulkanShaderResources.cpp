@@ -12,10 +12,12 @@
 #include "VulkanInternals/Resources/VulkanShaderResources.h"
 #include "Logger/Logger.h"
 #include "ShaderArchive.h"
+#include "Types/Platform/LFS/File/FileHelper.h"
 #include "Types/Platform/LFS/PlatformLFS.h"
 #include "Types/Platform/LFS/PathFunctions.h"
 #include "Types/Platform/LFS/Paths.h"
 #include "Types/Platform/PlatformAssertionErrors.h"
+#include "Types/Platform/Threading/CoPaT/CoroutineWait.h"
 #include "VulkanGraphicsHelper.h"
 #include "VulkanInternals/Debugging.h"
 #include "VulkanRHIModule.h"
@@ -90,32 +92,26 @@ void VulkanShaderResource::init()
     String filePath = PathFunctions::combinePath(Paths::applicationDirectory(), TCHAR("Shaders"), shaderConfig->getShaderFileName());
     String shaderFilePath = filePath + TCHAR(".") + SHADER_EXTENSION;
     String reflectionsFilePath = filePath + TCHAR(".") + REFLECTION_EXTENSION;
-    PlatformFile shaderFile(shaderFilePath);
-    shaderFile.setFileFlags(EFileFlags::Read | EFileFlags::OpenExisting);
-    shaderFile.addSharingFlags(EFileSharing::NoSharing);
-    shaderFile.addAttributes(EFileAdditionalFlags::ReadOnly);
-    PlatformFile reflectionFile(reflectionsFilePath);
-    reflectionFile.setFileFlags(EFileFlags::Read | EFileFlags::OpenExisting);
-    reflectionFile.addSharingFlags(EFileSharing::NoSharing);
-    reflectionFile.addAttributes(EFileAdditionalFlags::ReadOnly);
 
     fatalAssertf(
-        shaderFile.exists() && reflectionFile.exists(),
+        FileSystemFunctions::fileExists(shaderFilePath.getChar()) && FileSystemFunctions::fileExists(reflectionsFilePath.getChar()),
         "Shader and reflection files are mandatory in shader {}[Shader file {}, Reflection file {}]", getResourceName().getChar(),
-        shaderFile.getFileName().getChar(), reflectionFile.getFileName().getChar()
+        shaderFilePath.getChar(), reflectionsFilePath.getChar()
     );
-    shaderFile.openFile();
-    reflectionFile.openFile();
     LOG_DEBUG(
-        "VulkanShaderResource", "Loading from shader file {} and reflection file {}", shaderFile.getFileName().getChar(),
-        reflectionFile.getFileName().getChar()
+        "VulkanShaderResource", "Loading from shader file {} and reflection file {}", shaderFilePath.getChar(), reflectionsFilePath.getChar()
     );
 
+    // Both files are read together in worker threads
     std::vector<uint8> reflectionData;
-    shaderFile.read(shaderCode);
-    shaderFile.closeFile();
-    reflectionFile.read(reflectionData);
-    reflectionFile.closeFile();
+    FileHelper::AsyncReadBytesTask shaderReadTask = FileHelper::readBytesAsync(shaderCode, shaderFilePath);
+    FileHelper::AsyncReadBytesTask reflectionReadTask = FileHelper::readBytesAsync(reflectionData, reflectionsFilePath);
+    const bool bShaderRead = copat::waitOnAwaitable(shaderReadTask);
+    const bool bReflectionRead = copat::waitOnAwaitable(reflectionReadTask);
+    fatalAssertf(
+        bShaderRead && bReflectionRead, "Failed reading shader {}[Shader file {}, Reflection file {}]", getResourceName().getChar(),
+        shaderFilePath.getChar(), reflectionsFilePath.getChar()
+    );
 
     // Ensure shader code is multiple of 4bytes as it is supposed to be
     debugAssert(shaderCode.size() % sizeof(uint32) == 0);
@@ -23,6 +23,7 @@ public:
     /* IRHIModule overrides */
     IGraphicsInstance *createGraphicsInstance() final;
     const GraphicsHelperAPI *getGraphicsHelper() const final;
+    bool isHeadless() const final { return false; }
 
     /* IModuleBase overrides */
     void init() final;
@@ -0,0 +1,161 @@
+/*!
+ * \file ConsoleMain.cpp
+ *
+ * \author Jeslas
+ * \date October 2023
+ * \copyright
+ *  Copyright (C) Jeslas Pravin, 2022-2023
+ *  @jeslaspravin pravinjeslas@gmail.com
+ *  License can be read in LICENSE file at this repository's root
+ */
+
+#include "Logger/StructuredLog.h"
+#include "String/String.h"
+#include "Types/CoreTypes.h"
+#include "Types/Time.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+/**
+ * Decodes the binary structured log(.blog) written by the Logger into text log lines.
+ * Usage : LogDecoder <BinaryLogPath> [OutputTextPath]
+ */
+
+// Same as the text log's severity strings
+const AChar *SEVERITY_OUT_STR[] = { "[VERBOSE]", "[DEBUG]  ", "[LOG]    ", "[WARN]   ", "[ERROR]  " };
+
+template <typename Type>
+bool readValue(std::ifstream &inFile, Type &outValue)
+{
+    inFile.read(reinterpret_cast<char *>(&outValue), sizeof(Type));
+    return bool(inFile);
+}
+
+bool readHeader(std::ifstream &inFile)
+{
+    AChar magic[sizeof(StructuredLog::BINARY_LOG_MAGIC)];
+    uint32 version = 0;
+    uint32 charSize = 0;
+    inFile.read(magic, sizeof(magic));
+    if (!inFile || std::char_traits<AChar>::compare(magic, StructuredLog::BINARY_LOG_MAGIC, sizeof(magic)) != 0)
+    {
+        std::cerr << "Not a binary log file" << std::endl;
+        return false;
+    }
+    if (!readValue(inFile, version) || version != StructuredLog::BINARY_LOG_VERSION)
+    {
+        std::cerr << "Unsupported binary log version " << version << ", Expected " << StructuredLog::BINARY_LOG_VERSION << std::endl;
+        return false;
+    }
+    // String arguments are stored as TChar so log must be written by a build with same character type
+    if (!readValue(inFile, charSize) || charSize != sizeof(TChar))
+    {
+        std::cerr << "Binary log character size " << charSize << " does not match decoder's " << sizeof(TChar) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int32 main(int32 argsc, AChar **args)
+{
+    if (argsc < 2)
+    {
+        std::cout << "Usage : LogDecoder <BinaryLogPath> [OutputTextPath]" << std::endl;
+        return 1;
+    }
+
+    std::ifstream inFile(args[1], std::ios::binary);
+    if (!inFile.is_open())
+    {
+        std::cerr << "Failed to open " << args[1] << std::endl;
+        return 1;
+    }
+    if (!readHeader(inFile))
+    {
+        return 1;
+    }
+
+    std::ofstream outFile;
+    if (argsc > 2)
+    {
+        outFile.open(args[2], std::ios::binary | std::ios::trunc);
+        if (!outFile.is_open())
+        {
+            std::cerr << "Failed to open output " << args[2] << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &outStream = outFile.is_open() ? static_cast<std::ostream &>(outFile) : std::cout;
+
+    // String table indexed by string id, Strings are always written before the records using it
+    std::vector<std::string> strings;
+    std::vector<uint8> argsData;
+    uint32 recordsCount = 0;
+
+    StructuredLog::EBinaryLogEntry entryType;
+    while (readValue(inFile, entryType))
+    {
+        if (entryType == StructuredLog::EBinaryLogEntry::String)
+        {
+            uint32 strId = 0;
+            uint32 byteCount = 0;
+            if (!readValue(inFile, strId) || !readValue(inFile, byteCount))
+            {
+                break;
+            }
+            if (strId >= strings.size())
+            {
+                strings.resize(strId + 1);
+            }
+            strings[strId].resize(byteCount);
+            inFile.read(strings[strId].data(), byteCount);
+        }
+        else if (entryType == StructuredLog::EBinaryLogEntry::Record)
+        {
+            uint8 severity = 0;
+            int64 timeStamp = 0;
+            uint32 fmtId = 0, categoryId = 0, fileId = 0, funcId = 0, line = 0;
+            uint8 argsCount = 0;
+            uint32 argsSize = 0;
+            if (!readValue(inFile, severity) || !readValue(inFile, timeStamp) || !readValue(inFile, fmtId) || !readValue(inFile, categoryId)
+                || !readValue(inFile, fileId) || !readValue(inFile, funcId) || !readValue(inFile, line) || !readValue(inFile, argsCount)
+                || !readValue(inFile, argsSize))
+            {
+                break;
+            }
+            argsData.resize(argsSize);
+            inFile.read(reinterpret_cast<char *>(argsData.data()), argsSize);
+
+            const uint32 maxId = std::max({ fmtId, categoryId, fileId, funcId });
+            if (!inFile || maxId >= strings.size() || severity >= ARRAY_LENGTH(SEVERITY_OUT_STR))
+            {
+                std::cerr << "Corrupted record at " << recordsCount << std::endl;
+                break;
+            }
+
+            const String fmt = UTF8_TO_TCHAR(strings[fmtId].c_str());
+            const String message = StructuredLog::formatArgs(fmt.getChar(), argsData.data(), argsSize, argsCount);
+
+            if (timeStamp != 0)
+            {
+                outStream << "[" << TCHAR_TO_UTF8(Time::toString(timeStamp, false).getChar()) << "]";
+            }
+            outStream << SEVERITY_OUT_STR[severity];
+            outStream << "[" << strings[categoryId] << "]";
+            outStream << "[" << strings[fileId] << ":" << line << "]";
+            outStream << strings[funcId] << "() : ";
+            outStream << TCHAR_TO_UTF8(message.getChar()) << "\n";
+            recordsCount++;
+        }
+        else
+        {
+            std::cerr << "Unknown entry type " << uint32(entryType) << " after " << recordsCount << " records" << std::endl;
+            break;
+        }
+    }
+    outStream.flush();
+    return 0;
+}